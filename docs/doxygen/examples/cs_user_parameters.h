@@ -96,6 +96,15 @@
 
   \snippet cs_user_parameters-linear_solvers.c sles_user_1
 
+  \subsection cs_user_parameters_h_sles_user_2 Example: s-step GMRES
+
+  On large process counts, global reductions may dominate the cost of
+  GMRES iterations. The s-step variant builds and orthogonalizes the
+  Krylov basis by blocks of s vectors, requiring a single global
+  reduction per block:
+
+  \snippet cs_user_parameters-linear_solvers.c sles_user_2
+
   \subsection cs_user_parameters_h_sles_verbosity_1 Changing the verbosity
 
   By default, a linear solver uses the same verbosity as its matching variable,
@@ -112,6 +121,15 @@
 
   \snippet cs_user_parameters-linear_solvers.c sles_mgp_1
 
+  \subsection cs_user_parameters_h_sles_mg_reuse Example: multigrid hierarchy reuse
+
+  When the matrix structure does not change between time steps, the
+  multigrid grid hierarchy may be kept from one setup to the next, with
+  only the coarse matrix coefficients being recomputed, as shown in the
+  following example:
+
+  \snippet cs_user_parameters-linear_solvers.c sles_mg_reuse
+
   \subsection cs_user_parameters_h_sles_mgp_2 Example: multigrid preconditioner settings
 
   The following example shows how to use multigrid as a preconditioner for a
@@ -120,6 +138,31 @@
 
   \snippet cs_user_parameters-linear_solvers.c sles_mgp_2
 
+  \subsection cs_user_parameters_h_sles_mgp_vector Example: multigrid preconditioner for vector systems
+
+  Multigrid may also be used as a preconditioner for vector or tensor
+  systems with diagonal or full extra-diagonal blocks, such as a coupled
+  velocity solve, as shown in the following example:
+
+  \snippet cs_user_parameters-linear_solvers.c sles_mgp_vector
+
+  \subsection cs_user_parameters_h_sles_mg_colored_gs Example: multicolor Gauss-Seidel smoothers
+
+  When using OpenMP threads, multigrid smoothers based on a multicolor
+  Gauss-Seidel algorithm may be used, in which rows of a same color
+  (which do not share any matrix term) are relaxed in parallel:
+
+  \snippet cs_user_parameters-linear_solvers.c sles_mg_colored_gs
+
+  \subsection cs_user_parameters_h_sles_matrix_free Example: matrix-free operator
+
+  For scalar convection-diffusion equations, the \c matrix_free field
+  key may be set so that extradiagonal matrix terms are computed on the
+  fly from face values rather than stored. This requires a Krylov
+  solver with Jacobi or polynomial preconditioning:
+
+  \snippet cs_user_parameters-linear_solvers.c sles_matrix_free
+
   \subsection cs_user_parameters_h_sles_mg_parall Multigrid parallel settings
 
   In parallel, grids may optionally be merged across neigboring ranks
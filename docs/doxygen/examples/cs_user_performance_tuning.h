@@ -56,10 +56,42 @@
 
   \snippet cs_user_performance_tuning-partition.c performance_tuning_partition_4
 
+  \subsection cs_user_performance_tuning_h_cs_user_performance_tuning_partition_5 Example 5
+
+  Cell weights may be defined so as to balance the computational cost
+  of cells, using a function such as:
+
+  \snippet cs_user_performance_tuning-partition.c performance_tuning_partition_weights
+
+  \snippet cs_user_performance_tuning-partition.c performance_tuning_partition_5
+
+  \subsection cs_user_performance_tuning_h_cs_user_performance_tuning_partition_6 Example 6
+
+  Load imbalance may also be monitored during the computation, so as to
+  compute an adapted partitioning for a subsequent restart:
+
+  \snippet cs_user_performance_tuning-partition.c performance_tuning_partition_6
+
   \section cs_user_performance_tuning_h_cs_user_performance_tuning_parallel_io  Parallel IO
 
   \snippet cs_user_performance_tuning-parallel-io.c perfomance_tuning_parallel_io
 
+  Files may also be read using memory mappings:
+
+  \snippet cs_user_performance_tuning-parallel-io.c performance_tuning_mmap_read
+
+  Checkpoint files may also be written asynchronously, so that
+  computation resumes while data is written. In parallel, this requires
+  the \c CS_CHECKPOINT_ASYNC environment variable to be set to 1 at
+  startup, so that MPI is initialized with \c MPI_THREAD_MULTIPLE support:
+
+  \snippet cs_user_performance_tuning-parallel-io.c performance_tuning_async_checkpoint
+
+  Checkpoint file sections may be compressed, possibly with a bounded
+  loss of precision for time moments:
+
+  \snippet cs_user_performance_tuning-parallel-io.c performance_tuning_checkpoint_compression
+
   \section cs_user_performance_tuning_h_cs_user_performance_tuning_matrix  Matrix tuning
 
   \snippet cs_user_performance_tuning-matrix.c performance_tuning_matrix
@@ -257,7 +257,7 @@ class PerformanceTuningModel(Model):
         Set block IO read method if applicable
         """
         self.isInList(m, ('default', 'stdio serial', 'stdio parallel',
-                          'mpi independent', 'mpi noncollective',
+                          'mmap', 'mpi independent', 'mpi noncollective',
                           'mpi collective'))
         if m == 'default':
             node = self.node_io.xmlGetNode('read_method')
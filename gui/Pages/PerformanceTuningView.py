@@ -109,12 +109,13 @@ class PerformanceTuningView(QWidget, Ui_PerformanceTuningForm):
         self.modelPartOut.addItem(self.tr("For graph-based partitioning"), 'default')
         self.modelPartOut.addItem(self.tr("Yes"), 'yes')
 
-        self.modelBlockIORead = ComboModel(self.comboBox_IORead, 6, 1)
+        self.modelBlockIORead = ComboModel(self.comboBox_IORead, 7, 1)
         self.modelBlockIOWrite = ComboModel(self.comboBox_IOWrite, 4, 1)
 
         self.modelBlockIORead.addItem(self.tr("Default"), 'default')
         self.modelBlockIORead.addItem(self.tr("Standard I/O, serial"), 'stdio serial')
         self.modelBlockIORead.addItem(self.tr("Standard I/O, parallel"), 'stdio parallel')
+        self.modelBlockIORead.addItem(self.tr("Memory-mapped, parallel"), 'mmap')
         self.modelBlockIORead.addItem(self.tr("MPI I/O, independent"), 'mpi independent')
         self.modelBlockIORead.addItem(self.tr("MPI I/O, non-collective"), 'mpi noncollective')
         self.modelBlockIORead.addItem(self.tr("MPI I/O, collective"), 'mpi collective')
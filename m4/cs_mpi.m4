@@ -34,6 +34,7 @@ cs_have_mpi_io=no
 cs_have_mpi_one_sided=no
 cs_have_mpi_neighbor_coll=no
 cs_have_mpi_ibarrier=no
+cs_have_mpi_iallreduce=no
 
 mpi_prefix=""
 
@@ -440,6 +441,16 @@ if test "x$cs_have_mpi_header" = "xyes" ; then
                     cs_have_mpi_ibarrier=yes],
                    [cs_have_mpi_ibarrier=no])
       AC_MSG_RESULT($cs_have_mpi_ibarrier)
+    AC_MSG_CHECKING([for MPI nonblocking reduction])
+    AC_LINK_IFELSE([AC_LANG_PROGRAM([[#include <mpi.h>]],
+                   [[ double s[1], r[1];
+                      MPI_Request req;
+                      MPI_Comm comm;
+                      MPI_Iallreduce(s, r, 1, MPI_DOUBLE, MPI_SUM, comm, &req); ]])],
+                   [AC_DEFINE([HAVE_MPI_IALLREDUCE], 1, [MPI nonblocking reduction])
+                    cs_have_mpi_iallreduce=yes],
+                   [cs_have_mpi_iallreduce=no])
+      AC_MSG_RESULT($cs_have_mpi_iallreduce)
   fi
 
   CPPFLAGS="$saved_CPPFLAGS"
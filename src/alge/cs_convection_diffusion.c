@@ -62,6 +62,7 @@
 #include "cs_gradient_perio.h"
 #include "cs_ext_neighborhood.h"
 #include "cs_mesh_quantities.h"
+#include "cs_numbering.h"
 #include "cs_parall.h"
 #include "cs_parameters.h"
 #include "cs_prototypes.h"
@@ -97,6 +98,49 @@ BEGIN_C_DECLS
  * Local type definitions
  *============================================================================*/
 
+/* Interior face convection/diffusion context for scalars: options,
+   geometry and field values shared by the face flux kernels */
+
+typedef struct {
+
+  int                    iconvp;          /* convection flag */
+  int                    idiffp;          /* diffusion flag */
+  int                    ircflp;          /* flux reconstruction flag */
+  int                    imasac;          /* mass accumulation flag */
+  int                    limiter_choice;  /* limiter type (Roe-Sweby) */
+
+  double                 blencp;          /* blending coefficient */
+  double                 relaxp;          /* relaxation coefficient */
+  double                 thetap;          /* theta-scheme coefficient */
+
+  cs_lnum_t              n_cells;         /* number of local cells */
+  cs_lnum_t              n_i_faces;       /* number of interior faces */
+
+  const cs_numbering_t  *numbering;       /* interior faces numbering */
+
+  const cs_lnum_2_t     *i_face_cells;
+  const cs_real_t       *weight;
+  const cs_real_t       *i_dist;
+  const cs_real_t       *i_face_surf;
+  const cs_real_t       *cell_vol;
+  const cs_real_3_t     *cell_cen;
+  const cs_real_3_t     *i_face_normal;
+  const cs_real_3_t     *i_face_cog;
+  const cs_real_3_t     *dijpf;
+
+  const cs_real_t       *pvar;            /* variable (current time step) */
+  const cs_real_t       *pvara;           /* variable (previous time step) */
+  const cs_real_3_t     *grad;            /* reconstruction gradient */
+  const cs_real_3_t     *gradup;          /* upwind gradient, or NULL */
+  const cs_real_3_t     *gradst;          /* slope test gradient, or NULL */
+  const cs_real_t       *i_massflux;      /* interior faces mass flux */
+  const cs_real_t       *i_visc;          /* interior faces viscosity */
+
+  cs_real_t             *limiter;         /* convection limiter, or NULL */
+  cs_real_t             *v_slope_test;    /* slope test indicator, or NULL */
+
+} cs_i_face_cd_scalar_t;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -659,6 +703,924 @@ cs_upstream_val(const cs_real_t                     p_c,
   return p_u;
 }
 
+/*----------------------------------------------------------------------------
+ * Add pure upwind convection/diffusion fluxes of a scalar at a given
+ * interior face to the right hand side.
+ *
+ * parameters:
+ *   c       <-- interior face convection/diffusion context
+ *   steady  <-- true for steady algorithm, false for unsteady
+ *   face_id <-- interior face id
+ *   rhs     <-> right hand side
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_i_face_scalar_upwind(const cs_i_face_cd_scalar_t  *c,
+                      bool                          steady,
+                      cs_lnum_t                     face_id,
+                      cs_real_t                    *restrict rhs)
+{
+  const cs_lnum_t ii = c->i_face_cells[face_id][0];
+  const cs_lnum_t jj = c->i_face_cells[face_id][1];
+
+  cs_real_2_t fluxij = {0., 0.};
+
+  if (steady) {
+
+    cs_real_t pifri, pjfri, pifrj, pjfrj;
+    cs_real_t pip, pjp, pipr, pjpr;
+
+    cs_i_cd_steady_upwind(c->ircflp,
+                          c->relaxp,
+                          c->weight[face_id],
+                          c->cell_cen[ii],
+                          c->cell_cen[jj],
+                          c->i_face_cog[face_id],
+                          c->dijpf[face_id],
+                          c->grad[ii],
+                          c->grad[jj],
+                          c->pvar[ii],
+                          c->pvar[jj],
+                          c->pvara[ii],
+                          c->pvara[jj],
+                          &pifri,
+                          &pifrj,
+                          &pjfri,
+                          &pjfrj,
+                          &pip,
+                          &pjp,
+                          &pipr,
+                          &pjpr);
+
+    cs_i_conv_flux(c->iconvp,
+                   1.,
+                   1,
+                   c->pvar[ii],
+                   c->pvar[jj],
+                   pifri,
+                   pifrj,
+                   pjfri,
+                   pjfrj,
+                   c->i_massflux[face_id],
+                   1., /* xcpp */
+                   1., /* xcpp */
+                   fluxij);
+
+    cs_i_diff_flux(c->idiffp,
+                   1.,
+                   pip,
+                   pjp,
+                   pipr,
+                   pjpr,
+                   c->i_visc[face_id],
+                   fluxij);
+
+  }
+  else {
+
+    cs_real_t pif, pjf;
+    cs_real_t pip, pjp;
+
+    cs_i_cd_unsteady_upwind(c->ircflp,
+                            c->weight[face_id],
+                            c->cell_cen[ii],
+                            c->cell_cen[jj],
+                            c->i_face_cog[face_id],
+                            c->dijpf[face_id],
+                            c->grad[ii],
+                            c->grad[jj],
+                            c->pvar[ii],
+                            c->pvar[jj],
+                            &pif,
+                            &pjf,
+                            &pip,
+                            &pjp);
+
+    cs_i_conv_flux(c->iconvp,
+                   c->thetap,
+                   c->imasac,
+                   c->pvar[ii],
+                   c->pvar[jj],
+                   pif,
+                   pif, /* no relaxation */
+                   pjf,
+                   pjf, /* no relaxation */
+                   c->i_massflux[face_id],
+                   1., /* xcpp */
+                   1., /* xcpp */
+                   fluxij);
+
+    cs_i_diff_flux(c->idiffp,
+                   c->thetap,
+                   pip,
+                   pjp,
+                   pip, /* no relaxation */
+                   pjp, /* no relaxation */
+                   c->i_visc[face_id],
+                   fluxij);
+
+  }
+
+  rhs[ii] -= fluxij[0];
+  rhs[jj] += fluxij[1];
+}
+
+/*----------------------------------------------------------------------------
+ * Add centered or SOLU convection/diffusion fluxes of a scalar at a given
+ * interior face to the right hand side, without slope test.
+ *
+ * parameters:
+ *   c           <-- interior face convection/diffusion context
+ *   steady      <-- true for steady algorithm, false for unsteady
+ *   ischcp      <-- second order convection scheme flag
+ *   beta_limit  <-- use min/max beta limiter for blending (unsteady only)
+ *   face_id     <-- interior face id
+ *   rhs         <-> right hand side
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_i_face_scalar_cd(const cs_i_face_cd_scalar_t  *c,
+                  bool                          steady,
+                  int                           ischcp,
+                  bool                          beta_limit,
+                  cs_lnum_t                     face_id,
+                  cs_real_t                    *restrict rhs)
+{
+  const cs_lnum_t ii = c->i_face_cells[face_id][0];
+  const cs_lnum_t jj = c->i_face_cells[face_id][1];
+
+  cs_real_2_t fluxij = {0., 0.};
+
+  if (steady) {
+
+    cs_real_t pifri, pjfri, pifrj, pjfrj;
+    cs_real_t pip, pjp, pipr, pjpr;
+
+    cs_i_cd_steady(c->ircflp,
+                   ischcp,
+                   c->relaxp,
+                   c->blencp,
+                   c->weight[face_id],
+                   c->cell_cen[ii],
+                   c->cell_cen[jj],
+                   c->i_face_cog[face_id],
+                   c->dijpf[face_id],
+                   c->grad[ii],
+                   c->grad[jj],
+                   c->gradup[ii],
+                   c->gradup[jj],
+                   c->pvar[ii],
+                   c->pvar[jj],
+                   c->pvara[ii],
+                   c->pvara[jj],
+                   &pifri,
+                   &pifrj,
+                   &pjfri,
+                   &pjfrj,
+                   &pip,
+                   &pjp,
+                   &pipr,
+                   &pjpr);
+
+    cs_i_conv_flux(c->iconvp,
+                   1.,
+                   1,
+                   c->pvar[ii],
+                   c->pvar[jj],
+                   pifri,
+                   pifrj,
+                   pjfri,
+                   pjfrj,
+                   c->i_massflux[face_id],
+                   1., /* xcpp */
+                   1., /* xcpp */
+                   fluxij);
+
+    cs_i_diff_flux(c->idiffp,
+                   1.,
+                   pip,
+                   pjp,
+                   pipr,
+                   pjpr,
+                   c->i_visc[face_id],
+                   fluxij);
+
+  }
+  else {
+
+    cs_real_t beta = c->blencp;
+
+    cs_real_t pif, pjf;
+    cs_real_t pip, pjp;
+
+    /* Beta blending coefficient assuring the positivity of the scalar */
+    if (beta_limit)
+      beta = CS_MAX(CS_MIN(c->limiter[ii], c->limiter[jj]), 0.);
+
+    cs_i_cd_unsteady(c->ircflp,
+                     ischcp,
+                     beta,
+                     c->weight[face_id],
+                     c->cell_cen[ii],
+                     c->cell_cen[jj],
+                     c->i_face_cog[face_id],
+                     c->dijpf[face_id],
+                     c->grad[ii],
+                     c->grad[jj],
+                     c->gradup[ii],
+                     c->gradup[jj],
+                     c->pvar[ii],
+                     c->pvar[jj],
+                     &pif,
+                     &pjf,
+                     &pip,
+                     &pjp);
+
+    cs_i_conv_flux(c->iconvp,
+                   c->thetap,
+                   c->imasac,
+                   c->pvar[ii],
+                   c->pvar[jj],
+                   pif,
+                   pif, /* no relaxation */
+                   pjf,
+                   pjf, /* no relaxation */
+                   c->i_massflux[face_id],
+                   1., /* xcpp */
+                   1., /* xcpp */
+                   fluxij);
+
+    cs_i_diff_flux(c->idiffp,
+                   c->thetap,
+                   pip,
+                   pjp,
+                   pip, /* no relaxation */
+                   pjp, /* no relaxation */
+                   c->i_visc[face_id],
+                   fluxij);
+
+  }
+
+  rhs[ii] -= fluxij[0];
+  rhs[jj] += fluxij[1];
+}
+
+/*----------------------------------------------------------------------------
+ * Add centered or SOLU convection/diffusion fluxes of a scalar at a given
+ * interior face to the right hand side, with slope test.
+ *
+ * parameters:
+ *   c        <-- interior face convection/diffusion context
+ *   steady   <-- true for steady algorithm, false for unsteady
+ *   ischcp   <-- second order convection scheme flag
+ *   face_id  <-- interior face id
+ *   rhs      <-> right hand side
+ *
+ * returns:
+ *   1 if the face switched to upwind and is counted on this rank, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+static inline int
+_i_face_scalar_slope_test(const cs_i_face_cd_scalar_t  *c,
+                          bool                          steady,
+                          int                           ischcp,
+                          cs_lnum_t                     face_id,
+                          cs_real_t                    *restrict rhs)
+{
+  const cs_lnum_t ii = c->i_face_cells[face_id][0];
+  const cs_lnum_t jj = c->i_face_cells[face_id][1];
+
+  int retval = 0;
+  bool upwind_switch = false;
+
+  cs_real_2_t fluxij = {0., 0.};
+
+  if (steady) {
+
+    cs_real_t pifri, pjfri, pifrj, pjfrj;
+    cs_real_t pip, pjp, pipr, pjpr;
+
+    cs_i_cd_steady_slope_test(&upwind_switch,
+                              c->iconvp,
+                              c->ircflp,
+                              ischcp,
+                              c->relaxp,
+                              c->blencp,
+                              c->weight[face_id],
+                              c->i_dist[face_id],
+                              c->i_face_surf[face_id],
+                              c->cell_cen[ii],
+                              c->cell_cen[jj],
+                              c->i_face_normal[face_id],
+                              c->i_face_cog[face_id],
+                              c->dijpf[face_id],
+                              c->i_massflux[face_id],
+                              c->grad[ii],
+                              c->grad[jj],
+                              c->gradup[ii],
+                              c->gradup[jj],
+                              c->gradst[ii],
+                              c->gradst[jj],
+                              c->pvar[ii],
+                              c->pvar[jj],
+                              c->pvara[ii],
+                              c->pvara[jj],
+                              &pifri,
+                              &pifrj,
+                              &pjfri,
+                              &pjfrj,
+                              &pip,
+                              &pjp,
+                              &pipr,
+                              &pjpr);
+
+    cs_i_conv_flux(c->iconvp,
+                   1.,
+                   1,
+                   c->pvar[ii],
+                   c->pvar[jj],
+                   pifri,
+                   pifrj,
+                   pjfri,
+                   pjfrj,
+                   c->i_massflux[face_id],
+                   1., /* xcpp */
+                   1., /* xcpp */
+                   fluxij);
+
+    cs_i_diff_flux(c->idiffp,
+                   1.,
+                   pip,
+                   pjp,
+                   pipr,
+                   pjpr,
+                   c->i_visc[face_id],
+                   fluxij);
+
+  }
+  else {
+
+    cs_real_t pif, pjf;
+    cs_real_t pip, pjp;
+
+    cs_i_cd_unsteady_slope_test(&upwind_switch,
+                                c->iconvp,
+                                c->ircflp,
+                                ischcp,
+                                c->blencp,
+                                c->weight[face_id],
+                                c->i_dist[face_id],
+                                c->i_face_surf[face_id],
+                                c->cell_cen[ii],
+                                c->cell_cen[jj],
+                                c->i_face_normal[face_id],
+                                c->i_face_cog[face_id],
+                                c->dijpf[face_id],
+                                c->i_massflux[face_id],
+                                c->grad[ii],
+                                c->grad[jj],
+                                c->gradup[ii],
+                                c->gradup[jj],
+                                c->gradst[ii],
+                                c->gradst[jj],
+                                c->pvar[ii],
+                                c->pvar[jj],
+                                &pif,
+                                &pjf,
+                                &pip,
+                                &pjp);
+
+    cs_i_conv_flux(c->iconvp,
+                   c->thetap,
+                   c->imasac,
+                   c->pvar[ii],
+                   c->pvar[jj],
+                   pif,
+                   pif, /* no relaxation */
+                   pjf,
+                   pjf, /* no relaxation */
+                   c->i_massflux[face_id],
+                   1., /* xcpp */
+                   1., /* xcpp */
+                   fluxij);
+
+    cs_i_diff_flux(c->idiffp,
+                   c->thetap,
+                   pip,
+                   pjp,
+                   pip, /* no relaxation */
+                   pjp, /* no relaxation */
+                   c->i_visc[face_id],
+                   fluxij);
+
+  }
+
+  if (upwind_switch) {
+
+    /* in parallel, face will be counted by one and only one rank */
+    if (ii < c->n_cells)
+      retval = 1;
+    if (c->v_slope_test != NULL) {
+      const cs_real_t q = fabs(c->i_massflux[face_id]);
+      c->v_slope_test[ii] += q / c->cell_vol[ii];
+      c->v_slope_test[jj] += q / c->cell_vol[jj];
+    }
+
+  }
+
+  rhs[ii] -= fluxij[0];
+  rhs[jj] += fluxij[1];
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Add Roe-Sweby limited convection/diffusion fluxes of a scalar at a given
+ * interior face to the right hand side (unsteady algorithm).
+ *
+ * parameters:
+ *   c        <-- interior face convection/diffusion context
+ *   ischcp   <-- second order convection scheme flag
+ *   face_id  <-- interior face id
+ *   rhs      <-> right hand side
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_i_face_scalar_roe_sweby(const cs_i_face_cd_scalar_t  *c,
+                         int                           ischcp,
+                         cs_lnum_t                     face_id,
+                         cs_real_t                    *restrict rhs)
+{
+  const cs_lnum_t ii = c->i_face_cells[face_id][0];
+  const cs_lnum_t jj = c->i_face_cells[face_id][1];
+
+  cs_real_2_t fluxij = {0., 0.};
+
+  cs_real_t pif, pjf;
+  cs_real_t pip, pjp;
+
+  cs_real_t rij;
+
+  cs_lnum_t cur = ii;
+  cs_real_t p_u;
+  cs_real_t p_c = c->pvar[ii]; /* Current point value */
+  cs_real_t p_d = c->pvar[jj]; /* Downstream point value */
+
+  if (c->i_massflux[face_id] < 0.) {
+    cur = jj;
+    p_c = c->pvar[jj];
+    p_d = c->pvar[ii];
+  }
+
+  /* Compute the upstream point value */
+  p_u = cs_upstream_val(p_c,
+                        c->cell_vol[cur],
+                        c->i_face_surf[face_id],
+                        c->i_face_normal[face_id],
+                        c->gradup[cur]);
+
+  /* If non monotonicity is detected at the downstream side
+     the scheme switches to a first order upwind scheme */
+  if ((p_c-p_u)*(p_d-p_c) <= 0.) {
+    rij = 0.;
+  }
+  /* There is monotonicity at the downstream side */
+  else {
+    if (CS_ABS(p_d-p_c) < cs_math_epzero*(CS_ABS(p_u)+CS_ABS(p_c)+CS_ABS(p_d))) {
+      rij = cs_math_big_r;
+    }
+    /* consecutive downstream slopes rate */
+    else {
+      rij = CS_MIN(CS_ABS((p_c-p_u)/(p_d-p_c)), cs_math_big_r);
+    }
+  }
+
+  cs_real_t phi = cs_limiter_function(c->limiter_choice, rij);
+  /* If stored for post-processing */
+  if (c->limiter != NULL)
+    c->limiter[face_id] = phi;
+
+  /* Compute the limited convective flux based on
+     SOLU or centered scheme */
+
+  cs_i_cd_unsteady_limiter(c->ircflp,
+                           ischcp,
+                           c->weight[face_id],
+                           c->cell_cen[ii],
+                           c->cell_cen[jj],
+                           c->i_face_cog[face_id],
+                           phi,
+                           c->dijpf[face_id],
+                           c->grad[ii],
+                           c->grad[jj],
+                           c->gradup[ii],
+                           c->gradup[jj],
+                           c->pvar[ii],
+                           c->pvar[jj],
+                           &pif,
+                           &pjf,
+                           &pip,
+                           &pjp);
+
+  cs_i_conv_flux(c->iconvp,
+                 c->thetap,
+                 c->imasac,
+                 c->pvar[ii],
+                 c->pvar[jj],
+                 pif,
+                 pif, /* no relaxation */
+                 pjf,
+                 pjf, /* no relaxation */
+                 c->i_massflux[face_id],
+                 1., /* xcpp */
+                 1., /* xcpp */
+                 fluxij);
+
+  cs_i_diff_flux(c->idiffp,
+                 c->thetap,
+                 pip,
+                 pjp,
+                 pip, /* no relaxation */
+                 pjp, /* no relaxation */
+                 c->i_visc[face_id],
+                 fluxij);
+
+  rhs[ii] -= fluxij[0];
+  rhs[jj] += fluxij[1];
+}
+
+/*----------------------------------------------------------------------------
+ * Add pure upwind convection/diffusion fluxes of a scalar at interior faces
+ * to the right hand side.
+ *
+ * With a vectorized interior faces numbering, faces are processed in
+ * SIMD blocks in which no cell appears twice, so that the scatter to
+ * the right hand side is safe; otherwise, the threads/groups numbering
+ * is used.
+ *
+ * parameters:
+ *   c       <-- interior face convection/diffusion context
+ *   steady  <-- true for steady algorithm, false for unsteady
+ *   rhs     <-> right hand side
+ *
+ * returns:
+ *   local number of upwind faces
+ *----------------------------------------------------------------------------*/
+
+static inline cs_gnum_t
+_i_faces_scalar_upwind(const cs_i_face_cd_scalar_t  *c,
+                       bool                          steady,
+                       cs_real_t                    *restrict rhs)
+{
+  const cs_numbering_t *numbering = c->numbering;
+  const cs_lnum_2_t *restrict i_face_cells = c->i_face_cells;
+  const cs_lnum_t n_cells = c->n_cells;
+
+  cs_gnum_t n_upwind = 0;
+
+  if (numbering->type == CS_NUMBERING_VECTORIZE) {
+
+#   if defined(HAVE_OPENMP_SIMD)
+#     pragma omp simd safelen(CS_NUMBERING_SIMD_SIZE) reduction(+:n_upwind)
+#   else
+#     pragma dir nodep
+#     pragma GCC ivdep
+#   endif
+    for (cs_lnum_t face_id = 0; face_id < c->n_i_faces; face_id++) {
+      /* in parallel, face will be counted by one and only one rank */
+      if (i_face_cells[face_id][0] < n_cells)
+        n_upwind++;
+      _i_face_scalar_upwind(c, steady, face_id, rhs);
+    }
+
+  }
+  else {
+
+    const int n_groups = numbering->n_groups;
+    const int n_threads = numbering->n_threads;
+    const cs_lnum_t *restrict group_index = numbering->group_index;
+
+    for (int g_id = 0; g_id < n_groups; g_id++) {
+#     pragma omp parallel for reduction(+:n_upwind)
+      for (int t_id = 0; t_id < n_threads; t_id++) {
+        for (cs_lnum_t face_id = group_index[(t_id*n_groups + g_id)*2];
+             face_id < group_index[(t_id*n_groups + g_id)*2 + 1];
+             face_id++) {
+          /* in parallel, face will be counted by one and only one rank */
+          if (i_face_cells[face_id][0] < n_cells)
+            n_upwind++;
+          _i_face_scalar_upwind(c, steady, face_id, rhs);
+        }
+      }
+    }
+
+  }
+
+  return n_upwind;
+}
+
+/*----------------------------------------------------------------------------
+ * Add centered or SOLU convection/diffusion fluxes of a scalar at interior
+ * faces to the right hand side, without slope test.
+ *
+ * Loops are organized as in _i_faces_scalar_upwind; this function is
+ * called with constant scheme arguments, so that the per-face scheme
+ * tests are resolved at compile time.
+ *
+ * parameters:
+ *   c           <-- interior face convection/diffusion context
+ *   steady      <-- true for steady algorithm, false for unsteady
+ *   ischcp      <-- second order convection scheme flag
+ *   beta_limit  <-- use min/max beta limiter for blending (unsteady only)
+ *   rhs         <-> right hand side
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_i_faces_scalar_cd(const cs_i_face_cd_scalar_t  *c,
+                   bool                          steady,
+                   int                           ischcp,
+                   bool                          beta_limit,
+                   cs_real_t                    *restrict rhs)
+{
+  const cs_numbering_t *numbering = c->numbering;
+
+  if (numbering->type == CS_NUMBERING_VECTORIZE) {
+
+#   if defined(HAVE_OPENMP_SIMD)
+#     pragma omp simd safelen(CS_NUMBERING_SIMD_SIZE)
+#   else
+#     pragma dir nodep
+#     pragma GCC ivdep
+#   endif
+    for (cs_lnum_t face_id = 0; face_id < c->n_i_faces; face_id++)
+      _i_face_scalar_cd(c, steady, ischcp, beta_limit, face_id, rhs);
+
+  }
+  else {
+
+    const int n_groups = numbering->n_groups;
+    const int n_threads = numbering->n_threads;
+    const cs_lnum_t *restrict group_index = numbering->group_index;
+
+    for (int g_id = 0; g_id < n_groups; g_id++) {
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_threads; t_id++) {
+        for (cs_lnum_t face_id = group_index[(t_id*n_groups + g_id)*2];
+             face_id < group_index[(t_id*n_groups + g_id)*2 + 1];
+             face_id++)
+          _i_face_scalar_cd(c, steady, ischcp, beta_limit, face_id, rhs);
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Add centered or SOLU convection/diffusion fluxes of a scalar at interior
+ * faces to the right hand side, with slope test.
+ *
+ * Loops are organized as in _i_faces_scalar_upwind.
+ *
+ * parameters:
+ *   c       <-- interior face convection/diffusion context
+ *   steady  <-- true for steady algorithm, false for unsteady
+ *   ischcp  <-- second order convection scheme flag
+ *   rhs     <-> right hand side
+ *
+ * returns:
+ *   local number of faces switched to upwind
+ *----------------------------------------------------------------------------*/
+
+static inline cs_gnum_t
+_i_faces_scalar_slope_test(const cs_i_face_cd_scalar_t  *c,
+                           bool                          steady,
+                           int                           ischcp,
+                           cs_real_t                    *restrict rhs)
+{
+  const cs_numbering_t *numbering = c->numbering;
+
+  cs_gnum_t n_upwind = 0;
+
+  if (numbering->type == CS_NUMBERING_VECTORIZE) {
+
+#   if defined(HAVE_OPENMP_SIMD)
+#     pragma omp simd safelen(CS_NUMBERING_SIMD_SIZE) reduction(+:n_upwind)
+#   else
+#     pragma dir nodep
+#     pragma GCC ivdep
+#   endif
+    for (cs_lnum_t face_id = 0; face_id < c->n_i_faces; face_id++)
+      n_upwind += _i_face_scalar_slope_test(c, steady, ischcp, face_id, rhs);
+
+  }
+  else {
+
+    const int n_groups = numbering->n_groups;
+    const int n_threads = numbering->n_threads;
+    const cs_lnum_t *restrict group_index = numbering->group_index;
+
+    for (int g_id = 0; g_id < n_groups; g_id++) {
+#     pragma omp parallel for reduction(+:n_upwind)
+      for (int t_id = 0; t_id < n_threads; t_id++) {
+        for (cs_lnum_t face_id = group_index[(t_id*n_groups + g_id)*2];
+             face_id < group_index[(t_id*n_groups + g_id)*2 + 1];
+             face_id++)
+          n_upwind += _i_face_scalar_slope_test(c, steady, ischcp, face_id,
+                                                rhs);
+      }
+    }
+
+  }
+
+  return n_upwind;
+}
+
+/*----------------------------------------------------------------------------
+ * Add Roe-Sweby limited convection/diffusion fluxes of a scalar at
+ * interior faces to the right hand side (unsteady algorithm).
+ *
+ * Loops are organized as in _i_faces_scalar_upwind.
+ *
+ * parameters:
+ *   c       <-- interior face convection/diffusion context
+ *   ischcp  <-- second order convection scheme flag
+ *   rhs     <-> right hand side
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_i_faces_scalar_roe_sweby(const cs_i_face_cd_scalar_t  *c,
+                          int                           ischcp,
+                          cs_real_t                    *restrict rhs)
+{
+  const cs_numbering_t *numbering = c->numbering;
+
+  if (numbering->type == CS_NUMBERING_VECTORIZE) {
+
+#   if defined(HAVE_OPENMP_SIMD)
+#     pragma omp simd safelen(CS_NUMBERING_SIMD_SIZE)
+#   else
+#     pragma dir nodep
+#     pragma GCC ivdep
+#   endif
+    for (cs_lnum_t face_id = 0; face_id < c->n_i_faces; face_id++)
+      _i_face_scalar_roe_sweby(c, ischcp, face_id, rhs);
+
+  }
+  else {
+
+    const int n_groups = numbering->n_groups;
+    const int n_threads = numbering->n_threads;
+    const cs_lnum_t *restrict group_index = numbering->group_index;
+
+    for (int g_id = 0; g_id < n_groups; g_id++) {
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_threads; t_id++) {
+        for (cs_lnum_t face_id = group_index[(t_id*n_groups + g_id)*2];
+             face_id < group_index[(t_id*n_groups + g_id)*2 + 1];
+             face_id++)
+          _i_face_scalar_roe_sweby(c, ischcp, face_id, rhs);
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Add convection/diffusion fluxes of a scalar at interior faces to the
+ * right hand side.
+ *
+ * The face flux kernel matching the convection scheme, slope test and
+ * time algorithm is selected once here, and called with constant
+ * arguments, so that scheme tests are not evaluated per face.
+ *
+ * parameters:
+ *   c       <-- interior face convection/diffusion context
+ *   steady  <-- true for steady algorithm, false for unsteady
+ *   iupwin  <-- 1 for pure upwind scheme, 0 otherwise
+ *   ischcp  <-- second order convection scheme flag
+ *   isstpp  <-- slope test / limiter type
+ *   rhs     <-> right hand side
+ *
+ * returns:
+ *   local number of faces using an upwind scheme
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_i_faces_scalar_conv_diff(const cs_i_face_cd_scalar_t  *c,
+                          bool                          steady,
+                          int                           iupwin,
+                          int                           ischcp,
+                          int                           isstpp,
+                          cs_real_t                    *restrict rhs)
+{
+  cs_gnum_t n_upwind = 0;
+
+  /* Pure upwind flux */
+
+  if (iupwin == 1) {
+    if (steady)
+      n_upwind = _i_faces_scalar_upwind(c, true, rhs);
+    else
+      n_upwind = _i_faces_scalar_upwind(c, false, rhs);
+    return n_upwind;
+  }
+
+  if (ischcp < 0 || ischcp > 2) {
+    bft_error(__FILE__, __LINE__, 0,
+              _("invalid value of ischcv"));
+  }
+
+  /* Flux with no slope test or Min/Max Beta limiter */
+
+  if (isstpp == 1 || isstpp == 2) {
+
+    if (steady) {
+      switch (ischcp) {
+      case 0:
+        _i_faces_scalar_cd(c, true, 0, false, rhs);
+        break;
+      case 1:
+        _i_faces_scalar_cd(c, true, 1, false, rhs);
+        break;
+      default:
+        _i_faces_scalar_cd(c, true, 2, false, rhs);
+      }
+    }
+    else if (isstpp == 2) {
+      switch (ischcp) {
+      case 0:
+        _i_faces_scalar_cd(c, false, 0, true, rhs);
+        break;
+      case 1:
+        _i_faces_scalar_cd(c, false, 1, true, rhs);
+        break;
+      default:
+        _i_faces_scalar_cd(c, false, 2, true, rhs);
+      }
+    }
+    else {
+      switch (ischcp) {
+      case 0:
+        _i_faces_scalar_cd(c, false, 0, false, rhs);
+        break;
+      case 1:
+        _i_faces_scalar_cd(c, false, 1, false, rhs);
+        break;
+      default:
+        _i_faces_scalar_cd(c, false, 2, false, rhs);
+      }
+    }
+
+    return n_upwind;
+  }
+
+  /* Flux with slope test or Roe and Sweby limiter */
+
+  if (isstpp != 0 && isstpp != 3) {
+    bft_error(__FILE__, __LINE__, 0,
+              _("invalid value of isstpc"));
+  }
+
+  if (steady) {
+    switch (ischcp) {
+    case 0:
+      n_upwind = _i_faces_scalar_slope_test(c, true, 0, rhs);
+      break;
+    case 1:
+      n_upwind = _i_faces_scalar_slope_test(c, true, 1, rhs);
+      break;
+    default:
+      n_upwind = _i_faces_scalar_slope_test(c, true, 2, rhs);
+    }
+  }
+  else if (isstpp == 0) {
+    switch (ischcp) {
+    case 0:
+      n_upwind = _i_faces_scalar_slope_test(c, false, 0, rhs);
+      break;
+    case 1:
+      n_upwind = _i_faces_scalar_slope_test(c, false, 1, rhs);
+      break;
+    default:
+      n_upwind = _i_faces_scalar_slope_test(c, false, 2, rhs);
+    }
+  }
+  else {
+    switch (ischcp) {
+    case 0:
+      _i_faces_scalar_roe_sweby(c, 0, rhs);
+      break;
+    case 1:
+      _i_faces_scalar_roe_sweby(c, 1, rhs);
+      break;
+    default:
+      _i_faces_scalar_roe_sweby(c, 2, rhs);
+    }
+  }
+
+  return n_upwind;
+}
+
 /*============================================================================
  * Public function definitions for Fortran API
  *============================================================================*/
@@ -1709,11 +2671,8 @@ cs_convection_diffusion_scalar(int                       idtvar,
 
   const cs_lnum_t n_cells = m->n_cells;
   const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
-  const int n_i_groups = m->i_face_numbering->n_groups;
-  const int n_i_threads = m->i_face_numbering->n_threads;
   const int n_b_groups = m->b_face_numbering->n_groups;
   const int n_b_threads = m->b_face_numbering->n_threads;
-  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
   const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
 
   const cs_lnum_2_t *restrict i_face_cells
@@ -1936,606 +2895,47 @@ cs_convection_diffusion_scalar(int                       idtvar,
     }
   }
 
-  /* --> Pure upwind flux
-    =====================*/
-
-  if (iupwin == 1) {
-
-    /* Steady */
-    if (idtvar < 0) {
-
-      for (int g_id = 0; g_id < n_i_groups; g_id++) {
-#       pragma omp parallel for reduction(+:n_upwind)
-        for (int t_id = 0; t_id < n_i_threads; t_id++) {
-          for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-               face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-               face_id++) {
-
-            cs_lnum_t ii = i_face_cells[face_id][0];
-            cs_lnum_t jj = i_face_cells[face_id][1];
-
-            /* in parallel, face will be counted by one and only one rank */
-            if (ii < n_cells) {
-              n_upwind++;
-            }
-
-            cs_real_2_t fluxij = {0.,0.};
-
-            cs_real_t pifri, pjfri, pifrj, pjfrj;
-            cs_real_t pip, pjp, pipr, pjpr;
-
-            cs_i_cd_steady_upwind(ircflp,
-                                  relaxp,
-                                  weight[face_id],
-                                  cell_cen[ii],
-                                  cell_cen[jj],
-                                  i_face_cog[face_id],
-                                  dijpf[face_id],
-                                  grad[ii],
-                                  grad[jj],
-                                  pvar[ii],
-                                  pvar[jj],
-                                  pvara[ii],
-                                  pvara[jj],
-                                  &pifri,
-                                  &pifrj,
-                                  &pjfri,
-                                  &pjfrj,
-                                  &pip,
-                                  &pjp,
-                                  &pipr,
-                                  &pjpr);
-
-            cs_i_conv_flux(iconvp,
-                           1.,
-                           1,
-                           pvar[ii],
-                           pvar[jj],
-                           pifri,
-                           pifrj,
-                           pjfri,
-                           pjfrj,
-                           i_massflux[face_id],
-                           1., /* xcpp */
-                           1., /* xcpp */
-                           fluxij);
-
-            cs_i_diff_flux(idiffp,
-                           1.,
-                           pip,
-                           pjp,
-                           pipr,
-                           pjpr,
-                           i_visc[face_id],
-                           fluxij);
-
-            rhs[ii] -= fluxij[0];
-            rhs[jj] += fluxij[1];
-
-          }
-        }
-      }
-
-    /* Unsteady */
-    } else {
-
-      for (int g_id = 0; g_id < n_i_groups; g_id++) {
-#       pragma omp parallel for reduction(+:n_upwind)
-        for (int t_id = 0; t_id < n_i_threads; t_id++) {
-          for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-               face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-               face_id++) {
-
-            cs_lnum_t ii = i_face_cells[face_id][0];
-            cs_lnum_t jj = i_face_cells[face_id][1];
-
-            /* in parallel, face will be counted by one and only one rank */
-            if (ii < n_cells) {
-              n_upwind++;
-            }
-
-            cs_real_2_t fluxij = {0.,0.};
-
-            cs_real_t pif, pjf;
-            cs_real_t pip, pjp;
-
-            cs_i_cd_unsteady_upwind(ircflp,
-                                    weight[face_id],
-                                    cell_cen[ii],
-                                    cell_cen[jj],
-                                    i_face_cog[face_id],
-                                    dijpf[face_id],
-                                    grad[ii],
-                                    grad[jj],
-                                    pvar[ii],
-                                    pvar[jj],
-                                    &pif,
-                                    &pjf,
-                                    &pip,
-                                    &pjp);
-
-            cs_i_conv_flux(iconvp,
-                           thetap,
-                           imasac,
-                           pvar[ii],
-                           pvar[jj],
-                           pif,
-                           pif, /* no relaxation */
-                           pjf,
-                           pjf, /* no relaxation */
-                           i_massflux[face_id],
-                           1., /* xcpp */
-                           1., /* xcpp */
-                           fluxij);
-
-            cs_i_diff_flux(idiffp,
-                           thetap,
-                           pip,
-                           pjp,
-                           pip,/* no relaxation */
-                           pjp,/* no relaxation */
-                           i_visc[face_id],
-                           fluxij);
-
-            rhs[ii] -= fluxij[0];
-            rhs[jj] += fluxij[1];
-
-          }
-        }
-      }
-
-    }
-
-  /* --> Flux with no slope test or Min/Max Beta limiter
-    ====================================================*/
-
-  } else if (isstpp == 1 || isstpp == 2) {
-
-    if (ischcp < 0 || ischcp > 2) {
-      bft_error(__FILE__, __LINE__, 0,
-                _("invalid value of ischcv"));
-    }
-
-    /* Steady */
-    if (idtvar < 0) {
-
-      for (int g_id = 0; g_id < n_i_groups; g_id++) {
-#       pragma omp parallel for
-        for (int t_id = 0; t_id < n_i_threads; t_id++) {
-          for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-               face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-               face_id++) {
-
-            cs_lnum_t ii = i_face_cells[face_id][0];
-            cs_lnum_t jj = i_face_cells[face_id][1];
-
-            cs_real_2_t fluxij = {0.,0.};
-
-            cs_real_t pifri, pjfri, pifrj, pjfrj;
-            cs_real_t pip, pjp, pipr, pjpr;
-
-            cs_i_cd_steady(ircflp,
-                           ischcp,
-                           relaxp,
-                           blencp,
-                           weight[face_id],
-                           cell_cen[ii],
-                           cell_cen[jj],
-                           i_face_cog[face_id],
-                           dijpf[face_id],
-                           grad[ii],
-                           grad[jj],
-                           gradup[ii],
-                           gradup[jj],
-                           pvar[ii],
-                           pvar[jj],
-                           pvara[ii],
-                           pvara[jj],
-                           &pifri,
-                           &pifrj,
-                           &pjfri,
-                           &pjfrj,
-                           &pip,
-                           &pjp,
-                           &pipr,
-                           &pjpr);
-
-            cs_i_conv_flux(iconvp,
-                           1.,
-                           1,
-                           pvar[ii],
-                           pvar[jj],
-                           pifri,
-                           pifrj,
-                           pjfri,
-                           pjfrj,
-                           i_massflux[face_id],
-                           1., /* xcpp */
-                           1., /* xcpp */
-                           fluxij);
-
-            cs_i_diff_flux(idiffp,
-                           1.,
-                           pip,
-                           pjp,
-                           pipr,
-                           pjpr,
-                           i_visc[face_id],
-                           fluxij);
-
-            rhs[ii] -= fluxij[0];
-            rhs[jj] += fluxij[1];
-
-          }
-        }
-      }
-
-    /* Unsteady */
-    } else {
-
-      for (int g_id = 0; g_id < n_i_groups; g_id++) {
-#       pragma omp parallel for
-        for (int t_id = 0; t_id < n_i_threads; t_id++) {
-          for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-               face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-               face_id++) {
-
-            cs_lnum_t ii = i_face_cells[face_id][0];
-            cs_lnum_t jj = i_face_cells[face_id][1];
-
-            cs_real_t beta = blencp;
-
-            cs_real_t pif, pjf;
-            cs_real_t pip, pjp;
-
-            /*Beta blending coefficient assuring the positivity of the scalar*/
-            if (isstpp == 2) {
-              beta = CS_MAX(CS_MIN(limiter[ii], limiter[jj]), 0.);
-            }
-
-            cs_real_2_t fluxij = {0.,0.};
-
-            cs_i_cd_unsteady(ircflp,
-                             ischcp,
-                             beta,
-                             weight[face_id],
-                             cell_cen[ii],
-                             cell_cen[jj],
-                             i_face_cog[face_id],
-                             dijpf[face_id],
-                             grad[ii],
-                             grad[jj],
-                             gradup[ii],
-                             gradup[jj],
-                             pvar[ii],
-                             pvar[jj],
-                             &pif,
-                             &pjf,
-                             &pip,
-                             &pjp);
-
-            cs_i_conv_flux(iconvp,
-                           thetap,
-                           imasac,
-                           pvar[ii],
-                           pvar[jj],
-                           pif,
-                           pif, /* no relaxation */
-                           pjf,
-                           pjf, /* no relaxation */
-                           i_massflux[face_id],
-                           1., /* xcpp */
-                           1., /* xcpp */
-                           fluxij);
-
-            cs_i_diff_flux(idiffp,
-                           thetap,
-                           pip,
-                           pjp,
-                           pip, /* no relaxation */
-                           pjp, /* no relaxation */
-                           i_visc[face_id],
-                           fluxij);
-
-            rhs[ii] -= fluxij[0];
-            rhs[jj] += fluxij[1];
-
-          }
-        }
-      }
-
-    }
-
-  /* --> Flux with slope test or Roe and Sweby limiter
-    ==================================================*/
-
-  } else {
-
-    if (ischcp < 0 || ischcp > 2) {
-      bft_error(__FILE__, __LINE__, 0,
-                _("invalid value of ischcv"));
-    }
-    if (isstpp != 0 && isstpp != 3) {
-      bft_error(__FILE__, __LINE__, 0,
-                _("invalid value of isstpc"));
-    }
-
-    /* Steady */
-    if (idtvar < 0) {
-
-      for (int g_id = 0; g_id < n_i_groups; g_id++) {
-#       pragma omp parallel for reduction(+:n_upwind)
-        for (int t_id = 0; t_id < n_i_threads; t_id++) {
-          for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-               face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-               face_id++) {
-
-            cs_lnum_t ii = i_face_cells[face_id][0];
-            cs_lnum_t jj = i_face_cells[face_id][1];
-
-            cs_real_2_t fluxij = {0., 0.};
-
-            bool upwind_switch;
-            cs_real_t pifri, pjfri, pifrj, pjfrj;
-            cs_real_t pip, pjp, pipr, pjpr;
-
-            cs_i_cd_steady_slope_test(&upwind_switch,
-                                      iconvp,
-                                      ircflp,
-                                      ischcp,
-                                      relaxp,
-                                      blencp,
-                                      weight[face_id],
-                                      i_dist[face_id],
-                                      i_face_surf[face_id],
-                                      cell_cen[ii],
-                                      cell_cen[jj],
-                                      i_face_normal[face_id],
-                                      i_face_cog[face_id],
-                                      dijpf[face_id],
-                                      i_massflux[face_id],
-                                      grad[ii],
-                                      grad[jj],
-                                      gradup[ii],
-                                      gradup[jj],
-                                      gradst[ii],
-                                      gradst[jj],
-                                      pvar[ii],
-                                      pvar[jj],
-                                      pvara[ii],
-                                      pvara[jj],
-                                      &pifri,
-                                      &pifrj,
-                                      &pjfri,
-                                      &pjfrj,
-                                      &pip,
-                                      &pjp,
-                                      &pipr,
-                                      &pjpr);
-
-            cs_i_conv_flux(iconvp,
-                           1.,
-                           1,
-                           pvar[ii],
-                           pvar[jj],
-                           pifri,
-                           pifrj,
-                           pjfri,
-                           pjfrj,
-                           i_massflux[face_id],
-                           1., /* xcpp */
-                           1., /* xcpp */
-                           fluxij);
-
-            cs_i_diff_flux(idiffp,
-                           1.,
-                           pip,
-                           pjp,
-                           pipr,
-                           pjpr,
-                           i_visc[face_id],
-                           fluxij);
-
-            if (upwind_switch) {
-
-              /* in parallel, face will be counted by one and only one rank */
-              if (ii < n_cells)
-                n_upwind++;
-              if (v_slope_test != NULL) {
-                v_slope_test[ii] += fabs(i_massflux[face_id]) / cell_vol[ii];
-                v_slope_test[jj] += fabs(i_massflux[face_id]) / cell_vol[jj];
-              }
-
-            }
-
-            rhs[ii] -= fluxij[0];
-            rhs[jj] += fluxij[1];
-
-          }
-        }
-      }
-
-    /* Unsteady */
-    } else {
-
-      for (int g_id = 0; g_id < n_i_groups; g_id++) {
-#       pragma omp parallel for reduction(+:n_upwind)
-        for (int t_id = 0; t_id < n_i_threads; t_id++) {
-          for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-               face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-               face_id++) {
-
-            cs_lnum_t ii = i_face_cells[face_id][0];
-            cs_lnum_t jj = i_face_cells[face_id][1];
-
-            bool upwind_switch = false;
-
-            cs_real_2_t fluxij = {0.,0.};
-
-            cs_real_t pif, pjf;
-            cs_real_t pip, pjp;
-
-            /* Original slope test */
-            if (isstpp == 0) {
-
-              cs_i_cd_unsteady_slope_test(&upwind_switch,
-                                          iconvp,
-                                          ircflp,
-                                          ischcp,
-                                          blencp,
-                                          weight[face_id],
-                                          i_dist[face_id],
-                                          i_face_surf[face_id],
-                                          cell_cen[ii],
-                                          cell_cen[jj],
-                                          i_face_normal[face_id],
-                                          i_face_cog[face_id],
-                                          dijpf[face_id],
-                                          i_massflux[face_id],
-                                          grad[ii],
-                                          grad[jj],
-                                          gradup[ii],
-                                          gradup[jj],
-                                          gradst[ii],
-                                          gradst[jj],
-                                          pvar[ii],
-                                          pvar[jj],
-                                          &pif,
-                                          &pjf,
-                                          &pip,
-                                          &pjp);
-
-              cs_i_conv_flux(iconvp,
-                             thetap,
-                             imasac,
-                             pvar[ii],
-                             pvar[jj],
-                             pif,
-                             pif, /* no relaxation */
-                             pjf,
-                             pjf, /* no relaxation */
-                             i_massflux[face_id],
-                             1., /* xcpp */
-                             1., /* xcpp */
-                             fluxij);
-
-            }
-            /* Roe- Sweby limiter */
-            else { /* if (isstpp == 3) */
-
-              cs_real_t rij;
-
-              int cur;
-              cs_real_t p_u, p_c, p_d;
-
-              cur = ii;
-              // Current    point value
-              p_c = pvar[ii];
-              // Downstream point value
-              p_d = pvar[jj];
-
-              if (i_massflux[face_id] < 0.) {
-                cur = jj;
-                p_c = pvar[jj];
-                p_d = pvar[ii];
-              }
-
-              /* Compute the upstream point value */
-              p_u = cs_upstream_val(p_c,
-                                    cell_vol[cur],
-                                    i_face_surf[face_id],
-                                    i_face_normal[face_id],
-                                    gradup[cur]);
-
-              /* If non monotonicity is detected at the downstream side
-                 the scheme switches to a first order upwind scheme */
-              if ((p_c-p_u)*(p_d-p_c) <= 0.) {
-                 rij = 0.;
-              }
-              /* There is monotonicity at the downstream side */
-              else {
-                if (CS_ABS(p_d-p_c) < cs_math_epzero*(CS_ABS(p_u)+CS_ABS(p_c)+CS_ABS(p_d))) {
-                  rij = cs_math_big_r;
-                }
-                /* consecutive downstream slopes rate */
-                else {
-                  rij = CS_MIN(CS_ABS((p_c-p_u)/(p_d-p_c)), cs_math_big_r);
-                }
-              }
-
-              cs_real_t phi = cs_limiter_function(limiter_choice, rij);
-              /* If stored for post-processing */
-              if (limiter != NULL)
-                limiter[face_id] = phi;
-
-              /* Compute the limited convective flux based on
-                 SOLU or centered scheme */
-
-              cs_i_cd_unsteady_limiter(ircflp,
+  /* --> Convection/diffusion fluxes, using the kernel matching the scheme
+    =====================================================================*/
+
+  const cs_i_face_cd_scalar_t i_face_cd = {
+    .iconvp = iconvp,
+    .idiffp = idiffp,
+    .ircflp = ircflp,
+    .imasac = imasac,
+    .limiter_choice = limiter_choice,
+    .blencp = blencp,
+    .relaxp = relaxp,
+    .thetap = thetap,
+    .n_cells = n_cells,
+    .n_i_faces = m->n_i_faces,
+    .numbering = m->i_face_numbering,
+    .i_face_cells = i_face_cells,
+    .weight = weight,
+    .i_dist = i_dist,
+    .i_face_surf = i_face_surf,
+    .cell_vol = cell_vol,
+    .cell_cen = cell_cen,
+    .i_face_normal = i_face_normal,
+    .i_face_cog = i_face_cog,
+    .dijpf = dijpf,
+    .pvar = pvar,
+    .pvara = pvara,
+    .grad = (const cs_real_3_t *)grad,
+    .gradup = (const cs_real_3_t *)gradup,
+    .gradst = (const cs_real_3_t *)gradst,
+    .i_massflux = i_massflux,
+    .i_visc = i_visc,
+    .limiter = limiter,
+    .v_slope_test = v_slope_test
+  };
+
+  n_upwind = _i_faces_scalar_conv_diff(&i_face_cd,
+                                       (idtvar < 0),
+                                       iupwin,
                                        ischcp,
-                                       weight[face_id],
-                                       cell_cen[ii],
-                                       cell_cen[jj],
-                                       i_face_cog[face_id],
-                                       phi,
-                                       dijpf[face_id],
-                                       grad[ii],
-                                       grad[jj],
-                                       gradup[ii],
-                                       gradup[jj],
-                                       pvar[ii],
-                                       pvar[jj],
-                                       &pif,
-                                       &pjf,
-                                       &pip,
-                                       &pjp);
-
-              cs_i_conv_flux(iconvp,
-                             thetap,
-                             imasac,
-                             pvar[ii],
-                             pvar[jj],
-                             pif,
-                             pif, /* no relaxation */
-                             pjf,
-                             pjf, /* no relaxation */
-                             i_massflux[face_id],
-                             1., /* xcpp */
-                             1., /* xcpp */
-                             fluxij);
-
-            }
-            cs_i_diff_flux(idiffp,
-                           thetap,
-                           pip,
-                           pjp,
-                           pip, /* no relaxation */
-                           pjp, /* no relaxation */
-                           i_visc[face_id],
-                           fluxij);
-
-            if (upwind_switch) {
-
-              /* in parallel, face will be counted by one and only one rank */
-              if (ii < n_cells)
-                n_upwind++;
-              if (v_slope_test != NULL) {
-                v_slope_test[ii] += fabs(i_massflux[face_id]) / cell_vol[ii];
-                v_slope_test[jj] += fabs(i_massflux[face_id]) / cell_vol[jj];
-              }
-
-            }
-
-            rhs[ii] -= fluxij[0];
-            rhs[jj] += fluxij[1];
-
-          }
-        }
-      }
-
-    } /* idtvar */
-
-  } /* iupwin */
+                                       isstpp,
+                                       rhs);
 
 
   if (iwarnp >= 2) {
@@ -113,6 +113,29 @@ typedef struct _cs_gradient_info_t {
 
 } cs_gradient_info_t;
 
+/* Cached least-squares geometric weights (dc/|dc|^2) */
+/*----------------------------------------------------*/
+
+typedef struct {
+
+  int          fvq_count;          /* Mesh quantities computation count
+                                      at build time (-1 if not built) */
+
+  cs_lnum_t    n_i_faces;          /* Number of interior faces */
+  cs_lnum_t    n_b_faces;          /* Number of boundary faces */
+  cs_lnum_t    n_cell_cells;       /* Size of extended neighborhood */
+
+  cs_real_t   *i_face_w;           /* Interior face weights, or NULL */
+  cs_real_t   *b_face_w;           /* Boundary face weights, or NULL */
+  cs_real_t   *cell_cells_w;       /* Extended neighborhood weights,
+                                      or NULL */
+
+  float       *i_face_w_f;         /* Single precision variants, or NULL */
+  float       *b_face_w_f;
+  float       *cell_cells_w_f;
+
+} cs_gradient_lsq_w_cache_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -136,6 +159,13 @@ const char *cs_gradient_type_name[]
 
 static int _gradient_stat_id = -1;
 
+/* Least-squares geometric weights cache */
+
+static cs_gradient_lsq_cache_t  _lsq_w_cache_mode = CS_GRADIENT_LSQ_CACHE_NONE;
+
+static cs_gradient_lsq_w_cache_t  _lsq_w_cache
+  = {-1, 0, 0, 0, NULL, NULL, NULL, NULL, NULL, NULL};
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -385,6 +415,197 @@ _find_or_add_system(const char          *name,
   return cs_glob_gradient_systems[mid_id];
 }
 
+/*----------------------------------------------------------------------------
+ * Free cached least-squares geometric weights.
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_w_cache_free(void)
+{
+  _lsq_w_cache.fvq_count = -1;
+
+  _lsq_w_cache.n_i_faces = 0;
+  _lsq_w_cache.n_b_faces = 0;
+  _lsq_w_cache.n_cell_cells = 0;
+
+  BFT_FREE(_lsq_w_cache.i_face_w);
+  BFT_FREE(_lsq_w_cache.b_face_w);
+  BFT_FREE(_lsq_w_cache.cell_cells_w);
+  BFT_FREE(_lsq_w_cache.i_face_w_f);
+  BFT_FREE(_lsq_w_cache.b_face_w_f);
+  BFT_FREE(_lsq_w_cache.cell_cells_w_f);
+}
+
+/*----------------------------------------------------------------------------
+ * Store least-squares geometric weight dc/|dc|^2 in cache arrays.
+ *
+ * parameters:
+ *   dc     <-- distance vector
+ *   id     <-- element id
+ *   w      <-> double precision weights, or NULL
+ *   w_f    <-> single precision weights, or NULL
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_lsq_w_cache_store(const cs_real_t   dc[3],
+                   cs_lnum_t         id,
+                   cs_real_t        *w,
+                   float            *w_f)
+{
+  const cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+  if (w != NULL) {
+    for (int ll = 0; ll < 3; ll++)
+      w[id*3 + ll] = dc[ll] * ddc;
+  }
+  else {
+    for (int ll = 0; ll < 3; ll++)
+      w_f[id*3 + ll] = dc[ll] * ddc;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Return least-squares geometric weight from cache arrays.
+ *
+ * parameters:
+ *   w      <-- double precision weights, or NULL
+ *   w_f    <-- single precision weights, or NULL
+ *   id     <-- element id
+ *   dcw    --> dc/|dc|^2 for this element
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_lsq_w_cache_get(const cs_real_t  *restrict w,
+                 const float      *restrict w_f,
+                 cs_lnum_t                  id,
+                 cs_real_t                  dcw[3])
+{
+  if (w != NULL) {
+    dcw[0] = w[id*3];
+    dcw[1] = w[id*3 + 1];
+    dcw[2] = w[id*3 + 2];
+  }
+  else {
+    dcw[0] = w_f[id*3];
+    dcw[1] = w_f[id*3 + 1];
+    dcw[2] = w_f[id*3 + 2];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Return cached least-squares geometric weights, building or updating
+ * them if needed.
+ *
+ * Weights are rebuilt only when mesh quantities have been recomputed
+ * (i.e. when the mesh has moved) or mesh dimensions have changed.
+ *
+ * parameters:
+ *   m    <-- pointer to associated mesh structure
+ *   fvq  <-- pointer to associated finite volume quantities
+ *
+ * returns:
+ *   pointer to cached weights, or NULL if caching is not active
+ *----------------------------------------------------------------------------*/
+
+static const cs_gradient_lsq_w_cache_t *
+_get_lsq_w_cache(const cs_mesh_t             *m,
+                 const cs_mesh_quantities_t  *fvq)
+{
+  if (_lsq_w_cache_mode == CS_GRADIENT_LSQ_CACHE_NONE)
+    return NULL;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+  const cs_lnum_t n_cell_cells
+    = (m->cell_cells_idx != NULL) ? m->cell_cells_idx[n_cells] : 0;
+  const int fvq_count = cs_mesh_quantities_compute_count();
+
+  cs_gradient_lsq_w_cache_t *c = &_lsq_w_cache;
+
+  if (   c->fvq_count == fvq_count
+      && c->n_i_faces == n_i_faces
+      && c->n_b_faces == n_b_faces
+      && c->n_cell_cells == n_cell_cells)
+    return c;
+
+  _lsq_w_cache_free();
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+  const cs_lnum_t *restrict cell_cells_idx
+    = (const cs_lnum_t *restrict)m->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_lst
+    = (const cs_lnum_t *restrict)m->cell_cells_lst;
+
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict b_face_cog
+    = (const cs_real_3_t *restrict)fvq->b_face_cog;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+
+  if (_lsq_w_cache_mode == CS_GRADIENT_LSQ_CACHE_FLOAT) {
+    BFT_MALLOC(c->i_face_w_f, n_i_faces*3, float);
+    BFT_MALLOC(c->b_face_w_f, n_b_faces*3, float);
+    BFT_MALLOC(c->cell_cells_w_f, n_cell_cells*3, float);
+  }
+  else {
+    BFT_MALLOC(c->i_face_w, n_i_faces*3, cs_real_t);
+    BFT_MALLOC(c->b_face_w, n_b_faces*3, cs_real_t);
+    BFT_MALLOC(c->cell_cells_w, n_cell_cells*3, cs_real_t);
+  }
+
+  /* Interior faces */
+
+# pragma omp parallel for if(n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+    cs_real_3_t dc;
+    cs_lnum_t ii = i_face_cells[face_id][0];
+    cs_lnum_t jj = i_face_cells[face_id][1];
+    for (int ll = 0; ll < 3; ll++)
+      dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+    _lsq_w_cache_store(dc, face_id, c->i_face_w, c->i_face_w_f);
+  }
+
+  /* Boundary faces (I'F, used for vector gradients) */
+
+# pragma omp parallel for if(n_b_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
+    cs_real_3_t dc;
+    cs_lnum_t ii = b_face_cells[face_id];
+    for (int ll = 0; ll < 3; ll++)
+      dc[ll] = b_face_cog[face_id][ll] - cell_cen[ii][ll] - diipb[face_id][ll];
+    _lsq_w_cache_store(dc, face_id, c->b_face_w, c->b_face_w_f);
+  }
+
+  /* Extended neighborhood */
+
+  if (n_cell_cells > 0) {
+#   pragma omp parallel for if(n_cells > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+      for (cs_lnum_t cidx = cell_cells_idx[ii];
+           cidx < cell_cells_idx[ii+1];
+           cidx++) {
+        cs_real_3_t dc;
+        cs_lnum_t jj = cell_cells_lst[cidx];
+        for (int ll = 0; ll < 3; ll++)
+          dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+        _lsq_w_cache_store(dc, cidx, c->cell_cells_w, c->cell_cells_w_f);
+      }
+    }
+  }
+
+  c->fvq_count = fvq_count;
+  c->n_i_faces = n_i_faces;
+  c->n_b_faces = n_b_faces;
+  c->n_cell_cells = n_cell_cells;
+
+  return c;
+}
+
 /*----------------------------------------------------------------------------
  * Compute L2 norm.
  *
@@ -2207,7 +2428,7 @@ _lsq_scalar_gradient(const cs_mesh_t             *m,
   int        g_id, t_id;
   cs_real_t  a11, a12, a13, a22, a23, a33;
   cs_real_t  cocg11, cocg12, cocg13, cocg22, cocg23, cocg33;
-  cs_real_t  pfac, det_inv;
+  cs_real_t  pfac, ddc, det_inv;
   cs_real_t  extrab, unddij, umcbdd, udbfs;
   cs_real_3_t  dc, dddij, dsij;
   cs_real_4_t  fctb;
@@ -2345,6 +2566,11 @@ _lsq_scalar_gradient(const cs_mesh_t             *m,
 
   } /* End of recompute_cocg */
 
+  /* Cached geometric weights (not applicable to weighted gradients) */
+
+  const cs_gradient_lsq_w_cache_t *w_c
+    = (c_weight == NULL) ? _get_lsq_w_cache(m, fvq) : NULL;
+
   /* Compute Right-Hand Side */
   /*-------------------------*/
 
@@ -2365,7 +2591,8 @@ _lsq_scalar_gradient(const cs_mesh_t             *m,
 
     for (g_id = 0; g_id < n_i_groups; g_id++) {
 
-#     pragma omp parallel for private(face_id, ii, jj, ll, pfac, dc, fctb)
+#     pragma omp parallel for private(face_id, ii, jj, ll, pfac, ddc, dc, \
+                                      fctb)
       for (t_id = 0; t_id < n_i_threads; t_id++) {
 
         for (face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
@@ -2377,20 +2604,27 @@ _lsq_scalar_gradient(const cs_mesh_t             *m,
 
           cs_real_t pond = weight[face_id];
 
-          for (ll = 0; ll < 3; ll++)
-            dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
-
-          if (c_weight != NULL) {
-            if (w_stride == 6) {
-              _compute_ani_dc(&c_weight[ii*6],
-                              &c_weight[jj*6],
-                              dc,
-                              pond);
+          if (w_c != NULL) {
+            _lsq_w_cache_get(w_c->i_face_w, w_c->i_face_w_f, face_id, dc);
+            ddc = 1.;
+          }
+          else {
+            for (ll = 0; ll < 3; ll++)
+              dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+
+            if (c_weight != NULL) {
+              if (w_stride == 6) {
+                _compute_ani_dc(&c_weight[ii*6],
+                                &c_weight[jj*6],
+                                dc,
+                                pond);
+              }
             }
+
+            ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
           }
 
-          pfac =   (rhsv[jj][3] - rhsv[ii][3])
-                 / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+          pfac = (rhsv[jj][3] - rhsv[ii][3]) * ddc;
 
           for (ll = 0; ll < 3; ll++)
             fctb[ll] = dc[ll] * pfac;
@@ -2433,7 +2667,7 @@ _lsq_scalar_gradient(const cs_mesh_t             *m,
 
     if (halo_type == CS_HALO_EXTENDED) {
 
-#     pragma omp parallel for private(jj, ll, dc, fctb, pfac)
+#     pragma omp parallel for private(jj, ll, dc, fctb, pfac, ddc)
       for (ii = 0; ii < n_cells; ii++) {
         for (cs_lnum_t cidx = cell_cells_idx[ii];
              cidx < cell_cells_idx[ii+1];
@@ -2441,11 +2675,18 @@ _lsq_scalar_gradient(const cs_mesh_t             *m,
 
           jj = cell_cells_lst[cidx];
 
-          for (ll = 0; ll < 3; ll++)
-            dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+          if (w_c != NULL) {
+            _lsq_w_cache_get(w_c->cell_cells_w, w_c->cell_cells_w_f,
+                             cidx, dc);
+            ddc = 1.;
+          }
+          else {
+            for (ll = 0; ll < 3; ll++)
+              dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+            ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+          }
 
-          pfac =   (rhsv[jj][3] - rhsv[ii][3])
-                 / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+          pfac = (rhsv[jj][3] - rhsv[ii][3]) * ddc;
 
           for (ll = 0; ll < 3; ll++)
             fctb[ll] = dc[ll] * pfac;
@@ -2504,7 +2745,8 @@ _lsq_scalar_gradient(const cs_mesh_t             *m,
 
     for (g_id = 0; g_id < n_i_groups; g_id++) {
 
-#     pragma omp parallel for private(face_id, ii, jj, ll, dc, pfac, fctb)
+#     pragma omp parallel for private(face_id, ii, jj, ll, dc, ddc, pfac, \
+                                      fctb)
       for (t_id = 0; t_id < n_i_threads; t_id++) {
 
         for (face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
@@ -2514,8 +2756,15 @@ _lsq_scalar_gradient(const cs_mesh_t             *m,
           ii = i_face_cells[face_id][0];
           jj = i_face_cells[face_id][1];
 
-          for (ll = 0; ll < 3; ll++)
-            dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+          if (w_c != NULL) {
+            _lsq_w_cache_get(w_c->i_face_w, w_c->i_face_w_f, face_id, dc);
+            ddc = 1.;
+          }
+          else {
+            for (ll = 0; ll < 3; ll++)
+              dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+            ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+          }
 
           pfac =   (  rhsv[jj][3] - rhsv[ii][3]
                     + (cell_cen[ii][0] - i_face_cog[face_id][0]) * f_ext[ii][0]
@@ -2524,7 +2773,7 @@ _lsq_scalar_gradient(const cs_mesh_t             *m,
                     - (cell_cen[jj][0] - i_face_cog[face_id][0]) * f_ext[jj][0]
                     - (cell_cen[jj][1] - i_face_cog[face_id][1]) * f_ext[jj][1]
                     - (cell_cen[jj][2] - i_face_cog[face_id][2]) * f_ext[jj][2])
-                  / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+                  * ddc;
 
           for (ll = 0; ll < 3; ll++)
             fctb[ll] = dc[ll] * pfac;
@@ -2682,6 +2931,358 @@ _lsq_scalar_gradient(const cs_mesh_t             *m,
    }
 }
 
+/*----------------------------------------------------------------------------
+ * Compute cell gradients of several scalars using least-squares
+ * reconstruction for non-orthogonal meshes, in a single pass over faces.
+ *
+ * Values and gradients are interleaved (the values of all fields for a
+ * given cell are contiguous), so that connectivity and geometric quantities
+ * are loaded only once for all fields.
+ *
+ * As cocg depends on boundary conditions for boundary cells, cocg is
+ * recomputed for each field on those cells when required. For consistency
+ * with successive calls to _lsq_scalar_gradient, the values of the last
+ * field are then saved in fvq->cocg_s_lsq.
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   halo_type      <-- halo type (extended or not)
+ *   recompute_cocg <-- flag to recompute cocg
+ *   n_fields       <-- number of fields
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   extrap         <-- gradient extrapolation coefficient
+ *   coefap         <-- B.C. coefficients for boundary face normals,
+ *                      for each field
+ *   coefbp         <-- B.C. coefficients for boundary face normals,
+ *                      for each field
+ *   pvar           <-- interleaved variables (n_cells_ext*n_fields)
+ *   grad           --> interleaved gradients (n_cells_ext*n_fields*3)
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_scalar_gradient_multi(const cs_mesh_t             *m,
+                           cs_mesh_quantities_t        *fvq,
+                           cs_halo_type_t               halo_type,
+                           bool                         recompute_cocg,
+                           int                          n_fields,
+                           cs_real_t                    inc,
+                           double                       extrap,
+                           const cs_real_t             *coefap[],
+                           const cs_real_t             *coefbp[],
+                           const cs_real_t    *restrict pvar,
+                           cs_real_t          *restrict grad)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_b_cells = m->n_b_cells;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+  const cs_lnum_t *restrict cell_cells_idx
+    = (const cs_lnum_t *restrict)m->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_lst
+    = (const cs_lnum_t *restrict)m->cell_cells_lst;
+
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
+  const cs_real_t *restrict b_face_surf
+    = (const cs_real_t *restrict)fvq->b_face_surf;
+  const cs_real_t *restrict b_dist
+    = (const cs_real_t *restrict)fvq->b_dist;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+  const cs_int_t *isympa = fvq->b_sym_flag;
+
+  cs_real_33_t   *restrict cocgb = fvq->cocgb_s_lsq;
+  cs_real_33_t   *restrict cocg = fvq->cocg_s_lsq;
+  cs_real_33_t   *restrict b_cocg = NULL;
+  cs_lnum_t      *restrict b_cell_id = NULL;
+
+  const int n = n_fields;
+
+  const cs_gradient_lsq_w_cache_t *w_c = _get_lsq_w_cache(m, fvq);
+
+  /* Compute cocg of boundary cells for each field */
+  /*-----------------------------------------------*/
+
+  if (recompute_cocg) {
+
+    BFT_MALLOC(b_cell_id, n_cells, cs_lnum_t);
+    BFT_MALLOC(b_cocg, n_b_cells*n, cs_real_33_t);
+
+#   pragma omp parallel for
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
+      b_cell_id[cell_id] = -1;
+
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < n_b_cells; ii++) {
+      b_cell_id[m->b_cells[ii]] = ii;
+      for (int f_id = 0; f_id < n; f_id++) {
+        for (int ll = 0; ll < 3; ll++) {
+          for (int mm = 0; mm < 3; mm++)
+            b_cocg[ii*n + f_id][ll][mm] = cocgb[ii][ll][mm];
+        }
+      }
+    }
+
+    for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+        for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+             face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+             face_id++) {
+
+          const cs_lnum_t b_id = b_cell_id[b_face_cells[face_id]];
+          const cs_real_t udbfs_0 = 1. / b_face_surf[face_id];
+          const cs_real_t unddij = 1. / b_dist[face_id];
+
+          for (int f_id = 0; f_id < n; f_id++) {
+
+            cs_real_3_t dddij;
+
+            const cs_real_t extrab
+              = 1. - isympa[face_id]*extrap*coefbp[f_id][face_id];
+            const cs_real_t umcbdd
+              = extrab * (1. - coefbp[f_id][face_id]) * unddij;
+            const cs_real_t udbfs = extrab * udbfs_0;
+
+            for (int ll = 0; ll < 3; ll++)
+              dddij[ll] =   udbfs * b_face_normal[face_id][ll]
+                          + umcbdd * diipb[face_id][ll];
+
+            for (int ll = 0; ll < 3; ll++) {
+              for (int mm = 0; mm < 3; mm++)
+                b_cocg[b_id*n + f_id][ll][mm] += dddij[ll]*dddij[mm];
+            }
+
+          }
+
+        } /* loop on faces */
+
+      } /* loop on threads */
+
+    } /* loop on thread groups */
+
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < n_b_cells*n; ii++) {
+
+      cs_real_t *restrict _cocg = (cs_real_t *restrict)(b_cocg[ii]);
+
+      const cs_real_t cocg11 = _cocg[0];
+      const cs_real_t cocg12 = _cocg[1];
+      const cs_real_t cocg13 = _cocg[2];
+      const cs_real_t cocg22 = _cocg[4];
+      const cs_real_t cocg23 = _cocg[5];
+      const cs_real_t cocg33 = _cocg[8];
+
+      const cs_real_t a11 = cocg22*cocg33 - cocg23*cocg23;
+      const cs_real_t a12 = cocg23*cocg13 - cocg12*cocg33;
+      const cs_real_t a13 = cocg12*cocg23 - cocg22*cocg13;
+      const cs_real_t a22 = cocg11*cocg33 - cocg13*cocg13;
+      const cs_real_t a23 = cocg12*cocg13 - cocg11*cocg23;
+      const cs_real_t a33 = cocg11*cocg22 - cocg12*cocg12;
+
+      const cs_real_t det_inv = 1. / (cocg11*a11 + cocg12*a12 + cocg13*a13);
+
+      _cocg[0] = a11 * det_inv;
+      _cocg[1] = a12 * det_inv;
+      _cocg[2] = a13 * det_inv;
+      _cocg[3] = a12 * det_inv;
+      _cocg[4] = a22 * det_inv;
+      _cocg[5] = a23 * det_inv;
+      _cocg[6] = a13 * det_inv;
+      _cocg[7] = a23 * det_inv;
+      _cocg[8] = a33 * det_inv;
+
+    }
+
+    /* Save values for last field */
+
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < n_b_cells; ii++) {
+      cs_lnum_t cell_id = m->b_cells[ii];
+      for (int ll = 0; ll < 3; ll++) {
+        for (int mm = 0; mm < 3; mm++)
+          cocg[cell_id][ll][mm] = b_cocg[ii*n + n-1][ll][mm];
+      }
+    }
+
+  } /* End of recompute_cocg */
+
+  /* Compute Right-Hand Side */
+  /*-------------------------*/
+
+# pragma omp parallel for
+  for (cs_lnum_t ii = 0; ii < n_cells_ext*n*3; ii++)
+    grad[ii] = 0.0;
+
+  /* Contribution from interior faces */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        const cs_lnum_t ii = i_face_cells[face_id][0];
+        const cs_lnum_t jj = i_face_cells[face_id][1];
+
+        cs_real_3_t dc;
+        cs_real_t ddc = 1.;
+        if (w_c != NULL)
+          _lsq_w_cache_get(w_c->i_face_w, w_c->i_face_w_f, face_id, dc);
+        else {
+          for (int ll = 0; ll < 3; ll++)
+            dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+          ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+        }
+
+        const cs_real_t *restrict pvar_i = pvar + ii*n;
+        const cs_real_t *restrict pvar_j = pvar + jj*n;
+        cs_real_t *restrict rhs_i = grad + ii*n*3;
+        cs_real_t *restrict rhs_j = grad + jj*n*3;
+
+        for (int f_id = 0; f_id < n; f_id++) {
+          const cs_real_t pfac = (pvar_j[f_id] - pvar_i[f_id]) * ddc;
+          for (int ll = 0; ll < 3; ll++) {
+            rhs_i[f_id*3 + ll] += dc[ll] * pfac;
+            rhs_j[f_id*3 + ll] += dc[ll] * pfac;
+          }
+        }
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+  /* Contribution from extended neighborhood */
+
+  if (halo_type == CS_HALO_EXTENDED) {
+
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+
+      const cs_real_t *restrict pvar_i = pvar + ii*n;
+      cs_real_t *restrict rhs_i = grad + ii*n*3;
+
+      for (cs_lnum_t cidx = cell_cells_idx[ii];
+           cidx < cell_cells_idx[ii+1];
+           cidx++) {
+
+        const cs_lnum_t jj = cell_cells_lst[cidx];
+        const cs_real_t *restrict pvar_j = pvar + jj*n;
+
+        cs_real_3_t dc;
+        cs_real_t ddc = 1.;
+        if (w_c != NULL)
+          _lsq_w_cache_get(w_c->cell_cells_w, w_c->cell_cells_w_f, cidx, dc);
+        else {
+          for (int ll = 0; ll < 3; ll++)
+            dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+          ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+        }
+
+        for (int f_id = 0; f_id < n; f_id++) {
+          const cs_real_t pfac = (pvar_j[f_id] - pvar_i[f_id]) * ddc;
+          for (int ll = 0; ll < 3; ll++)
+            rhs_i[f_id*3 + ll] += dc[ll] * pfac;
+        }
+
+      }
+    }
+
+  } /* End for extended neighborhood */
+
+  /* Contribution from boundary faces */
+
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+      for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           face_id++) {
+
+        const cs_lnum_t ii = b_face_cells[face_id];
+
+        const cs_real_t unddij = 1. / b_dist[face_id];
+        const cs_real_t udbfs = 1. / b_face_surf[face_id];
+
+        const cs_real_t *restrict pvar_i = pvar + ii*n;
+        cs_real_t *restrict rhs_i = grad + ii*n*3;
+
+        for (int f_id = 0; f_id < n; f_id++) {
+
+          const cs_real_t b_coefa = coefap[f_id][face_id];
+          const cs_real_t b_coefb = coefbp[f_id][face_id];
+
+          const cs_real_t extrab
+            = pow((1. - isympa[face_id]*extrap*b_coefb), 2.0);
+          const cs_real_t umcbdd = (1. - b_coefb) * unddij;
+
+          const cs_real_t pfac
+            = (b_coefa*inc + (b_coefb - 1.)*pvar_i[f_id]) * unddij * extrab;
+
+          for (int ll = 0; ll < 3; ll++)
+            rhs_i[f_id*3 + ll] +=   (  udbfs * b_face_normal[face_id][ll]
+                                     + umcbdd*diipb[face_id][ll])
+                                  * pfac;
+
+        }
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+  /* Compute gradient (in place) */
+  /*-----------------------------*/
+
+# pragma omp parallel for
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+
+    const cs_lnum_t b_id = (b_cell_id != NULL) ? b_cell_id[cell_id] : -1;
+
+    for (int f_id = 0; f_id < n; f_id++) {
+
+      cs_real_3_t *restrict _cocg
+        = (b_id > -1) ? b_cocg[b_id*n + f_id] : cocg[cell_id];
+      cs_real_t *restrict _grad = grad + (cell_id*n + f_id)*3;
+
+      const cs_real_t rhs[3] = {_grad[0], _grad[1], _grad[2]};
+
+      for (int ll = 0; ll < 3; ll++)
+        _grad[ll] =   _cocg[ll][0] * rhs[0]
+                    + _cocg[ll][1] * rhs[1]
+                    + _cocg[ll][2] * rhs[2];
+
+    }
+
+  }
+
+  BFT_FREE(b_cocg);
+  BFT_FREE(b_cell_id);
+}
+
 /*----------------------------------------------------------------------------
  * Clip the gradient of a vector if necessary. This function deals with the
  * standard or extended neighborhood.
@@ -3918,6 +4519,8 @@ _lsq_vector_gradient(const cs_mesh_t              *m,
 
   cs_real_33_t *rhs;
 
+  const cs_gradient_lsq_w_cache_t *w_c = _get_lsq_w_cache(m, fvq);
+
   BFT_MALLOC(rhs, n_cells_ext, cs_real_33_t);
 
   /* By default, handle the gradient as a tensor
@@ -3954,10 +4557,15 @@ _lsq_vector_gradient(const cs_mesh_t              *m,
         cell_id1 = i_face_cells[face_id][0];
         cell_id2 = i_face_cells[face_id][1];
 
-        for (i = 0; i < 3; i++)
-          dc[i] = cell_cen[cell_id2][i] - cell_cen[cell_id1][i];
-
-        ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+        if (w_c != NULL) {
+          _lsq_w_cache_get(w_c->i_face_w, w_c->i_face_w_f, face_id, dc);
+          ddc = 1.;
+        }
+        else {
+          for (i = 0; i < 3; i++)
+            dc[i] = cell_cen[cell_id2][i] - cell_cen[cell_id1][i];
+          ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+        }
 
         for (i = 0; i < 3; i++) {
           pfac =  (pvar[cell_id2][i] - pvar[cell_id1][i]) * ddc;
@@ -3987,10 +4595,15 @@ _lsq_vector_gradient(const cs_mesh_t              *m,
 
         cell_id2 = cell_cells_lst[cidx];
 
-        for (i = 0; i < 3; i++)
-          dc[i] = cell_cen[cell_id2][i] - cell_cen[cell_id1][i];
-
-        ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+        if (w_c != NULL) {
+          _lsq_w_cache_get(w_c->cell_cells_w, w_c->cell_cells_w_f, cidx, dc);
+          ddc = 1.;
+        }
+        else {
+          for (i = 0; i < 3; i++)
+            dc[i] = cell_cen[cell_id2][i] - cell_cen[cell_id1][i];
+          ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+        }
 
         for (i = 0; i < 3; i++) {
 
@@ -4018,14 +4631,20 @@ _lsq_vector_gradient(const cs_mesh_t              *m,
 
         cell_id1 = b_face_cells[face_id];
 
-        const cs_real_t *iipbf = &diipb[face_id][0];
+        if (w_c != NULL) {
+          _lsq_w_cache_get(w_c->b_face_w, w_c->b_face_w_f, face_id, dc);
+          ddc = 1.;
+        }
+        else {
+          const cs_real_t *iipbf = &diipb[face_id][0];
 
-        /* db = I'F */
-        for (i = 0; i < 3; i++)
-          dc[i] = b_face_cog[face_id][i] - cell_cen[cell_id1][i]
-                 -iipbf[i];
+          /* db = I'F */
+          for (i = 0; i < 3; i++)
+            dc[i] = b_face_cog[face_id][i] - cell_cen[cell_id1][i]
+                   -iipbf[i];
 
-        ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+          ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+        }
 
         for (i = 0; i < 3; i++) {
           pfac = (coefav[face_id][i]*inc
@@ -5477,6 +6096,48 @@ cs_gradient_finalize(void)
 
   cs_glob_gradient_n_systems = 0;
   cs_glob_gradient_n_max_systems = 0;
+
+  _lsq_w_cache_free();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set caching mode for least-squares gradient geometric weights.
+ *
+ * When active, the per-face geometric factors used to build least-squares
+ * gradient right-hand sides (for interior faces, boundary faces, and
+ * the extended neighborhood) are computed once and reused, until the
+ * mesh quantities are recomputed (for example when the mesh moves).
+ * The single precision variant halves the associated memory traffic,
+ * at the cost of a slight loss of accuracy in the gradient.
+ *
+ * Weights are not cached for weighted (anisotropic) gradients.
+ *
+ * \param[in]  mode  caching mode
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_set_lsq_cache(cs_gradient_lsq_cache_t  mode)
+{
+  if (mode != _lsq_w_cache_mode)
+    _lsq_w_cache_free();
+
+  _lsq_w_cache_mode = mode;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return caching mode for least-squares gradient geometric weights.
+ *
+ * \return  caching mode
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_gradient_lsq_cache_t
+cs_gradient_get_lsq_cache(void)
+{
+  return _lsq_w_cache_mode;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -5739,6 +6400,198 @@ cs_gradient_scalar(const char                *var_name,
 }
 
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of several scalar fields.
+ *
+ * Using the least-squares gradient type with reconstruction
+ * (\p n_r_sweeps > 1), gradients of all fields are computed in a single
+ * pass over the mesh faces, with a single halo exchange for variables and
+ * a single one for gradients, amortizing the connectivity and geometry
+ * accesses over all fields. Other gradient types are handled by successive
+ * calls to \ref cs_gradient_scalar.
+ *
+ * Periodicity of rotation and hydrostatic pressure are not handled here,
+ * as this function is intended for sets of transported scalars
+ * (such as species), which share the same gradient options.
+ *
+ * \param[in]       var_name        name used for gradient statistics
+ * \param[in]       gradient_type   gradient type
+ * \param[in]       halo_type       halo type
+ * \param[in]       inc             if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg  should COCG FV quantities be recomputed ?
+ * \param[in]       n_r_sweeps      if > 1, number of reconstruction sweeps
+ * \param[in]       n_fields        number of fields
+ * \param[in]       verbosity       verbosity level
+ * \param[in]       clip_mode       clipping mode
+ * \param[in]       epsilon         precision for iterative gradient calculation
+ * \param[in]       extrap          boundary gradient extrapolation coefficient
+ * \param[in]       clip_coeff      clipping coefficient
+ * \param[in]       bc_coeff_a      boundary condition term a, for each field
+ * \param[in]       bc_coeff_b      boundary condition term b, for each field
+ * \param[in, out]  var             gradients' base variables
+ * \param[out]      grad            gradients, for each field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_multi(const char                *var_name,
+                         cs_gradient_type_t         gradient_type,
+                         cs_halo_type_t             halo_type,
+                         int                        inc,
+                         bool                       recompute_cocg,
+                         int                        n_r_sweeps,
+                         int                        n_fields,
+                         int                        verbosity,
+                         int                        clip_mode,
+                         double                     epsilon,
+                         double                     extrap,
+                         double                     clip_coeff,
+                         const cs_real_t           *bc_coeff_a[],
+                         const cs_real_t           *bc_coeff_b[],
+                         cs_real_t                 *var[],
+                         cs_real_3_t               *grad[])
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_halo_t  *halo = mesh->halo;
+  cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const int n = n_fields;
+
+  cs_gradient_info_t *gradient_info = NULL;
+  cs_timer_t t0, t1;
+
+  cs_real_t  *restrict _var, *restrict _grad;
+
+  bool update_stats = true;
+
+  static int last_fvm_count = 0;
+
+  if (n_fields < 1)
+    return;
+
+  /* Cases not handled by the fused algorithm */
+
+  if (gradient_type != CS_GRADIENT_LSQ || n_r_sweeps <= 1) {
+    for (int f_id = 0; f_id < n_fields; f_id++)
+      cs_gradient_scalar(var_name,
+                         gradient_type,
+                         halo_type,
+                         inc,
+                         recompute_cocg,
+                         n_r_sweeps,
+                         0,             /* tr_dim */
+                         0,             /* hyd_p_flag */
+                         1,             /* w_stride */
+                         verbosity,
+                         clip_mode,
+                         epsilon,
+                         extrap,
+                         clip_coeff,
+                         NULL,          /* f_ext */
+                         bc_coeff_a[f_id],
+                         bc_coeff_b[f_id],
+                         var[f_id],
+                         NULL,          /* c_weight */
+                         grad[f_id]);
+    return;
+  }
+
+  {
+    int prev_fvq_count = last_fvm_count;
+    last_fvm_count = cs_mesh_quantities_compute_count();
+    if (last_fvm_count != prev_fvq_count)
+      recompute_cocg = true;
+  }
+
+  /* Allocate work arrays */
+
+  BFT_MALLOC(_var, n_cells_ext*n, cs_real_t);
+  BFT_MALLOC(_grad, n_cells_ext*n*3, cs_real_t);
+
+  t0 = cs_timer_time();
+
+  if (update_stats == true)
+    gradient_info = _find_or_add_system(var_name, gradient_type);
+
+  /* Interleave and synchronize variables */
+
+# pragma omp parallel for
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    for (int f_id = 0; f_id < n; f_id++)
+      _var[cell_id*n + f_id] = var[f_id][cell_id];
+  }
+
+  if (halo != NULL) {
+
+    cs_halo_sync_var_strided(halo, halo_type, _var, n);
+
+    /* Update ghost values of base variables, as for cs_gradient_scalar */
+
+#   pragma omp parallel for
+    for (cs_lnum_t cell_id = n_cells; cell_id < n_cells_ext; cell_id++) {
+      for (int f_id = 0; f_id < n; f_id++)
+        var[f_id][cell_id] = _var[cell_id*n + f_id];
+    }
+
+  }
+
+  /* Compute gradients */
+
+  _lsq_scalar_gradient_multi(mesh,
+                             fvq,
+                             halo_type,
+                             recompute_cocg,
+                             n,
+                             inc,
+                             extrap,
+                             bc_coeff_a,
+                             bc_coeff_b,
+                             _var,
+                             _grad);
+
+  if (halo != NULL)
+    cs_halo_sync_var_strided(halo, CS_HALO_STANDARD, _grad, n*3);
+
+  /* De-interleave gradients */
+
+# pragma omp parallel for
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
+    for (int f_id = 0; f_id < n; f_id++) {
+      for (int ll = 0; ll < 3; ll++)
+        grad[f_id][cell_id][ll] = _grad[(cell_id*n + f_id)*3 + ll];
+    }
+  }
+
+  BFT_FREE(_grad);
+  BFT_FREE(_var);
+
+  for (int f_id = 0; f_id < n; f_id++) {
+
+    if (halo != NULL && mesh->n_init_perio > 0)
+      cs_halo_perio_sync_var_vect(halo,
+                                  CS_HALO_STANDARD,
+                                  (cs_real_t *)(grad[f_id]),
+                                  3);
+
+    _scalar_gradient_clipping(halo_type, clip_mode, verbosity, 0, clip_coeff,
+                              var[f_id], grad[f_id]);
+
+  }
+
+  t1 = cs_timer_time();
+
+  if (update_stats == true) {
+    gradient_info->n_calls += 1;
+    cs_timer_counter_add_diff(&(gradient_info->t_tot), &t0, &t1);
+  }
+
+  if (_gradient_stat_id > -1)
+    cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of vector field.
@@ -59,6 +59,18 @@ typedef enum {
 
 } cs_gradient_type_t;
 
+/*----------------------------------------------------------------------------
+ * Caching of least-squares gradient geometric weights
+ *----------------------------------------------------------------------------*/
+
+typedef enum {
+
+  CS_GRADIENT_LSQ_CACHE_NONE,    /* Weights recomputed at each call */
+  CS_GRADIENT_LSQ_CACHE_DOUBLE,  /* Weights cached in double precision */
+  CS_GRADIENT_LSQ_CACHE_FLOAT    /* Weights cached in single precision */
+
+} cs_gradient_lsq_cache_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -102,6 +114,51 @@ void CS_PROCF (cgdcel, CGDCEL)
        cs_real_3_t       grad[]       /* <-> gradient                         */
 );
 
+/*----------------------------------------------------------------------------
+ * Compute cell gradients of several scalar fields.
+ *
+ * Using the least-squares gradient type with reconstruction
+ * (n_r_sweeps > 1), gradients of all fields are computed in a single
+ * pass over the mesh faces, with grouped halo exchanges. Other gradient
+ * types are handled by successive calls to cs_gradient_scalar.
+ *
+ * parameters:
+ *   var_name       <-- name used for gradient statistics
+ *   gradient_type  <-- gradient type
+ *   halo_type      <-- halo type
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   recompute_cocg <-- should COCG FV quantities be recomputed ?
+ *   n_r_sweeps     <-- if > 1, number of reconstruction sweeps
+ *   n_fields       <-- number of fields
+ *   verbosity      <-- verbosity level
+ *   clip_mode      <-- clipping mode
+ *   epsilon        <-- precision for iterative gradient calculation
+ *   extrap         <-- boundary gradient extrapolation coefficient
+ *   clip_coeff     <-- clipping coefficient
+ *   bc_coeff_a     <-- boundary condition term a, for each field
+ *   bc_coeff_b     <-- boundary condition term b, for each field
+ *   var            <-> gradients' base variables
+ *   grad           --> gradients, for each field
+ *----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_multi(const char                *var_name,
+                         cs_gradient_type_t         gradient_type,
+                         cs_halo_type_t             halo_type,
+                         int                        inc,
+                         bool                       recompute_cocg,
+                         int                        n_r_sweeps,
+                         int                        n_fields,
+                         int                        verbosity,
+                         int                        clip_mode,
+                         double                     epsilon,
+                         double                     extrap,
+                         double                     clip_coeff,
+                         const cs_real_t           *bc_coeff_a[],
+                         const cs_real_t           *bc_coeff_b[],
+                         cs_real_t                 *var[],
+                         cs_real_3_t               *grad[]);
+
 /*----------------------------------------------------------------------------
  * Compute cell gradient of vector field.
  *----------------------------------------------------------------------------*/
@@ -165,6 +222,30 @@ cs_gradient_initialize(void);
 void
 cs_gradient_finalize(void);
 
+/*----------------------------------------------------------------------------
+ * Set caching mode for least-squares gradient geometric weights.
+ *
+ * When active, the per-face geometric factors used to build least-squares
+ * gradient right-hand sides are computed once and reused, until the mesh
+ * quantities are recomputed (for example when the mesh moves).
+ *
+ * parameters:
+ *   mode <-- caching mode
+ *----------------------------------------------------------------------------*/
+
+void
+cs_gradient_set_lsq_cache(cs_gradient_lsq_cache_t  mode);
+
+/*----------------------------------------------------------------------------
+ * Return caching mode for least-squares gradient geometric weights.
+ *
+ * returns:
+ *   caching mode
+ *----------------------------------------------------------------------------*/
+
+cs_gradient_lsq_cache_t
+cs_gradient_get_lsq_cache(void);
+
 /*----------------------------------------------------------------------------
  * Compute cell gradient of scalar field or component of vector or
  * tensor field.
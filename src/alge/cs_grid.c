@@ -253,10 +253,40 @@ static int _grid_tune_max_level = 0;
 static int *_grid_tune_max_fill_level = NULL;
 static cs_matrix_variant_t **_grid_tune_variant = NULL;
 
+/* Store coarse matrix extra-diagonal coefficients in single precision */
+
+static bool _grid_mixed_precision = false;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Return the mean of the diagonal terms of an extra-diagonal block.
+ *
+ * This is used to obtain a scalar connection strength for each face
+ * when extra-diagonal terms are full blocks.
+ *
+ * parameters:
+ *   eb_size <-- extra-diagonal block sizes
+ *   xa      <-- pointer to extra-diagonal block values
+ *
+ * returns:
+ *   mean of extra-diagonal block diagonal terms
+ *----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_eb_mean_diag(const int        *eb_size,
+              const cs_real_t  *xa)
+{
+  cs_real_t s = 0.;
+
+  for (int kk = 0; kk < eb_size[0]; kk++)
+    s += xa[eb_size[2]*kk + kk];
+
+  return s / eb_size[0];
+}
+
 /*----------------------------------------------------------------------------
  * Allocate empty grid structure
  *
@@ -1499,6 +1529,7 @@ _empty_halo(cs_halo_t  *h)
   BFT_FREE(h->send_perio_lst);
   BFT_FREE(h->index);
   BFT_FREE(h->perio_lst);
+  cs_halo_update_buffers(h);
 }
 
 /*----------------------------------------------------------------------------
@@ -2075,6 +2106,9 @@ _append_face_data(cs_grid_t   *g,
 {
   int rank_id;
 
+  const cs_lnum_t xa_stride = (g->symmetric == true) ?
+    g->extra_diag_block_size[3] : 2*g->extra_diag_block_size[3];
+
   cs_lnum_t *recv_count = NULL;
 
   MPI_Status status;
@@ -2111,10 +2145,7 @@ _append_face_data(cs_grid_t   *g,
 
     BFT_REALLOC(g->_face_normal, n_faces_tot*3, cs_real_t);
 
-    if (g->symmetric == true)
-      BFT_REALLOC(g->_xa, n_faces_tot, cs_real_t);
-    else
-      BFT_REALLOC(g->_xa, n_faces_tot*2, cs_real_t);
+    BFT_REALLOC(g->_xa, n_faces_tot*xa_stride, cs_real_t);
 
     BFT_REALLOC(g->_xa0, n_faces_tot, cs_real_t);
     BFT_REALLOC(g->xa0ij, n_faces_tot*3, cs_real_t);
@@ -2132,12 +2163,8 @@ _append_face_data(cs_grid_t   *g,
       MPI_Recv(g->_face_normal + g->n_faces*3, n_recv*3,
                CS_MPI_REAL, dist_rank, tag, comm, &status);
 
-      if (g->symmetric == true)
-        MPI_Recv(g->_xa + g->n_faces, n_recv,
-                 CS_MPI_REAL, dist_rank, tag, comm, &status);
-      else
-        MPI_Recv(g->_xa + g->n_faces*2, n_recv*2,
-                 CS_MPI_REAL, dist_rank, tag, comm, &status);
+      MPI_Recv(g->_xa + g->n_faces*xa_stride, n_recv*xa_stride,
+               CS_MPI_REAL, dist_rank, tag, comm, &status);
 
       MPI_Recv(g->_xa0 + g->n_faces, n_recv,
                CS_MPI_REAL, dist_rank, tag, comm, &status);
@@ -2164,12 +2191,8 @@ _append_face_data(cs_grid_t   *g,
       g->_face_normal[face_id*3] = g->_face_normal[p_face_id*3];
       g->_face_normal[face_id*3 + 1] = g->_face_normal[p_face_id*3 + 1];
       g->_face_normal[face_id*3 + 2] = g->_face_normal[p_face_id*3 + 2];
-      if (g->symmetric == true)
-        g->_xa[face_id] = g->_xa[p_face_id];
-      else {
-        g->_xa[face_id*2] = g->_xa[p_face_id*2];
-        g->_xa[face_id*2+1] = g->_xa[p_face_id*2+1];
-      }
+      for (cs_lnum_t kk = 0; kk < xa_stride; kk++)
+        g->_xa[face_id*xa_stride + kk] = g->_xa[p_face_id*xa_stride + kk];
       g->_xa0[face_id] = g->_xa0[p_face_id];
       g->xa0ij[face_id*3] = g->xa0ij[p_face_id*3];
       g->xa0ij[face_id*3 + 1] = g->xa0ij[p_face_id*3 + 1];
@@ -2184,12 +2207,8 @@ _append_face_data(cs_grid_t   *g,
              g->merge_sub_root, tag, comm);
     BFT_FREE(g->_face_normal);
 
-    if (g->symmetric == true)
-      MPI_Send(g->_xa, n_faces, CS_MPI_REAL,
-               g->merge_sub_root, tag, comm);
-    else
-      MPI_Send(g->_xa, n_faces*2, CS_MPI_REAL,
-               g->merge_sub_root, tag, comm);
+    MPI_Send(g->_xa, n_faces*xa_stride, CS_MPI_REAL,
+             g->merge_sub_root, tag, comm);
     BFT_FREE(g->_xa);
 
     MPI_Send(g->_xa0, n_faces, CS_MPI_REAL,
@@ -2581,6 +2600,7 @@ _automatic_aggregation(const cs_grid_t  *fine_grid,
   cs_real_t *aggr_crit = NULL;
 
   const int *db_size = fine_grid->diag_block_size;
+  const int *eb_size = fine_grid->extra_diag_block_size;
   const cs_lnum_2_t *f_face_cells = fine_grid->face_cell;
   const cs_real_t *f_da = fine_grid->da;
   const cs_real_t *f_xa = fine_grid->xa;
@@ -2709,8 +2729,15 @@ _automatic_aggregation(const cs_grid_t  *fine_grid,
         /* the communication pattern and require a more complex algorithm). */
 
         if (ii < f_n_cells && jj < f_n_cells) {
-          f_xa1 = f_xa[c_face*isym];//TODO if f_xa1 is a block
-          f_xa2 = f_xa[(c_face +1)*isym -1];
+          if (eb_size[0] == 1) {
+            f_xa1 = f_xa[c_face*isym];
+            f_xa2 = f_xa[(c_face +1)*isym -1];
+          }
+          else {
+            f_xa1 = _eb_mean_diag(eb_size, f_xa + c_face*isym*eb_size[3]);
+            f_xa2 = _eb_mean_diag(eb_size,
+                                  f_xa + ((c_face +1)*isym -1)*eb_size[3]);
+          }
           /* TODO: remove these tests, or adimensionalize them */
           f_xa1 = CS_MAX(-f_xa1, 1.e-15);
           f_xa2 = CS_MAX(-f_xa2, 1.e-15);
@@ -3275,9 +3302,10 @@ _compute_coarse_quantities(const cs_grid_t  *fine_grid,
   cs_real_t *c_da = coarse_grid->_da;
   cs_real_t *c_xa = coarse_grid->_xa;
 
-  cs_real_t *w1 = NULL;
+  cs_real_t *w1 = NULL, *c_xa_s = NULL;
 
   const int *db_size = fine_grid->diag_block_size;
+  const int *eb_size = fine_grid->extra_diag_block_size;
 
   const cs_lnum_2_t *f_face_cell = fine_grid->face_cell;
   const cs_lnum_2_t *c_face_cell = coarse_grid->face_cell;
@@ -3292,6 +3320,15 @@ _compute_coarse_quantities(const cs_grid_t  *fine_grid,
   if (fine_grid->symmetric == true)
     isym = 1;
 
+  /* With full extra-diagonal blocks, scalar coefficients are first
+     computed as for the scalar case, then used to scale the
+     P0 restriction of the blocks */
+
+  if (eb_size[0] > 1) {
+    BFT_MALLOC(c_xa_s, c_n_faces*isym, cs_real_t);
+    c_xa = c_xa_s;
+  }
+
   /* P0 restriction of matrixes, "interior" surface: */
   /* xag0(nfacg), surfag(3,nfacgl), xagxg0(2,nfacg) */
 
@@ -3362,12 +3399,26 @@ _compute_coarse_quantities(const cs_grid_t  *fine_grid,
   for (ii = f_n_cells*db_size[3]; ii < f_n_cells_ext*db_size[3]; ii++)
     w1[ii] = 0.;
 
-  for (face_id = 0; face_id < f_n_faces; face_id++) {
-    ii = f_face_cell[face_id][0];
-    jj = f_face_cell[face_id][1];
-    for (kk = 0; kk < db_size[0]; kk++) {
-      w1[ii*db_size[3] + db_size[2]*kk + kk] += f_xa[face_id*isym];
-      w1[jj*db_size[3] + db_size[2]*kk + kk] += f_xa[(face_id +1)*isym -1];
+  if (eb_size[0] == 1) {
+    for (face_id = 0; face_id < f_n_faces; face_id++) {
+      ii = f_face_cell[face_id][0];
+      jj = f_face_cell[face_id][1];
+      for (kk = 0; kk < db_size[0]; kk++) {
+        w1[ii*db_size[3] + db_size[2]*kk + kk] += f_xa[face_id*isym];
+        w1[jj*db_size[3] + db_size[2]*kk + kk] += f_xa[(face_id +1)*isym -1];
+      }
+    }
+  }
+  else {
+    for (face_id = 0; face_id < f_n_faces; face_id++) {
+      ii = f_face_cell[face_id][0];
+      jj = f_face_cell[face_id][1];
+      const cs_real_t *f_xa_ij = f_xa + face_id*isym*eb_size[3];
+      const cs_real_t *f_xa_ji = f_xa + ((face_id +1)*isym -1)*eb_size[3];
+      for (kk = 0; kk < eb_size[3]; kk++) {
+        w1[ii*db_size[3] + kk] += f_xa_ij[kk];
+        w1[jj*db_size[3] + kk] += f_xa_ji[kk];
+      }
     }
   }
 
@@ -3455,6 +3506,59 @@ _compute_coarse_quantities(const cs_grid_t  *fine_grid,
   if (interp != 0 && interp != 1)
     bft_error(__FILE__, __LINE__, 0, "interp incorrectly defined.");
 
+  /* Extradiagonal blocks: P0 restriction of fine blocks, scaled by
+     the ratio of the scalar coefficients to their P0 restriction */
+
+  if (eb_size[0] > 1) {
+
+    c_xa = coarse_grid->_xa;
+
+#   pragma omp parallel for if(c_n_faces*isym*eb_size[3] > CS_THR_MIN)
+    for (c_face = 0; c_face < c_n_faces*isym*eb_size[3]; c_face++)
+      c_xa[c_face] = 0.;
+
+    for (face_id = 0; face_id < f_n_faces; face_id++) {
+
+      const cs_real_t *f_xa_ij = f_xa + face_id*isym*eb_size[3];
+      const cs_real_t *f_xa_ji = f_xa + ((face_id +1)*isym -1)*eb_size[3];
+
+      if (c_coarse_face[face_id] > 0) {
+        c_face = c_coarse_face[face_id] -1;
+        cs_real_t *c_xa_ij = c_xa + c_face*isym*eb_size[3];
+        cs_real_t *c_xa_ji = c_xa + ((c_face +1)*isym -1)*eb_size[3];
+        for (kk = 0; kk < eb_size[3]; kk++) {
+          c_xa_ij[kk] += f_xa_ij[kk];
+          if (isym == 2)
+            c_xa_ji[kk] += f_xa_ji[kk];
+        }
+      }
+      else if (c_coarse_face[face_id] < 0) {
+        c_face = -c_coarse_face[face_id] -1;
+        cs_real_t *c_xa_ij = c_xa + c_face*isym*eb_size[3];
+        cs_real_t *c_xa_ji = c_xa + ((c_face +1)*isym -1)*eb_size[3];
+        for (kk = 0; kk < eb_size[3]; kk++) {
+          c_xa_ij[kk] += f_xa_ji[kk];
+          if (isym == 2)
+            c_xa_ji[kk] += f_xa_ij[kk];
+        }
+      }
+
+    }
+
+    for (c_face = 0; c_face < c_n_faces; c_face++) {
+      for (jj = 0; jj < isym; jj++) {
+        cs_real_t r = 1.;
+        if (fabs(c_xa0[c_face]) > EPZERO)
+          r = c_xa_s[c_face*isym + jj] / c_xa0[c_face];
+        for (kk = 0; kk < eb_size[3]; kk++)
+          c_xa[(c_face*isym + jj)*eb_size[3] + kk] *= r;
+      }
+    }
+
+    BFT_FREE(c_xa_s);
+
+  }
+
   /* Diagonal term */
 
   if (db_size[0] == 1) {
@@ -3474,20 +3578,34 @@ _compute_coarse_quantities(const cs_grid_t  *fine_grid,
     }
   }
 
-  for (c_face = 0; c_face < c_n_faces; c_face++) {
-    ic = c_face_cell[c_face][0];
-    jc = c_face_cell[c_face][1];
-    for (kk = 0; kk < db_size[0]; kk++) {
-      c_da[ic*db_size[3] + db_size[2]*kk + kk] -= c_xa[c_face*isym];
-      c_da[jc*db_size[3] + db_size[2]*kk + kk] -= c_xa[(c_face +1)*isym -1];
+  if (eb_size[0] == 1) {
+    for (c_face = 0; c_face < c_n_faces; c_face++) {
+      ic = c_face_cell[c_face][0];
+      jc = c_face_cell[c_face][1];
+      for (kk = 0; kk < db_size[0]; kk++) {
+        c_da[ic*db_size[3] + db_size[2]*kk + kk] -= c_xa[c_face*isym];
+        c_da[jc*db_size[3] + db_size[2]*kk + kk] -= c_xa[(c_face +1)*isym -1];
+      }
+    }
+  }
+  else {
+    for (c_face = 0; c_face < c_n_faces; c_face++) {
+      ic = c_face_cell[c_face][0];
+      jc = c_face_cell[c_face][1];
+      const cs_real_t *c_xa_ij = c_xa + c_face*isym*eb_size[3];
+      const cs_real_t *c_xa_ji = c_xa + ((c_face +1)*isym -1)*eb_size[3];
+      for (kk = 0; kk < eb_size[3]; kk++) {
+        c_da[ic*db_size[3] + kk] -= c_xa_ij[kk];
+        c_da[jc*db_size[3] + kk] -= c_xa_ji[kk];
+      }
     }
   }
 
   BFT_FREE(w1);
 
-  /* Optional verification */
+  /* Optional verification (scalar extra-diagonal terms only) */
 
-  if (verbosity > 3)
+  if (verbosity > 3 && eb_size[0] == 1)
     _verify_coarse_quantities(fine_grid,
                               coarse_grid,
                               n_clips_min,
@@ -3865,6 +3983,97 @@ _compute_coarse_quantities_conv_diff(const cs_grid_t  *fine_grid,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Map base grid matrix coefficients and compute associated terms.
+ *
+ * This is used both when creating a base grid and when updating its
+ * coefficients for a new matrix with the same structure.
+ *
+ * parameters:
+ *   g      <-> base grid structure
+ *   a      <-- associated matrix
+ *   a_conv <-- associated matrix (convection), or NULL
+ *   a_diff <-- associated matrix (diffusion), or NULL
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_base_coefficients(cs_grid_t          *g,
+                       const cs_matrix_t  *a,
+                       const cs_matrix_t  *a_conv,
+                       const cs_matrix_t  *a_diff)
+{
+  cs_lnum_t ii, jj, kk, face_id;
+
+  const cs_lnum_t n_faces = g->n_faces;
+  const cs_lnum_2_t *face_cell = g->face_cell;
+  const cs_real_t *cell_cen = g->cell_cen;
+  const cs_real_t *xa = cs_matrix_get_extra_diagonal(a);
+
+  /* Set shared matrix coefficients */
+
+  g->da = cs_matrix_get_diagonal(a);
+  g->xa = xa;
+
+  if (g->conv_diff) {
+    g->da_conv = cs_matrix_get_diagonal(a_conv);
+    g->da_diff = cs_matrix_get_diagonal(a_diff);
+    g->xa_conv = cs_matrix_get_extra_diagonal(a_conv);
+    g->xa_diff = cs_matrix_get_extra_diagonal(a_diff);
+  }
+
+  /* Build symmetrized extra-diagonal terms if necessary,
+     or point to existing terms if already symmetric */
+
+  if (g->extra_diag_block_size[0] > 1) {
+    const int *eb_size = g->extra_diag_block_size;
+    BFT_REALLOC(g->_xa0, n_faces, cs_real_t);
+    if (g->symmetric == true) {
+      for (face_id = 0; face_id < n_faces; face_id++)
+        g->_xa0[face_id] = _eb_mean_diag(eb_size, xa + face_id*eb_size[3]);
+    }
+    else {
+      for (face_id = 0; face_id < n_faces; face_id++)
+        g->_xa0[face_id]
+          = 0.5 * (  _eb_mean_diag(eb_size, xa + face_id*2*eb_size[3])
+                   + _eb_mean_diag(eb_size, xa + (face_id*2+1)*eb_size[3]));
+    }
+    g->xa0 = g->_xa0;
+  }
+  else if (g->symmetric == true)
+    g->xa0 = g->xa;
+  else if (g->conv_diff) {
+    g->xa0  = g->xa;
+    g->xa0_conv = g->xa_conv;
+    g->xa0_diff = g->xa_diff;
+  }
+  else {
+    BFT_REALLOC(g->_xa0, n_faces, cs_real_t);
+    for (face_id = 0; face_id < n_faces; face_id++)
+      g->_xa0[face_id] = 0.5 * (xa[face_id*2] + xa[face_id*2+1]);
+    g->xa0 = g->_xa0;
+  }
+
+  /* Compute multigrid-specific terms */
+
+  BFT_REALLOC(g->xa0ij, n_faces*3, cs_real_t);
+
+  const cs_real_t *restrict g_xa0 = g->xa0;
+  if (g->conv_diff)
+    g_xa0 = g->xa0_diff;
+
+# pragma omp parallel for private(ii, jj, kk) if(n_faces > CS_THR_MIN)
+  for (face_id = 0; face_id < n_faces; face_id++) {
+    ii = face_cell[face_id][0];
+    jj = face_cell[face_id][1];
+    for (kk = 0; kk < 3; kk++) {
+      g->xa0ij[face_id*3 + kk] =   g_xa0[face_id]
+                                 * (cell_cen[jj*3 + kk] - cell_cen[ii*3 + kk]);
+    }
+  }
+
+  g->matrix = a;
+}
+
 /*============================================================================
  * Semi-private function definitions
  *
@@ -3917,15 +4126,10 @@ cs_grid_create_from_shared(cs_lnum_t              n_cells,
                            const cs_matrix_t     *a_conv,
                            const cs_matrix_t     *a_diff)
 {
-  cs_lnum_t ii, jj, kk, face_id;
+  cs_lnum_t ii;
 
   cs_grid_t *g = NULL;
 
-  const cs_real_t *da      = cs_matrix_get_diagonal(a);
-  const cs_real_t *xa      = cs_matrix_get_extra_diagonal(a);
-  const cs_real_t *da_conv = NULL, *da_diff = NULL;
-  const cs_real_t *xa_conv = NULL, *xa_diff = NULL;
-
   /* Create empty structure and map base data */
 
   g = _create_grid();
@@ -3934,13 +4138,8 @@ cs_grid_create_from_shared(cs_lnum_t              n_cells,
   g->conv_diff = false;
   g->symmetric = symmetric;
 
-  if (a_conv != NULL || a_diff != NULL) {
+  if (a_conv != NULL || a_diff != NULL)
     g->conv_diff = true;
-    da_conv = cs_matrix_get_diagonal(a_conv);
-    da_diff = cs_matrix_get_diagonal(a_diff);
-    xa_conv = cs_matrix_get_extra_diagonal(a_conv);
-    xa_diff = cs_matrix_get_extra_diagonal(a_diff);
-  }
 
   if (diag_block_size != NULL) {
     for (ii = 0; ii < 4; ii++)
@@ -3982,67 +4181,9 @@ cs_grid_create_from_shared(cs_lnum_t              n_cells,
 
   g->halo = halo;
 
-  /* Set shared matrix coefficients */
-
-  g->da = da;
-  g->_da = NULL;
-
-  if (g->conv_diff) {
-    g->da_conv = da_conv;
-    g->_da_conv = NULL;
-    g->da_diff = da_diff;
-    g->_da_diff = NULL;
-  }
-
-  g->xa = xa;
-  g->_xa = NULL;
-
-  if (g->conv_diff) {
-    g->xa_conv = xa_conv;
-    g->_xa_conv = NULL;
-    g->xa_diff = xa_diff;
-    g->_xa_diff = NULL;
-  }
-
-  /* Build symmetrized extra-diagonal terms if necessary,
-     or point to existing terms if already symmetric */
-
-  if (symmetric == true) {
-    g->xa0 = g->xa;
-    g->_xa0 = NULL;
-  }
-  else if (g->conv_diff) {
-    g->xa0  = g->xa;
-    g->_xa0 = NULL;
-    g->xa0_conv = g->xa_conv;
-    g->_xa0_conv = NULL;
-    g->xa0_diff = g->xa_diff;
-    g->_xa0_diff = NULL;
-  }
-  else {
-    BFT_MALLOC(g->_xa0, n_faces, cs_real_t);
-    for (face_id = 0; face_id < n_faces; face_id++)
-      g->_xa0[face_id] = 0.5 * (xa[face_id*2] + xa[face_id*2+1]);
-    g->xa0 = g->_xa0;
-  }
-
-  /* Compute multigrid-specific terms */
-
-  BFT_MALLOC(g->xa0ij, n_faces*3, cs_real_t);
+  /* Map shared matrix coefficients and compute derived terms */
 
-  const cs_real_t *restrict g_xa0 = g->xa0;
-  if (g->conv_diff)
-    g_xa0 = g->xa0_diff;
-
-# pragma omp parallel for private(ii, jj, kk) if(n_faces > CS_THR_MIN)
-  for (face_id = 0; face_id < n_faces; face_id++) {
-    ii = face_cell[face_id][0];
-    jj = face_cell[face_id][1];
-    for (kk = 0; kk < 3; kk++) {
-      g->xa0ij[face_id*3 + kk] =   g_xa0[face_id]
-                                 * (cell_cen[jj*3 + kk] - cell_cen[ii*3 + kk]);
-    }
-  }
+  _set_base_coefficients(g, a, a_conv, a_diff);
 
   g->matrix_struct = NULL;
   g->matrix = a;
@@ -4355,6 +4496,11 @@ cs_grid_coarsen(const cs_grid_t   *f,
 
   assert(f != NULL);
 
+  /* Full extra-diagonal blocks are not handled by the MSR format */
+
+  if (f->extra_diag_block_size[0] > 1)
+    coarse_matrix_type = CS_MATRIX_BSR;
+
   /* Initialization */
 
   c = _coarse_init(f);
@@ -4396,7 +4542,7 @@ cs_grid_coarsen(const cs_grid_t   *f,
     c->da_diff = c->_da_diff;
   }
 
-  BFT_MALLOC(c->_xa, c->n_faces*isym, cs_real_t);
+  BFT_MALLOC(c->_xa, c->n_faces*isym*c->extra_diag_block_size[3], cs_real_t);
   c->xa = c->_xa;
 
   if (conv_diff) {
@@ -4535,6 +4681,9 @@ cs_grid_coarsen(const cs_grid_t   *f,
   else
     c->_matrix = cs_matrix_create(c->matrix_struct);
 
+  if (_grid_mixed_precision)
+    cs_matrix_set_mixed_precision(c->_matrix, true);
+
   cs_matrix_set_coefficients(c->_matrix,
                              c->symmetric,
                              c->diag_block_size,
@@ -4551,6 +4700,105 @@ cs_grid_coarsen(const cs_grid_t   *f,
   return c;
 }
 
+/*----------------------------------------------------------------------------
+ * Update base grid matrix coefficients from shared matrices.
+ *
+ * The grid connectivity and geometry are unchanged, so the matrices must
+ * have the same structure as those used to create the grid.
+ *
+ * parameters:
+ *   g      <-> Base grid structure
+ *   a      <-- Associated matrix
+ *   a_conv <-- Associated matrix (convection), or NULL
+ *   a_diff <-- Associated matrix (diffusion), or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_update_from_shared(cs_grid_t          *g,
+                           const cs_matrix_t  *a,
+                           const cs_matrix_t  *a_conv,
+                           const cs_matrix_t  *a_diff)
+{
+  assert(g != NULL && g->level == 0);
+  assert(g->conv_diff == (a_conv != NULL || a_diff != NULL));
+
+  _set_base_coefficients(g, a, a_conv, a_diff);
+}
+
+/*----------------------------------------------------------------------------
+ * Indicate whether ranks were merged when building a given grid.
+ *
+ * parameters:
+ *   g <-- Grid structure
+ *
+ * returns:
+ *   true if grid data was merged from several ranks, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_is_merged(const cs_grid_t  *g)
+{
+  bool retval = false;
+
+#if defined(HAVE_MPI)
+  if (g->parent != NULL) {
+    if (g->next_merge_stride > g->parent->next_merge_stride)
+      retval = true;
+  }
+#endif
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Update coarse grid matrix coefficients from fine grid.
+ *
+ * The coarsening (fine -> coarse cell and face connectivity), coarse halo
+ * and coarse matrix structure of a grid built by cs_grid_coarsen() are
+ * kept; only the coarse matrix coefficients are recomputed, based on the
+ * current fine grid coefficients. This is not possible for grids built
+ * by merging ranks (see cs_grid_is_merged()).
+ *
+ * parameters:
+ *   f                    <-- Fine grid structure
+ *   c                    <-> Coarse grid structure
+ *   verbosity            <-- Verbosity level
+ *   relaxation_parameter <-- P0/P1 relaxation factor
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_update_coarse(const cs_grid_t  *f,
+                      cs_grid_t        *c,
+                      int               verbosity,
+                      double            relaxation_parameter)
+{
+  assert(c->parent == f);
+
+  if (cs_grid_is_merged(c))
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: coefficients of grid level %d can not be updated,\n"
+                "as that grid was built by merging ranks."),
+              __func__, c->level);
+
+  if (c->conv_diff)
+    _compute_coarse_quantities_conv_diff(f, c, relaxation_parameter, verbosity);
+  else
+    _compute_coarse_quantities(f, c, relaxation_parameter, verbosity);
+
+  if (c->halo != NULL)
+    cs_halo_sync_var_strided(c->halo, CS_HALO_STANDARD,
+                             c->_da, c->diag_block_size[3]);
+
+  cs_matrix_set_coefficients(c->_matrix,
+                             c->symmetric,
+                             c->diag_block_size,
+                             c->extra_diag_block_size,
+                             c->n_faces,
+                             c->face_cell,
+                             c->da,
+                             c->xa);
+}
+
 /*----------------------------------------------------------------------------
  * Compute coarse cell variable values from fine cell values
  *
@@ -4988,6 +5236,7 @@ cs_grid_project_diag_dom(const cs_grid_t  *g,
 
   cs_real_t *dd = NULL;
   const int *db_size = g->diag_block_size;
+  const int *eb_size = g->extra_diag_block_size;
 
   assert(g != NULL);
   assert(diag_dom != NULL);
@@ -5016,7 +5265,25 @@ cs_grid_project_diag_dom(const cs_grid_t  *g,
     if (g->halo != NULL)
       cs_halo_sync_var_strided(g->halo, CS_HALO_STANDARD, dd, db_size[3]);
 
-    if (g->symmetric) {
+    if (eb_size[0] > 1) {
+      const cs_lnum_t isym = (g->symmetric) ? 1 : 2;
+      for (face_id = 0; face_id < n_faces; face_id++) {
+        ii = face_cel[face_id][0];
+        jj = face_cel[face_id][1];
+        const cs_real_t *xa_ij = g->xa + face_id*isym*eb_size[3];
+        const cs_real_t *xa_ji = g->xa + ((face_id +1)*isym -1)*eb_size[3];
+
+        for (i = 0; i < db_size[0]; i++) {
+          for (j = 0; j < eb_size[0]; j++) {
+            dd[ii*db_size[3] + db_size[2]*i + i]
+              -= fabs(xa_ij[eb_size[2]*i + j]);
+            dd[jj*db_size[3] + db_size[2]*i + i]
+              -= fabs(xa_ji[eb_size[2]*i + j]);
+          }
+        }
+      }
+    }
+    else if (g->symmetric) {
       for (face_id = 0; face_id < n_faces; face_id++) {
         ii = face_cel[face_id][0];
         jj = face_cel[face_id][1];
@@ -5362,6 +5629,44 @@ cs_grid_set_matrix_variant(cs_matrix_fill_type_t       fill_type,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set whether multigrid coarse mesh matrices should store their
+ *        extra-diagonal coefficients in single precision.
+ *
+ * Diagonal coefficients and vectors remain in double precision, and
+ * products are accumulated in double precision, so this mostly reduces
+ * memory bandwidth for the smoothers and coarse solvers. The finest mesh
+ * (level 0) is not affected. This is currently only effective for
+ * coarse matrices in MSR format with scalar extra-diagonal coefficients.
+ *
+ * \param[in]  mixed  true to use single precision coarse extra-diagonal
+ *                    coefficients, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_grid_set_mixed_precision(bool  mixed)
+{
+  _grid_mixed_precision = mixed;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query whether multigrid coarse mesh matrices store their
+ *        extra-diagonal coefficients in single precision.
+ *
+ * \return  true if single precision coarse extra-diagonal coefficients
+ *          are used, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_grid_get_mixed_precision(void)
+{
+  return _grid_mixed_precision;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Log the current settings for multigrid parallel merging.
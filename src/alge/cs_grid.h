@@ -259,6 +259,60 @@ cs_grid_coarsen(const cs_grid_t  *f,
                 int               aggregation_limit,
                 double            relaxation_parameter);
 
+/*----------------------------------------------------------------------------
+ * Update base grid matrix coefficients from shared matrices.
+ *
+ * The grid connectivity and geometry are unchanged, so the matrices must
+ * have the same structure as those used to create the grid.
+ *
+ * parameters:
+ *   g      <-> Base grid structure
+ *   a      <-- Associated matrix
+ *   a_conv <-- Associated matrix (convection), or NULL
+ *   a_diff <-- Associated matrix (diffusion), or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_update_from_shared(cs_grid_t          *g,
+                           const cs_matrix_t  *a,
+                           const cs_matrix_t  *a_conv,
+                           const cs_matrix_t  *a_diff);
+
+/*----------------------------------------------------------------------------
+ * Indicate whether ranks were merged when building a given grid.
+ *
+ * parameters:
+ *   g <-- Grid structure
+ *
+ * returns:
+ *   true if grid data was merged from several ranks, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_is_merged(const cs_grid_t  *g);
+
+/*----------------------------------------------------------------------------
+ * Update coarse grid matrix coefficients from fine grid.
+ *
+ * The coarsening (fine -> coarse cell and face connectivity), coarse halo
+ * and coarse matrix structure of a grid built by cs_grid_coarsen() are
+ * kept; only the coarse matrix coefficients are recomputed, based on the
+ * current fine grid coefficients. This is not possible for grids built
+ * by merging ranks (see cs_grid_is_merged()).
+ *
+ * parameters:
+ *   f                    <-- Fine grid structure
+ *   c                    <-> Coarse grid structure
+ *   verbosity            <-- Verbosity level
+ *   relaxation_parameter <-- P0/P1 relaxation factor
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_update_coarse(const cs_grid_t  *f,
+                      cs_grid_t        *c,
+                      int               verbosity,
+                      double            relaxation_parameter);
+
 /*----------------------------------------------------------------------------
  * Compute coarse cell variable values from fine cell values
  *
@@ -476,6 +530,35 @@ cs_grid_set_matrix_variant(cs_matrix_fill_type_t       fill_type,
                            int                         level,
                            const cs_matrix_variant_t  *mv);
 
+/*----------------------------------------------------------------------------
+ * Set whether multigrid coarse mesh matrices should store their
+ * extra-diagonal coefficients in single precision.
+ *
+ * Diagonal coefficients and vectors remain in double precision, and
+ * products are accumulated in double precision. The finest mesh (level 0)
+ * is not affected. This is currently only effective for coarse matrices
+ * in MSR format with scalar extra-diagonal coefficients.
+ *
+ * parameters:
+ *   mixed <-- true to use single precision coarse extra-diagonal
+ *             coefficients, false otherwise
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_set_mixed_precision(bool  mixed);
+
+/*----------------------------------------------------------------------------
+ * Query whether multigrid coarse mesh matrices store their
+ * extra-diagonal coefficients in single precision.
+ *
+ * returns:
+ *   true if single precision coarse extra-diagonal coefficients are used,
+ *   false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_get_mixed_precision(void);
+
 /*----------------------------------------------------------------------------
  * Log the current settings for multigrid parallel merging.
  *----------------------------------------------------------------------------*/
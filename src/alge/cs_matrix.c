@@ -115,6 +115,16 @@ BEGIN_C_DECLS
 /* Note that most types are declared in cs_matrix_priv.h.
    only those only handled here are declared here. */
 
+/* Partial (row range) local matrix.vector product, for CSR-based formats */
+
+typedef void
+(cs_matrix_vector_product_rows_t) (bool                exclude_diag,
+                                   const cs_matrix_t  *matrix,
+                                   cs_lnum_t           s_id,
+                                   cs_lnum_t           e_id,
+                                   const cs_real_t    *restrict x,
+                                   cs_real_t          *restrict y);
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -124,7 +134,10 @@ BEGIN_C_DECLS
 const char  *cs_matrix_type_name[] = {N_("native"),
                                       N_("CSR"),
                                       N_("symmetric CSR"),
-                                      N_("MSR")};
+                                      N_("MSR"),
+                                      N_("SELL"),
+                                      N_("BSR"),
+                                      N_("matrix-free")};
 
 /* Full names for matrix types */
 
@@ -132,7 +145,10 @@ const char
 *cs_matrix_type_fullname[] = {N_("diagonal + faces"),
                               N_("Compressed Sparse Row"),
                               N_("symmetric Compressed Sparse Row"),
-                              N_("Modified Compressed Sparse Row")};
+                              N_("Modified Compressed Sparse Row"),
+                              N_("Sliced ELLPACK (SELL-C-sigma)"),
+                              N_("Block Compressed Sparse Row"),
+                              N_("matrix-free (face fluxes)")};
 
 /* Fill type names for matrices */
 
@@ -143,6 +159,11 @@ const char  *cs_matrix_fill_type_name[] = {"CS_MATRIX_SCALAR",
                                            "CS_MATRIX_BLOCK_D_SYM",
                                            "CS_MATRIX_BLOCK"};
 
+/* Overlap halo exchange with the local matrix.vector product of rows
+   which do not reference ghost values, when possible */
+
+static bool _halo_overlap = false;
+
 #if defined (HAVE_MKL)
 
 static char _no_exclude_diag_error_str[]
@@ -850,7 +871,7 @@ _release_coeffs_native(cs_matrix_t  *matrix)
 }
 
 /*----------------------------------------------------------------------------
- * Copy diagonal of native or MSR matrix.
+ * Copy diagonal of native, MSR, SELL, BSR, or matrix-free matrix.
  *
  * parameters:
  *   matrix <-- pointer to matrix structure
@@ -866,10 +887,16 @@ _copy_diagonal_separate(const cs_matrix_t  *matrix,
     const cs_matrix_coeff_native_t  *mc = matrix->coeffs;
     _da = mc->da;
   }
-  else if (matrix->type == CS_MATRIX_MSR) {
+  else if (   matrix->type == CS_MATRIX_MSR
+           || matrix->type == CS_MATRIX_SELL
+           || matrix->type == CS_MATRIX_BSR) {
     const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
     _da = mc->d_val;
   }
+  else if (matrix->type == CS_MATRIX_FREE) {
+    const cs_matrix_coeff_free_t  *mc = matrix->coeffs;
+    _da = mc->da;
+  }
   const cs_lnum_t  n_rows = matrix->n_rows;
 
   /* Unblocked version */
@@ -1726,6 +1753,39 @@ _mat_vec_p_l_native_vector(bool                exclude_diag,
 
 #endif /* Vector machine variant */
 
+/*----------------------------------------------------------------------------
+ * Count leading rows of a CSR structure with no ghost column.
+ *
+ * When cells adjacent to the halo are numbered last (see
+ * cs_renumber_set_algorithm()), this covers all rows whose matrix.vector
+ * product does not depend on ghost values.
+ *
+ * parameters:
+ *   n_rows    <-- local number of rows
+ *   row_index <-- row index (0 to n-1)
+ *   col_id    <-- column id (0 to n-1)
+ *
+ * returns:
+ *   number of leading rows not referencing ghost columns
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_n_rows_no_ghost(cs_lnum_t         n_rows,
+                 const cs_lnum_t  *row_index,
+                 const cs_lnum_t  *col_id)
+{
+  cs_lnum_t ii;
+
+  for (ii = 0; ii < n_rows; ii++) {
+    for (cs_lnum_t jj = row_index[ii]; jj < row_index[ii+1]; jj++) {
+      if (col_id[jj] >= n_rows)
+        return ii;
+    }
+  }
+
+  return ii;
+}
+
 /*----------------------------------------------------------------------------
  * Destroy a CSR matrix structure.
  *
@@ -1902,6 +1962,10 @@ _create_struct_csr(bool                have_diag,
   ms->row_index = ms->_row_index;
   ms->col_id = ms->_col_id;
 
+  ms->n_rows_no_ghost = _n_rows_no_ghost(ms->n_rows,
+                                         ms->row_index,
+                                         ms->col_id);
+
   return ms;
 }
 
@@ -1967,6 +2031,10 @@ _create_struct_csr_from_csr(bool         have_diag,
 
   }
 
+  ms->n_rows_no_ghost = _n_rows_no_ghost(ms->n_rows,
+                                         ms->row_index,
+                                         ms->col_id);
+
   return ms;
 }
 
@@ -2012,6 +2080,10 @@ _create_struct_csr_from_shared(bool              have_diag,
   ms->_row_index = NULL;
   ms->_col_id = NULL;
 
+  ms->n_rows_no_ghost = _n_rows_no_ghost(ms->n_rows,
+                                         ms->row_index,
+                                         ms->col_id);
+
   return ms;
 }
 
@@ -2592,29 +2664,34 @@ _copy_diagonal_csr(const cs_matrix_t  *matrix,
 /*----------------------------------------------------------------------------
  * Local matrix.vector product y = A.x with CSR matrix.
  *
+ * Only rows s_id to e_id - 1 are computed.
+ *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
  *   matrix       <-- pointer to matrix structure
+ *   s_id         <-- id of first row to compute
+ *   e_id         <-- id of past-the-end row to compute
  *   x            <-- multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
-_mat_vec_p_l_csr(bool                exclude_diag,
-                 const cs_matrix_t  *matrix,
-                 const cs_real_t    *restrict x,
-                 cs_real_t          *restrict y)
+_mat_vec_p_l_csr_rows(bool                exclude_diag,
+                      const cs_matrix_t  *matrix,
+                      cs_lnum_t           s_id,
+                      cs_lnum_t           e_id,
+                      const cs_real_t    *restrict x,
+                      cs_real_t          *restrict y)
 {
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
   const cs_matrix_coeff_csr_t  *mc = matrix->coeffs;
-  cs_lnum_t  n_rows = ms->n_rows;
 
   /* Standard case */
 
   if (!exclude_diag) {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+#   pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
 
       const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
       const cs_real_t *restrict m_row = mc->val + ms->row_index[ii];
@@ -2634,8 +2711,8 @@ _mat_vec_p_l_csr(bool                exclude_diag,
 
   else {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+#   pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
 
       const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
       const cs_real_t *restrict m_row = mc->val + ms->row_index[ii];
@@ -2654,6 +2731,25 @@ _mat_vec_p_l_csr(bool                exclude_diag,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with CSR matrix.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_csr(bool                exclude_diag,
+                 const cs_matrix_t  *matrix,
+                 const cs_real_t    *restrict x,
+                 cs_real_t          *restrict y)
+{
+  _mat_vec_p_l_csr_rows(exclude_diag, matrix, 0, matrix->n_rows, x, y);
+}
+
 #if defined (HAVE_MKL)
 
 static void
@@ -3273,12 +3369,16 @@ _create_coeff_msr(void)
   mc->max_db_size = 0;
   mc->max_eb_size = 0;
 
+  mc->x_float = false;
+
   mc->d_val = NULL;
   mc->x_val = NULL;
 
   mc->_d_val = NULL;
   mc->_x_val = NULL;
 
+  mc->_x_val_f = NULL;
+
   return mc;
 }
 
@@ -3296,6 +3396,7 @@ _destroy_coeff_msr(cs_matrix_coeff_msr_t  **coeff)
 
     cs_matrix_coeff_msr_t  *mc = *coeff;
 
+    BFT_FREE(mc->_x_val_f);
     BFT_FREE(mc->_x_val);
 
     BFT_FREE(mc->_d_val);
@@ -3618,6 +3719,40 @@ _map_or_copy_xa_coeffs_msr(cs_matrix_t      *matrix,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Convert MSR matrix extra diagonal coefficients to single precision
+ * if required.
+ *
+ * Only scalar extradiagonal coefficients are handled; the double precision
+ * coefficients are released once converted.
+ *
+ * parameters:
+ *   matrix           <-> pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_x_coeffs_msr_to_float(cs_matrix_t  *matrix)
+{
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_lnum_t n_rows = matrix->n_rows;
+
+  if (mc->x_float == false || matrix->eb_size[3] != 1 || mc->x_val == NULL)
+    return;
+
+  BFT_REALLOC(mc->_x_val_f, ms->row_index[n_rows], float);
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    for (cs_lnum_t jj = ms->row_index[ii]; jj < ms->row_index[ii+1]; jj++)
+      mc->_x_val_f[jj] = mc->x_val[jj];
+  }
+
+  mc->x_val = NULL;
+  BFT_FREE(mc->_x_val);
+}
+
 /*----------------------------------------------------------------------------
  * Set MSR matrix coefficients.
  *
@@ -3669,6 +3804,8 @@ _set_coeffs_msr(cs_matrix_t         *matrix,
       _set_xa_coeffs_msr_increment(matrix, symmetric, n_edges, edges, xa);
 
   }
+
+  _x_coeffs_msr_to_float(matrix);
 }
 
 /*----------------------------------------------------------------------------
@@ -3741,6 +3878,8 @@ _set_coeffs_msr_from_msr(cs_matrix_t       *matrix,
   if (x_transferred == false)
     _map_or_copy_xa_coeffs_msr(matrix, copy, x_vals);
 
+  _x_coeffs_msr_to_float(matrix);
+
   /* Now free transferred arrays */
 
   if (d_vals_transfer != NULL)
@@ -3770,29 +3909,34 @@ _release_coeffs_msr(cs_matrix_t  *matrix)
 /*----------------------------------------------------------------------------
  * Local matrix.vector product y = A.x with MSR matrix.
  *
+ * Only rows s_id to e_id - 1 are computed.
+ *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
  *   matrix       <-- pointer to matrix structure
+ *   s_id         <-- id of first row to compute
+ *   e_id         <-- id of past-the-end row to compute
  *   x            <-- multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
-_mat_vec_p_l_msr(bool                exclude_diag,
-                 const cs_matrix_t  *matrix,
-                 const cs_real_t    *restrict x,
-                 cs_real_t          *restrict y)
+_mat_vec_p_l_msr_rows(bool                exclude_diag,
+                      const cs_matrix_t  *matrix,
+                      cs_lnum_t           s_id,
+                      cs_lnum_t           e_id,
+                      const cs_real_t    *restrict x,
+                      cs_real_t          *restrict y)
 {
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
   const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
-  cs_lnum_t  n_rows = ms->n_rows;
 
   /* Standard case */
 
   if (!exclude_diag && mc->d_val != NULL) {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+#   pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
 
       const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
       const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
@@ -3812,8 +3956,8 @@ _mat_vec_p_l_msr(bool                exclude_diag,
 
   else {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+#   pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
 
       const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
       const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
@@ -3830,6 +3974,25 @@ _mat_vec_p_l_msr(bool                exclude_diag,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr(bool                exclude_diag,
+                 const cs_matrix_t  *matrix,
+                 const cs_real_t    *restrict x,
+                 cs_real_t          *restrict y)
+{
+  _mat_vec_p_l_msr_rows(exclude_diag, matrix, 0, matrix->n_rows, x, y);
+}
+
 /*----------------------------------------------------------------------------
  * Local matrix.vector product y = A.x with MSR matrix.
  *
@@ -3941,30 +4104,35 @@ _mat_vec_p_l_msr_omp_sched(bool                exclude_diag,
 /*----------------------------------------------------------------------------
  * Local matrix.vector product y = A.x with MSR matrix, blocked version.
  *
+ * Only rows s_id to e_id - 1 are computed.
+ *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
  *   matrix       <-- pointer to matrix structure
+ *   s_id         <-- id of first row to compute
+ *   e_id         <-- id of past-the-end row to compute
  *   x            <-- multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
-_b_mat_vec_p_l_msr_generic(bool                exclude_diag,
-                           const cs_matrix_t  *matrix,
-                           const cs_real_t    *restrict x,
-                           cs_real_t          *restrict y)
+_b_mat_vec_p_l_msr_generic_rows(bool                exclude_diag,
+                                const cs_matrix_t  *matrix,
+                                cs_lnum_t           s_id,
+                                cs_lnum_t           e_id,
+                                const cs_real_t    *restrict x,
+                                cs_real_t          *restrict y)
 {
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
   const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
-  const cs_lnum_t  n_rows = ms->n_rows;
   const int *db_size = matrix->db_size;
 
   /* Standard case */
 
   if (!exclude_diag && mc->d_val != NULL) {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+#   pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
 
       const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
       const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
@@ -3987,8 +4155,8 @@ _b_mat_vec_p_l_msr_generic(bool                exclude_diag,
 
   else {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+#   pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
 
       const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
       const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
@@ -4009,25 +4177,49 @@ _b_mat_vec_p_l_msr_generic(bool                exclude_diag,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, blocked version.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_msr_generic(bool                exclude_diag,
+                           const cs_matrix_t  *matrix,
+                           const cs_real_t    *restrict x,
+                           cs_real_t          *restrict y)
+{
+  _b_mat_vec_p_l_msr_generic_rows(exclude_diag, matrix, 0, matrix->n_rows, x, y);
+}
+
 /*----------------------------------------------------------------------------
  * Local matrix.vector product y = A.x with MSR matrix, 3x3 blocked version.
  *
+ * Only rows s_id to e_id - 1 are computed.
+ *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
  *   matrix       <-- pointer to matrix structure
+ *   s_id         <-- id of first row to compute
+ *   e_id         <-- id of past-the-end row to compute
  *   x            <-- multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
-_3_3_mat_vec_p_l_msr(bool                exclude_diag,
-                     const cs_matrix_t  *matrix,
-                     const cs_real_t    *restrict x,
-                     cs_real_t          *restrict y)
+_3_3_mat_vec_p_l_msr_rows(bool                exclude_diag,
+                          const cs_matrix_t  *matrix,
+                          cs_lnum_t           s_id,
+                          cs_lnum_t           e_id,
+                          const cs_real_t    *restrict x,
+                          cs_real_t          *restrict y)
 {
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
   const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
-  const cs_lnum_t  n_rows = ms->n_rows;
 
   assert(matrix->db_size[0] == 3 && matrix->db_size[3] == 9);
 
@@ -4035,8 +4227,8 @@ _3_3_mat_vec_p_l_msr(bool                exclude_diag,
 
   if (!exclude_diag && mc->d_val != NULL) {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+#   pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
 
       const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
       const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
@@ -4057,8 +4249,8 @@ _3_3_mat_vec_p_l_msr(bool                exclude_diag,
 
   else {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+#   pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
 
       const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
       const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
@@ -4078,7 +4270,7 @@ _3_3_mat_vec_p_l_msr(bool                exclude_diag,
 }
 
 /*----------------------------------------------------------------------------
- * Local matrix.vector product y = A.x with MSR matrix, 6x6 blocked version.
+ * Local matrix.vector product y = A.x with MSR matrix, 3x3 blocked version.
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
@@ -4088,14 +4280,38 @@ _3_3_mat_vec_p_l_msr(bool                exclude_diag,
  *----------------------------------------------------------------------------*/
 
 static void
-_6_6_mat_vec_p_l_msr(bool                exclude_diag,
+_3_3_mat_vec_p_l_msr(bool                exclude_diag,
                      const cs_matrix_t  *matrix,
                      const cs_real_t    *restrict x,
                      cs_real_t          *restrict y)
+{
+  _3_3_mat_vec_p_l_msr_rows(exclude_diag, matrix, 0, matrix->n_rows, x, y);
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, 6x6 blocked version.
+ *
+ * Only rows s_id to e_id - 1 are computed.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   s_id         <-- id of first row to compute
+ *   e_id         <-- id of past-the-end row to compute
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_6_6_mat_vec_p_l_msr_rows(bool                exclude_diag,
+                          const cs_matrix_t  *matrix,
+                          cs_lnum_t           s_id,
+                          cs_lnum_t           e_id,
+                          const cs_real_t    *restrict x,
+                          cs_real_t          *restrict y)
 {
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
   const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
-  const cs_lnum_t  n_rows = ms->n_rows;
 
   assert(matrix->db_size[0] == 6 && matrix->db_size[3] == 36);
 
@@ -4103,8 +4319,8 @@ _6_6_mat_vec_p_l_msr(bool                exclude_diag,
 
   if (!exclude_diag && mc->d_val != NULL) {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+#   pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
 
       const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
       const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
@@ -4125,8 +4341,8 @@ _6_6_mat_vec_p_l_msr(bool                exclude_diag,
 
   else {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+#   pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
 
       const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
       const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
@@ -4145,6 +4361,58 @@ _6_6_mat_vec_p_l_msr(bool                exclude_diag,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, 6x6 blocked version.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_6_6_mat_vec_p_l_msr(bool                exclude_diag,
+                     const cs_matrix_t  *matrix,
+                     const cs_real_t    *restrict x,
+                     cs_real_t          *restrict y)
+{
+  _6_6_mat_vec_p_l_msr_rows(exclude_diag, matrix, 0, matrix->n_rows, x, y);
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, blocked version.
+ *
+ * This variant uses fixed block size variants for common cases.
+ * Only rows s_id to e_id - 1 are computed.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   s_id         <-- id of first row to compute
+ *   e_id         <-- id of past-the-end row to compute
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_msr_rows(bool                exclude_diag,
+                        const cs_matrix_t  *matrix,
+                        cs_lnum_t           s_id,
+                        cs_lnum_t           e_id,
+                        const cs_real_t    *restrict x,
+                        cs_real_t          *restrict y)
+{
+  if (matrix->db_size[0] == 3 && matrix->db_size[3] == 9)
+    _3_3_mat_vec_p_l_msr_rows(exclude_diag, matrix, s_id, e_id, x, y);
+
+  else if (matrix->db_size[0] == 6 && matrix->db_size[3] == 36)
+    _6_6_mat_vec_p_l_msr_rows(exclude_diag, matrix, s_id, e_id, x, y);
+
+  else
+    _b_mat_vec_p_l_msr_generic_rows(exclude_diag, matrix, s_id, e_id, x, y);
+}
+
 /*----------------------------------------------------------------------------
  * Local matrix.vector product y = A.x with MSR matrix, blocked version.
  *
@@ -4174,7 +4442,8 @@ _b_mat_vec_p_l_msr(bool                exclude_diag,
 }
 
 /*----------------------------------------------------------------------------
- * Local matrix.vector product y = A.x with MSR matrix, using MKL
+ * Local matrix.vector product y = A.x with MSR matrix, with extra-diagonal
+ * coefficients stored in single precision.
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
@@ -4183,40 +4452,1346 @@ _b_mat_vec_p_l_msr(bool                exclude_diag,
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
-#if defined (HAVE_MKL)
-
 static void
-_mat_vec_p_l_msr_mkl(bool                exclude_diag,
-                     const cs_matrix_t  *matrix,
-                     const cs_real_t    *restrict x,
-                     cs_real_t          *restrict y)
+_mat_vec_p_l_msr_f(bool                exclude_diag,
+                   const cs_matrix_t  *matrix,
+                   const cs_real_t    *restrict x,
+                   cs_real_t          *restrict y)
 {
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
   const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = ms->n_rows;
 
-  int n_rows = ms->n_rows;
-  char transa[] = "n";
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
 
-  mkl_cspblas_dcsrgemv(transa,
-                       &n_rows,
-                       mc->x_val,
-                       ms->row_index,
-                       ms->col_id,
-                       (double *)x,
-                       y);
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
 
-  /* Add diagonal contribution */
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const float *restrict m_row = mc->_x_val_f + ms->row_index[ii];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+    cs_real_t sii = 0.0;
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+      sii += (m_row[jj]*x[col_id[jj]]);
+
+    if (d_val != NULL)
+      y[ii] = sii + d_val[ii]*x[ii];
+    else
+      y[ii] = sii;
 
-  if (!exclude_diag && mc->d_val != NULL) {
-    cs_lnum_t ii;
-    const double *restrict da = mc->d_val;
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (ii = 0; ii < n_rows; ii++)
-      y[ii] += da[ii] * x[ii];
   }
 }
 
-#endif /* defined (HAVE_MKL) */
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, blocked version,
+ * with extra-diagonal coefficients stored in single precision.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_msr_f(bool                exclude_diag,
+                     const cs_matrix_t  *matrix,
+                     const cs_real_t    *restrict x,
+                     cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const int *db_size = matrix->db_size;
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
+
+# pragma omp parallel for  if(n_rows*db_size[0] > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const float *restrict m_row = mc->_x_val_f + ms->row_index[ii];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+    if (d_val != NULL)
+      _dense_b_ax(ii, db_size, d_val, x, y);
+    else {
+      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+        y[ii*db_size[1] + kk] = 0.;
+    }
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+        y[ii*db_size[1] + kk]
+          += (m_row[jj]*x[col_id[jj]*db_size[1] + kk]);
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, using MKL
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+#if defined (HAVE_MKL)
+
+static void
+_mat_vec_p_l_msr_mkl(bool                exclude_diag,
+                     const cs_matrix_t  *matrix,
+                     const cs_real_t    *restrict x,
+                     cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  int n_rows = ms->n_rows;
+  char transa[] = "n";
+
+  mkl_cspblas_dcsrgemv(transa,
+                       &n_rows,
+                       mc->x_val,
+                       ms->row_index,
+                       ms->col_id,
+                       (double *)x,
+                       y);
+
+  /* Add diagonal contribution */
+
+  if (!exclude_diag && mc->d_val != NULL) {
+    cs_lnum_t ii;
+    const double *restrict da = mc->d_val;
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (ii = 0; ii < n_rows; ii++)
+      y[ii] += da[ii] * x[ii];
+  }
+}
+
+#endif /* defined (HAVE_MKL) */
+
+/*----------------------------------------------------------------------------
+ * Destroy a SELL matrix structure.
+ *
+ * parameters:
+ *   matrix  <->  pointer to SELL matrix structure pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_destroy_struct_sell(cs_matrix_struct_sell_t  **matrix)
+{
+  if (matrix != NULL && *matrix !=NULL) {
+
+    cs_matrix_struct_sell_t  *ms = *matrix;
+
+    BFT_FREE(ms->row_index);
+    BFT_FREE(ms->row_id);
+    BFT_FREE(ms->row_pos);
+    BFT_FREE(ms->chunk_index);
+    BFT_FREE(ms->col_id);
+
+    BFT_FREE(ms);
+
+    *matrix = NULL;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Create a SELL matrix structure from a native matrix stucture.
+ *
+ * A CSR structure (without diagonal) is first built, then rows are
+ * sorted by decreasing length inside windows of CS_MATRIX_SELL_SIGMA rows,
+ * and grouped in slices of CS_MATRIX_SELL_C rows.
+ *
+ * parameters:
+ *   n_rows      <-- number of local rows
+ *   n_cols_ext  <-- number of local + ghost columns
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *
+ * returns:
+ *   pointer to allocated SELL matrix structure.
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_struct_sell_t *
+_create_struct_sell(cs_lnum_t           n_rows,
+                    cs_lnum_t           n_cols_ext,
+                    cs_lnum_t           n_edges,
+                    const cs_lnum_2_t  *edges)
+{
+  const cs_lnum_t c_size = CS_MATRIX_SELL_C;
+
+  cs_matrix_struct_csr_t  *ms_csr = _create_struct_csr(false,
+                                                       n_rows,
+                                                       n_cols_ext,
+                                                       n_edges,
+                                                       edges);
+
+  cs_matrix_struct_sell_t  *ms;
+
+  BFT_MALLOC(ms, 1, cs_matrix_struct_sell_t);
+
+  ms->n_rows = n_rows;
+  ms->n_cols_ext = n_cols_ext;
+  ms->n_chunks = (n_rows + c_size - 1) / c_size;
+
+  ms->direct_assembly = ms_csr->direct_assembly;
+
+  /* Keep CSR row index (giving row lengths) */
+
+  ms->row_index = ms_csr->_row_index;
+  ms_csr->_row_index = NULL;
+
+  const cs_lnum_t  *row_index = ms->row_index;
+
+  /* Sort rows by decreasing length inside each sorting window
+     (stable insertion sort, as windows are small) */
+
+  BFT_MALLOC(ms->row_id, n_rows, cs_lnum_t);
+  BFT_MALLOC(ms->row_pos, n_rows, cs_lnum_t);
+
+  for (cs_lnum_t s_id = 0; s_id < n_rows; s_id += CS_MATRIX_SELL_SIGMA) {
+    cs_lnum_t e_id = CS_MIN(s_id + CS_MATRIX_SELL_SIGMA, n_rows);
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+      cs_lnum_t n_cols = row_index[ii+1] - row_index[ii];
+      cs_lnum_t jj = ii;
+      while (jj > s_id) {
+        cs_lnum_t kk = ms->row_id[jj-1];
+        if (row_index[kk+1] - row_index[kk] >= n_cols)
+          break;
+        ms->row_id[jj] = kk;
+        jj--;
+      }
+      ms->row_id[jj] = ii;
+    }
+  }
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    ms->row_pos[ms->row_id[ii]] = ii;
+
+  /* Build slice index, based on longest row of each slice */
+
+  BFT_MALLOC(ms->chunk_index, ms->n_chunks + 1, cs_lnum_t);
+
+  ms->chunk_index[0] = 0;
+
+  for (cs_lnum_t c_id = 0; c_id < ms->n_chunks; c_id++) {
+    cs_lnum_t s_id = c_id*c_size;
+    cs_lnum_t e_id = CS_MIN(s_id + c_size, n_rows);
+    cs_lnum_t c_len = 0;
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+      cs_lnum_t r_id = ms->row_id[ii];
+      c_len = CS_MAX(c_len, row_index[r_id+1] - row_index[r_id]);
+    }
+    ms->chunk_index[c_id+1] = ms->chunk_index[c_id] + c_len*c_size;
+  }
+
+  /* Build padded, slice-interleaved column ids */
+
+  BFT_MALLOC(ms->col_id, ms->chunk_index[ms->n_chunks], cs_lnum_t);
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < ms->n_chunks; c_id++) {
+    cs_lnum_t c_len = (ms->chunk_index[c_id+1] - ms->chunk_index[c_id]) / c_size;
+    cs_lnum_t *c_col_id = ms->col_id + ms->chunk_index[c_id];
+    for (cs_lnum_t l_id = 0; l_id < c_size; l_id++) {
+      cs_lnum_t pos = CS_MIN(c_id*c_size + l_id, n_rows - 1);
+      cs_lnum_t r_id = ms->row_id[pos];
+      cs_lnum_t n_cols = row_index[r_id+1] - row_index[r_id];
+      const cs_lnum_t *r_col_id = ms_csr->col_id + row_index[r_id];
+      if (c_id*c_size + l_id >= n_rows)
+        n_cols = 0;
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        c_col_id[jj*c_size + l_id] = r_col_id[jj];
+      for (cs_lnum_t jj = n_cols; jj < c_len; jj++)
+        c_col_id[jj*c_size + l_id] = r_id;
+    }
+  }
+
+  _destroy_struct_csr(&ms_csr);
+
+  return ms;
+}
+
+/*----------------------------------------------------------------------------
+ * Return position of a given extradiagonal term in SELL matrix arrays.
+ *
+ * parameters:
+ *   ms      <-- pointer to SELL matrix structure
+ *   row_id  <-- row id
+ *   col_id  <-- column id (must be present in row)
+ *
+ * returns:
+ *   position of term in column id and extradiagonal coefficient arrays
+ *----------------------------------------------------------------------------*/
+
+static inline cs_lnum_t
+_sell_x_id(const cs_matrix_struct_sell_t  *ms,
+           cs_lnum_t                       row_id,
+           cs_lnum_t                       col_id)
+{
+  const cs_lnum_t pos = ms->row_pos[row_id];
+
+  cs_lnum_t kk =   ms->chunk_index[pos / CS_MATRIX_SELL_C]
+                 + pos % CS_MATRIX_SELL_C;
+
+  while (ms->col_id[kk] != col_id)
+    kk += CS_MATRIX_SELL_C;
+
+  return kk;
+}
+
+/*----------------------------------------------------------------------------
+ * Set SELL matrix extradiagonal coefficients to zero.
+ *
+ * Padding terms are also set to zero.
+ *
+ * parameters:
+ *   matrix           <-> pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_zero_x_coeffs_sell(cs_matrix_t  *matrix)
+{
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+
+# pragma omp parallel for  if(ms->n_rows > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < ms->n_chunks; c_id++) {
+    for (cs_lnum_t kk = ms->chunk_index[c_id];
+         kk < ms->chunk_index[c_id+1];
+         kk++)
+      mc->_x_val[kk] = 0.0;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Set SELL extradiagonal matrix coefficients from native coefficients.
+ *
+ * When each coefficient corresponds to a unique edge, values are assigned
+ * directly, in parallel; otherwise, values are added, so multiple
+ * contributions to a given coefficient are handled. Coefficients should
+ * have been set to 0 before calling this function.
+ *
+ * parameters:
+ *   matrix      <-- pointer to matrix structure
+ *   symmetric   <-- indicates if extradiagonal values are symmetric
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *   xa          <-- extradiagonal values
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_xa_coeffs_sell(cs_matrix_t        *matrix,
+                    bool                symmetric,
+                    cs_lnum_t           n_edges,
+                    const cs_lnum_2_t  *edges,
+                    const cs_real_t    *restrict xa)
+{
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_lnum_t  x_stride = (symmetric) ? 1 : 2;
+  const cs_lnum_t  x_shift = (symmetric) ? 0 : 1;
+
+  assert(edges != NULL);
+
+  if (ms->direct_assembly) {
+
+#   pragma omp parallel for  if(n_edges > CS_THR_MIN)
+    for (cs_lnum_t face_id = 0; face_id < n_edges; face_id++) {
+      cs_lnum_t ii = edges[face_id][0];
+      cs_lnum_t jj = edges[face_id][1];
+      if (ii < ms->n_rows)
+        mc->_x_val[_sell_x_id(ms, ii, jj)] = xa[x_stride*face_id];
+      if (jj < ms->n_rows)
+        mc->_x_val[_sell_x_id(ms, jj, ii)] = xa[x_stride*face_id + x_shift];
+    }
+
+  }
+  else {
+
+    for (cs_lnum_t face_id = 0; face_id < n_edges; face_id++) {
+      cs_lnum_t ii = edges[face_id][0];
+      cs_lnum_t jj = edges[face_id][1];
+      if (ii < ms->n_rows)
+        mc->_x_val[_sell_x_id(ms, ii, jj)] += xa[x_stride*face_id];
+      if (jj < ms->n_rows)
+        mc->_x_val[_sell_x_id(ms, jj, ii)] += xa[x_stride*face_id + x_shift];
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Set SELL matrix coefficients.
+ *
+ * Diagonal coefficients are handled as for MSR matrices; extradiagonal
+ * coefficients are always copied, as the storage layout differs from
+ * the native one.
+ *
+ * parameters:
+ *   matrix      <-> pointer to matrix structure
+ *   symmetric   <-- indicates if extradiagonal values are symmetric
+ *   copy        <-- indicates if coefficients should be copied
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *   da          <-- diagonal values (NULL if all zero)
+ *   xa          <-- extradiagonal values (NULL if all zero)
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_coeffs_sell(cs_matrix_t         *matrix,
+                 bool                 symmetric,
+                 bool                 copy,
+                 cs_lnum_t            n_edges,
+                 const cs_lnum_2_t  *restrict edges,
+                 const cs_real_t    *restrict da,
+                 const cs_real_t    *restrict xa)
+{
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+
+  /* Map or copy diagonal values */
+
+  _map_or_copy_da_coeffs_msr(matrix, copy, da);
+
+  /* Extradiagonal values */
+
+  if (mc->_x_val == NULL)
+    BFT_MALLOC(mc->_x_val, ms->chunk_index[ms->n_chunks], cs_real_t);
+  mc->x_val = mc->_x_val;
+
+  _zero_x_coeffs_sell(matrix);
+
+  if (xa != NULL)
+    _set_xa_coeffs_sell(matrix, symmetric, n_edges, edges, xa);
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL matrix.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_sell(bool                exclude_diag,
+                  const cs_matrix_t  *matrix,
+                  const cs_real_t    *restrict x,
+                  cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < ms->n_chunks; c_id++) {
+
+    const cs_lnum_t  s_id = ms->chunk_index[c_id];
+    const cs_lnum_t  c_len = (ms->chunk_index[c_id+1] - s_id)/CS_MATRIX_SELL_C;
+    const cs_lnum_t  n_lanes = CS_MIN(CS_MATRIX_SELL_C,
+                                      n_rows - c_id*CS_MATRIX_SELL_C);
+    const cs_lnum_t *restrict col_id = ms->col_id + s_id;
+    const cs_lnum_t *restrict row_id = ms->row_id + c_id*CS_MATRIX_SELL_C;
+    const cs_real_t *restrict m_val = mc->x_val + s_id;
+
+    cs_real_t  s[CS_MATRIX_SELL_C];
+
+    for (cs_lnum_t ll = 0; ll < CS_MATRIX_SELL_C; ll++)
+      s[ll] = 0.;
+
+    for (cs_lnum_t jj = 0; jj < c_len; jj++) {
+      for (cs_lnum_t ll = 0; ll < CS_MATRIX_SELL_C; ll++)
+        s[ll] +=   m_val[jj*CS_MATRIX_SELL_C + ll]
+                 * x[col_id[jj*CS_MATRIX_SELL_C + ll]];
+    }
+
+    if (d_val != NULL) {
+      for (cs_lnum_t ll = 0; ll < n_lanes; ll++) {
+        cs_lnum_t ii = row_id[ll];
+        y[ii] = s[ll] + d_val[ii]*x[ii];
+      }
+    }
+    else {
+      for (cs_lnum_t ll = 0; ll < n_lanes; ll++)
+        y[row_id[ll]] = s[ll];
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL matrix, blocked version.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_sell_generic(bool                exclude_diag,
+                            const cs_matrix_t  *matrix,
+                            const cs_real_t    *restrict x,
+                            cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const int *db_size = matrix->db_size;
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
+
+# pragma omp parallel for  if(n_rows*db_size[0] > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < ms->n_chunks; c_id++) {
+
+    const cs_lnum_t  s_id = ms->chunk_index[c_id];
+    const cs_lnum_t  c_len = (ms->chunk_index[c_id+1] - s_id)/CS_MATRIX_SELL_C;
+    const cs_lnum_t  n_lanes = CS_MIN(CS_MATRIX_SELL_C,
+                                      n_rows - c_id*CS_MATRIX_SELL_C);
+    const cs_lnum_t *restrict col_id = ms->col_id + s_id;
+    const cs_lnum_t *restrict row_id = ms->row_id + c_id*CS_MATRIX_SELL_C;
+    const cs_real_t *restrict m_val = mc->x_val + s_id;
+
+    for (cs_lnum_t ll = 0; ll < n_lanes; ll++) {
+      cs_lnum_t ii = row_id[ll];
+      if (d_val != NULL)
+        _dense_b_ax(ii, db_size, d_val, x, y);
+      else {
+        for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+          y[ii*db_size[1] + kk] = 0.;
+      }
+    }
+
+    for (cs_lnum_t jj = 0; jj < c_len; jj++) {
+      for (cs_lnum_t ll = 0; ll < n_lanes; ll++) {
+        cs_lnum_t ii = row_id[ll];
+        cs_lnum_t k_id = jj*CS_MATRIX_SELL_C + ll;
+        for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+          y[ii*db_size[1] + kk]
+            += m_val[k_id]*x[col_id[k_id]*db_size[1] + kk];
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL matrix, 3x3 blocked version.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_3_3_mat_vec_p_l_sell(bool                exclude_diag,
+                      const cs_matrix_t  *matrix,
+                      const cs_real_t    *restrict x,
+                      cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
+
+  assert(matrix->db_size[0] == 3 && matrix->db_size[3] == 9);
+
+# pragma omp parallel for  if(n_rows*3 > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < ms->n_chunks; c_id++) {
+
+    const cs_lnum_t  s_id = ms->chunk_index[c_id];
+    const cs_lnum_t  c_len = (ms->chunk_index[c_id+1] - s_id)/CS_MATRIX_SELL_C;
+    const cs_lnum_t  n_lanes = CS_MIN(CS_MATRIX_SELL_C,
+                                      n_rows - c_id*CS_MATRIX_SELL_C);
+    const cs_lnum_t *restrict col_id = ms->col_id + s_id;
+    const cs_lnum_t *restrict row_id = ms->row_id + c_id*CS_MATRIX_SELL_C;
+    const cs_real_t *restrict m_val = mc->x_val + s_id;
+
+    cs_real_t  s[3][CS_MATRIX_SELL_C];
+
+    for (cs_lnum_t kk = 0; kk < 3; kk++) {
+      for (cs_lnum_t ll = 0; ll < CS_MATRIX_SELL_C; ll++)
+        s[kk][ll] = 0.;
+    }
+
+    for (cs_lnum_t jj = 0; jj < c_len; jj++) {
+      for (cs_lnum_t ll = 0; ll < CS_MATRIX_SELL_C; ll++) {
+        const cs_real_t  a = m_val[jj*CS_MATRIX_SELL_C + ll];
+        const cs_real_t *restrict _x = x + col_id[jj*CS_MATRIX_SELL_C + ll]*3;
+        s[0][ll] += a*_x[0];
+        s[1][ll] += a*_x[1];
+        s[2][ll] += a*_x[2];
+      }
+    }
+
+    for (cs_lnum_t ll = 0; ll < n_lanes; ll++) {
+      cs_lnum_t ii = row_id[ll];
+      if (d_val != NULL) {
+        _dense_3_3_ax(ii, d_val, x, y);
+        for (cs_lnum_t kk = 0; kk < 3; kk++)
+          y[ii*3 + kk] += s[kk][ll];
+      }
+      else {
+        for (cs_lnum_t kk = 0; kk < 3; kk++)
+          y[ii*3 + kk] = s[kk][ll];
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL matrix, 6x6 blocked version.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_6_6_mat_vec_p_l_sell(bool                exclude_diag,
+                      const cs_matrix_t  *matrix,
+                      const cs_real_t    *restrict x,
+                      cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
+
+  assert(matrix->db_size[0] == 6 && matrix->db_size[3] == 36);
+
+# pragma omp parallel for  if(n_rows*6 > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < ms->n_chunks; c_id++) {
+
+    const cs_lnum_t  s_id = ms->chunk_index[c_id];
+    const cs_lnum_t  c_len = (ms->chunk_index[c_id+1] - s_id)/CS_MATRIX_SELL_C;
+    const cs_lnum_t  n_lanes = CS_MIN(CS_MATRIX_SELL_C,
+                                      n_rows - c_id*CS_MATRIX_SELL_C);
+    const cs_lnum_t *restrict col_id = ms->col_id + s_id;
+    const cs_lnum_t *restrict row_id = ms->row_id + c_id*CS_MATRIX_SELL_C;
+    const cs_real_t *restrict m_val = mc->x_val + s_id;
+
+    cs_real_t  s[6][CS_MATRIX_SELL_C];
+
+    for (cs_lnum_t kk = 0; kk < 6; kk++) {
+      for (cs_lnum_t ll = 0; ll < CS_MATRIX_SELL_C; ll++)
+        s[kk][ll] = 0.;
+    }
+
+    for (cs_lnum_t jj = 0; jj < c_len; jj++) {
+      for (cs_lnum_t ll = 0; ll < CS_MATRIX_SELL_C; ll++) {
+        const cs_real_t  a = m_val[jj*CS_MATRIX_SELL_C + ll];
+        const cs_real_t *restrict _x = x + col_id[jj*CS_MATRIX_SELL_C + ll]*6;
+        for (cs_lnum_t kk = 0; kk < 6; kk++)
+          s[kk][ll] += a*_x[kk];
+      }
+    }
+
+    for (cs_lnum_t ll = 0; ll < n_lanes; ll++) {
+      cs_lnum_t ii = row_id[ll];
+      if (d_val != NULL) {
+        _dense_6_6_ax(ii, d_val, x, y);
+        for (cs_lnum_t kk = 0; kk < 6; kk++)
+          y[ii*6 + kk] += s[kk][ll];
+      }
+      else {
+        for (cs_lnum_t kk = 0; kk < 6; kk++)
+          y[ii*6 + kk] = s[kk][ll];
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL matrix, blocked version.
+ *
+ * This variant uses fixed block size variants for common cases.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_sell(bool                exclude_diag,
+                    const cs_matrix_t  *matrix,
+                    const cs_real_t    *restrict x,
+                    cs_real_t          *restrict y)
+{
+  if (matrix->db_size[0] == 3 && matrix->db_size[3] == 9)
+    _3_3_mat_vec_p_l_sell(exclude_diag, matrix, x, y);
+
+  else if (matrix->db_size[0] == 6 && matrix->db_size[3] == 36)
+    _6_6_mat_vec_p_l_sell(exclude_diag, matrix, x, y);
+
+  else
+    _b_mat_vec_p_l_sell_generic(exclude_diag, matrix, x, y);
+}
+
+/*----------------------------------------------------------------------------
+ * Set BSR extradiagonal matrix coefficients from native coefficients.
+ *
+ * Values are added, so multiple contributions to a given block
+ * are handled; coefficients should have been set to 0 before calling
+ * this function.
+ *
+ * parameters:
+ *   matrix      <-- pointer to matrix structure
+ *   symmetric   <-- indicates if extradiagonal values are symmetric
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *   xa          <-- extradiagonal values
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_xa_coeffs_bsr(cs_matrix_t        *matrix,
+                   bool                symmetric,
+                   cs_lnum_t           n_edges,
+                   const cs_lnum_2_t  *edges,
+                   const cs_real_t    *restrict xa)
+{
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_lnum_t  x_stride = (symmetric) ? 1 : 2;
+  const cs_lnum_t  x_shift = (symmetric) ? 0 : 1;
+  const cs_lnum_t  b_stride = matrix->eb_size[3];
+
+  assert(edges != NULL);
+
+  for (cs_lnum_t face_id = 0; face_id < n_edges; face_id++) {
+    cs_lnum_t ii = edges[face_id][0];
+    cs_lnum_t jj = edges[face_id][1];
+    if (ii < ms->n_rows) {
+      cs_lnum_t kk;
+      for (kk = ms->row_index[ii]; ms->col_id[kk] != jj; kk++);
+      const cs_real_t *s_b = xa + (x_stride*face_id)*b_stride;
+      cs_real_t *d_b = mc->_x_val + kk*b_stride;
+      for (cs_lnum_t ll = 0; ll < b_stride; ll++)
+        d_b[ll] += s_b[ll];
+    }
+    if (jj < ms->n_rows) {
+      cs_lnum_t kk;
+      for (kk = ms->row_index[jj]; ms->col_id[kk] != ii; kk++);
+      const cs_real_t *s_b = xa + (x_stride*face_id + x_shift)*b_stride;
+      cs_real_t *d_b = mc->_x_val + kk*b_stride;
+      for (cs_lnum_t ll = 0; ll < b_stride; ll++)
+        d_b[ll] += s_b[ll];
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Set BSR matrix coefficients.
+ *
+ * Diagonal coefficients are handled as for MSR matrices; extradiagonal
+ * blocks are always copied, as the storage layout differs from
+ * the native one.
+ *
+ * parameters:
+ *   matrix      <-> pointer to matrix structure
+ *   symmetric   <-- indicates if extradiagonal values are symmetric
+ *   copy        <-- indicates if coefficients should be copied
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *   da          <-- diagonal values (NULL if all zero)
+ *   xa          <-- extradiagonal values (NULL if all zero)
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_coeffs_bsr(cs_matrix_t         *matrix,
+                bool                 symmetric,
+                bool                 copy,
+                cs_lnum_t            n_edges,
+                const cs_lnum_2_t  *restrict edges,
+                const cs_real_t    *restrict da,
+                const cs_real_t    *restrict xa)
+{
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t  b_stride = matrix->eb_size[3];
+
+  /* Map or copy diagonal values */
+
+  _map_or_copy_da_coeffs_msr(matrix, copy, da);
+
+  /* Extradiagonal values */
+
+  if (mc->_x_val == NULL || mc->max_eb_size < b_stride) {
+    BFT_REALLOC(mc->_x_val, b_stride*ms->row_index[n_rows], cs_real_t);
+    mc->max_eb_size = b_stride;
+  }
+  mc->x_val = mc->_x_val;
+
+# pragma omp parallel for  if(n_rows*b_stride > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    for (cs_lnum_t kk = ms->row_index[ii]*b_stride;
+         kk < ms->row_index[ii+1]*b_stride;
+         kk++)
+      mc->_x_val[kk] = 0.0;
+  }
+
+  if (xa != NULL)
+    _set_xa_coeffs_bsr(matrix, symmetric, n_edges, edges, xa);
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with BSR matrix, generic block
+ * version.
+ *
+ * Only rows s_id to e_id - 1 are computed.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   s_id         <-- id of first row to compute
+ *   e_id         <-- id of past-the-end row to compute
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_bb_mat_vec_p_l_bsr_generic_rows(bool                exclude_diag,
+                                 const cs_matrix_t  *matrix,
+                                 cs_lnum_t           s_id,
+                                 cs_lnum_t           e_id,
+                                 const cs_real_t    *restrict x,
+                                 cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const int *db_size = matrix->db_size;
+  const int *eb_size = matrix->eb_size;
+
+  const cs_real_t  *restrict d_val
+    = (exclude_diag) ? NULL : mc->d_val;
+
+# pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+  for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const cs_real_t *restrict m_row
+      = mc->x_val + ms->row_index[ii]*eb_size[3];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+    if (d_val != NULL)
+      _dense_b_ax(ii, db_size, d_val, x, y);
+    else {
+      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+        y[ii*db_size[1] + kk] = 0.;
+    }
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      for (cs_lnum_t kk = 0; kk < eb_size[0]; kk++) {
+        for (cs_lnum_t ll = 0; ll < eb_size[0]; ll++)
+          y[ii*db_size[1] + kk]
+            +=   m_row[jj*eb_size[3] + kk*eb_size[2] + ll]
+               * x[col_id[jj]*db_size[1] + ll];
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with BSR matrix, generic block
+ * version.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_bb_mat_vec_p_l_bsr_generic(bool                exclude_diag,
+                            const cs_matrix_t  *matrix,
+                            const cs_real_t    *restrict x,
+                            cs_real_t          *restrict y)
+{
+  _bb_mat_vec_p_l_bsr_generic_rows(exclude_diag, matrix, 0, matrix->n_rows,
+                                   x, y);
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with BSR matrix, 3x3 blocked version.
+ *
+ * Block products are fully unrolled, and the row's results kept in
+ * local variables.
+ *
+ * Only rows s_id to e_id - 1 are computed.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   s_id         <-- id of first row to compute
+ *   e_id         <-- id of past-the-end row to compute
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_3_3_mat_vec_p_l_bsr_rows(bool                exclude_diag,
+                          const cs_matrix_t  *matrix,
+                          cs_lnum_t           s_id,
+                          cs_lnum_t           e_id,
+                          const cs_real_t    *restrict x,
+                          cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_real_t  *restrict d_val
+    = (exclude_diag) ? NULL : mc->d_val;
+
+  assert(matrix->db_size[3] == 9 && matrix->eb_size[3] == 9);
+
+# pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+  for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii]*9;
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+    cs_real_t s0 = 0., s1 = 0., s2 = 0.;
+
+    if (d_val != NULL) {
+      const cs_real_t *restrict a = d_val + ii*9;
+      const cs_real_t *restrict _x = x + ii*3;
+      s0 = a[0]*_x[0] + a[1]*_x[1] + a[2]*_x[2];
+      s1 = a[3]*_x[0] + a[4]*_x[1] + a[5]*_x[2];
+      s2 = a[6]*_x[0] + a[7]*_x[1] + a[8]*_x[2];
+    }
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      const cs_real_t *restrict a = m_row + jj*9;
+      const cs_real_t *restrict _x = x + col_id[jj]*3;
+      s0 += a[0]*_x[0] + a[1]*_x[1] + a[2]*_x[2];
+      s1 += a[3]*_x[0] + a[4]*_x[1] + a[5]*_x[2];
+      s2 += a[6]*_x[0] + a[7]*_x[1] + a[8]*_x[2];
+    }
+
+    y[ii*3]     = s0;
+    y[ii*3 + 1] = s1;
+    y[ii*3 + 2] = s2;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with BSR matrix, 6x6 blocked version.
+ *
+ * Only rows s_id to e_id - 1 are computed.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   s_id         <-- id of first row to compute
+ *   e_id         <-- id of past-the-end row to compute
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_6_6_mat_vec_p_l_bsr_rows(bool                exclude_diag,
+                          const cs_matrix_t  *matrix,
+                          cs_lnum_t           s_id,
+                          cs_lnum_t           e_id,
+                          const cs_real_t    *restrict x,
+                          cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_real_t  *restrict d_val
+    = (exclude_diag) ? NULL : mc->d_val;
+
+  assert(matrix->db_size[3] == 36 && matrix->eb_size[3] == 36);
+
+# pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+  for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii]*36;
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+    cs_real_t s[6] = {0., 0., 0., 0., 0., 0.};
+
+    if (d_val != NULL) {
+      const cs_real_t *restrict a = d_val + ii*36;
+      const cs_real_t *restrict _x = x + ii*6;
+      for (cs_lnum_t kk = 0; kk < 6; kk++)
+        s[kk] =   a[kk*6]*_x[0]     + a[kk*6 + 1]*_x[1]
+                + a[kk*6 + 2]*_x[2] + a[kk*6 + 3]*_x[3]
+                + a[kk*6 + 4]*_x[4] + a[kk*6 + 5]*_x[5];
+    }
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      const cs_real_t *restrict a = m_row + jj*36;
+      const cs_real_t *restrict _x = x + col_id[jj]*6;
+      for (cs_lnum_t kk = 0; kk < 6; kk++)
+        s[kk] +=   a[kk*6]*_x[0]     + a[kk*6 + 1]*_x[1]
+                 + a[kk*6 + 2]*_x[2] + a[kk*6 + 3]*_x[3]
+                 + a[kk*6 + 4]*_x[4] + a[kk*6 + 5]*_x[5];
+    }
+
+    for (cs_lnum_t kk = 0; kk < 6; kk++)
+      y[ii*6 + kk] = s[kk];
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with BSR matrix.
+ *
+ * This variant uses fixed block size variants for common cases.
+ * Only rows s_id to e_id - 1 are computed.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   s_id         <-- id of first row to compute
+ *   e_id         <-- id of past-the-end row to compute
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_bb_mat_vec_p_l_bsr_rows(bool                exclude_diag,
+                         const cs_matrix_t  *matrix,
+                         cs_lnum_t           s_id,
+                         cs_lnum_t           e_id,
+                         const cs_real_t    *restrict x,
+                         cs_real_t          *restrict y)
+{
+  const int *db_size = matrix->db_size;
+  const int *eb_size = matrix->eb_size;
+
+  if (   db_size[0] == 3 && db_size[1] == 3 && db_size[3] == 9
+      && eb_size[0] == 3 && eb_size[3] == 9)
+    _3_3_mat_vec_p_l_bsr_rows(exclude_diag, matrix, s_id, e_id, x, y);
+
+  else if (   db_size[0] == 6 && db_size[1] == 6 && db_size[3] == 36
+           && eb_size[0] == 6 && eb_size[3] == 36)
+    _6_6_mat_vec_p_l_bsr_rows(exclude_diag, matrix, s_id, e_id, x, y);
+
+  else
+    _bb_mat_vec_p_l_bsr_generic_rows(exclude_diag, matrix, s_id, e_id, x, y);
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with BSR matrix.
+ *
+ * This variant uses fixed block size variants for common cases.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_bb_mat_vec_p_l_bsr(bool                exclude_diag,
+                    const cs_matrix_t  *matrix,
+                    const cs_real_t    *restrict x,
+                    cs_real_t          *restrict y)
+{
+  _bb_mat_vec_p_l_bsr_rows(exclude_diag, matrix, 0, matrix->n_rows, x, y);
+}
+
+/*----------------------------------------------------------------------------
+ * Create matrix-free operator coefficients.
+ *
+ * returns:
+ *   pointer to allocated matrix-free coefficients structure.
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_coeff_free_t *
+_create_coeff_free(void)
+{
+  cs_matrix_coeff_free_t  *mc;
+
+  /* Allocate */
+
+  BFT_MALLOC(mc, 1, cs_matrix_coeff_free_t);
+
+  /* Initialize */
+
+  mc->symmetric = false;
+
+  mc->iconvp = 0;
+  mc->idiffp = 0;
+  mc->thetap = 1.;
+
+  mc->da = NULL;
+  mc->xcpp = NULL;
+  mc->i_massflux = NULL;
+  mc->i_visc = NULL;
+
+  return mc;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy matrix-free operator coefficients.
+ *
+ * parameters:
+ *   coeff  <->  pointer to matrix-free coefficients pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_destroy_coeff_free(cs_matrix_coeff_free_t **coeff)
+{
+  if (coeff != NULL && *coeff !=NULL)
+    BFT_FREE(*coeff);
+}
+
+/*----------------------------------------------------------------------------
+ * Release shared matrix-free operator coefficients.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_release_coeffs_free(cs_matrix_t  *matrix)
+{
+  cs_matrix_coeff_free_t  *mc = matrix->coeffs;
+  if (mc != NULL) {
+    mc->da = NULL;
+    mc->xcpp = NULL;
+    mc->i_massflux = NULL;
+    mc->i_visc = NULL;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute extradiagonal terms of a matrix-free operator for a given face.
+ *
+ * parameters:
+ *   mc      <-- pointer to matrix-free coefficients structure
+ *   face_id <-- face id
+ *   ii      <-- first adjacent cell id
+ *   jj      <-- second adjacent cell id
+ *   xij     --> X_ij term
+ *   xji     --> X_ji term
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_free_face_xa(const cs_matrix_coeff_free_t  *mc,
+              cs_lnum_t                      face_id,
+              cs_lnum_t                      ii,
+              cs_lnum_t                      jj,
+              cs_real_t                     *xij,
+              cs_real_t                     *xji)
+{
+  cs_real_t _xij = 0., _xji = 0.;
+
+  if (mc->i_visc != NULL) {
+    _xij = - mc->i_visc[face_id];
+    _xji = _xij;
+  }
+
+  if (mc->i_massflux != NULL) {
+    const cs_real_t m_ij = mc->i_massflux[face_id];
+    cs_real_t flui =  0.5*(m_ij - fabs(m_ij));
+    cs_real_t fluj = -0.5*(m_ij + fabs(m_ij));
+    if (mc->xcpp != NULL) {
+      flui *= mc->xcpp[ii];
+      fluj *= mc->xcpp[jj];
+    }
+    _xij += flui;
+    _xji += fluj;
+  }
+
+  *xij = mc->thetap * _xij;
+  *xji = mc->thetap * _xji;
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with matrix-free operator.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_free(bool                exclude_diag,
+                  const cs_matrix_t  *matrix,
+                  const cs_real_t    *restrict x,
+                  cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_native_t  *ms = matrix->structure;
+  const cs_matrix_coeff_free_t  *mc = matrix->coeffs;
+
+  /* Diagonal part of matrix.vector product */
+
+  if (! exclude_diag) {
+    _diag_vec_p_l(mc->da, x, y, ms->n_rows);
+    _zero_range(y, ms->n_rows, ms->n_cols_ext);
+  }
+  else
+    _zero_range(y, 0, ms->n_cols_ext);
+
+  /* non-diagonal terms, computed from face values */
+
+  if (mc->i_visc == NULL && mc->i_massflux == NULL)
+    return;
+
+  const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+
+  if (   matrix->numbering != NULL
+      && matrix->numbering->type == CS_NUMBERING_THREADS) {
+
+    const int n_threads = matrix->numbering->n_threads;
+    const int n_groups = matrix->numbering->n_groups;
+    const cs_lnum_t *group_index = matrix->numbering->group_index;
+
+    for (int g_id = 0; g_id < n_groups; g_id++) {
+
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_threads; t_id++) {
+
+        for (cs_lnum_t face_id = group_index[(t_id*n_groups + g_id)*2];
+             face_id < group_index[(t_id*n_groups + g_id)*2 + 1];
+             face_id++) {
+          cs_real_t xij, xji;
+          cs_lnum_t ii = face_cel_p[face_id][0];
+          cs_lnum_t jj = face_cel_p[face_id][1];
+          _free_face_xa(mc, face_id, ii, jj, &xij, &xji);
+          y[ii] += xij * x[jj];
+          y[jj] += xji * x[ii];
+        }
+      }
+    }
+
+  }
+  else {
+
+    for (cs_lnum_t face_id = 0; face_id < ms->n_edges; face_id++) {
+      cs_real_t xij, xji;
+      cs_lnum_t ii = face_cel_p[face_id][0];
+      cs_lnum_t jj = face_cel_p[face_id][1];
+      _free_face_xa(mc, face_id, ii, jj, &xij, &xji);
+      y[ii] += xij * x[jj];
+      y[jj] += xji * x[ii];
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with matrix-free operator,
+ * blocked version (extradiagonal terms applied to each component).
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_free(bool                exclude_diag,
+                    const cs_matrix_t  *matrix,
+                    const cs_real_t    *restrict x,
+                    cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_native_t  *ms = matrix->structure;
+  const cs_matrix_coeff_free_t  *mc = matrix->coeffs;
+  const int *db_size = matrix->db_size;
+
+  /* Diagonal part of matrix.vector product */
+
+  if (! exclude_diag) {
+    _b_diag_vec_p_l(mc->da, x, y, ms->n_rows, db_size);
+    _b_zero_range(y, ms->n_rows, ms->n_cols_ext, db_size);
+  }
+  else
+    _b_zero_range(y, 0, ms->n_cols_ext, db_size);
+
+  /* non-diagonal terms, computed from face values */
+
+  if (mc->i_visc == NULL && mc->i_massflux == NULL)
+    return;
+
+  const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+
+  if (   matrix->numbering != NULL
+      && matrix->numbering->type == CS_NUMBERING_THREADS) {
+
+    const int n_threads = matrix->numbering->n_threads;
+    const int n_groups = matrix->numbering->n_groups;
+    const cs_lnum_t *group_index = matrix->numbering->group_index;
+
+    for (int g_id = 0; g_id < n_groups; g_id++) {
+
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_threads; t_id++) {
+
+        for (cs_lnum_t face_id = group_index[(t_id*n_groups + g_id)*2];
+             face_id < group_index[(t_id*n_groups + g_id)*2 + 1];
+             face_id++) {
+          cs_real_t xij, xji;
+          cs_lnum_t ii = face_cel_p[face_id][0];
+          cs_lnum_t jj = face_cel_p[face_id][1];
+          _free_face_xa(mc, face_id, ii, jj, &xij, &xji);
+          for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+            y[ii*db_size[1] + kk] += xij * x[jj*db_size[1] + kk];
+            y[jj*db_size[1] + kk] += xji * x[ii*db_size[1] + kk];
+          }
+        }
+      }
+    }
+
+  }
+  else {
+
+    for (cs_lnum_t face_id = 0; face_id < ms->n_edges; face_id++) {
+      cs_real_t xij, xji;
+      cs_lnum_t ii = face_cel_p[face_id][0];
+      cs_lnum_t jj = face_cel_p[face_id][1];
+      _free_face_xa(mc, face_id, ii, jj, &xij, &xji);
+      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+        y[ii*db_size[1] + kk] += xij * x[jj*db_size[1] + kk];
+        y[jj*db_size[1] + kk] += xji * x[ii*db_size[1] + kk];
+      }
+    }
+
+  }
+}
 
 /*----------------------------------------------------------------------------
  * Synchronize ghost values prior to matrix.vector product
@@ -4288,6 +5863,109 @@ _pre_vector_multiply_sync(cs_halo_rotation_t   rotation_mode,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Matrix.vector product with ghost value synchronization overlapped
+ * with the product of rows which do not reference ghost values.
+ *
+ * This is possible only for CSR-based (CSR, MSR, BSR) matrices using the default
+ * matrix.vector product variants. The halo exchange is started first,
+ * leading rows with no ghost column are computed, and remaining rows
+ * are handled once the exchange is complete.
+ *
+ * parameters:
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   exclude_diag  <-- exclude diagonal if true
+ *   matrix        <-- pointer to matrix structure
+ *   x             <-> multipliying vector values (ghost values updated)
+ *   y             --> resulting vector
+ *
+ * returns:
+ *   true if the product was computed, false if it is not handled here
+ *----------------------------------------------------------------------------*/
+
+static bool
+_vector_multiply_overlap(cs_halo_rotation_t   rotation_mode,
+                         bool                 exclude_diag,
+                         const cs_matrix_t   *matrix,
+                         cs_real_t           *restrict x,
+                         cs_real_t           *restrict y)
+{
+  if (_halo_overlap == false || cs_glob_n_ranks < 2)
+    return false;
+
+  if (   matrix->type != CS_MATRIX_CSR
+      && matrix->type != CS_MATRIX_MSR
+      && matrix->type != CS_MATRIX_BSR)
+    return false;
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+
+  if (ms->n_rows_no_ghost < 1)
+    return false;
+
+  /* Only default variants have a row range counterpart */
+
+  cs_matrix_vector_product_rows_t  *vector_multiply_rows = NULL;
+  cs_matrix_vector_product_t  *vector_multiply
+    = matrix->vector_multiply[matrix->fill_type][(exclude_diag) ? 1 : 0];
+
+  if (vector_multiply == _mat_vec_p_l_csr)
+    vector_multiply_rows = _mat_vec_p_l_csr_rows;
+  else if (vector_multiply == _mat_vec_p_l_msr)
+    vector_multiply_rows = _mat_vec_p_l_msr_rows;
+  else if (vector_multiply == _b_mat_vec_p_l_msr)
+    vector_multiply_rows = _b_mat_vec_p_l_msr_rows;
+  else if (vector_multiply == _b_mat_vec_p_l_msr_generic)
+    vector_multiply_rows = _b_mat_vec_p_l_msr_generic_rows;
+  else if (vector_multiply == _bb_mat_vec_p_l_bsr)
+    vector_multiply_rows = _bb_mat_vec_p_l_bsr_rows;
+  else if (vector_multiply == _bb_mat_vec_p_l_bsr_generic)
+    vector_multiply_rows = _bb_mat_vec_p_l_bsr_generic_rows;
+  else
+    return false;
+
+  const cs_halo_t *halo = matrix->halo;
+  const int *db_size = matrix->db_size;
+  const cs_lnum_t n_rows = matrix->n_rows;
+
+  /* Start update of distant ghost rows */
+
+  if (db_size[3] == 1) {
+    _zero_range(y, n_rows, matrix->n_cols_ext);
+    cs_halo_sync_start(halo, CS_HALO_STANDARD, rotation_mode, x, 1);
+  }
+  else {
+    _b_zero_range(y, n_rows, matrix->n_cols_ext, db_size);
+    cs_halo_sync_start(halo, CS_HALO_STANDARD, CS_HALO_ROTATION_COPY,
+                       x, db_size[1]);
+  }
+
+  /* Compute rows independent of ghost values */
+
+  vector_multiply_rows(exclude_diag, matrix, 0, ms->n_rows_no_ghost, x, y);
+
+  /* Complete update of ghost rows */
+
+  if (db_size[3] == 1)
+    cs_halo_sync_wait(halo, CS_HALO_STANDARD, rotation_mode, x, 1);
+  else {
+    cs_halo_sync_wait(halo, CS_HALO_STANDARD, CS_HALO_ROTATION_COPY,
+                      x, db_size[1]);
+    if (halo->n_transforms > 0 && db_size[0] == 3)
+      cs_halo_perio_sync_var_vect(halo,
+                                  CS_HALO_STANDARD,
+                                  x,
+                                  db_size[1]);
+  }
+
+  /* Compute remaining rows */
+
+  vector_multiply_rows(exclude_diag, matrix, ms->n_rows_no_ghost, n_rows,
+                       x, y);
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------
  * Copy array to reference for matrix computation check.
  *
@@ -4627,6 +6305,17 @@ _variant_add(const char                        *name,
  *     omp_sched       (Improved scheduling for OpenMP)
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *
+ *   CS_MATRIX_SELL    (all fill types except CS_MATRIX_33_BLOCK)
+ *     standard
+ *     generic         (for CS_MATRIX_??_BLOCK_D or CS_MATRIX_??_BLOCK_D_SYM)
+ *
+ *   CS_MATRIX_BSR     (all fill types)
+ *     standard        (3x3 and 6x6 fixed blocks, or generic)
+ *     generic         (for CS_MATRIX_BLOCK)
+ *
+ *   CS_MATRIX_FREE    (all fill types except CS_MATRIX_BLOCK)
+ *     standard
+ *
  * parameters:
  *   m_type          <-- Matrix type
  *   numbering       <-- mesh numbering type, or NULL
@@ -4822,13 +6511,114 @@ _set_spmv_func(cs_matrix_type_t             m_type,
         retcode = 2;
 #endif
       }
-      break;
-    default:
-      break;
+      break;
+    default:
+      break;
+    }
+    break;
+
+ case CS_MATRIX_MSR:
+
+    if (standard > 0) {
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        spmv[0] = _mat_vec_p_l_msr;
+        spmv[1] = _mat_vec_p_l_msr;
+        break;
+      case CS_MATRIX_BLOCK_D:
+      case CS_MATRIX_BLOCK_D_66:
+      case CS_MATRIX_BLOCK_D_SYM:
+        spmv[0] = _b_mat_vec_p_l_msr;
+        spmv[1] = _b_mat_vec_p_l_msr;
+        break;
+      default:
+        break;
+      }
+    }
+
+    else if (!strcmp(func_name, "generic")) {
+      switch(fill_type) {
+      case CS_MATRIX_BLOCK_D:
+      case CS_MATRIX_BLOCK_D_66:
+      case CS_MATRIX_BLOCK_D_SYM:
+        spmv[0] = _b_mat_vec_p_l_msr_generic;
+        spmv[1] = _b_mat_vec_p_l_msr_generic;
+        break;
+      default:
+        break;
+      }
+    }
+
+    else if (!strcmp(func_name, "mkl")) {
+#if defined(HAVE_MKL)
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        spmv[0] = _mat_vec_p_l_msr_mkl;
+        spmv[1] = _mat_vec_p_l_msr_mkl;
+        break;
+      default:
+        break;
+      }
+#else
+      retcode = 2;
+#endif
+    }
+
+    else if (!strcmp(func_name, "omp_sched")) {
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        spmv[0] = _mat_vec_p_l_msr_omp_sched;
+        spmv[1] = _mat_vec_p_l_msr_omp_sched;
+        break;
+      default:
+        break;
+      }
+    }
+
+    break;
+
+  case CS_MATRIX_SELL:
+
+    if (standard > 0) {
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        spmv[0] = _mat_vec_p_l_sell;
+        spmv[1] = _mat_vec_p_l_sell;
+        break;
+      case CS_MATRIX_BLOCK_D:
+      case CS_MATRIX_BLOCK_D_66:
+      case CS_MATRIX_BLOCK_D_SYM:
+        spmv[0] = _b_mat_vec_p_l_sell;
+        spmv[1] = _b_mat_vec_p_l_sell;
+        break;
+      default:
+        break;
+      }
+    }
+
+    else if (!strcmp(func_name, "generic")) {
+      switch(fill_type) {
+      case CS_MATRIX_BLOCK_D:
+      case CS_MATRIX_BLOCK_D_66:
+      case CS_MATRIX_BLOCK_D_SYM:
+        spmv[0] = _b_mat_vec_p_l_sell_generic;
+        spmv[1] = _b_mat_vec_p_l_sell_generic;
+        break;
+      default:
+        break;
+      }
     }
+
     break;
 
- case CS_MATRIX_MSR:
+  case CS_MATRIX_BSR:
+
+    /* With scalar extradiagonal terms, the BSR layout is identical
+       to the MSR layout */
 
     if (standard > 0) {
       switch(fill_type) {
@@ -4843,6 +6633,10 @@ _set_spmv_func(cs_matrix_type_t             m_type,
         spmv[0] = _b_mat_vec_p_l_msr;
         spmv[1] = _b_mat_vec_p_l_msr;
         break;
+      case CS_MATRIX_BLOCK:
+        spmv[0] = _bb_mat_vec_p_l_bsr;
+        spmv[1] = _bb_mat_vec_p_l_bsr;
+        break;
       default:
         break;
       }
@@ -4850,39 +6644,31 @@ _set_spmv_func(cs_matrix_type_t             m_type,
 
     else if (!strcmp(func_name, "generic")) {
       switch(fill_type) {
-      case CS_MATRIX_BLOCK_D:
-      case CS_MATRIX_BLOCK_D_66:
-      case CS_MATRIX_BLOCK_D_SYM:
-        spmv[0] = _b_mat_vec_p_l_msr_generic;
-        spmv[1] = _b_mat_vec_p_l_msr_generic;
+      case CS_MATRIX_BLOCK:
+        spmv[0] = _bb_mat_vec_p_l_bsr_generic;
+        spmv[1] = _bb_mat_vec_p_l_bsr_generic;
         break;
       default:
         break;
       }
     }
 
-    else if (!strcmp(func_name, "mkl")) {
-#if defined(HAVE_MKL)
-      switch(fill_type) {
-      case CS_MATRIX_SCALAR:
-      case CS_MATRIX_SCALAR_SYM:
-        spmv[0] = _mat_vec_p_l_msr_mkl;
-        spmv[1] = _mat_vec_p_l_msr_mkl;
-        break;
-      default:
-        break;
-      }
-#else
-      retcode = 2;
-#endif
-    }
+    break;
 
-    else if (!strcmp(func_name, "omp_sched")) {
+  case CS_MATRIX_FREE:
+
+    if (standard > 0) {
       switch(fill_type) {
       case CS_MATRIX_SCALAR:
       case CS_MATRIX_SCALAR_SYM:
-        spmv[0] = _mat_vec_p_l_msr_omp_sched;
-        spmv[1] = _mat_vec_p_l_msr_omp_sched;
+        spmv[0] = _mat_vec_p_l_free;
+        spmv[1] = _mat_vec_p_l_free;
+        break;
+      case CS_MATRIX_BLOCK_D:
+      case CS_MATRIX_BLOCK_D_66:
+      case CS_MATRIX_BLOCK_D_SYM:
+        spmv[0] = _b_mat_vec_p_l_free;
+        spmv[1] = _b_mat_vec_p_l_free;
         break;
       default:
         break;
@@ -4968,6 +6754,7 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
 
   switch(ms->type) {
   case CS_MATRIX_NATIVE:
+  case CS_MATRIX_FREE:
     ms->structure = _create_struct_native(n_rows,
                                           n_cols_ext,
                                           n_edges,
@@ -4988,12 +6775,19 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
                                            edges);
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_BSR:
     ms->structure = _create_struct_csr(false,
                                        n_rows,
                                        n_cols_ext,
                                        n_edges,
                                        edges);
     break;
+  case CS_MATRIX_SELL:
+    ms->structure = _create_struct_sell(n_rows,
+                                        n_cols_ext,
+                                        n_edges,
+                                        edges);
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in %s format\n"
@@ -5180,6 +6974,7 @@ cs_matrix_structure_destroy(cs_matrix_structure_t  **ms)
 
     switch(_ms->type) {
     case CS_MATRIX_NATIVE:
+    case CS_MATRIX_FREE:
       {
         cs_matrix_struct_native_t *structure = _ms->structure;
         _destroy_struct_native(&structure);
@@ -5198,11 +6993,18 @@ cs_matrix_structure_destroy(cs_matrix_structure_t  **ms)
       }
       break;
     case CS_MATRIX_MSR:
+    case CS_MATRIX_BSR:
       {
         cs_matrix_struct_csr_t *structure = _ms->structure;
         _destroy_struct_csr(&structure);
       }
       break;
+    case CS_MATRIX_SELL:
+      {
+        cs_matrix_struct_sell_t *structure = _ms->structure;
+        _destroy_struct_sell(&structure);
+      }
+      break;
     default:
       assert(0);
       break;
@@ -5278,8 +7080,13 @@ cs_matrix_create(const cs_matrix_structure_t  *ms)
     m->coeffs = _create_coeff_csr_sym();
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
+  case CS_MATRIX_BSR:
     m->coeffs = _create_coeff_msr();
     break;
+  case CS_MATRIX_FREE:
+    m->coeffs = _create_coeff_free();
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in %s format\n"
@@ -5330,6 +7137,25 @@ cs_matrix_create(const cs_matrix_structure_t  *ms)
     m->copy_diagonal = _copy_diagonal_separate;
     break;
 
+  case CS_MATRIX_SELL:
+    m->set_coefficients = _set_coeffs_sell;
+    m->release_coefficients = _release_coeffs_msr;
+    m->copy_diagonal = _copy_diagonal_separate;
+    break;
+
+  case CS_MATRIX_BSR:
+    m->set_coefficients = _set_coeffs_bsr;
+    m->release_coefficients = _release_coeffs_msr;
+    m->copy_diagonal = _copy_diagonal_separate;
+    break;
+
+  case CS_MATRIX_FREE:
+    /* Coefficients are only set by cs_matrix_set_coefficients_conv_diff */
+    m->set_coefficients = NULL;
+    m->release_coefficients = _release_coeffs_free;
+    m->copy_diagonal = _copy_diagonal_separate;
+    break;
+
   default:
     assert(0);
     break;
@@ -5415,8 +7241,13 @@ cs_matrix_create_by_copy(cs_matrix_t   *src)
     m->coeffs = _create_coeff_csr_sym();
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
+  case CS_MATRIX_BSR:
     m->coeffs = _create_coeff_msr();
     break;
+  case CS_MATRIX_FREE:
+    m->coeffs = _create_coeff_free();
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in %s format\n"
@@ -5425,6 +7256,12 @@ cs_matrix_create_by_copy(cs_matrix_t   *src)
     break;
   }
 
+  if (m->type == CS_MATRIX_MSR) {
+    const cs_matrix_coeff_msr_t  *src_mc = src->coeffs;
+    cs_matrix_coeff_msr_t  *mc = m->coeffs;
+    mc->x_float = src_mc->x_float;
+  }
+
   cs_matrix_release_coefficients(m);
 
   return m;
@@ -5468,12 +7305,21 @@ cs_matrix_destroy(cs_matrix_t **matrix)
       }
       break;
     case CS_MATRIX_MSR:
+    case CS_MATRIX_SELL:
+    case CS_MATRIX_BSR:
       {
         cs_matrix_coeff_msr_t *coeffs = m->coeffs;
         _destroy_coeff_msr(&coeffs);
         m->coeffs = NULL;
       }
       break;
+    case CS_MATRIX_FREE:
+      {
+        cs_matrix_coeff_free_t *coeffs = m->coeffs;
+        _destroy_coeff_free(&coeffs);
+        m->coeffs = NULL;
+      }
+      break;
     default:
       assert(0);
       break;
@@ -5875,6 +7721,93 @@ cs_matrix_transfer_coefficients_msr(cs_matrix_t         *matrix,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set coefficients of a matrix-free convection-diffusion operator,
+ * sharing arrays with the caller.
+ *
+ * Only the diagonal is stored; extradiagonal terms are computed on the fly
+ * from face values during matrix.vector products, using the same
+ * expressions as \ref cs_matrix_scalar and \ref cs_sym_matrix_scalar:
+ * \f$ X_{ij} = \theta (c_i (\dot{m}_{ij})^- - \mu_{ij}) \f$ and
+ * \f$ X_{ji} = \theta (c_j (-\dot{m}_{ij})^- - \mu_{ij}) \f$.
+ * This avoids storing and streaming 2 extradiagonal values per interior face.
+ *
+ * With block diagonal sizes, extradiagonal terms are applied to each
+ * component (as for \ref cs_matrix_vector).
+ *
+ * The matrix becomes unusable if the arrays passed as arguments are
+ * modified (its coefficients should be released first to mark this).
+ *
+ * \param[in, out]  matrix           pointer to matrix structure
+ *                                   (type CS_MATRIX_FREE)
+ * \param[in]       symmetric        indicates if matrix coefficients
+ *                                   are symmetric (in which case
+ *                                   convection is ignored)
+ * \param[in]       diag_block_size  block sizes for diagonal, or NULL
+ * \param[in]       iconvp           1 for convection, 0 otherwise
+ * \param[in]       idiffp           1 for diffusion, 0 otherwise
+ * \param[in]       thetap           weighting coefficient for the
+ *                                   theta-scheme
+ * \param[in]       xcpp             array of specific heat (Cp), or NULL
+ * \param[in]       i_massflux       mass flux at interior faces
+ *                                   (NULL if iconvp = 0)
+ * \param[in]       i_visc           face viscosity at interior faces
+ *                                   (NULL if idiffp = 0)
+ * \param[in]       da               diagonal values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_coefficients_conv_diff(cs_matrix_t      *matrix,
+                                     bool              symmetric,
+                                     const int        *diag_block_size,
+                                     int               iconvp,
+                                     int               idiffp,
+                                     double            thetap,
+                                     const cs_real_t   xcpp[],
+                                     const cs_real_t   i_massflux[],
+                                     const cs_real_t   i_visc[],
+                                     const cs_real_t  *da)
+{
+  if (matrix == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("The matrix is not defined."));
+
+  if (matrix->type != CS_MATRIX_FREE)
+    bft_error
+      (__FILE__, __LINE__, 0,
+       _("Matrix format %s does not handle coefficient assignment\n"
+         "from face-based convection-diffusion values."),
+       cs_matrix_type_name[matrix->type]);
+
+  if (da == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("A matrix-free operator requires diagonal values."));
+
+  cs_base_check_bool(&symmetric);
+
+  /* Set fill type */
+
+  _set_fill_info(matrix, symmetric, diag_block_size, NULL);
+
+  /* Map coefficients; no extradiagonal array is available */
+
+  cs_matrix_coeff_free_t  *mc = matrix->coeffs;
+
+  mc->symmetric = symmetric;
+  mc->iconvp = iconvp;
+  mc->idiffp = idiffp;
+  mc->thetap = thetap;
+
+  mc->da = da;
+  mc->i_visc = (idiffp != 0) ? i_visc : NULL;
+  mc->i_massflux = (iconvp != 0 && !symmetric) ? i_massflux : NULL;
+  mc->xcpp = (mc->i_massflux != NULL) ? xcpp : NULL;
+
+  matrix->xa = NULL;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Release shared matrix coefficients.
@@ -6024,6 +7957,8 @@ cs_matrix_get_diagonal(const cs_matrix_t  *matrix)
     break;
 
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
+  case CS_MATRIX_BSR:
     {
       cs_matrix_coeff_msr_t *mc = matrix->coeffs;
       if (mc->d_val == NULL) {
@@ -6041,6 +7976,13 @@ cs_matrix_get_diagonal(const cs_matrix_t  *matrix)
     }
     break;
 
+  case CS_MATRIX_FREE:
+    {
+      const cs_matrix_coeff_free_t *mc = matrix->coeffs;
+      diag = mc->da;
+    }
+    break;
+
   default:
     assert(0);
     break;
@@ -6168,7 +8110,9 @@ cs_matrix_get_row(const cs_matrix_t     *matrix,
     {
       const cs_lnum_t _row_id = row_id / b_size;
       const cs_matrix_struct_csr_t  *ms = matrix->structure;
-      const cs_matrix_coeff_csr_t  *mc = matrix->coeffs;
+      const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+      /* Scalar extradiagonal values may be stored in single precision */
+      const float *x_val_f = (mc->x_val == NULL) ? mc->_x_val_f : NULL;
       const cs_lnum_t n_ed_cols =   ms->row_index[_row_id+1]
                                   - ms->row_index[_row_id];
       if (b_size == 1)
@@ -6187,25 +8131,28 @@ cs_matrix_get_row(const cs_matrix_t     *matrix,
       cs_lnum_t ii = 0, jj = 0;
       const cs_lnum_t *restrict c_id = ms->col_id + ms->row_index[_row_id];
       if (b_size == 1) {
-        const cs_real_t *m_row = mc->val + ms->row_index[_row_id];
+        const cs_lnum_t s_id = ms->row_index[_row_id];
         for (jj = 0; jj < n_ed_cols && c_id[jj] < _row_id; jj++) {
           r->_col_id[ii] = c_id[jj];
-          r->_vals[ii++] = m_row[jj];
+          r->_vals[ii++] = (x_val_f != NULL) ?
+            x_val_f[s_id + jj] : mc->x_val[s_id + jj];
         }
         r->_col_id[ii] = _row_id;
         r->_vals[ii++] = mc->d_val[_row_id];
         for (; jj < n_ed_cols; jj++) {
           r->_col_id[ii] = c_id[jj];
-          r->_vals[ii++] = m_row[jj];
+          r->_vals[ii++] = (x_val_f != NULL) ?
+            x_val_f[s_id + jj] : mc->x_val[s_id + jj];
         }
       }
       else if (matrix->eb_size[0] == 1) {
         const cs_lnum_t _sub_id = row_id % b_size;
-        const cs_lnum_t *db_size = matrix->db_size;
-        const cs_real_t *m_row = mc->val + ms->row_index[_row_id];
+        const int *db_size = matrix->db_size;
+        const cs_lnum_t s_id = ms->row_index[_row_id];
         for (jj = 0; jj < n_ed_cols && c_id[jj] < _row_id; jj++) {
           r->_col_id[ii] = c_id[jj]*b_size + _sub_id;
-          r->_vals[ii++] = m_row[jj];
+          r->_vals[ii++] = (x_val_f != NULL) ?
+            x_val_f[s_id + jj] : mc->x_val[s_id + jj];
         }
         for (cs_lnum_t kk = 0; kk < b_size; kk++) {
           r->_col_id[ii] = _row_id*b_size + kk;
@@ -6214,18 +8161,20 @@ cs_matrix_get_row(const cs_matrix_t     *matrix,
         }
         for (; jj < n_ed_cols; jj++) {
           r->_col_id[ii] = c_id[jj]*b_size + _sub_id;
-          r->_vals[ii++] = m_row[jj];
+          r->_vals[ii++] = (x_val_f != NULL) ?
+            x_val_f[s_id + jj] : mc->x_val[s_id + jj];
         }
       }
       else {
         const cs_lnum_t _sub_id = row_id % b_size;
-        const cs_lnum_t *db_size = matrix->db_size;
-        const cs_lnum_t *eb_size = matrix->db_size;
-        const cs_real_t *m_row = mc->val + ms->row_index[_row_id]*eb_size[3];
+        const int *db_size = matrix->db_size;
+        const int *eb_size = matrix->eb_size;
+        const cs_real_t *m_row
+          = mc->x_val + ms->row_index[_row_id]*eb_size[3];
         for (jj = 0; jj < n_ed_cols && c_id[jj] < _row_id; jj++) {
           for (cs_lnum_t kk = 0; kk < b_size; kk++) {
             r->_col_id[ii] = c_id[jj]*b_size + kk;
-            r->_vals[ii++] = m_row[_sub_id*eb_size[2] + kk];
+            r->_vals[ii++] = m_row[jj*eb_size[3] + _sub_id*eb_size[2] + kk];
           }
         }
         for (cs_lnum_t kk = 0; kk < b_size; kk++) {
@@ -6236,13 +8185,100 @@ cs_matrix_get_row(const cs_matrix_t     *matrix,
         for (; jj < n_ed_cols; jj++) {
           for (cs_lnum_t kk = 0; kk < b_size; kk++) {
             r->_col_id[ii] = c_id[jj]*b_size + kk;
-            r->_vals[ii++] = m_row[_sub_id*eb_size[2] + kk];
+            r->_vals[ii++] = m_row[jj*eb_size[3] + _sub_id*eb_size[2] + kk];
           }
         }
       }
     }
     break;
 
+  case CS_MATRIX_SELL:
+    {
+      const cs_lnum_t _row_id = row_id / b_size;
+      const cs_matrix_struct_sell_t  *ms = matrix->structure;
+      const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+      const cs_lnum_t n_ed_cols =   ms->row_index[_row_id+1]
+                                  - ms->row_index[_row_id];
+      const cs_lnum_t pos = ms->row_pos[_row_id];
+      const cs_lnum_t s_id =   ms->chunk_index[pos / CS_MATRIX_SELL_C]
+                             + pos % CS_MATRIX_SELL_C;
+      const cs_lnum_t *restrict c_id = ms->col_id + s_id;
+      const cs_real_t *restrict m_row = mc->x_val + s_id;
+      const cs_lnum_t _sub_id = row_id % b_size;
+      const int *db_size = matrix->db_size;
+      r->row_size = n_ed_cols + b_size;
+      if (r->buffer_size < r->row_size) {
+        r->buffer_size = r->row_size*2;
+        BFT_REALLOC(r->_col_id, r->buffer_size, cs_lnum_t);
+        r->col_id = r->_col_id;
+        BFT_REALLOC(r->_vals, r->buffer_size, cs_real_t);
+        r->vals = r->_vals;
+      }
+      cs_lnum_t ii = 0, jj = 0;
+      for (jj = 0;
+           jj < n_ed_cols && c_id[jj*CS_MATRIX_SELL_C] < _row_id;
+           jj++) {
+        r->_col_id[ii] = c_id[jj*CS_MATRIX_SELL_C]*b_size + _sub_id;
+        r->_vals[ii++] = m_row[jj*CS_MATRIX_SELL_C];
+      }
+      for (cs_lnum_t kk = 0; kk < b_size; kk++) {
+        r->_col_id[ii] = _row_id*b_size + kk;
+        r->_vals[ii++] = mc->d_val[  _row_id*db_size[3]
+                                   + _sub_id*db_size[2] + kk];
+      }
+      for (; jj < n_ed_cols; jj++) {
+        r->_col_id[ii] = c_id[jj*CS_MATRIX_SELL_C]*b_size + _sub_id;
+        r->_vals[ii++] = m_row[jj*CS_MATRIX_SELL_C];
+      }
+    }
+    break;
+
+  case CS_MATRIX_BSR:
+    {
+      const cs_lnum_t _row_id = row_id / b_size;
+      const cs_matrix_struct_csr_t  *ms = matrix->structure;
+      const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+      const cs_lnum_t n_ed_cols =   ms->row_index[_row_id+1]
+                                  - ms->row_index[_row_id];
+      const cs_lnum_t _sub_id = row_id % b_size;
+      const int *db_size = matrix->db_size;
+      const int *eb_size = matrix->eb_size;
+      /* With scalar extradiagonal terms, only the matching
+         component of each neighbor column is coupled */
+      const cs_lnum_t e_b_size = eb_size[0];
+      const cs_lnum_t e_shift = (e_b_size > 1) ? _sub_id*eb_size[2] : 0;
+      const cs_lnum_t *restrict c_id = ms->col_id + ms->row_index[_row_id];
+      const cs_real_t *restrict m_row
+        = mc->x_val + ms->row_index[_row_id]*eb_size[3];
+      r->row_size = n_ed_cols*e_b_size + b_size;
+      if (r->buffer_size < r->row_size) {
+        r->buffer_size = r->row_size*2;
+        BFT_REALLOC(r->_col_id, r->buffer_size, cs_lnum_t);
+        r->col_id = r->_col_id;
+        BFT_REALLOC(r->_vals, r->buffer_size, cs_real_t);
+        r->vals = r->_vals;
+      }
+      cs_lnum_t ii = 0, jj = 0;
+      for (jj = 0; jj < n_ed_cols && c_id[jj] < _row_id; jj++) {
+        for (cs_lnum_t kk = 0; kk < e_b_size; kk++) {
+          r->_col_id[ii] = c_id[jj]*b_size + ((e_b_size > 1) ? kk : _sub_id);
+          r->_vals[ii++] = m_row[jj*eb_size[3] + e_shift + kk];
+        }
+      }
+      for (cs_lnum_t kk = 0; kk < b_size; kk++) {
+        r->_col_id[ii] = _row_id*b_size + kk;
+        r->_vals[ii++] = mc->d_val[  _row_id*db_size[3]
+                                   + _sub_id*db_size[2] + kk];
+      }
+      for (; jj < n_ed_cols; jj++) {
+        for (cs_lnum_t kk = 0; kk < e_b_size; kk++) {
+          r->_col_id[ii] = c_id[jj]*b_size + ((e_b_size > 1) ? kk : _sub_id);
+          r->_vals[ii++] = m_row[jj*eb_size[3] + e_shift + kk];
+        }
+      }
+    }
+    break;
+
   default:
     bft_error
       (__FILE__, __LINE__, 0,
@@ -6401,6 +8437,91 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get single precision extra-diagonal values of a matrix
+ *        in MSR format.
+ *
+ * This function only works for an MSR matrix whose coefficients are
+ * stored in mixed precision (see \ref cs_matrix_set_mixed_precision);
+ * in this case, the extra-diagonal values returned by
+ * \ref cs_matrix_get_msr_arrays are NULL.
+ *
+ * \param[in]  matrix  pointer to matrix structure
+ *
+ * \return  pointer to single precision extra-diagonal values, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+const float *
+cs_matrix_get_msr_x_val_float(const cs_matrix_t  *matrix)
+{
+  const float *x_val_f = NULL;
+
+  if (matrix->type == CS_MATRIX_MSR) {
+    const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+    if (mc != NULL && mc->x_val == NULL)
+      x_val_f = mc->_x_val_f;
+  }
+
+  return x_val_f;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether a matrix's extra-diagonal coefficients should
+ *        be stored in single precision.
+ *
+ * Only MSR matrices with scalar extra-diagonal coefficients are handled;
+ * this setting is ignored for other matrix types. Diagonal coefficients
+ * and vectors remain in double precision, and matrix.vector products
+ * are accumulated in double precision, so this mainly reduces the
+ * memory bandwidth required by those products (i.e. for coarse
+ * multigrid levels).
+ *
+ * This setting applies to coefficients assigned after this call.
+ *
+ * \param[in, out]  matrix  pointer to matrix structure
+ * \param[in]       mixed   true to store extra-diagonal coefficients
+ *                          in single precision
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_mixed_precision(cs_matrix_t  *matrix,
+                              bool          mixed)
+{
+  if (matrix == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("The matrix is not defined."));
+
+  if (matrix->type != CS_MATRIX_MSR)
+    return;
+
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  mc->x_float = mixed;
+
+  if (mixed) {
+    for (int i = 0; i < 2; i++) {
+      matrix->vector_multiply[CS_MATRIX_SCALAR][i] = _mat_vec_p_l_msr_f;
+      matrix->vector_multiply[CS_MATRIX_SCALAR_SYM][i] = _mat_vec_p_l_msr_f;
+      matrix->vector_multiply[CS_MATRIX_BLOCK_D][i] = _b_mat_vec_p_l_msr_f;
+      matrix->vector_multiply[CS_MATRIX_BLOCK_D_66][i] = _b_mat_vec_p_l_msr_f;
+      matrix->vector_multiply[CS_MATRIX_BLOCK_D_SYM][i] = _b_mat_vec_p_l_msr_f;
+    }
+  }
+  else {
+    for (cs_matrix_fill_type_t mft = 0; mft < CS_MATRIX_N_FILL_TYPES; mft++)
+      _set_spmv_func(matrix->type,
+                     matrix->numbering,
+                     mft,
+                     2,    /* ed_flag */
+                     NULL, /* func_name */
+                     matrix->vector_multiply);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Matrix.vector product y = A.x
@@ -6424,11 +8545,14 @@ cs_matrix_vector_multiply(cs_halo_rotation_t   rotation_mode,
 {
   assert(matrix != NULL);
 
-  if (matrix->halo != NULL)
+  if (matrix->halo != NULL) {
+    if (_vector_multiply_overlap(rotation_mode, false, matrix, x, y))
+      return;
     _pre_vector_multiply_sync(rotation_mode,
                               matrix,
                               x,
                               y);
+  }
 
   if (matrix->vector_multiply[matrix->fill_type][0] != NULL)
     matrix->vector_multiply[matrix->fill_type][0](false, matrix, x, y);
@@ -6493,11 +8617,14 @@ cs_matrix_exdiag_vector_multiply(cs_halo_rotation_t   rotation_mode,
 {
   assert(matrix != NULL);
 
-  if (matrix->halo != NULL)
+  if (matrix->halo != NULL) {
+    if (_vector_multiply_overlap(rotation_mode, true, matrix, x, y))
+      return;
     _pre_vector_multiply_sync(rotation_mode,
                               matrix,
                               x,
                               y);
+  }
 
   if (matrix->vector_multiply[matrix->fill_type][1] != NULL)
     matrix->vector_multiply[matrix->fill_type][1](true, matrix, x, y);
@@ -6508,6 +8635,47 @@ cs_matrix_exdiag_vector_multiply(cs_halo_rotation_t   rotation_mode,
        cs_matrix_fill_type_name[matrix->fill_type]);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether halo exchanges are overlapped with computation
+ *        in matrix.vector products.
+ *
+ * \return  true if overlap is active, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_get_halo_overlap(void)
+{
+  return _halo_overlap;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set overlap of halo exchanges with computation in
+ *        matrix.vector products.
+ *
+ * When active, cs_matrix_vector_multiply() and
+ * cs_matrix_exdiag_vector_multiply() start the halo exchange, compute
+ * rows which do not reference ghost values, then complete the exchange
+ * and compute the remaining rows. This is handled for CSR and MSR
+ * matrices using the default product variants; other cases use the
+ * standard synchronous exchange.
+ *
+ * Only leading rows with no ghost columns are computed before the
+ * exchange completes, so this is most effective when cells adjacent to
+ * the halo are numbered last (see \ref cs_renumber_set_algorithm).
+ *
+ * \param[in]  overlap  true to overlap halo exchanges, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_halo_overlap(bool  overlap)
+{
+  _halo_overlap = overlap;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Build matrix variant
@@ -6787,6 +8955,64 @@ cs_matrix_variant_build_list(int                      n_fill_types,
 
   }
 
+  if (type_filter[CS_MATRIX_SELL]) {
+
+    _variant_add(_("SELL"),
+                 CS_MATRIX_SELL,
+                 n_fill_types,
+                 fill_types,
+                 2, /* ed_flag */
+                 _mat_vec_p_l_sell,
+                 _b_mat_vec_p_l_sell,
+                 NULL,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+    _variant_add(_("SELL, generic"),
+                 CS_MATRIX_SELL,
+                 n_fill_types,
+                 fill_types,
+                 2, /* ed_flag */
+                 NULL,
+                 _b_mat_vec_p_l_sell_generic,
+                 NULL,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+  }
+
+  /* BSR only differs from MSR for full extradiagonal blocks */
+
+  if (type_filter[CS_MATRIX_BSR]) {
+
+    _variant_add(_("BSR"),
+                 CS_MATRIX_BSR,
+                 n_fill_types,
+                 fill_types,
+                 2, /* ed_flag */
+                 NULL,
+                 NULL,
+                 _bb_mat_vec_p_l_bsr,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+    _variant_add(_("BSR, generic"),
+                 CS_MATRIX_BSR,
+                 n_fill_types,
+                 fill_types,
+                 2, /* ed_flag */
+                 NULL,
+                 NULL,
+                 _bb_mat_vec_p_l_bsr_generic,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+  }
+
   n_variants_max = *n_variants;
   BFT_REALLOC(*m_variant, *n_variants, cs_matrix_variant_t);
 }
@@ -6832,6 +9058,17 @@ cs_matrix_variant_destroy(cs_matrix_variant_t  **mv)
  *     fixed           (for CS_MATRIX_??_BLOCK_D or CS_MATRIX_??_BLOCK_D_SYM)
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *
+ *   CS_MATRIX_SELL    (all fill types except CS_MATRIX_33_BLOCK)
+ *     standard
+ *     generic         (for CS_MATRIX_??_BLOCK_D or CS_MATRIX_??_BLOCK_D_SYM)
+ *
+ *   CS_MATRIX_BSR     (all fill types)
+ *     standard        (3x3 and 6x6 fixed blocks, or generic)
+ *     generic         (for CS_MATRIX_BLOCK)
+ *
+ *   CS_MATRIX_FREE    (all fill types except CS_MATRIX_BLOCK)
+ *     standard
+ *
  * parameters:
  *   mv        <-> Pointer to matrix variant
  *   numbering <-- mesh numbering info, or NULL
@@ -6946,7 +9183,7 @@ cs_matrix_variant_test(cs_lnum_t              n_rows,
                        const cs_numbering_t  *numbering)
 {
   int  n_variants = 0;
-  bool type_filter[CS_MATRIX_N_TYPES] = {true, true, true, true};
+  bool type_filter[CS_MATRIX_N_TYPES] = {true, true, true, true, true, true};
   cs_matrix_fill_type_t  fill_types[] = {CS_MATRIX_SCALAR,
                                          CS_MATRIX_SCALAR_SYM,
                                          CS_MATRIX_BLOCK_D,
@@ -57,6 +57,10 @@ typedef enum {
   CS_MATRIX_CSR,        /* Compressed Sparse Row storage format */
   CS_MATRIX_CSR_SYM,    /* Compressed Symmetric Sparse Row storage format */
   CS_MATRIX_MSR,        /* Modified Compressed Sparse Row storage format */
+  CS_MATRIX_SELL,       /* Sliced ELLPACK (SELL-C-sigma) storage format */
+  CS_MATRIX_BSR,        /* Block Compressed Sparse Row storage format */
+  CS_MATRIX_FREE,       /* Matrix-free (face-based) convection-diffusion
+                           operator, with no stored extradiagonal terms */
   CS_MATRIX_N_TYPES     /* Number of known matrix types */
 
 } cs_matrix_type_t;
@@ -521,6 +525,49 @@ cs_matrix_transfer_coefficients_msr(cs_matrix_t         *matrix,
                                     cs_real_t          **d_val,
                                     cs_real_t          **x_val);
 
+/*----------------------------------------------------------------------------
+ * Set coefficients of a matrix-free convection-diffusion operator,
+ * sharing arrays with the caller.
+ *
+ * Only the diagonal is stored; extradiagonal terms are computed on the fly
+ * from face values during matrix.vector products, using the same
+ * expressions as cs_matrix_scalar() and cs_sym_matrix_scalar():
+ *   X_ij = thetap*(iconvp*xcpp_i*(m_ij)^- - idiffp*i_visc_ij)
+ *   X_ji = thetap*(iconvp*xcpp_j*(-m_ij)^- - idiffp*i_visc_ij)
+ *
+ * With block diagonal sizes, extradiagonal terms are applied to each
+ * component (as for cs_matrix_vector()).
+ *
+ * The matrix becomes unusable if the arrays passed as arguments are
+ * modified (its coefficients should be released first to mark this).
+ *
+ * parameters:
+ *   matrix           <-> pointer to matrix structure (type CS_MATRIX_FREE)
+ *   symmetric        <-- indicates if matrix coefficients are symmetric
+ *                        (in which case convection is ignored)
+ *   diag_block_size  <-- block sizes for diagonal, or NULL
+ *   iconvp           <-- 1 for convection, 0 otherwise
+ *   idiffp           <-- 1 for diffusion, 0 otherwise
+ *   thetap           <-- weighting coefficient for the theta-scheme
+ *   xcpp             <-- array of specific heat (Cp), or NULL
+ *   i_massflux       <-- mass flux at interior faces (NULL if iconvp = 0)
+ *   i_visc           <-- face viscosity at interior faces
+ *                        (NULL if idiffp = 0)
+ *   da               <-- diagonal values
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_coefficients_conv_diff(cs_matrix_t      *matrix,
+                                     bool              symmetric,
+                                     const int        *diag_block_size,
+                                     int               iconvp,
+                                     int               idiffp,
+                                     double            thetap,
+                                     const cs_real_t   xcpp[],
+                                     const cs_real_t   i_massflux[],
+                                     const cs_real_t   i_visc[],
+                                     const cs_real_t  *da);
+
 /*----------------------------------------------------------------------------
  * Release shared matrix coefficients.
  *
@@ -714,6 +761,45 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
                          const cs_real_t    **d_val,
                          const cs_real_t    **x_val);
 
+/*----------------------------------------------------------------------------
+ * Get single precision extra-diagonal values of a matrix in MSR format.
+ *
+ * This function only works for an MSR matrix whose coefficients are
+ * stored in mixed precision (see cs_matrix_set_mixed_precision);
+ * in this case, the extra-diagonal values returned by
+ * cs_matrix_get_msr_arrays are NULL.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *
+ * returns:
+ *   pointer to single precision extra-diagonal values, or NULL
+ *----------------------------------------------------------------------------*/
+
+const float *
+cs_matrix_get_msr_x_val_float(const cs_matrix_t  *matrix);
+
+/*----------------------------------------------------------------------------
+ * Indicate whether a matrix's extra-diagonal coefficients should
+ * be stored in single precision.
+ *
+ * Only MSR matrices with scalar extra-diagonal coefficients are handled;
+ * this setting is ignored for other matrix types. Diagonal coefficients
+ * and vectors remain in double precision, and matrix.vector products
+ * are accumulated in double precision.
+ *
+ * This setting applies to coefficients assigned after this call.
+ *
+ * parameters:
+ *   matrix <-> pointer to matrix structure
+ *   mixed  <-- true to store extra-diagonal coefficients
+ *              in single precision
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_mixed_precision(cs_matrix_t  *matrix,
+                              bool          mixed);
+
 /*----------------------------------------------------------------------------
  * Matrix.vector product y = A.x
  *
@@ -769,6 +855,38 @@ cs_matrix_exdiag_vector_multiply(cs_halo_rotation_t   rotation_mode,
                                  cs_real_t           *restrict x,
                                  cs_real_t           *restrict y);
 
+/*----------------------------------------------------------------------------
+ * Indicate whether halo exchanges are overlapped with computation
+ * in matrix.vector products.
+ *
+ * returns:
+ *   true if overlap is active, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_get_halo_overlap(void);
+
+/*----------------------------------------------------------------------------
+ * Set overlap of halo exchanges with computation in matrix.vector products.
+ *
+ * When active, cs_matrix_vector_multiply() and
+ * cs_matrix_exdiag_vector_multiply() start the halo exchange, compute
+ * rows which do not reference ghost values, then complete the exchange
+ * and compute the remaining rows. This is handled for CSR and MSR
+ * matrices using the default product variants; other cases use the
+ * standard synchronous exchange.
+ *
+ * Only leading rows with no ghost columns are computed before the
+ * exchange completes, so this is most effective when cells adjacent to
+ * the halo are numbered last (see cs_renumber_set_algorithm()).
+ *
+ * parameters:
+ *   overlap <-- true to overlap halo exchanges, false otherwise
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_halo_overlap(bool  overlap);
+
 /*----------------------------------------------------------------------------
  * Build list of variants for tuning or testing.
  *
@@ -841,6 +959,17 @@ cs_matrix_variant_destroy(cs_matrix_variant_t  **mv);
  *     generic         (for CS_MATRIX_??_BLOCK_D or CS_MATRIX_??_BLOCK_D_SYM)
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *
+ *   CS_MATRIX_SELL    (all fill types except CS_MATRIX_33_BLOCK)
+ *     standard
+ *     generic         (for CS_MATRIX_??_BLOCK_D or CS_MATRIX_??_BLOCK_D_SYM)
+ *
+ *   CS_MATRIX_BSR     (all fill types)
+ *     standard        (3x3 and 6x6 fixed blocks, or generic)
+ *     generic         (for CS_MATRIX_BLOCK)
+ *
+ *   CS_MATRIX_FREE    (all fill types except CS_MATRIX_BLOCK)
+ *     standard
+ *
  * parameters:
  *   mv        <-> pointer to matrix variant
  *   numbering <-- mesh numbering info, or NULL
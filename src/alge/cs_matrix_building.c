@@ -269,6 +269,148 @@ cs_matrix_wrapper_scalar(int               iconvp,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Diagonal-only counterpart of cs_matrix_wrapper_scalar, for use with
+ * matrix-free (CS_MATRIX_FREE) operators: the extradiagonal terms are
+ * recomputed from face values when needed, so are not stored here.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_wrapper_scalar_diagonal(int               iconvp,
+                                  int               idiffp,
+                                  int               ndircp,
+                                  int               isym,
+                                  double            thetap,
+                                  int               imucpp,
+                                  const cs_real_t   coefbp[],
+                                  const cs_real_t   cofbfp[],
+                                  const cs_real_t   rovsdt[],
+                                  const cs_real_t   i_massflux[],
+                                  const cs_real_t   b_massflux[],
+                                  const cs_real_t   i_visc[],
+                                  const cs_real_t   b_visc[],
+                                  const cs_real_t   xcpp[],
+                                  cs_real_t         da[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+
+  if (isym != 1 && isym != 2) {
+    bft_error(__FILE__, __LINE__, 0,
+              _("invalid value of isym"));
+  }
+
+  /* Symmetric matrix: no convection */
+  if (isym == 1)
+    iconvp = 0;
+
+  /* 1. Initialization */
+
+# pragma omp parallel for
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    da[cell_id] = rovsdt[cell_id];
+  }
+  if (n_cells_ext > n_cells) {
+#   pragma omp parallel for if (n_cells_ext - n_cells > CS_THR_MIN)
+    for (cs_lnum_t cell_id = n_cells; cell_id < n_cells_ext; cell_id++) {
+      da[cell_id] = 0.;
+    }
+  }
+
+  /* 2. Contribution of the extra-diagonal terms to the diagonal,
+        with the same extradiagonal terms as cs_matrix_scalar */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#   pragma omp parallel for firstprivate(thetap, iconvp, idiffp)
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = i_face_cells[face_id][0];
+        cs_lnum_t jj = i_face_cells[face_id][1];
+
+        double visc = idiffp*i_visc[face_id];
+
+        if (iconvp == 0) {
+          da[ii] += thetap*visc;
+          da[jj] += thetap*visc;
+        }
+        else {
+          double m_ij = i_massflux[face_id];
+          double cpi = (imucpp == 0) ? 1. : xcpp[ii];
+          double cpj = (imucpp == 0) ? 1. : xcpp[jj];
+
+          double flui = 0.5*(m_ij -fabs(m_ij));
+          double fluj =-0.5*(m_ij +fabs(m_ij));
+
+          /* D_ii = -X_ij - (1-theta)*m_ij
+           * D_jj = -X_ji + (1-theta)*m_ij
+           */
+          da[ii] -= thetap*(cpi*flui - visc) + (1. - thetap)*cpi*m_ij;
+          da[jj] -= thetap*(cpj*fluj - visc) - (1. - thetap)*cpj*m_ij;
+        }
+
+      }
+    }
+  }
+
+  /* 3. Contribution of border faces to the diagonal */
+
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+#   pragma omp parallel for firstprivate(thetap, iconvp, idiffp) \
+                        if(m->n_b_faces > CS_THR_MIN)
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+      for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = b_face_cells[face_id];
+
+        da[ii] += idiffp*thetap*b_visc[face_id]*cofbfp[face_id];
+
+        if (iconvp != 0) {
+          double cpi = (imucpp == 0) ? 1. : xcpp[ii];
+          double flui = 0.5*(b_massflux[face_id] - fabs(b_massflux[face_id]));
+          da[ii] += cpi*(flui*thetap*(coefbp[face_id]-1.)
+                         -(1.-thetap)*b_massflux[face_id]);
+        }
+
+      }
+    }
+  }
+
+  /* Penalization if non invertible matrix (as in cs_matrix_wrapper_scalar) */
+
+  if (ndircp <= 0) {
+    const double epsi = 1.e-7;
+
+#   pragma omp parallel for
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      da[cell_id] = (1.+epsi)*da[cell_id];
+    }
+  }
+
+  /* If a whole line of the matrix is 0, the diagonal is set to 1 */
+# pragma omp parallel for
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    da[cell_id] += mq->c_solid_flag[CS_MIN(cs_glob_porous_model, 1)*cell_id];
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Wrapper to cs_matrix_scalar for convection/diffusion multigrid
  *----------------------------------------------------------------------------*/
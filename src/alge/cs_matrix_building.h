@@ -124,6 +124,28 @@ cs_matrix_wrapper_scalar(int               iconvp,
                          cs_real_t         da[],
                          cs_real_t         xa[]);
 
+/*----------------------------------------------------------------------------
+ * Diagonal-only counterpart of cs_matrix_wrapper_scalar, for use with
+ * matrix-free (CS_MATRIX_FREE) operators.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_wrapper_scalar_diagonal(int               iconvp,
+                                  int               idiffp,
+                                  int               ndircp,
+                                  int               isym,
+                                  double            thetap,
+                                  int               imucpp,
+                                  const cs_real_t   coefbp[],
+                                  const cs_real_t   cofbfp[],
+                                  const cs_real_t   rovsdt[],
+                                  const cs_real_t   i_massflux[],
+                                  const cs_real_t   b_massflux[],
+                                  const cs_real_t   i_visc[],
+                                  const cs_real_t   b_visc[],
+                                  const cs_real_t   xcpp[],
+                                  cs_real_t         da[]);
+
 /*----------------------------------------------------------------------------
  * Wrapper to cs_matrix_scalar for convection/diffusion multigrid
  *----------------------------------------------------------------------------*/
@@ -125,6 +125,11 @@ static cs_matrix_t *_matrix_msr = NULL;
 static cs_matrix_structure_t *_matrix_struct_native = NULL;
 static cs_matrix_t *_matrix_native = NULL;
 
+/* Matrix-free operator structure, if needed */
+
+static cs_matrix_structure_t *_matrix_struct_free = NULL;
+static cs_matrix_t *_matrix_free = NULL;
+
 /* Tuning options */
 
 static double _t_measure = 0.5;
@@ -156,6 +161,8 @@ _initialize_api(void)
     _matrix_msr = NULL;
     _matrix_struct_native = NULL;
     _matrix_native = NULL;
+    _matrix_struct_free = NULL;
+    _matrix_free = NULL;
     _initialized = true;
   }
 }
@@ -458,6 +465,11 @@ cs_matrix_finalize(void)
   if (_matrix_struct_native != NULL)
     cs_matrix_structure_destroy(&(_matrix_struct_native));
 
+  if (_matrix_free != NULL)
+    cs_matrix_destroy(&(_matrix_free));
+  if (_matrix_struct_free != NULL)
+    cs_matrix_structure_destroy(&(_matrix_struct_free));
+
   _initialized = false;
   _initialize_api();
   _initialized = false;
@@ -575,6 +587,28 @@ cs_matrix_update_mesh(void)
 
   }
 
+  /* ...and matrix-free operator */
+
+  if (_matrix_free != NULL) {
+
+    cs_matrix_destroy(&(_matrix_free));
+    cs_matrix_structure_destroy(&(_matrix_struct_free));
+
+    _matrix_struct_free
+      = cs_matrix_structure_create(CS_MATRIX_FREE,
+                                   true,
+                                   mesh->n_cells,
+                                   mesh->n_cells_with_ghosts,
+                                   mesh->n_i_faces,
+                                   mesh->global_cell_num,
+                                   (const cs_lnum_2_t *)(mesh->i_face_cells),
+                                   mesh->halo,
+                                   mesh->i_face_numbering);
+
+    _matrix_free = cs_matrix_create(_matrix_struct_free);
+
+  }
+
 }
 
 /*----------------------------------------------------------------------------
@@ -743,6 +777,43 @@ cs_matrix_native(bool        symmetric,
   return m;
 }
 
+/*----------------------------------------------------------------------------
+ * Return matrix-free convection-diffusion operator.
+ *
+ * Coefficients of the returned matrix should be assigned using
+ * cs_matrix_set_coefficients_conv_diff().
+ *
+ * returns:
+ *   pointer to matrix-free operator based on mesh faces
+ *----------------------------------------------------------------------------*/
+
+cs_matrix_t  *
+cs_matrix_free_operator(void)
+{
+  /* Create matrix if not done yet */
+
+  if (_matrix_free == NULL) {
+
+    cs_mesh_t  *mesh = cs_glob_mesh;
+
+    _matrix_struct_free
+      = cs_matrix_structure_create(CS_MATRIX_FREE,
+                                   true,
+                                   mesh->n_cells,
+                                   mesh->n_cells_with_ghosts,
+                                   mesh->n_i_faces,
+                                   mesh->global_cell_num,
+                                   (const cs_lnum_2_t *)(mesh->i_face_cells),
+                                   mesh->halo,
+                                   mesh->i_face_numbering);
+
+    _matrix_free = cs_matrix_create(_matrix_struct_free);
+
+  }
+
+  return _matrix_free;
+}
+
 /*----------------------------------------------------------------------------
  * Force matrix variant for a given fill type
  *
@@ -157,6 +157,19 @@ cs_matrix_native(bool        symmetric,
                  const int  *diag_block_size,
                  const int  *extra_diag_block_size);
 
+/*----------------------------------------------------------------------------
+ * Return matrix-free convection-diffusion operator.
+ *
+ * Coefficients of the returned matrix should be assigned using
+ * cs_matrix_set_coefficients_conv_diff().
+ *
+ * returns:
+ *   pointer to matrix-free operator based on mesh faces
+ *----------------------------------------------------------------------------*/
+
+cs_matrix_t  *
+cs_matrix_free_operator(void);
+
 /*----------------------------------------------------------------------------
  * Force matrix variant for a given fill type
  *
@@ -45,6 +45,16 @@ BEGIN_C_DECLS
  * Macro definitions
  *============================================================================*/
 
+/* Number of rows per slice for SELL-C-sigma matrices (C); should be
+   a multiple of the SIMD width in cs_real_t units */
+
+#define CS_MATRIX_SELL_C         8
+
+/* Sorting window for SELL-C-sigma matrices, in rows (sigma);
+   should be a multiple of CS_MATRIX_SELL_C */
+
+#define CS_MATRIX_SELL_SIGMA   256
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -54,6 +64,10 @@ BEGIN_C_DECLS
  *  - Native
  *  - Compressed Sparse Row (CSR)
  *  - Symmetric Compressed Sparse Row (CSR_SYM)
+ *  - Modified Compressed Sparse Row (MSR)
+ *  - Sliced ELLPACK (SELL-C-sigma)
+ *  - Block Compressed Sparse Row (BSR)
+ *  - Matrix-free (face-based) convection-diffusion operator
  */
 
 /*----------------------------------------------------------------------------
@@ -136,6 +150,9 @@ typedef struct _cs_matrix_struct_csr_t {
 
   cs_lnum_t         n_rows;           /* Local number of rows */
   cs_lnum_t         n_cols_ext;       /* Local number of columns + ghosts */
+  cs_lnum_t         n_rows_no_ghost;  /* Number of leading rows with no
+                                         ghost column (whose product may
+                                         be computed before halo update) */
 
   /* Pointers to structure arrays and info (row_index, col_id) */
 
@@ -216,23 +233,96 @@ typedef struct _cs_matrix_coeff_csr_sym_t {
 /* MSR matrix coefficients representation */
 /*----------------------------------------*/
 
+/* Also used for SELL and BSR matrices. BSR matrices use the MSR (CSR
+   without diagonal) structure, with contiguous extradiagonal blocks of
+   eb_size[3] values per structure entry. */
+
 typedef struct _cs_matrix_coeff_msr_t {
 
   int              max_db_size;       /* Current max allocated block size */
   int              max_eb_size;       /* Current max allocated extradiag block size */
 
+  bool             x_float;           /* Store scalar extra-diagonal
+                                         coefficients in single precision */
+
   /* Pointers to possibly shared arrays */
 
   const cs_real_t  *d_val;            /* Diagonal matrix coefficients */
-  const cs_real_t  *x_val;            /* Extra-diagonal matrix coefficients */
+  const cs_real_t  *x_val;            /* Extra-diagonal matrix coefficients
+                                         (NULL if stored in single
+                                         precision) */
 
   /* Pointers to private arrays (NULL if shared) */
 
   cs_real_t        *_d_val;           /* Diagonal matrix coefficients */
   cs_real_t        *_x_val;           /* Extra-diagonal matrix coefficients */
 
+  float            *_x_val_f;         /* Single precision extra-diagonal
+                                         matrix coefficients, or NULL */
+
 } cs_matrix_coeff_msr_t;
 
+/* SELL-C-sigma (sliced ELLPACK) matrix structure representation */
+/*-----------------------------------------------------------------*/
+
+/* Rows are grouped in slices of CS_MATRIX_SELL_C rows, after sorting
+   them by decreasing length inside windows of CS_MATRIX_SELL_SIGMA rows.
+   Inside a slice, extradiagonal terms are stored column-major and padded
+   to the slice's longest row, so that the rows of a slice may be
+   handled together in SIMD lanes. Padding terms reference the row itself,
+   with zero coefficients. Diagonal terms are stored separately, as for
+   MSR matrices (whose coefficients structure is shared). */
+
+typedef struct _cs_matrix_struct_sell_t {
+
+  cs_lnum_t         n_rows;           /* Local number of rows */
+  cs_lnum_t         n_cols_ext;       /* Local number of columns + ghosts */
+  cs_lnum_t         n_chunks;         /* Number of slices */
+
+  bool              direct_assembly;  /* True if each value corresponds to
+                                         a unique face */
+
+  cs_lnum_t        *row_index;        /* Extradiagonal row index (0 to n-1),
+                                         giving row lengths */
+  cs_lnum_t        *row_id;           /* Row id associated with each slice
+                                         position (size: n_rows) */
+  cs_lnum_t        *row_pos;          /* Slice position associated with
+                                         each row (size: n_rows) */
+  cs_lnum_t        *chunk_index;      /* Start of each slice in column id
+                                         and coefficient arrays
+                                         (size: n_chunks + 1) */
+  cs_lnum_t        *col_id;           /* Column id (0 to n-1), padded */
+
+} cs_matrix_struct_sell_t;
+
+/* Matrix-free (face-based) convection-diffusion operator coefficients */
+/*---------------------------------------------------------------------*/
+
+/* The structure is the same as for native matrices; extradiagonal terms
+   are not stored, but recomputed on the fly from face values:
+     X_ij = thetap*(iconvp*cpi*(m_ij)^- - idiffp*visc_ij)
+     X_ji = thetap*(iconvp*cpj*(-m_ij)^- - idiffp*visc_ij) */
+
+typedef struct _cs_matrix_coeff_free_t {
+
+  bool              symmetric;       /* Symmetry indicator */
+
+  int               iconvp;          /* 1 with convection, 0 otherwise */
+  int               idiffp;          /* 1 with diffusion, 0 otherwise */
+  double            thetap;          /* Theta-scheme weighting coefficient */
+
+  /* Pointers to shared arrays */
+
+  const cs_real_t   *da;             /* Diagonal terms */
+  const cs_real_t   *xcpp;           /* Cell convection multiplier
+                                        (such as Cp), or NULL */
+  const cs_real_t   *i_massflux;     /* Mass flux at interior faces,
+                                        or NULL if iconvp = 0 */
+  const cs_real_t   *i_visc;         /* Face viscosity at interior faces,
+                                        or NULL if idiffp = 0 */
+
+} cs_matrix_coeff_free_t;
+
 /* Matrix structure (representation-independent part) */
 /*----------------------------------------------------*/
 
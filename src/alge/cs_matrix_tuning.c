@@ -717,6 +717,8 @@ cs_matrix_variant_tuned(double                 t_measure,
   int cur_select[CS_MATRIX_N_FILL_TYPES][2];
 
   bool                   type_filter[CS_MATRIX_N_TYPES] = {true,
+                                                           true,
+                                                           true,
                                                            true,
                                                            true,
                                                            true};
@@ -575,6 +575,8 @@ _diag_dom_msr(const cs_matrix_t  *matrix,
 
   /* extra-diagonal contribution */
 
+  const float  *x_val_f = cs_matrix_get_msr_x_val_float(matrix);
+
   if (mc->x_val != NULL) {
 
 #   pragma omp parallel for private(jj, m_row, n_cols, sii)
@@ -587,6 +589,19 @@ _diag_dom_msr(const cs_matrix_t  *matrix,
       dd[ii] += sii;
     }
 
+  }
+  else if (x_val_f != NULL) {
+
+#   pragma omp parallel for private(jj, n_cols, sii)
+    for (ii = 0; ii < n_rows; ii++) {
+      const float  *restrict m_row_f = x_val_f + ms->row_index[ii];
+      n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      sii = 0.0;
+      for (jj = 0; jj < n_cols; jj++)
+        sii -= fabs(m_row_f[jj]);
+      dd[ii] += sii;
+    }
+
   }
 
   _diag_dom_diag_normalize(mc->d_val, dd, n_rows);
@@ -618,6 +633,8 @@ _b_diag_dom_msr(const cs_matrix_t  *matrix,
 
   /* extra-diagonal contribution */
 
+  const float  *x_val_f = cs_matrix_get_msr_x_val_float(matrix);
+
   if (mc->x_val != NULL) {
 
 #   pragma omp parallel for private(jj, kk, m_row, n_cols)
@@ -630,6 +647,115 @@ _b_diag_dom_msr(const cs_matrix_t  *matrix,
       }
     }
 
+  }
+  else if (x_val_f != NULL) {
+
+#   pragma omp parallel for private(jj, kk, n_cols)
+    for (ii = 0; ii < n_rows; ii++) {
+      const float  *restrict m_row_f = x_val_f + ms->row_index[ii];
+      n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      for (jj = 0; jj < n_cols; jj++) {
+        for (kk = 0; kk < db_size[0]; kk++)
+          dd[ii*db_size[1] + kk] -= fabs(m_row_f[jj]);
+      }
+    }
+
+  }
+
+  _b_diag_dom_diag_normalize(mc->d_val, dd, ms->n_rows, db_size);
+}
+
+/*----------------------------------------------------------------------------
+ * Measure Diagonal dominance of SELL matrix (scalar or block diagonal).
+ *
+ * parameters:
+ *   matrix <-- Pointer to matrix structure
+ *   dd     --> Resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_diag_dom_sell(const cs_matrix_t  *matrix,
+               cs_real_t          *restrict dd)
+{
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const int *db_size = matrix->db_size;
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  /* diagonal contribution */
+
+  if (db_size[3] == 1)
+    _diag_dom_diag_contrib(mc->d_val, dd, ms->n_rows, ms->n_cols_ext);
+  else
+    _b_diag_dom_diag_contrib(mc->d_val, dd, ms->n_rows, ms->n_cols_ext,
+                             db_size);
+
+  /* extra-diagonal contribution (padding terms are not used) */
+
+  if (mc->x_val != NULL) {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      const cs_lnum_t  pos = ms->row_pos[ii];
+      const cs_lnum_t  n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      const cs_real_t  *restrict m_row
+        =   mc->x_val + ms->chunk_index[pos / CS_MATRIX_SELL_C]
+          + pos % CS_MATRIX_SELL_C;
+      cs_real_t  sii = 0.0;
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        sii -= fabs(m_row[jj*CS_MATRIX_SELL_C]);
+      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+        dd[ii*db_size[1] + kk] += sii;
+    }
+
+  }
+
+  if (db_size[3] == 1)
+    _diag_dom_diag_normalize(mc->d_val, dd, n_rows);
+  else
+    _b_diag_dom_diag_normalize(mc->d_val, dd, n_rows, db_size);
+}
+
+/*----------------------------------------------------------------------------
+ * Measure Diagonal dominance of BSR matrix with full extradiagonal blocks.
+ *
+ * parameters:
+ *   matrix <-- Pointer to matrix structure
+ *   dd     --> Resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_bb_diag_dom_bsr(const cs_matrix_t  *matrix,
+                 cs_real_t          *restrict dd)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const int *db_size = matrix->db_size;
+  const int *eb_size = matrix->eb_size;
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  /* diagonal contribution */
+
+  _b_diag_dom_diag_contrib(mc->d_val, dd, ms->n_rows, ms->n_cols_ext, db_size);
+
+  /* extra-diagonal contribution */
+
+  if (mc->x_val != NULL) {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      const cs_real_t  *restrict m_row
+        = mc->x_val + ms->row_index[ii]*eb_size[3];
+      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        for (cs_lnum_t kk = 0; kk < eb_size[0]; kk++) {
+          for (cs_lnum_t ll = 0; ll < eb_size[0]; ll++)
+            dd[ii*db_size[1] + kk]
+              -= fabs(m_row[jj*eb_size[3] + kk*eb_size[2] + ll]);
+        }
+      }
+    }
+
   }
 
   _b_diag_dom_diag_normalize(mc->d_val, dd, ms->n_rows, db_size);
@@ -1114,6 +1240,8 @@ _pre_dump_msr(const cs_matrix_t   *matrix,
 
   /* extra-diagonal contribution */
 
+  const float  *x_val_f = cs_matrix_get_msr_x_val_float(matrix);
+
   if (mc->x_val != NULL) {
 #   pragma omp parallel for private(jj, dump_id, col_id, m_row, n_cols)
     for (ii = 0; ii < n_rows; ii++) {
@@ -1128,6 +1256,20 @@ _pre_dump_msr(const cs_matrix_t   *matrix,
       }
     }
   }
+  else if (x_val_f != NULL) {
+#   pragma omp parallel for private(jj, dump_id, col_id, n_cols)
+    for (ii = 0; ii < n_rows; ii++) {
+      const float  *restrict m_row_f = x_val_f + ms->row_index[ii];
+      col_id = ms->col_id + ms->row_index[ii];
+      n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      for (jj = 0; jj < n_cols; jj++) {
+        dump_id = ms->row_index[ii] + jj + ms->n_rows;
+        _m_coo[dump_id*2] = g_coo_num[ii];
+        _m_coo[dump_id*2+1] = g_coo_num[col_id[jj]];
+        _m_val[dump_id] = m_row_f[jj];
+      }
+    }
+  }
   else {
 #   pragma omp parallel for private(jj, dump_id, col_id, n_cols)
     for (ii = 0; ii < n_rows; ii++) {
@@ -1196,6 +1338,8 @@ _b_pre_dump_msr(const cs_matrix_t   *matrix,
 
   /* extra-diagonal contribution */
 
+  const float  *x_val_f = cs_matrix_get_msr_x_val_float(matrix);
+
   if (mc->x_val != NULL) {
 #   pragma omp parallel for private(jj, kk, dump_id, col_id, m_row, n_cols)
     for (ii = 0; ii < n_rows; ii++) {
@@ -1212,6 +1356,22 @@ _b_pre_dump_msr(const cs_matrix_t   *matrix,
       }
     }
   }
+  else if (x_val_f != NULL) {
+#   pragma omp parallel for private(jj, kk, dump_id, col_id, n_cols)
+    for (ii = 0; ii < n_rows; ii++) {
+      const float  *restrict m_row_f = x_val_f + ms->row_index[ii];
+      col_id = ms->col_id + ms->row_index[ii];
+      n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      for (jj = 0; jj < n_cols; jj++) {
+        for (kk = 0; kk < db_size[0]; kk++) {
+          dump_id = (ms->row_index[ii] + jj)*db_size[0] + kk + dump_id_shift;
+          _m_coo[dump_id*2] = g_coo_num[ii]*db_size[0] + kk;
+          _m_coo[dump_id*2+1] = g_coo_num[col_id[jj]]*db_size[0] + kk;
+          _m_val[dump_id] = m_row_f[jj];
+        }
+      }
+    }
+  }
   else {
 #   pragma omp parallel for private(jj, kk, dump_id, col_id, n_cols)
     for (ii = 0; ii < n_rows; ii++) {
@@ -1231,6 +1391,79 @@ _b_pre_dump_msr(const cs_matrix_t   *matrix,
   return n_entries;
 }
 
+/*----------------------------------------------------------------------------
+ * Prepare dump of SELL matrix (scalar or block diagonal).
+ *
+ * Padding terms are not dumped.
+ *
+ * parameters:
+ *   matrix    <-- Pointer to matrix structure
+ *   g_coo_num <-- Global coordinate numbers
+ *   m_coo     --> Matrix coefficient coordinates array
+ *   m_val     --> Matrix coefficient values array
+ *
+ * returns:
+ *   number of matrix entries
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_pre_dump_sell(const cs_matrix_t   *matrix,
+               const cs_gnum_t     *g_coo_num,
+               cs_gnum_t          **m_coo,
+               cs_real_t          **m_val)
+{
+  cs_gnum_t   *restrict _m_coo;
+  cs_real_t   *restrict _m_val;
+
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const int  *db_size = matrix->db_size;
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t  dump_id_shift = ms->n_rows*db_size[0]*db_size[0];
+
+  cs_lnum_t  n_entries =   ms->row_index[n_rows]*db_size[0]
+                         + ms->n_rows*db_size[0]*db_size[0];
+
+  /* Allocate arrays */
+
+  BFT_MALLOC(_m_coo, n_entries*2, cs_gnum_t);
+  BFT_MALLOC(_m_val, n_entries, double);
+
+  *m_coo = _m_coo;
+  *m_val = _m_val;
+
+  /* diagonal contribution */
+
+  if (db_size[3] == 1)
+    _pre_dump_diag_contrib(mc->d_val, _m_coo, _m_val, g_coo_num, ms->n_rows);
+  else
+    _b_pre_dump_diag_contrib(mc->d_val, _m_coo, _m_val,
+                             g_coo_num, ms->n_rows, db_size);
+
+  /* extra-diagonal contribution */
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    const cs_lnum_t  pos = ms->row_pos[ii];
+    const cs_lnum_t  n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+    const cs_lnum_t  s_id =   ms->chunk_index[pos / CS_MATRIX_SELL_C]
+                            + pos % CS_MATRIX_SELL_C;
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      const cs_lnum_t  x_id = s_id + jj*CS_MATRIX_SELL_C;
+      const cs_real_t  x_val = (mc->x_val != NULL) ? mc->x_val[x_id] : 0.0;
+      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+        cs_lnum_t dump_id =   (ms->row_index[ii] + jj)*db_size[0] + kk
+                            + dump_id_shift;
+        _m_coo[dump_id*2] = g_coo_num[ii]*db_size[0] + kk;
+        _m_coo[dump_id*2+1] = g_coo_num[ms->col_id[x_id]]*db_size[0] + kk;
+        _m_val[dump_id] = x_val;
+      }
+    }
+  }
+
+  return n_entries;
+}
+
 /*----------------------------------------------------------------------------
  * Write header for dump of matrix to native file.
  *
@@ -1377,6 +1610,15 @@ _prepare_matrix_dump_data(const cs_matrix_t   *m,
     else
       _n_entries = _b_pre_dump_msr(m, g_coo_num, &_m_coords, &_m_vals);
     break;
+  case CS_MATRIX_SELL:
+    if (m->eb_size[3] == 1)
+      _n_entries = _pre_dump_sell(m, g_coo_num, &_m_coords, &_m_vals);
+    else
+      bft_error(__FILE__, __LINE__, 0,
+                _("Dump of matrixes in %s format\n"
+                  "with extradiagonal blocks is not operational yet."),
+                _(cs_matrix_type_name[m->type]));
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Dump of matrixes in %s format\n"
@@ -1865,6 +2107,7 @@ _frobenius_norm(const cs_matrix_t  *m)
     break;
 
   case CS_MATRIX_MSR:
+  case CS_MATRIX_BSR:
     if (   (m->eb_size[0]*m->eb_size[0] == m->eb_size[3])
         && (m->db_size[0]*m->db_size[0] == m->db_size[3])) {
       cs_lnum_t  d_stride = m->db_size[3];
@@ -1874,7 +2117,29 @@ _frobenius_norm(const cs_matrix_t  *m)
       cs_lnum_t n_vals = ms->row_index[m->n_rows];
       double d_mult = (m->eb_size[3] == 1) ? m->db_size[0] : 1;
       retval = cs_dot_xx(d_stride*m->n_rows, mc->d_val);
-      retval += d_mult * cs_dot_xx(e_stride*n_vals, mc->x_val);
+      if (mc->x_val != NULL)
+        retval += d_mult * cs_dot_xx(e_stride*n_vals, mc->x_val);
+      else if (mc->_x_val_f != NULL) {
+        double x_sum = 0.;
+        for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+          x_sum += (double)mc->_x_val_f[ii] * (double)mc->_x_val_f[ii];
+        retval += d_mult * x_sum;
+      }
+      cs_parall_sum(1, CS_DOUBLE, &retval);
+    }
+    break;
+
+  case CS_MATRIX_SELL:
+    if (   (m->eb_size[0]*m->eb_size[0] == m->eb_size[3])
+        && (m->db_size[0]*m->db_size[0] == m->db_size[3])
+        && m->eb_size[3] == 1) {
+      cs_lnum_t  d_stride = m->db_size[3];
+      const cs_matrix_struct_sell_t  *ms = m->structure;
+      const cs_matrix_coeff_msr_t  *mc = m->coeffs;
+      cs_lnum_t n_vals = ms->chunk_index[ms->n_chunks]; /* padding is zero */
+      double d_mult = m->db_size[0];
+      retval = cs_dot_xx(d_stride*m->n_rows, mc->d_val);
+      retval += d_mult * cs_dot_xx(n_vals, mc->x_val);
       cs_parall_sum(1, CS_DOUBLE, &retval);
     }
     break;
@@ -1932,6 +2197,22 @@ cs_matrix_diag_dominance(const cs_matrix_t  *matrix,
     else
       _b_diag_dom_msr(matrix, dd);
     break;
+  case CS_MATRIX_BSR:
+    if (matrix->db_size[3] == 1)
+      _diag_dom_msr(matrix, dd);
+    else if (matrix->eb_size[3] == 1)
+      _b_diag_dom_msr(matrix, dd);
+    else
+      _bb_diag_dom_bsr(matrix, dd);
+    break;
+  case CS_MATRIX_SELL:
+    if (matrix->eb_size[3] == 1)
+      _diag_dom_sell(matrix, dd);
+    else
+      bft_error(__FILE__, __LINE__, 0,
+                _("Extraction of diagonal dominance of matrixes in %s format\n"
+                  "with extradiagonal blocks is not operational yet."),
+                _(cs_matrix_type_name[matrix->type]));
     break;
   default:
     bft_error(__FILE__, __LINE__, 0,
@@ -133,6 +133,9 @@ typedef struct _cs_multigrid_info_t {
 
   unsigned             n_calls[2];          /* Number of times grids built
                                                (0) or solved (1) */
+  unsigned             n_updates;           /* Number of grid builds
+                                               reusing a previous hierarchy
+                                               (coefficients update only) */
 
   unsigned long long   n_levels_tot;        /* Total accumulated number of
                                                grid levels built */
@@ -196,6 +199,9 @@ typedef struct _cs_multigrid_setup_data_t {
   unsigned        n_levels;           /* Current number of grid levels */
   unsigned        n_levels_alloc;     /* Allocated number of grid levels */
 
+  bool            conv_diff;          /* Built with convection/diffusion
+                                         matrices */
+
   cs_grid_t     **grid_hierarchy;     /* Array of grid pointers */
   cs_sles_it_t  **sles_hierarchy;     /* Pointer to contexts for  associated
                                          iterative solvers (i*2: descent, coarse;
@@ -248,6 +254,16 @@ struct _cs_multigrid_t {
 
   double     p0p1_relax;         /* p0/p1 relaxation_parameter */
 
+  int        rebuild_interval;   /* Number of setups between full grid
+                                    hierarchy rebuilds (1: rebuild at each
+                                    setup; 0: reuse until convergence
+                                    degrades); intermediate setups
+                                    only update coarse coefficients */
+  double     rebuild_cycles_ratio; /* If > 0, force a full rebuild when the
+                                      number of cycles exceeds this multiple
+                                      of that of the first resolution
+                                      following the last full rebuild */
+
   /* Setting for use as a preconditioner */
 
   double     pc_precision;       /* preconditioner precision */
@@ -276,6 +292,15 @@ struct _cs_multigrid_t {
 
   cs_multigrid_setup_data_t  *setup_data;   /* setup data */
 
+  /* Grid hierarchy kept between "free" and "setup" states when reused */
+
+  cs_multigrid_setup_data_t  *kept_data;    /* kept grid hierarchy, or NULL */
+  int                         n_setups_since_rebuild;
+  unsigned                    n_cycles_ref; /* number of cycles of first
+                                               resolution after rebuild
+                                               (0 if unknown) */
+  bool                        rebuild_required; /* rebuild at next setup */
+
   char                       *plot_base_name;   /* base plot name, or NULL */
   cs_time_plot_t             *cycle_plot;       /* plotting of cycles */
   cs_time_plot_t            **sles_it_plot;     /* plotting if smoothers */
@@ -336,6 +361,8 @@ _multigrid_info_init(cs_multigrid_info_t *info)
   for (i = 0; i < 2; i++)
     info->n_calls[i] = 0;
 
+  info->n_updates = 0;
+
   info->n_levels_tot = 0;
 
   for (i = 0; i < 3; i++) {
@@ -427,6 +454,14 @@ _multigrid_setup_log(const cs_multigrid_t *mg)
                   mg->info.precision_mult[i]);
   }
 
+  if (mg->rebuild_interval != 1) {
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Grid hierarchy reuse:\n"
+                    "    Full rebuild interval:           %d\n"
+                    "    Cycles ratio for rebuild:        %g\n"),
+                  mg->rebuild_interval, mg->rebuild_cycles_ratio);
+  }
+
   cs_log_printf(CS_LOG_SETUP,
                 _("  Postprocess coarsening:            %d\n"),
                 mg->post_cell_max);
@@ -504,6 +539,12 @@ _multigrid_performance_log(const cs_multigrid_t *mg)
                 tmp_s[1], n_cy_mean,
                 (int)(mg->info.n_cycles[0]), (int)(mg->info.n_cycles[1]));
 
+  if (mg->info.n_updates > 0)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  Grid hierarchy reused (coefficients update only)\n"
+                    "    for %u of %u constructions.\n\n"),
+                  mg->info.n_updates, mg->info.n_calls[0]);
+
   cs_log_timer_array_header(CS_LOG_PERFORMANCE,
                             2,                  /* indent, */
                             "",                 /* header title */
@@ -661,6 +702,8 @@ _multigrid_setup_data_create(void)
   mgd->n_levels = 0;
   mgd->n_levels_alloc = 0;
 
+  mgd->conv_diff = false;
+
   mgd->grid_hierarchy = NULL;
   mgd->sles_hierarchy = NULL;
 
@@ -679,6 +722,68 @@ _multigrid_setup_data_create(void)
   return mgd;
 }
 
+/*----------------------------------------------------------------------------
+ * Free solver-related data in multigrid setup data, keeping the
+ * grid hierarchy.
+ *
+ * parameters:
+ *   mgd <-> multigrid setup data structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_multigrid_setup_data_free_solvers(cs_multigrid_setup_data_t  *mgd)
+{
+  /* Free coarse solution data */
+
+  BFT_FREE(mgd->rhs_vx);
+  BFT_FREE(mgd->rhs_vx_buf);
+
+  /* Destroy solver hierarchy */
+
+  for (int i = mgd->n_levels - 1; i > -1; i--) {
+    for (int j = 0; j < 2; j++) {
+      if (mgd->sles_hierarchy[i*2+j] != NULL) {
+        void *sles_it = mgd->sles_hierarchy[i*2 + j];
+        cs_sles_it_destroy(&sles_it);
+        mgd->sles_hierarchy[i*2+j] = NULL;
+      }
+    }
+  }
+
+  /* Destroy peconditioning-only arrays */
+
+  BFT_FREE(mgd->pc_name);
+  BFT_FREE(mgd->pc_aux);
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy multigrid setup data, including the grid hierarchy.
+ *
+ * parameters:
+ *   mgd <-> pointer to multigrid setup data structure pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_multigrid_setup_data_destroy(cs_multigrid_setup_data_t  **mgd)
+{
+  if (*mgd == NULL)
+    return;
+
+  cs_multigrid_setup_data_t *_mgd = *mgd;
+
+  _multigrid_setup_data_free_solvers(_mgd);
+
+  BFT_FREE(_mgd->sles_hierarchy);
+
+  /* Destroy grid hierarchy */
+
+  for (int i = _mgd->n_levels - 1; i > -1; i--)
+    cs_grid_destroy(_mgd->grid_hierarchy + i);
+  BFT_FREE(_mgd->grid_hierarchy);
+
+  BFT_FREE(*mgd);
+}
+
 /*----------------------------------------------------------------------------
  * Add grid to multigrid structure hierarchy.
  *
@@ -1009,6 +1114,33 @@ _cs_multigrid_post_function(void                  *mgh,
   BFT_FREE(var_name);
 }
 
+/*----------------------------------------------------------------------------
+ * Return the iterative solver type to use for a given level.
+ *
+ * The process-local Gauss-Seidel solvers require an MSR matrix; matrices
+ * with full extra-diagonal blocks use the native format, so Jacobi
+ * is used instead in that case.
+ *
+ * parameters:
+ *   type <-- requested solver type
+ *   m    <-- matrix associated with level
+ *
+ * returns:
+ *   solver type to use for level
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_it_type_t
+_level_sles_it_type(cs_sles_it_type_t   type,
+                    const cs_matrix_t  *m)
+{
+  if (   (   type == CS_SLES_P_GAUSS_SEIDEL
+          || type == CS_SLES_P_COLORED_GAUSS_SEIDEL)
+      && cs_matrix_get_type(m) != CS_MATRIX_MSR)
+    return CS_SLES_JACOBI;
+
+  return type;
+}
+
 /*----------------------------------------------------------------------------
  * Setup multigrid sparse linear equation solvers on existing hierarchy.
  *
@@ -1051,7 +1183,7 @@ _multigrid_setup_sles_it(cs_multigrid_t  *mg,
   mg_lv_info = mg->lv_info + i;
 
   mgd->sles_hierarchy[0]
-    = cs_sles_it_create(mg->info.type[0],
+    = cs_sles_it_create(_level_sles_it_type(mg->info.type[0], m),
                         mg->info.poly_degree[0],
                         mg->info.n_max_iter[0],
                         false); /* stats not updated here */
@@ -1081,13 +1213,13 @@ _multigrid_setup_sles_it(cs_multigrid_t  *mg,
     mg_lv_info = mg->lv_info + i;
 
     mgd->sles_hierarchy[i*2]
-      = cs_sles_it_create(mg->info.type[0],
+      = cs_sles_it_create(_level_sles_it_type(mg->info.type[0], m),
                           mg->info.poly_degree[0],
                           mg->info.n_max_iter[0],
                           false); /* stats not updated here */
 
     mgd->sles_hierarchy[i*2+1]
-      = cs_sles_it_create(mg->info.type[1],
+      = cs_sles_it_create(_level_sles_it_type(mg->info.type[1], m),
                           mg->info.poly_degree[1],
                           mg->info.n_max_iter[1],
                           false); /* stats not updated here */
@@ -1130,7 +1262,7 @@ _multigrid_setup_sles_it(cs_multigrid_t  *mg,
     mg_lv_info = mg->lv_info + i;
 
     mgd->sles_hierarchy[i*2]
-      = cs_sles_it_create(mg->info.type[2],
+      = cs_sles_it_create(_level_sles_it_type(mg->info.type[2], m),
                           mg->info.poly_degree[2],
                           mg->info.n_max_iter[2],
                           false); /* stats not updated here */
@@ -1191,6 +1323,170 @@ _multigrid_setup_sles_it(cs_multigrid_t  *mg,
   cs_timer_counter_add_diff(&(mg_lv_info->t_tot[0]), &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------
+ * Update multigrid hierarchy kept from a previous setup, recomputing only
+ * coarse matrix coefficients, if allowed by reuse settings and state.
+ *
+ * If the kept hierarchy may not be reused, it is destroyed.
+ *
+ * parameters:
+ *   mg        <-> pointer to multigrid solver info and context
+ *   name      <-- linear system name
+ *   a         <-- associated matrix
+ *   a_conv    <-- associated matrix (convection), or NULL
+ *   a_diff    <-- associated matrix (diffusion), or NULL
+ *   verbosity <-- associated verbosity
+ *
+ * returns:
+ *   true if the kept hierarchy was updated, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_multigrid_update_hierarchy(cs_multigrid_t     *mg,
+                            const char         *name,
+                            const cs_matrix_t  *a,
+                            const cs_matrix_t  *a_conv,
+                            const cs_matrix_t  *a_diff,
+                            int                 verbosity)
+{
+  cs_multigrid_setup_data_t *mgd = mg->kept_data;
+
+  mg->kept_data = NULL;
+
+  /* Check if the kept hierarchy may be reused */
+
+  bool update = true;
+
+  if (mg->rebuild_required)
+    update = false;
+  else if (   mg->rebuild_interval > 1
+           && mg->n_setups_since_rebuild + 1 >= mg->rebuild_interval)
+    update = false;
+  else if (mgd->conv_diff != (a_conv != NULL || a_diff != NULL))
+    update = false;
+  else {
+    bool g_symmetric;
+    int g_db_size[4], g_eb_size[4];
+    cs_lnum_t g_n_cells, g_n_cells_ext;
+
+    cs_grid_get_info(mgd->grid_hierarchy[0],
+                     NULL,
+                     &g_symmetric,
+                     g_db_size,
+                     g_eb_size,
+                     NULL,
+                     &g_n_cells,
+                     &g_n_cells_ext,
+                     NULL,
+                     NULL);
+
+    if (   g_symmetric != cs_matrix_is_symmetric(a)
+        || g_db_size[0] != (cs_matrix_get_diag_block_size(a))[0]
+        || g_eb_size[0] != (cs_matrix_get_extra_diag_block_size(a))[0]
+        || g_n_cells != cs_matrix_get_n_rows(a)
+        || g_n_cells_ext != cs_matrix_get_n_columns(a))
+      update = false;
+  }
+
+  if (update == false) {
+    _multigrid_setup_data_destroy(&mgd);
+    return false;
+  }
+
+  /* Update coefficients on all levels */
+
+  cs_timer_t t0 = cs_timer_time();
+  cs_timer_t t1, t2;
+
+  if (verbosity > 1)
+    bft_printf(_("\n Update of grid hierarchy coefficients for \"%s\"\n"),
+               name);
+
+  mg->setup_data = mgd;
+
+  cs_grid_update_from_shared(mgd->grid_hierarchy[0], a, a_conv, a_diff);
+
+  t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&(mg->lv_info[0].t_tot[0]), &t0, &t1);
+
+  for (unsigned i = 1; i < mgd->n_levels; i++) {
+
+    cs_grid_update_coarse(mgd->grid_hierarchy[i-1],
+                          mgd->grid_hierarchy[i],
+                          verbosity,
+                          mg->p0p1_relax);
+
+    t2 = cs_timer_time();
+    cs_timer_counter_add_diff(&(mg->lv_info[i].t_tot[0]), &t1, &t2);
+    t1 = t2;
+
+  }
+
+  /* Update info (level statistics are unchanged) */
+
+  for (unsigned i = 0; i < mgd->n_levels; i++) {
+    cs_multigrid_level_info_t  *lv_info = mg->lv_info + i;
+    lv_info->n_ranks[3] += lv_info->n_ranks[0];
+    lv_info->n_g_cells[3] += lv_info->n_g_cells[0];
+    for (int j = 0; j < 3; j++) {
+      lv_info->n_elts[j][3] += lv_info->n_elts[j][0];
+      lv_info->unbalance[j][3] += lv_info->unbalance[j][0];
+    }
+    lv_info->n_calls[0] += 1;
+  }
+
+  mg->info.n_levels_tot += mg->info.n_levels[0];
+
+  mg->info.n_calls[0] += 1;
+  mg->info.n_updates += 1;
+
+  mg->n_setups_since_rebuild += 1;
+
+  /* Setup solvers */
+
+  _multigrid_setup_sles_it(mg, name, verbosity);
+
+  /* Update timers */
+
+  t2 = cs_timer_time();
+  cs_timer_counter_add_diff(&(mg->info.t_tot[0]), &t0, &t2);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Check whether the grid hierarchy should be fully rebuilt at the next
+ * setup, based on the convergence of the last resolution.
+ *
+ * When used as a preconditioner, the number of cycles is usually fixed,
+ * so only divergence or breakdown lead to a rebuild.
+ *
+ * parameters:
+ *   mg       <-> pointer to multigrid solver info and context
+ *   cvg      <-- convergence state of last resolution
+ *   n_cycles <-- number of cycles of last resolution
+ *----------------------------------------------------------------------------*/
+
+static void
+_multigrid_check_rebuild(cs_multigrid_t               *mg,
+                         cs_sles_convergence_state_t   cvg,
+                         unsigned                      n_cycles)
+{
+  if (cvg == CS_SLES_DIVERGED || cvg == CS_SLES_BREAKDOWN)
+    mg->rebuild_required = true;
+
+  else if (mg->info.is_pc == false) {
+    if (cvg == CS_SLES_MAX_ITERATION)
+      mg->rebuild_required = true;
+    else if (mg->rebuild_cycles_ratio > 0) {
+      if (mg->n_cycles_ref == 0)
+        mg->n_cycles_ref = n_cycles;
+      else if (n_cycles > mg->rebuild_cycles_ratio * mg->n_cycles_ref)
+        mg->rebuild_required = true;
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Compute dot product, summing result over all ranks.
  *
@@ -2196,6 +2492,9 @@ cs_multigrid_create(void)
 
   mg->p0p1_relax = 0.95;
 
+  mg->rebuild_interval = 1;
+  mg->rebuild_cycles_ratio = -1.;
+
   _multigrid_info_init(&(mg->info));
 
   mg->pc_precision = 0.0;
@@ -2205,6 +2504,11 @@ cs_multigrid_create(void)
 
   mg->setup_data = NULL;
 
+  mg->kept_data = NULL;
+  mg->n_setups_since_rebuild = 0;
+  mg->n_cycles_ref = 0;
+  mg->rebuild_required = false;
+
   BFT_MALLOC(mg->lv_info, mg->n_levels_max, cs_multigrid_level_info_t);
 
   for (ii = 0; ii < mg->n_levels_max; ii++)
@@ -2239,6 +2543,8 @@ cs_multigrid_destroy(void  **context)
   if (mg == NULL)
     return;
 
+  _multigrid_setup_data_destroy(&(mg->kept_data));
+
   BFT_FREE(mg->lv_info);
 
   if (mg->post_cell_num != NULL) {
@@ -2371,6 +2677,48 @@ cs_multigrid_set_coarsening_options(cs_multigrid_t  *mg,
   mg->p0p1_relax = p0p1_relax;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid grid hierarchy reuse options.
+ *
+ * When the grid hierarchy is reused, the aggregation, coarse halos
+ * and coarse matrix structures built at a given setup are kept when the
+ * solver is freed, and following setups only recompute the coarse matrix
+ * coefficients from the new fine matrix. This is useful when the
+ * matrix structure does not change between time steps.
+ *
+ * A full rebuild occurs every rebuild_interval setups, if convergence
+ * fails, or if the number of cycles exceeds rebuild_cycles_ratio times
+ * that of the first resolution following the last full rebuild.
+ * Levels built by merging ranks can not be updated, so the hierarchy
+ * is rebuilt at each setup if grid merging occurs.
+ *
+ * \param[in, out]  mg                    pointer to multigrid info
+ *                                        and context
+ * \param[in]       rebuild_interval      number of setups between full
+ *                                        rebuilds (1: rebuild at each setup,
+ *                                        the default; 0: no periodic rebuild)
+ * \param[in]       rebuild_cycles_ratio  if > 0, ratio of number of cycles
+ *                                        to reference number of cycles
+ *                                        above which a rebuild is forced
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_reuse_options(cs_multigrid_t  *mg,
+                               int              rebuild_interval,
+                               double           rebuild_cycles_ratio)
+{
+  if (mg == NULL)
+    return;
+
+  mg->rebuild_interval = CS_MAX(rebuild_interval, 0);
+  mg->rebuild_cycles_ratio = rebuild_cycles_ratio;
+
+  if (mg->rebuild_interval == 1)
+    _multigrid_setup_data_destroy(&(mg->kept_data));
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set multigrid parameters for associated iterative solvers.
@@ -2443,7 +2791,8 @@ cs_multigrid_set_solver_options(cs_multigrid_t     *mg,
 
   for (int i = 0; i < 3; i++) {
     if (   info->type[i] == CS_SLES_JACOBI
-        || info->type[i] == CS_SLES_P_GAUSS_SEIDEL)
+        || info->type[i] == CS_SLES_P_GAUSS_SEIDEL
+        || info->type[i] == CS_SLES_P_COLORED_GAUSS_SEIDEL)
       info->poly_degree[i] = -1;
   }
 }
@@ -2543,6 +2892,13 @@ cs_multigrid_setup_conv_diff(void               *context,
   if (mg->setup_data != NULL)
     cs_multigrid_free(mg);
 
+  /* Reuse hierarchy from previous setup if possible */
+
+  if (mg->kept_data != NULL) {
+    if (_multigrid_update_hierarchy(mg, name, a, a_conv, a_diff, verbosity))
+      return;
+  }
+
   /* Initialization */
 
   t0 = cs_timer_time();
@@ -2553,6 +2909,12 @@ cs_multigrid_setup_conv_diff(void               *context,
 
   mg->setup_data = _multigrid_setup_data_create();
 
+  mg->setup_data->conv_diff = (a_conv != NULL || a_diff != NULL);
+
+  mg->n_setups_since_rebuild = 0;
+  mg->n_cycles_ref = 0;
+  mg->rebuild_required = false;
+
   /* Build coarse grids hierarchy */
   /*------------------------------*/
 
@@ -2911,6 +3273,11 @@ cs_multigrid_solve(void                *context,
     mg_info->n_cycles[1] = n_cycles;
   }
 
+  /* Check for convergence degradation if grid hierarchy is reused */
+
+  if (mg->rebuild_interval != 1)
+    _multigrid_check_rebuild(mg, cvg, n_cycles);
+
   /* Update number of resolutions and timing data */
 
   mg_info->n_calls[1] += 1;
@@ -2947,35 +3314,26 @@ cs_multigrid_free(void  *context)
 
     cs_multigrid_setup_data_t *mgd = mg->setup_data;
 
-    /* Free coarse solution data */
-
-    BFT_FREE(mgd->rhs_vx);
-    BFT_FREE(mgd->rhs_vx_buf);
+    /* Keep grid hierarchy if it may be reused by the next setup */
 
-    /* Destroy solver hierarchy */
+    bool keep_grids = false;
 
-    for (int i = mgd->n_levels - 1; i > -1; i--) {
-      for (int j = 0; j < 2; j++) {
-        if (mgd->sles_hierarchy[i*2+j] != NULL) {
-          void *sles_it = mgd->sles_hierarchy[i*2 + j];
-          cs_sles_it_destroy(&sles_it);
-        }
+    if (mg->rebuild_interval != 1) {
+      keep_grids = true;
+      for (unsigned i = 1; i < mgd->n_levels; i++) {
+        if (cs_grid_is_merged(mgd->grid_hierarchy[i]))
+          keep_grids = false;
       }
     }
-    BFT_FREE(mgd->sles_hierarchy);
-
-    /* Destroy grid hierarchy */
 
-    for (int i = mgd->n_levels - 1; i > -1; i--)
-      cs_grid_destroy(mgd->grid_hierarchy + i);
-    BFT_FREE(mgd->grid_hierarchy);
-
-    /* Destroy peconditioning-only arrays */
-
-    BFT_FREE(mgd->pc_name);
-    BFT_FREE(mgd->pc_aux);
-
-    BFT_FREE(mg->setup_data);
+    if (keep_grids) {
+      _multigrid_setup_data_free_solvers(mgd);
+      _multigrid_setup_data_destroy(&(mg->kept_data));
+      mg->kept_data = mgd;
+      mg->setup_data = NULL;
+    }
+    else
+      _multigrid_setup_data_destroy(&(mg->setup_data));
   }
 
   /* Update timers */
@@ -181,6 +181,27 @@ cs_multigrid_set_coarsening_options(cs_multigrid_t  *mg,
                                     double           p0p1_relax,
                                     int              postprocess_block_size);
 
+/*----------------------------------------------------------------------------
+ * Set multigrid grid hierarchy reuse options.
+ *
+ * When the hierarchy is reused, setups between full rebuilds only
+ * recompute coarse matrix coefficients from the new fine matrix.
+ *
+ * parameters:
+ *   mg                   <-> pointer to multigrid info and context
+ *   rebuild_interval     <-- number of setups between full rebuilds
+ *                            (1: rebuild at each setup, the default;
+ *                            0: no periodic rebuild)
+ *   rebuild_cycles_ratio <-- if > 0, ratio of number of cycles to
+ *                            reference number of cycles (first resolution
+ *                            after rebuild) above which a rebuild is forced
+ *----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_reuse_options(cs_multigrid_t  *mg,
+                               int              rebuild_interval,
+                               double           rebuild_cycles_ratio);
+
 /*----------------------------------------------------------------------------
  * Set multigrid parameters for associated iterative solvers.
  *
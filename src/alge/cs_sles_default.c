@@ -180,6 +180,12 @@ _sles_default_native(int                f_id,
       sles_it_type = CS_SLES_JACOBI;
   }
 
+  /* Matrix-free operators provide no extradiagonal coefficients
+     from which coarse grids could be built */
+
+  if (matrix_type == CS_MATRIX_FREE)
+    multigrid = false;
+
   if (multigrid) {
 
     /* Multigrid used as preconditionner if possible, as solver otherwise */
@@ -263,6 +269,7 @@ cs_sles_default_setup(void)
   cs_sles_set_default_verbosity(cs_sles_default_get_verbosity);
 
   int key_cal_opt_id = cs_field_key_id("var_cal_opt");
+  int key_matrix_free_id = cs_field_key_id_try("matrix_free");
 
   /* Define for all variable fields */
 
@@ -282,12 +289,27 @@ cs_sles_default_setup(void)
         if (sc != NULL)
           context = cs_sles_get_context(sc);
 
+        bool matrix_free = false;
+        if (key_matrix_free_id > -1)
+          matrix_free = (cs_field_get_key_int(f, key_matrix_free_id) > 0);
+
         if (context == NULL) {
           /* Get the calculation option from the field */
           cs_var_cal_opt_t var_cal_opt;
           cs_field_get_key_struct(f, key_cal_opt_id, &var_cal_opt);
           bool symmetric = (var_cal_opt.iconv > 0) ? false : true;
-          _sles_default_native(f_id, NULL, CS_MATRIX_N_TYPES, symmetric);
+          _sles_default_native(f_id,
+                               NULL,
+                               (matrix_free) ? CS_MATRIX_FREE
+                                             : CS_MATRIX_N_TYPES,
+                               symmetric);
+        }
+        else if (matrix_free && !cs_sles_matrix_free_supported(f_id, NULL)) {
+          cs_base_warn(__FILE__, __LINE__);
+          bft_printf(_("The solver defined for field \"%s\" requires\n"
+                       "matrix coefficients, so the \"matrix_free\" key\n"
+                       "is ignored and the matrix will be assembled.\n"),
+                     f->name);
         }
 
       }
@@ -596,7 +618,9 @@ cs_sles_solve_native(int                  f_id,
 
     if (strcmp(cs_sles_get_type(sc), "cs_sles_it_t") == 0) {
       cs_sles_it_t *c = cs_sles_get_context(sc);
-      if (cs_sles_it_get_type(c) == CS_SLES_P_GAUSS_SEIDEL)
+      cs_sles_it_type_t it_type = cs_sles_it_get_type(c);
+      if (   it_type == CS_SLES_P_GAUSS_SEIDEL
+          || it_type == CS_SLES_P_COLORED_GAUSS_SEIDEL)
         need_msr = true;
       else {
         pc = cs_sles_it_get_pc(c);
@@ -610,7 +634,9 @@ cs_sles_solve_native(int                  f_id,
       mg = cs_sles_get_context(sc);
 
     if (mg != NULL) {
-      if (cs_multigrid_get_fine_solver_type(mg) == CS_SLES_P_GAUSS_SEIDEL)
+      cs_sles_it_type_t fine_type = cs_multigrid_get_fine_solver_type(mg);
+      if (   fine_type == CS_SLES_P_GAUSS_SEIDEL
+          || fine_type == CS_SLES_P_COLORED_GAUSS_SEIDEL)
         need_msr = true;
     }
 
@@ -658,6 +684,149 @@ cs_sles_solve_native(int                  f_id,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether the solver associated with a given system may be
+ *        used with a matrix-free operator.
+ *
+ * Multigrid (as a solver or preconditioner), Gauss-Seidel variants, and
+ * solvers of types not handled here require access to matrix coefficients.
+ * If no solver has been defined yet, the default definition based on a
+ * matrix-free operator is compatible.
+ *
+ * \param[in]  f_id  associated field id, or < 0
+ * \param[in]  name  associated name if f_id < 0, or NULL
+ *
+ * \return  true if a matrix-free operator may be used, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_sles_matrix_free_supported(int          f_id,
+                              const char  *name)
+{
+  cs_sles_t *sc = cs_sles_find(f_id, name);
+
+  if (sc == NULL)
+    return true;
+  if (cs_sles_get_context(sc) == NULL)
+    return true;
+
+  if (strcmp(cs_sles_get_type(sc), "cs_sles_it_t") != 0)
+    return false;
+
+  cs_sles_it_t *c = cs_sles_get_context(sc);
+
+  cs_sles_it_type_t sles_it_type = cs_sles_it_get_type(c);
+  if (   sles_it_type == CS_SLES_P_GAUSS_SEIDEL
+      || sles_it_type == CS_SLES_P_COLORED_GAUSS_SEIDEL)
+    return false;
+
+  cs_sles_pc_t *pc = cs_sles_it_get_pc(c);
+  if (pc != NULL) {
+    if (strcmp(cs_sles_pc_get_type(pc), "multigrid") == 0)
+      return false;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Call sparse linear equation solver using a given matrix.
+ *
+ * This is intended for operators which are not defined by native matrix
+ * arrays, such as matrix-free operators (see \ref cs_matrix_free_operator).
+ * The matrix coefficients should already be set, and remain valid until
+ * \ref cs_sles_free_native is called, which also releases them.
+ * For matrix-free operators, the associated solver should be compatible
+ * (see \ref cs_sles_matrix_free_supported).
+ *
+ * \param[in]       f_id                   associated field id, or < 0
+ * \param[in]       name                   associated name if f_id < 0, or NULL
+ * \param[in]       a                      matrix
+ * \param[in]       rotation_mode          halo update option for
+ *                                         rotational periodicity
+ * \param[in]       precision              solver precision
+ * \param[in]       r_norm                 residue normalization
+ * \param[out]      n_iter                 number of "equivalent" iterations
+ * \param[out]      residue                residue
+ * \param[in]       rhs                    right hand side
+ * \param[in, out]  vx                     system solution
+ *
+ * \return  convergence state
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_solve_matrix(int                  f_id,
+                     const char          *name,
+                     cs_matrix_t         *a,
+                     cs_halo_rotation_t   rotation_mode,
+                     double               precision,
+                     double               r_norm,
+                     int                 *n_iter,
+                     double              *residue,
+                     const cs_real_t     *rhs,
+                     cs_real_t           *vx)
+{
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+
+  /* Check if this system has already been setup */
+
+  cs_sles_t *sc = cs_sles_find_or_add(f_id, name);
+
+  int setup_id = 0;
+  while (setup_id < _n_setups) {
+    if (_sles_setup[setup_id] == sc)
+      break;
+    else
+      setup_id++;
+  }
+
+  if (setup_id >= _n_setups) {
+
+    _n_setups += 1;
+
+    if (_n_setups > CS_SLES_DEFAULT_N_SETUPS)
+      bft_error
+        (__FILE__, __LINE__, 0,
+         "Too many linear systems solved without calling cs_sles_free_native\n"
+         "  maximum number of systems: %d\n"
+         "If this is not an error, increase CS_SLES_DEFAULT_N_SETUPS\n"
+         "  in file %s.", CS_SLES_DEFAULT_N_SETUPS, __FILE__);
+
+    /* Define context based on the given matrix if not done yet */
+
+    if (cs_sles_get_context(sc) == NULL) {
+      cs_sles_define_t  *sles_default_func = cs_sles_get_default_define();
+      sles_default_func(f_id, name, a);
+    }
+
+    _sles_setup[setup_id] = sc;
+    _matrix_setup[setup_id][0] = a;
+    _matrix_setup[setup_id][1] = NULL;
+    _matrix_setup[setup_id][2] = NULL;
+
+  }
+
+  /* Solve system */
+
+  cvg = cs_sles_solve(sc,
+                      a,
+                      rotation_mode,
+                      precision,
+                      r_norm,
+                      n_iter,
+                      residue,
+                      rhs,
+                      vx,
+                      0,
+                      NULL);
+
+  return cvg;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Free sparse linear equation solver setup using native matrix arrays.
@@ -179,6 +179,63 @@ cs_sles_solve_native(int                  f_id,
                      const cs_real_t     *rhs,
                      cs_real_t           *vx);
 
+/*----------------------------------------------------------------------------
+ * Indicate whether the solver associated with a given system may be
+ * used with a matrix-free operator.
+ *
+ * Multigrid (as a solver or preconditioner), Gauss-Seidel variants, and
+ * solvers of types not handled here require access to matrix coefficients.
+ * If no solver has been defined yet, the default definition based on a
+ * matrix-free operator is compatible.
+ *
+ * parameters:
+ *   f_id <-- associated field id, or < 0
+ *   name <-- associated name if f_id < 0, or NULL
+ *
+ * returns:
+ *   true if a matrix-free operator may be used, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_sles_matrix_free_supported(int          f_id,
+                              const char  *name);
+
+/*----------------------------------------------------------------------------
+ * Call sparse linear equation solver using a given matrix.
+ *
+ * This is intended for operators which are not defined by native matrix
+ * arrays, such as matrix-free operators (see cs_matrix_free_operator()).
+ * The matrix coefficients should already be set, and remain valid until
+ * cs_sles_free_native() is called, which also releases them.
+ *
+ * parameters:
+ *   f_id                   <-- associated field id, or < 0
+ *   name                   <-- associated name if f_id < 0, or NULL
+ *   a                      <-- matrix
+ *   rotation_mode          <-- halo update option for rotational periodicity
+ *   r_epsilon              <-- precision
+ *   r_norm                 <-- residue normalization
+ *   n_iter                 --> number of iterations
+ *   residue                --> residue
+ *   rhs                    <-- right hand side
+ *   vx                     <-> system solution
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_solve_matrix(int                  f_id,
+                     const char          *name,
+                     cs_matrix_t         *a,
+                     cs_halo_rotation_t   rotation_mode,
+                     double               precision,
+                     double               r_norm,
+                     int                 *n_iter,
+                     double              *residue,
+                     const cs_real_t     *rhs,
+                     cs_real_t           *vx);
+
 /*----------------------------------------------------------------------------
  * Free sparse linear equation solver setup using native matrix arrays.
  *
@@ -101,6 +101,15 @@ BEGIN_C_DECLS
        Process-local Gauss-Seidel
   \var CS_SLES_PCR3
        3-layer conjugate residual
+  \var CS_SLES_PCG_PIPELINED
+       Pipelined preconditioned conjugate gradient (single global
+       reduction per iteration, overlapped with computation)
+  \var CS_SLES_P_COLORED_GAUSS_SEIDEL
+       Process-local multicolor Gauss-Seidel (rows of a same color
+       are relaxed in parallel)
+  \var CS_SLES_GMRES_S_STEP
+       Preconditioned s-step GMRES (Krylov basis built and orthogonalized
+       by blocks of s vectors, with a single global reduction per block)
 
  \page sles_it Iterative linear solvers.
 
@@ -171,6 +180,11 @@ typedef struct _cs_sles_it_setup_t {
   void                *pc_context;       /* preconditioner context */
   cs_sles_pc_apply_t  *pc_apply;         /* preconditioner apply */
 
+  cs_lnum_t            n_colors;         /* number of row colors for
+                                            multicolor Gauss-Seidel */
+  cs_lnum_t           *color_index;      /* rows by color index, or NULL */
+  cs_lnum_t           *color_rows;       /* rows by color */
+
 } cs_sles_it_setup_t;
 
 /* Solver additional data */
@@ -193,6 +207,8 @@ struct _cs_sles_it_t {
 
   bool                 symmetric;          /* symmetric for Gauss-Seidel */
 
+  int                  s_step;             /* block size for s-step GMRES */
+
   bool                 update_stats;       /* do stats need to be updated ? */
 
   int                  n_max_iter;         /* maximum number of iterations */
@@ -281,7 +297,10 @@ const char *cs_sles_it_type_name[] = {N_("Conjugate gradient"),
                                       N_("BiCGstab2"),
                                       N_("GMRES"),
                                       N_("Processor Gauss-Seidel"),
-                                      N_("3-layer conjugate residual")};
+                                      N_("3-layer conjugate residual"),
+                                      N_("Pipelined conjugate gradient"),
+                                      N_("Process-local colored Gauss-Seidel"),
+                                      N_("s-step GMRES")};
 
 /*============================================================================
  * Private function definitions
@@ -741,6 +760,103 @@ _fact_lu(cs_lnum_t         n_blocks,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Build a greedy coloring of the local rows of an MSR matrix.
+ *
+ * Two rows sharing a local (non-ghost) extra-diagonal term are always
+ * assigned different colors, so that all rows of a given color may be
+ * relaxed independently, and the Gauss-Seidel sweep remains a true
+ * (colored) Gauss-Seidel sweep regardless of the number of threads.
+ *
+ * parameters:
+ *   sd <-> pointer to solver setup data
+ *   a  <-- associated matrix
+ *----------------------------------------------------------------------------*/
+
+static void
+_setup_msr_coloring(cs_sles_it_setup_t  *sd,
+                    const cs_matrix_t   *a)
+{
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+
+  const cs_lnum_t  *a_row_index, *a_col_id;
+  const cs_real_t  *a_d_val, *a_x_val;
+
+  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+
+  cs_lnum_t *row_color, *color_mark;
+  cs_lnum_t max_row_size = 0;
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    cs_lnum_t row_size = a_row_index[ii+1] - a_row_index[ii];
+    if (row_size > max_row_size)
+      max_row_size = row_size;
+  }
+
+  BFT_MALLOC(row_color, n_rows, cs_lnum_t);
+  BFT_MALLOC(color_mark, max_row_size + 1, cs_lnum_t);
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    row_color[ii] = -1;
+  for (cs_lnum_t ii = 0; ii < max_row_size + 1; ii++)
+    color_mark[ii] = -1;
+
+  /* Greedy coloring: use the smallest color not used by neighbors
+     (color_mark[k] == ii if color k is used by a neighbor of row ii) */
+
+  cs_lnum_t n_colors = 0;
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    for (cs_lnum_t jj = a_row_index[ii]; jj < a_row_index[ii+1]; jj++) {
+      cs_lnum_t col_id = a_col_id[jj];
+      if (col_id < n_rows) {
+        if (row_color[col_id] > -1)
+          color_mark[row_color[col_id]] = ii;
+      }
+    }
+
+    cs_lnum_t color_id = 0;
+    while (color_mark[color_id] == ii)
+      color_id++;
+
+    row_color[ii] = color_id;
+    if (color_id >= n_colors)
+      n_colors = color_id + 1;
+
+  }
+
+  BFT_FREE(color_mark);
+
+  /* Build rows by color index */
+
+  BFT_REALLOC(sd->color_index, n_colors + 1, cs_lnum_t);
+  BFT_REALLOC(sd->color_rows, n_rows, cs_lnum_t);
+
+  sd->n_colors = n_colors;
+
+  for (cs_lnum_t ii = 0; ii < n_colors + 1; ii++)
+    sd->color_index[ii] = 0;
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    sd->color_index[row_color[ii] + 1] += 1;
+
+  for (cs_lnum_t ii = 0; ii < n_colors; ii++)
+    sd->color_index[ii+1] += sd->color_index[ii];
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    cs_lnum_t color_id = row_color[ii];
+    sd->color_rows[sd->color_index[color_id]] = ii;
+    sd->color_index[color_id] += 1;
+  }
+
+  for (cs_lnum_t ii = n_colors; ii > 0; ii--)
+    sd->color_index[ii] = sd->color_index[ii-1];
+  sd->color_index[0] = 0;
+
+  BFT_FREE(row_color);
+}
+
 /*----------------------------------------------------------------------------
  * Setup context for iterative linear solver.
  *
@@ -775,6 +891,9 @@ _setup_sles_it(cs_sles_it_t       *c,
     sd = c->setup_data;
     sd->ad_inv = NULL;
     sd->_ad_inv = NULL;
+    sd->n_colors = 0;
+    sd->color_index = NULL;
+    sd->color_rows = NULL;
   }
 
   sd->n_rows = cs_matrix_get_n_rows(a) * diag_block_size;
@@ -860,6 +979,16 @@ _setup_sles_it(cs_sles_it_t       *c,
 
   }
 
+  /* Row coloring for multicolor Gauss-Seidel */
+
+  if (   c->type == CS_SLES_P_COLORED_GAUSS_SEIDEL
+      && cs_matrix_get_type(a) == CS_MATRIX_MSR) {
+    _setup_msr_coloring(sd, a);
+    if (verbosity > 1)
+      bft_printf(_("  Number of Gauss-Seidel row colors: %ld\n"),
+                 (long)(sd->n_colors));
+  }
+
   /* Check for single-reduction */
 
 #if defined(HAVE_MPI)
@@ -1293,6 +1422,211 @@ _conjugate_gradient_sr(cs_sles_it_t              *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using pipelined preconditioned conjugate gradient.
+ *
+ * This variant requires a single global reduction per iteration, which
+ * is started before the preconditioning and matrix.vector product of that
+ * iteration and completed only after them, so that its latency may be
+ * hidden behind local computation (when nonblocking MPI collectives are
+ * available). This comes at the cost of additional vector updates, and
+ * slightly lower numerical stability than the standard algorithm.
+ *
+ * For more information, see P. Ghysels and W. Vanroose, "Hiding global
+ * synchronization latency in the preconditioned Conjugate Gradient
+ * algorithm", Parallel Computing 40 (2014), pp. 224-238.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- block size of element ii, ii
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_conjugate_gradient_pipelined(cs_sles_it_t              *c,
+                              const cs_matrix_t         *a,
+                              int                        diag_block_size,
+                              cs_halo_rotation_t         rotation_mode,
+                              cs_sles_it_convergence_t  *convergence,
+                              const cs_real_t           *rhs,
+                              cs_real_t                 *restrict vx,
+                              size_t                     aux_size,
+                              void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg;
+  double  alpha = 0., beta, gk, gk_m1 = 0., dk, residue;
+  double  s_loc[3], s[3];
+  cs_real_t *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict uk, *restrict wk;
+  cs_real_t  *restrict mk, *restrict nk, *restrict zk;
+  cs_real_t  *restrict qk, *restrict sk, *restrict pk;
+
+  unsigned n_iter = 0;
+
+#if defined(HAVE_MPI) && defined(HAVE_MPI_IALLREDUCE)
+  MPI_Request request = MPI_REQUEST_NULL;
+#endif
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const size_t n_wa = 9;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    rk = _aux_vectors;
+    uk = _aux_vectors + wa_size;
+    wk = _aux_vectors + wa_size*2;
+    mk = _aux_vectors + wa_size*3;
+    nk = _aux_vectors + wa_size*4;
+    zk = _aux_vectors + wa_size*5;
+    qk = _aux_vectors + wa_size*6;
+    sk = _aux_vectors + wa_size*7;
+    pk = _aux_vectors + wa_size*8;
+  }
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  /* Residue rk = rhs - A.x0, preconditioned residue uk, and wk = A.uk */
+
+  cs_matrix_vector_multiply(rotation_mode, a, vx, rk);
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    rk[ii] = rhs[ii] - rk[ii];
+
+  c->setup_data->pc_apply(c->setup_data->pc_context,
+                          rotation_mode,
+                          rk,
+                          uk);
+
+  cs_matrix_vector_multiply(rotation_mode, a, uk, wk);
+
+  /* Current Iteration */
+  /*-------------------*/
+
+  while (true) {
+
+    /* Start reduction of rk.rk, rk.uk, and uk.wk */
+
+    cs_dot_xx_xy_yz(n_rows, rk, uk, wk, s_loc, s_loc+1, s_loc+2);
+
+#if defined(HAVE_MPI)
+    if (c->comm != MPI_COMM_NULL) {
+#if defined(HAVE_MPI_IALLREDUCE)
+      MPI_Iallreduce(s_loc, s, 3, MPI_DOUBLE, MPI_SUM, c->comm, &request);
+#else
+      MPI_Allreduce(s_loc, s, 3, MPI_DOUBLE, MPI_SUM, c->comm);
+#endif
+    }
+    else
+#endif /* defined(HAVE_MPI) */
+    {
+      s[0] = s_loc[0];
+      s[1] = s_loc[1];
+      s[2] = s_loc[2];
+    }
+
+    /* Preconditioning and matrix.vector product, overlapping reduction */
+
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            wk,
+                            mk);
+
+    cs_matrix_vector_multiply(rotation_mode, a, mk, nk);  /* nk = A.mk */
+
+#if defined(HAVE_MPI) && defined(HAVE_MPI_IALLREDUCE)
+    if (request != MPI_REQUEST_NULL)
+      MPI_Wait(&request, MPI_STATUS_IGNORE);
+#endif
+
+    residue = sqrt(s[0]);
+    gk = s[1];
+    dk = s[2];
+
+    /* Convergence test */
+
+    if (n_iter == 0)
+      c->setup_data->initial_residue = residue;
+
+    cvg = _convergence_test(c, n_iter, residue, convergence);
+
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    n_iter += 1;
+
+    /* Descent parameters and vector updates */
+
+    if (n_iter > 1) {
+
+      beta = gk / gk_m1;
+      alpha = gk / (dk - beta*gk/alpha);
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        zk[ii] = nk[ii] + beta*zk[ii];
+        qk[ii] = mk[ii] + beta*qk[ii];
+        sk[ii] = wk[ii] + beta*sk[ii];
+        pk[ii] = uk[ii] + beta*pk[ii];
+        vx[ii] += alpha*pk[ii];
+        rk[ii] -= alpha*sk[ii];
+        uk[ii] -= alpha*qk[ii];
+        wk[ii] -= alpha*zk[ii];
+      }
+
+    }
+    else {
+
+      alpha = gk / dk;
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        zk[ii] = nk[ii];
+        qk[ii] = mk[ii];
+        sk[ii] = wk[ii];
+        pk[ii] = uk[ii];
+        vx[ii] += alpha*pk[ii];
+        rk[ii] -= alpha*sk[ii];
+        uk[ii] -= alpha*qk[ii];
+        wk[ii] -= alpha*zk[ii];
+      }
+
+    }
+
+    gk_m1 = gk;
+
+  }
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using non-preconditioned conjugate gradient.
  *
@@ -3162,67 +3496,540 @@ _gmres(cs_sles_it_t              *c,
 }
 
 /*----------------------------------------------------------------------------
- * Solution of A.vx = Rhs using Process-local Gauss-Seidel.
+ * Return coefficient of the s-step basis vector (before scaling) in the
+ * orthonormal Krylov basis, as obtained from block orthogonalization.
+ *
+ * Basis vector z_i (i = 1 to n_z) of the current block is the sum of
+ * c(k, i-1).q_k for k <= j0, and r(k, i-1).q_(j0+1+k) for k < i.
+ *
+ * parameters:
+ *   cc    <-- projection coefficients on previous basis, (j0+1)*n_z
+ *   rr    <-- Cholesky factor of projected Gram matrix, n_z*n_z
+ *   j0    <-- index of last basis vector before current block
+ *   n_z   <-- number of vectors in current block
+ *   i     <-- block vector id (0 to n_z-1, for z_(i+1))
+ *   row   <-- row id in orthonormal basis
+ *
+ * returns:
+ *   matching coefficient
+ *----------------------------------------------------------------------------*/
+
+static inline double
+_s_step_basis_coeff(const cs_real_t  *cc,
+                    const cs_real_t  *rr,
+                    int               j0,
+                    int               n_z,
+                    int               i,
+                    int               row)
+{
+  double retval = 0.;
+
+  if (row <= j0)
+    retval = cc[row + i*(j0+1)];
+  else if (row <= j0 + 1 + i)
+    retval = rr[(row - j0 - 1) + i*n_z];
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using preconditioned s-step GMRES.
+ *
+ * This communication-avoiding variant builds the Krylov basis by blocks
+ * of s vectors. Each block is generated with s successive preconditioned
+ * matrix.vector products (using a scaled monomial basis), then
+ * orthogonalized against the previous basis and within itself using
+ * block classical Gram-Schmidt followed by a Cholesky QR factorization.
+ * All dot products required for a block are grouped in a single global
+ * reduction, instead of the j+1 reductions per column of the standard
+ * (modified Gram-Schmidt) algorithm. The Hessenberg matrix is then
+ * recovered from the change of basis, and the least-squares problem is
+ * updated using the usual Givens rotations.
+ *
+ * The true residual is computed at each restart only. When the Gram
+ * matrix of a block becomes numerically singular, the block is truncated,
+ * so that s acts as an upper bound on the block size.
+ *
+ * For more information, see M. Hoemmen, "Communication-avoiding Krylov
+ * subspace methods", PhD thesis, UC Berkeley (2010).
  *
  * On entry, vx is considered initialized.
  *
  * parameters:
  *   c               <-- pointer to solver context info
- *   a               <-- linear equation matrix
- *   diag_block_size <-- diagonal block size
+ *   a               <-- matrix
+ *   diag_block_size <-- block size of element ii, ii
  *   rotation_mode   <-- halo update option for rotational periodicity
  *   convergence     <-- convergence information structure
  *   rhs             <-- right hand side
  *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
  *
  * returns:
  *   convergence state
  *----------------------------------------------------------------------------*/
 
 static cs_sles_convergence_state_t
-_p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
-                            const cs_matrix_t         *a,
-                            int                        diag_block_size,
-                            cs_halo_rotation_t         rotation_mode,
-                            cs_sles_it_convergence_t  *convergence,
-                            const cs_real_t           *rhs,
-                            cs_real_t                 *restrict vx)
+_gmres_s_step(cs_sles_it_t              *c,
+              const cs_matrix_t         *a,
+              int                        diag_block_size,
+              cs_halo_rotation_t         rotation_mode,
+              cs_sles_it_convergence_t  *convergence,
+              const cs_real_t           *rhs,
+              cs_real_t                 *restrict vx,
+              size_t                     aux_size,
+              void                      *aux_vectors)
 {
-  cs_sles_convergence_state_t cvg;
-  double  res2, residue;
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+  int krylov_size;
+  double residue;
+  cs_real_t *_aux_vectors;
+  cs_real_t *restrict _krylov_vectors;
+  cs_real_t *restrict rk, *restrict gk, *restrict fk;
+  cs_real_t *_dense;
+  size_t wa_size;
 
+  int krylov_size_max = 75;
   unsigned n_iter = 0;
 
-  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
-
-  const cs_halo_t *halo = cs_matrix_get_halo(a);
+  /* Relative tolerance on Cholesky pivots, under which
+     a block is truncated */
 
-  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+  const double chol_eps = 1.e-12;
 
-  const cs_real_t  *restrict ad = cs_matrix_get_diagonal(a);
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
 
-  const cs_lnum_t  *a_row_index, *a_col_id;
-  const cs_real_t  *a_d_val, *a_x_val;
+  assert(c->setup_data != NULL);
 
-  const int *db_size = cs_matrix_get_diag_block_size(a);
-  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
 
-  const cs_lnum_t  *order = c->add_data->order;
+  krylov_size =  (krylov_size_max < (int)sqrt(n_rows)*1.5) ?
+                  krylov_size_max : (int)sqrt(n_rows)*1.5 + 1;
 
-  cvg = CS_SLES_ITERATING;
+#if defined(HAVE_MPI)
+  if (c->comm != MPI_COMM_NULL) {
+    int _krylov_size = krylov_size;
+    MPI_Allreduce(&_krylov_size,
+                  &krylov_size,
+                  1,
+                  MPI_INT,
+                  MPI_MIN,
+                  c->comm);
+  }
+#endif
 
-  /* Current iteration */
-  /*-------------------*/
+  if (krylov_size < 2)
+    krylov_size = 2;
 
-  while (cvg == CS_SLES_ITERATING) {
+  /* m: restart length (basis vectors 0 to m); s: maximum block size */
 
-    register double r;
+  const int m = krylov_size - 1;
+  const int h_ld = m + 1;
+  const int s = CS_MAX(1, CS_MIN(c->s_step, m));
 
-    n_iter += 1;
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const size_t n_wa = 3 + h_ld;
 
-    /* Synchronize ghost cells first */
+    wa_size = CS_SIMD_SIZE(n_cols);
 
-    if (halo != NULL) {
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    rk = _aux_vectors;
+    gk = _aux_vectors + wa_size;
+    fk = _aux_vectors + wa_size*2;
+    _krylov_vectors = _aux_vectors + wa_size*3;
+  }
+
+  /* Dense arrays: unrotated and rotated Hessenberg matrices, Givens
+     coefficients, least-squares right-hand side and solution, block
+     reduction buffers, and Cholesky factor */
+
+  const int s_buf_size = h_ld*s + s*s;
+
+  BFT_MALLOC(_dense, 2*h_ld*m + 4*h_ld + 2*s_buf_size + s*s, cs_real_t);
+
+  cs_real_t *h = _dense;
+  cs_real_t *hr = h + h_ld*m;
+  cs_real_t *givens_coeff = hr + h_ld*m;
+  cs_real_t *beta = givens_coeff + 2*h_ld;
+  cs_real_t *y = beta + h_ld;
+  cs_real_t *s_loc = y + h_ld;
+  cs_real_t *s_glob = s_loc + s_buf_size;
+  cs_real_t *rr = s_glob + s_buf_size;
+
+  /* Scaling factor for the monomial basis */
+
+  double sigma = 1.;
+
+  /* Restart loop */
+
+  while (true) {
+
+    /* Residue rk = rhs - A.vx */
+
+    cs_matrix_vector_multiply(rotation_mode, a, vx, rk);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      rk[ii] = rhs[ii] - rk[ii];
+
+    residue = sqrt(_dot_product_xx(c, rk));
+
+    if (n_iter == 0)
+      c->setup_data->initial_residue = residue;
+
+    cvg = _convergence_test(c, n_iter, residue, convergence);
+
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    /* First basis vector */
+
+    {
+      const double d_r = 1./residue;
+      cs_real_t *restrict v0 = _krylov_vectors;
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        v0[ii] = rk[ii]*d_r;
+    }
+
+    for (int i = 0; i < h_ld*m; i++) {
+      h[i] = 0.;
+      hr[i] = 0.;
+    }
+
+    beta[0] = residue;
+    for (int i = 1; i < h_ld; i++)
+      beta[i] = 0.;
+
+    /* Build Krylov basis by blocks */
+
+    int j0 = 0;
+    bool cycle_end = false;
+
+    while (j0 < m && cycle_end == false) {
+
+      const int n_z = CS_MIN(s, m - j0);
+      const int n_c = (j0+1)*n_z;
+
+      bool breakdown = false;
+
+      /* Scaled matrix powers: z_i = A.M^-1.z_(i-1) / sigma */
+
+      for (int i = 1; i <= n_z; i++) {
+
+        const cs_real_t *restrict z_prev
+          = _krylov_vectors + (j0+i-1)*wa_size;
+        cs_real_t *restrict z = _krylov_vectors + (j0+i)*wa_size;
+
+        c->setup_data->pc_apply(c->setup_data->pc_context,
+                                rotation_mode,
+                                z_prev,
+                                gk);
+
+        cs_matrix_vector_multiply(rotation_mode, a, gk, z);
+
+        const double d_sigma = 1./sigma;
+
+#       pragma omp parallel for if(n_rows > CS_THR_MIN)
+        for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+          z[ii] *= d_sigma;
+
+      }
+
+      /* Single reduction for projection on previous basis (Q^t.Z)
+         and Gram matrix of block (Z^t.Z); only the upper triangle
+         of the latter is computed, so the buffer is zeroed first */
+
+      for (int i = 0; i < n_c + n_z*n_z; i++)
+        s_loc[i] = 0.;
+
+      for (int i = 0; i < n_z; i++) {
+        const cs_real_t *z = _krylov_vectors + (j0+1+i)*wa_size;
+        for (int k = 0; k <= j0; k++)
+          s_loc[k + i*(j0+1)]
+            = cs_dot(n_rows, _krylov_vectors + k*wa_size, z);
+        for (int l = i; l < n_z; l++)
+          s_loc[n_c + i*n_z + l]
+            = cs_dot(n_rows, _krylov_vectors + (j0+1+l)*wa_size, z);
+      }
+
+#if defined(HAVE_MPI)
+      if (c->comm != MPI_COMM_NULL)
+        MPI_Allreduce(s_loc, s_glob, n_c + n_z*n_z, MPI_DOUBLE, MPI_SUM,
+                      c->comm);
+      else
+#endif
+      {
+        for (int i = 0; i < n_c + n_z*n_z; i++)
+          s_glob[i] = s_loc[i];
+      }
+
+      const cs_real_t *cc = s_glob;
+      const cs_real_t *gg = s_glob + n_c;
+
+      /* Cholesky factorization of projected Gram matrix
+         (Z^t.Z - C^t.C = R^t.R), truncating block at first
+         non-positive pivot */
+
+      int n_b = 0;
+
+      for (int i = 0; i < n_z; i++) {
+        bool pivot_ok = true;
+        for (int l = i; l < n_z; l++) {
+          double v = gg[i*n_z + l];
+          for (int k = 0; k <= j0; k++)
+            v -= cc[k + i*(j0+1)]*cc[k + l*(j0+1)];
+          for (int k = 0; k < i; k++)
+            v -= rr[k + i*n_z]*rr[k + l*n_z];
+          if (l == i) {
+            if (v <= chol_eps*gg[i*n_z + i]) {
+              pivot_ok = false;
+              break;
+            }
+            rr[i + i*n_z] = sqrt(v);
+          }
+          else
+            rr[i + l*n_z] = v / rr[i + i*n_z];
+        }
+        if (pivot_ok == false)
+          break;
+        n_b = i+1;
+      }
+
+      /* Invariant subspace reached (lucky breakdown) */
+
+      if (n_b == 0) {
+        n_b = 1;
+        rr[0] = 0.;
+        breakdown = true;
+      }
+
+      /* Orthonormalize block: Q_b = (Z - Q.C).R^-1 */
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        for (int i = 0; i < n_b; i++) {
+          cs_real_t *restrict z = _krylov_vectors + (j0+1+i)*wa_size;
+          double v = z[ii];
+          for (int k = 0; k <= j0; k++)
+            v -= cc[k + i*(j0+1)] * _krylov_vectors[k*wa_size + ii];
+          for (int k = 0; k < i; k++)
+            v -= rr[k + i*n_z] * _krylov_vectors[(j0+1+k)*wa_size + ii];
+          z[ii] = (rr[i + i*n_z] > 0.) ? v / rr[i + i*n_z] : 0.;
+        }
+      }
+
+      /* Recover Hessenberg matrix columns j0 to j0+n_b-1 from
+         A.M^-1.[q_j0, z_1, ..., z_(n_b-1)] = sigma.[z_1, ..., z_n_b],
+         expressed in the orthonormal basis. */
+
+      for (int i = 0; i < n_b; i++) {
+
+        const int col = j0 + i;
+        cs_real_t *restrict h_col = h + col*h_ld;
+
+        /* Right-hand side: sigma.z_(i+1) - H_prev.X(:, i), where X holds
+           components of the input vector on the previous basis */
+
+        for (int row = 0; row <= col + 1; row++)
+          h_col[row] = sigma * _s_step_basis_coeff(cc, rr, j0, n_z, i, row);
+
+        if (i > 0) {
+          for (int k = 0; k < j0; k++) {
+            const double x_k = _s_step_basis_coeff(cc, rr, j0, n_z, i-1, k);
+            for (int row = 0; row <= k + 1; row++)
+              h_col[row] -= h[k*h_ld + row] * x_k;
+          }
+          for (int l = 0; l < i; l++) {
+            const double t_l
+              = _s_step_basis_coeff(cc, rr, j0, n_z, i-1, j0 + l);
+            for (int row = 0; row <= j0 + l + 1; row++)
+              h_col[row] -= h[(j0+l)*h_ld + row] * t_l;
+          }
+          const double d_t = 1./_s_step_basis_coeff(cc, rr, j0, n_z,
+                                                    i-1, j0 + i);
+          for (int row = 0; row <= col + 1; row++)
+            h_col[row] *= d_t;
+        }
+
+        for (int row = 0; row <= col + 1; row++)
+          hr[col*h_ld + row] = h_col[row];
+
+      }
+
+      /* Update triangular factor and least-squares right-hand side */
+
+      _givens_rot_update(hr,
+                         h_ld,
+                         beta,
+                         givens_coeff,
+                         j0,
+                         j0 + n_b);
+
+      /* Update monomial basis scaling based on norm growth */
+
+      if (n_b == n_z && gg[(n_z-1)*n_z + n_z-1] > 0.) {
+        double growth = pow(gg[(n_z-1)*n_z + n_z-1], 0.5/n_z);
+        if (growth > 0.)
+          sigma *= growth;
+      }
+
+      j0 += n_b;
+      n_iter += n_b;
+
+      /* Residual estimate */
+
+      if (   breakdown
+          || fabs(beta[j0]) <= convergence->precision*convergence->r_norm
+          || n_iter >= convergence->n_iterations_max)
+        cycle_end = true;
+
+    }
+
+    /* Update solution: vx <- vx + M^-1.V.y */
+
+    _solve_diag_sup_halo(hr, j0, h_ld, beta, y);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      fk[ii] = 0.0;
+      for (int k = 0; k < j0; k++)
+        fk[ii] += _krylov_vectors[k*wa_size + ii] * y[k];
+    }
+
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            fk,
+                            gk);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      vx[ii] += gk[ii];
+
+  }
+
+  BFT_FREE(_dense);
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the extra-diagonal contribution of an MSR matrix row.
+ *
+ * Extra-diagonal values may be stored in single precision (when the
+ * matrix uses mixed precision), in which case a_x_val is NULL and
+ * a_x_val_f is used; accumulation is always done in double precision.
+ *
+ * parameters:
+ *   a_col_id  <-- MSR column ids
+ *   a_x_val   <-- MSR extra-diagonal values, or NULL
+ *   a_x_val_f <-- MSR single precision extra-diagonal values, or NULL
+ *   s_id      <-- start id of row in column ids and values
+ *   e_id      <-- past-the-end id of row in column ids and values
+ *   stride    <-- stride of vector vx
+ *   vx        <-- vector values
+ *
+ * returns:
+ *   sum of extra-diagonal coefficients times matching vx values
+ *----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_msr_x_row_dot(const cs_lnum_t  *restrict a_col_id,
+               const cs_real_t  *restrict a_x_val,
+               const float      *restrict a_x_val_f,
+               cs_lnum_t                  s_id,
+               cs_lnum_t                  e_id,
+               cs_lnum_t                  stride,
+               const cs_real_t  *restrict vx)
+{
+  cs_real_t s = 0.;
+
+  if (a_x_val != NULL) {
+    for (cs_lnum_t jj = s_id; jj < e_id; jj++)
+      s += a_x_val[jj]*vx[a_col_id[jj]*stride];
+  }
+  else {
+    for (cs_lnum_t jj = s_id; jj < e_id; jj++)
+      s += (cs_real_t)a_x_val_f[jj]*vx[a_col_id[jj]*stride];
+  }
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using Process-local Gauss-Seidel.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
+                            const cs_matrix_t         *a,
+                            int                        diag_block_size,
+                            cs_halo_rotation_t         rotation_mode,
+                            cs_sles_it_convergence_t  *convergence,
+                            const cs_real_t           *rhs,
+                            cs_real_t                 *restrict vx)
+{
+  cs_sles_convergence_state_t cvg;
+  double  res2, residue;
+
+  unsigned n_iter = 0;
+
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+
+  const cs_halo_t *halo = cs_matrix_get_halo(a);
+
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+
+  const cs_real_t  *restrict ad = cs_matrix_get_diagonal(a);
+
+  const cs_lnum_t  *a_row_index, *a_col_id;
+  const cs_real_t  *a_d_val, *a_x_val;
+
+  const int *db_size = cs_matrix_get_diag_block_size(a);
+  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+  const float *a_x_val_f = cs_matrix_get_msr_x_val_float(a);
+
+  const cs_lnum_t  *order = c->add_data->order;
+
+  cvg = CS_SLES_ITERATING;
+
+  /* Current iteration */
+  /*-------------------*/
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    register double r;
+
+    n_iter += 1;
+
+    /* Synchronize ghost cells first */
+
+    if (halo != NULL) {
 
       if (db_size[3] == 1)
         cs_halo_sync_component(halo,
@@ -3261,15 +4068,14 @@ _p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
 
         cs_lnum_t ii = order[ll];
 
-        const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
-        const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+        const cs_lnum_t s_id = a_row_index[ii];
+        const cs_lnum_t e_id = a_row_index[ii+1];
 
         cs_real_t vxm1 = vx[ii];
         cs_real_t vx0 = rhs[ii];
 
-        for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-          vx0 -= (m_row[jj]*vx[col_id[jj]]);
+        vx0 -= _msr_x_row_dot(a_col_id, a_x_val, a_x_val_f,
+                              s_id, e_id, 1, vx);
 
         vx0 *= ad_inv[ii];
 
@@ -3289,9 +4095,8 @@ _p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
 
         cs_lnum_t ii = order[ll];
 
-        const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
-        const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+        const cs_lnum_t s_id = a_row_index[ii];
+        const cs_lnum_t e_id = a_row_index[ii+1];
 
         for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
 
@@ -3305,8 +4110,8 @@ _p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
             vx0 -=   ad[ii*db_size[3] + kk*db_size[2] + jj]
                    * vx[ii*db_size[1] + jj];
 
-          for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-            vx0 -= (m_row[jj]*vx[col_id[jj]*db_size[1] + kk]);
+          vx0 -= _msr_x_row_dot(a_col_id, a_x_val, a_x_val_f,
+                                s_id, e_id, db_size[1], vx + kk);
 
           vx0 *= ad_inv[ii*db_size[1] + kk];
 
@@ -3390,6 +4195,7 @@ _p_gauss_seidel_msr(cs_sles_it_t              *c,
 
   const int *db_size = cs_matrix_get_diag_block_size(a);
   cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+  const float *a_x_val_f = cs_matrix_get_msr_x_val_float(a);
 
   cvg = CS_SLES_ITERATING;
 
@@ -3441,15 +4247,14 @@ _p_gauss_seidel_msr(cs_sles_it_t              *c,
                           if(n_rows > CS_THR_MIN && !_thread_debug)
       for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
 
-        const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
-        const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+        const cs_lnum_t s_id = a_row_index[ii];
+        const cs_lnum_t e_id = a_row_index[ii+1];
 
         cs_real_t vxm1 = vx[ii];
         cs_real_t vx0 = rhs[ii];
 
-        for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-          vx0 -= (m_row[jj]*vx[col_id[jj]]);
+        vx0 -= _msr_x_row_dot(a_col_id, a_x_val, a_x_val_f,
+                              s_id, e_id, 1, vx);
 
         vx0 *= ad_inv[ii];
 
@@ -3466,9 +4271,8 @@ _p_gauss_seidel_msr(cs_sles_it_t              *c,
                           if(n_rows > CS_THR_MIN && !_thread_debug)
       for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
 
-        const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
-        const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+        const cs_lnum_t s_id = a_row_index[ii];
+        const cs_lnum_t e_id = a_row_index[ii+1];
 
         for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
 
@@ -3482,8 +4286,8 @@ _p_gauss_seidel_msr(cs_sles_it_t              *c,
             vx0 -=   ad[ii*db_size[3] + kk*db_size[2] + jj]
                    * vx[ii*db_size[1] + jj];
 
-          for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-            vx0 -= (m_row[jj]*vx[col_id[jj]*db_size[1] + kk]);
+          vx0 -= _msr_x_row_dot(a_col_id, a_x_val, a_x_val_f,
+                                s_id, e_id, db_size[1], vx + kk);
 
           vx0 *= ad_inv[ii*db_size[1] + kk];
 
@@ -3568,6 +4372,7 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
 
   const int *db_size = cs_matrix_get_diag_block_size(a);
   cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+  const float *a_x_val_f = cs_matrix_get_msr_x_val_float(a);
 
   cvg = CS_SLES_ITERATING;
 
@@ -3616,14 +4421,13 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
 #     pragma omp parallel for if(n_rows > CS_THR_MIN && !_thread_debug)
       for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
 
-        const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
-        const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+        const cs_lnum_t s_id = a_row_index[ii];
+        const cs_lnum_t e_id = a_row_index[ii+1];
 
         cs_real_t vx0 = rhs[ii];
 
-        for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-          vx0 -= (m_row[jj]*vx[col_id[jj]]);
+        vx0 -= _msr_x_row_dot(a_col_id, a_x_val, a_x_val_f,
+                              s_id, e_id, 1, vx);
 
         vx[ii] = vx0 * ad_inv[ii];
 
@@ -3635,9 +4439,8 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
 #     pragma omp parallel for if(n_rows > CS_THR_MIN && !_thread_debug)
       for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
 
-        const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
-        const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+        const cs_lnum_t s_id = a_row_index[ii];
+        const cs_lnum_t e_id = a_row_index[ii+1];
 
         for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
 
@@ -3650,8 +4453,8 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
             vx0 -=   ad[ii*db_size[3] + kk*db_size[2] + jj]
                    * vx[ii*db_size[1] + jj];
 
-          for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-            vx0 -= (m_row[jj]*vx[col_id[jj]*db_size[1] + kk]);
+          vx0 -= _msr_x_row_dot(a_col_id, a_x_val, a_x_val_f,
+                                s_id, e_id, db_size[1], vx + kk);
 
           vx[ii*db_size[1] + kk] = vx0 * ad_inv[ii*db_size[1] + kk];
 
@@ -3700,15 +4503,14 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
                           if(n_rows > CS_THR_MIN && !_thread_debug)
       for (cs_lnum_t ii = n_rows - 1; ii > - 1; ii--) {
 
-        const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
-        const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+        const cs_lnum_t s_id = a_row_index[ii];
+        const cs_lnum_t e_id = a_row_index[ii+1];
 
         cs_real_t vxm1 = vx[ii];
         cs_real_t vx0 = rhs[ii];
 
-        for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-          vx0 -= (m_row[jj]*vx[col_id[jj]]);
+        vx0 -= _msr_x_row_dot(a_col_id, a_x_val, a_x_val_f,
+                              s_id, e_id, 1, vx);
 
         vx0 *= ad_inv[ii];
 
@@ -3725,9 +4527,8 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
                           if(n_rows > CS_THR_MIN && !_thread_debug)
       for (cs_lnum_t ii = n_rows - 1; ii > - 1; ii--) {
 
-        const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
-        const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+        const cs_lnum_t s_id = a_row_index[ii];
+        const cs_lnum_t e_id = a_row_index[ii+1];
 
         for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
 
@@ -3742,8 +4543,8 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
             vx0 -=   ad[ii*db_size[3] + kk*db_size[2] + jj]
                    * vx[ii*db_size[1] + jj];
 
-          for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-            vx0 -= (m_row[jj]*vx[col_id[jj]*db_size[1] + kk]);
+          vx0 -= _msr_x_row_dot(a_col_id, a_x_val, a_x_val_f,
+                                s_id, e_id, db_size[1], vx + kk);
 
           vx0 *= ad_inv[ii*db_size[1] + kk];
 
@@ -3871,6 +4672,274 @@ _p_gauss_seidel(cs_sles_it_t              *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Relax rows of a given color range for multicolor Gauss-Seidel.
+ *
+ * Rows of a same color do not depend on each other, so each color is
+ * handled by a parallel loop; colors are processed in increasing order
+ * for a forward sweep, and in decreasing order for a backward sweep.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size
+ *   forward         <-- true for forward sweep, false for backward sweep
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *
+ * returns:
+ *   local contribution to the squared residue
+ *----------------------------------------------------------------------------*/
+
+static double
+_p_colored_gauss_seidel_sweep(cs_sles_it_t       *c,
+                              const cs_matrix_t  *a,
+                              int                 diag_block_size,
+                              bool                forward,
+                              const cs_real_t    *rhs,
+                              cs_real_t          *restrict vx)
+{
+  double res2 = 0.0;
+
+  const cs_lnum_t n_colors = c->setup_data->n_colors;
+  const cs_lnum_t *color_index = c->setup_data->color_index;
+  const cs_lnum_t *color_rows = c->setup_data->color_rows;
+
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+
+  const cs_real_t  *restrict ad = cs_matrix_get_diagonal(a);
+
+  const cs_lnum_t  *a_row_index, *a_col_id;
+  const cs_real_t  *a_d_val, *a_x_val;
+
+  const int *db_size = cs_matrix_get_diag_block_size(a);
+  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+  const float *a_x_val_f = cs_matrix_get_msr_x_val_float(a);
+
+  for (cs_lnum_t cc = 0; cc < n_colors; cc++) {
+
+    const cs_lnum_t color_id = (forward) ? cc : n_colors - 1 - cc;
+    const cs_lnum_t s_ll = color_index[color_id];
+    const cs_lnum_t e_ll = color_index[color_id + 1];
+    const cs_lnum_t n_c_rows = e_ll - s_ll;
+
+    if (diag_block_size == 1) {
+
+#     pragma omp parallel for reduction(+:res2) \
+                          if(n_c_rows > CS_THR_MIN && !_thread_debug)
+      for (cs_lnum_t ll = s_ll; ll < e_ll; ll++) {
+
+        const cs_lnum_t ii = color_rows[ll];
+
+        const cs_lnum_t s_id = a_row_index[ii];
+        const cs_lnum_t e_id = a_row_index[ii+1];
+
+        cs_real_t vxm1 = vx[ii];
+        cs_real_t vx0 = rhs[ii];
+
+        vx0 -= _msr_x_row_dot(a_col_id, a_x_val, a_x_val_f,
+                              s_id, e_id, 1, vx);
+
+        vx0 *= ad_inv[ii];
+
+        double r = ad[ii] * (vx0-vxm1);
+        res2 += (r*r);
+
+        vx[ii] = vx0;
+      }
+
+    }
+    else {
+
+#     pragma omp parallel for reduction(+:res2) \
+                          if(n_c_rows > CS_THR_MIN && !_thread_debug)
+      for (cs_lnum_t ll = s_ll; ll < e_ll; ll++) {
+
+        const cs_lnum_t ii = color_rows[ll];
+
+        const cs_lnum_t s_id = a_row_index[ii];
+        const cs_lnum_t e_id = a_row_index[ii+1];
+
+        for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+
+          cs_real_t vxm1 = vx[ii*db_size[1] + kk];
+          cs_real_t vx0 = rhs[ii*db_size[1] + kk];
+
+          for (cs_lnum_t jj = 0; jj < kk; jj++)
+            vx0 -=   ad[ii*db_size[3] + kk*db_size[2] + jj]
+                   * vx[ii*db_size[1] + jj];
+          for (cs_lnum_t jj = kk+1; jj < db_size[0]; jj++)
+            vx0 -=   ad[ii*db_size[3] + kk*db_size[2] + jj]
+                   * vx[ii*db_size[1] + jj];
+
+          vx0 -= _msr_x_row_dot(a_col_id, a_x_val, a_x_val_f,
+                                s_id, e_id, db_size[1], vx + kk);
+
+          vx0 *= ad_inv[ii*db_size[1] + kk];
+
+          double r = ad[ii*db_size[1] + kk] * (vx0-vxm1);
+          res2 += (r*r);
+
+          vx[ii*db_size[1] + kk] = vx0;
+
+        }
+
+      }
+
+    }
+
+  }
+
+  return res2;
+}
+
+/*----------------------------------------------------------------------------
+ * Synchronize ghost values before a Gauss-Seidel sweep.
+ *
+ * parameters:
+ *   a             <-- linear equation matrix
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   vx            <-> system solution
+ *----------------------------------------------------------------------------*/
+
+static void
+_p_gauss_seidel_sync(const cs_matrix_t   *a,
+                     cs_halo_rotation_t   rotation_mode,
+                     cs_real_t           *vx)
+{
+  const cs_halo_t *halo = cs_matrix_get_halo(a);
+
+  if (halo == NULL)
+    return;
+
+  const int *db_size = cs_matrix_get_diag_block_size(a);
+
+  if (db_size[3] == 1)
+    cs_halo_sync_component(halo,
+                           CS_HALO_STANDARD,
+                           rotation_mode,
+                           vx);
+
+  else { /* if (matrix->db_size[3] > 1) */
+
+    cs_halo_sync_var_strided(halo,
+                             CS_HALO_STANDARD,
+                             vx,
+                             db_size[1]);
+
+    /* Synchronize periodic values */
+
+    if (halo->n_transforms > 0 && db_size[0] == 3)
+      cs_halo_perio_sync_var_vect(halo,
+                                  CS_HALO_STANDARD,
+                                  vx,
+                                  db_size[1]);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using Process-local multicolor Gauss-Seidel.
+ *
+ * Rows are relaxed color by color, based on the coloring built at setup,
+ * so that threads may be used within each color without degrading the
+ * method to a Gauss-Seidel/Jacobi hybrid. If the symmetric option is set,
+ * each iteration is followed by a backward sweep over colors.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_p_colored_gauss_seidel(cs_sles_it_t              *c,
+                        const cs_matrix_t         *a,
+                        int                        diag_block_size,
+                        cs_halo_rotation_t         rotation_mode,
+                        cs_sles_it_convergence_t  *convergence,
+                        const cs_real_t           *rhs,
+                        cs_real_t                 *restrict vx)
+{
+  cs_sles_convergence_state_t cvg;
+  double  res2, residue;
+
+  unsigned n_iter = 0;
+
+  /* Check matrix storage type */
+
+  if (cs_matrix_get_type(a) != CS_MATRIX_MSR)
+    bft_error
+      (__FILE__, __LINE__, 0,
+       _("Multicolor Gauss-Seidel solver only supported with a\n"
+         "matrix using %s (%s) storage."),
+       cs_matrix_type_name[CS_MATRIX_MSR],
+       _(cs_matrix_type_fullname[CS_MATRIX_MSR]));
+
+  assert(c->setup_data != NULL);
+  assert(c->setup_data->color_index != NULL);
+
+  cvg = CS_SLES_ITERATING;
+
+  /* Current iteration */
+  /*-------------------*/
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    n_iter += 1;
+
+    /* Forward sweep (with residue unless symmetric) */
+
+    _p_gauss_seidel_sync(a, rotation_mode, vx);
+
+    res2 = _p_colored_gauss_seidel_sweep(c, a, diag_block_size, true,
+                                         rhs, vx);
+
+    /* Backward sweep for symmetric variant */
+
+    if (c->symmetric) {
+
+      _p_gauss_seidel_sync(a, rotation_mode, vx);
+
+      res2 = _p_colored_gauss_seidel_sweep(c, a, diag_block_size, false,
+                                           rhs, vx);
+
+    }
+
+#if defined(HAVE_MPI)
+
+    if (c->comm != MPI_COMM_NULL) {
+      double _sum;
+      MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM,
+                    c->comm);
+      res2 = _sum;
+    }
+
+#endif /* defined(HAVE_MPI) */
+
+    residue = sqrt(res2); /* Actually, residue of previous iteration */
+
+    /* Convergence test */
+
+    if (n_iter == 1)
+      c->setup_data->initial_residue = residue;
+
+    cvg = _convergence_test(c, n_iter, residue, convergence);
+
+  }
+
+  return cvg;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -3966,6 +5035,7 @@ cs_sles_it_create(cs_sles_it_type_t   solver_type,
   switch(c->type) {
   case CS_SLES_JACOBI:
   case CS_SLES_P_GAUSS_SEIDEL:
+  case CS_SLES_P_COLORED_GAUSS_SEIDEL:
     c->_pc = NULL;
     break;
   case CS_SLES_PCG:         /* specific implementation for non-preconditioned */
@@ -3987,6 +5057,8 @@ cs_sles_it_create(cs_sles_it_type_t   solver_type,
 
   c->symmetric = false;
 
+  c->s_step = 4;
+
   c->update_stats = update_stats;
 
   c->n_max_iter = n_max_iter;
@@ -4079,6 +5151,8 @@ cs_sles_it_copy(const void  *context)
       d->pc = c->pc;
     }
 
+    d->s_step = c->s_step;
+
 #if defined(HAVE_MPI)
     d->comm = c->comm;
 #endif
@@ -4112,6 +5186,10 @@ cs_sles_it_log(const void  *context,
       cs_log_printf(log_type,
                     _("  Preconditioning:                   %s\n"),
                     _(cs_sles_pc_get_type_name(c->pc)));
+    if (c->type == CS_SLES_GMRES_S_STEP)
+      cs_log_printf(log_type,
+                    _("  s-step block size:                 %d\n"),
+                    c->s_step);
     cs_log_printf(log_type,
                   _("  Maximum number of iterations:      %d\n"),
                   c->n_max_iter);
@@ -4349,6 +5427,17 @@ cs_sles_it_solve(void                *context,
                                            aux_vectors);
       }
       break;
+    case CS_SLES_PCG_PIPELINED:
+      cvg = _conjugate_gradient_pipelined(c,
+                                          a,
+                                          _diag_block_size,
+                                          rotation_mode,
+                                          &convergence,
+                                          rhs,
+                                          vx,
+                                          aux_size,
+                                          aux_vectors);
+      break;
     case CS_SLES_JACOBI:
       if (_diag_block_size == 1)
         cvg = _jacobi(c,
@@ -4417,6 +5506,17 @@ cs_sles_it_solve(void                *context,
           (__FILE__, __LINE__, 0,
            _("GMRES not supported with block_size > 1 (velocity coupling)."));
       break;
+    case CS_SLES_GMRES_S_STEP:
+      cvg = _gmres_s_step(c,
+                          a,
+                          _diag_block_size,
+                          rotation_mode,
+                          &convergence,
+                          rhs,
+                          vx,
+                          aux_size,
+                          aux_vectors);
+      break;
     case CS_SLES_P_GAUSS_SEIDEL:
       cvg = _p_gauss_seidel(c,
                             a,
@@ -4426,6 +5526,15 @@ cs_sles_it_solve(void                *context,
                             rhs,
                             vx);
       break;
+    case CS_SLES_P_COLORED_GAUSS_SEIDEL:
+      cvg = _p_colored_gauss_seidel(c,
+                                    a,
+                                    _diag_block_size,
+                                    rotation_mode,
+                                    &convergence,
+                                    rhs,
+                                    vx);
+      break;
     default:
       bft_error
         (__FILE__, __LINE__, 0,
@@ -4511,6 +5620,8 @@ cs_sles_it_free(void  *context)
 
   if (c->setup_data != NULL) {
     BFT_FREE(c->setup_data->_ad_inv);
+    BFT_FREE(c->setup_data->color_index);
+    BFT_FREE(c->setup_data->color_rows);
     BFT_FREE(c->setup_data);
   }
 
@@ -4648,6 +5759,7 @@ cs_sles_it_transfer_parameters(const cs_sles_it_t  *src,
 
     dest->update_stats = src->update_stats;
     dest->n_max_iter = src->n_max_iter;
+    dest->s_step = src->s_step;
 
     dest->plot_time_stamp = src->plot_time_stamp;
     dest->plot = src->plot;
@@ -4786,10 +5898,37 @@ void
 cs_sles_it_set_symmetric(cs_sles_it_t   *context,
                          bool            symmetric)
 {
-  if (context->type == CS_SLES_P_GAUSS_SEIDEL)
+  if (   context->type == CS_SLES_P_GAUSS_SEIDEL
+      || context->type == CS_SLES_P_COLORED_GAUSS_SEIDEL)
     context->symmetric = symmetric;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Assign block size to s-step GMRES iterative solver.
+ *
+ * This is useful only for s-step GMRES. Each block of s Krylov vectors
+ * requires a single global reduction, so larger values reduce
+ * synchronization, at the cost of a less well-conditioned basis
+ * (blocks are truncated automatically when needed).
+ *
+ * \param[in, out]  context  pointer to iterative solver info and context
+ * \param[in]       s_step   block size (default: 4)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_s_step(cs_sles_it_t   *context,
+                      int             s_step)
+{
+  if (s_step < 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: s-step block size must be at least 1 (%d given)."),
+              __func__, s_step);
+
+  context->s_step = s_step;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Query mean number of rows under which Conjugate Gradient algorithm
@@ -63,6 +63,9 @@ typedef enum {
   CS_SLES_GMRES,           /* Generalized minimal residual */
   CS_SLES_P_GAUSS_SEIDEL,  /* Process-local Gauss-Seidel */
   CS_SLES_PCR3,            /* 3-layer conjugate residual */
+  CS_SLES_PCG_PIPELINED,   /* Pipelined preconditioned conjugate gradient */
+  CS_SLES_P_COLORED_GAUSS_SEIDEL, /* Process-local multicolor Gauss-Seidel */
+  CS_SLES_GMRES_S_STEP,    /* s-step (communication-avoiding) GMRES */
   CS_SLES_N_IT_TYPES       /* Number of resolution algorithms */
 
 } cs_sles_it_type_t;
@@ -409,6 +412,20 @@ void
 cs_sles_it_set_symmetric(cs_sles_it_t   *context,
                          bool            symmetric);
 
+/*----------------------------------------------------------------------------
+ * Assign block size to s-step GMRES iterative solver.
+ *
+ * This is useful only for s-step GMRES.
+ *
+ * parameters:
+ *   context <-> pointer to iterative solver info and context
+ *   s_step  <-- block size (default: 4)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_s_step(cs_sles_it_t   *context,
+                      int             s_step);
+
 /*----------------------------------------------------------------------------
  * Query mean number of rows under which Conjugate Gradient algorithm
  * uses the single-reduction variant.
@@ -58,6 +58,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(HAVE_ZLIB)
+#include <zlib.h>
+#endif
+
 /*----------------------------------------------------------------------------
  *  Local headers
  *----------------------------------------------------------------------------*/
@@ -95,6 +99,10 @@ typedef struct {
   long long      *h_vals;            /* Base values associated
                                         with each header */
 
+  long long      *z_vals;            /* For each entry, number of compressed
+                                        chunks and compressed body size
+                                        (0 if not compressed) */
+
   long long      *offset;            /* Position of associated data
                                         in file (-1 if embedded) */
 
@@ -139,6 +147,11 @@ typedef struct {
   const char     *type_name;      /* Pointer to type field in section header */
   void           *data;           /* Pointer to data in section header */
 
+  long long       z_n_chunks;     /* Number of compressed chunks in
+                                     section body (0 if not compressed) */
+  long long       z_size;         /* Compressed body size, including
+                                     chunk table */
+
   long long       offset;         /* Current position in file */
   int             swap_endian;    /* Swap big-endian and little-endian ? */
 
@@ -656,6 +669,9 @@ _open_input(const char  *filename,
   inp.type_name = NULL;
   inp.data = NULL;
 
+  inp.z_n_chunks = 0;
+  inp.z_size = 0;
+
   inp.offset = 0;
   inp.swap_endian = 0;
 
@@ -1250,13 +1266,36 @@ _read_section_header(_cs_io_t  *inp)
   if (header_vals[1] > 0 && inp->type_name[7] == 'e')
     inp->data = inp->buffer + 56 + header_vals[5];
 
+  /* Compressed sections have the number of chunks and compressed
+     body size following the section name */
+
+  inp->z_n_chunks = 0;
+  inp->z_size = 0;
+
+  if (header_vals[1] > 0 && inp->type_name[6] == 'z') {
+
+    size_t z_vals[2];
+    unsigned char *z_data = inp->buffer + 56 + header_vals[5];
+
+    if (int_endian == 1)
+      _swap_endian(z_data, 8, 2);
+
+    _convert_size(z_data, z_vals, 2);
+
+    inp->z_n_chunks = z_vals[0];
+    inp->z_size = z_vals[1];
+  }
+
   inp->type_size = 0;
 
   if (inp->n_vals > 0) {
 
     inp->type_size = _type_size_from_name(inp->type_name);
 
-    if (inp->data == NULL)
+    if (inp->z_n_chunks > 0)
+      body_size = inp->z_size;
+
+    else if (inp->data == NULL)
       body_size = inp->type_size*inp->n_vals;
 
     else if (int_endian == 1 && inp->type_size > 1)
@@ -1266,6 +1305,107 @@ _read_section_header(_cs_io_t  *inp)
   return body_size;
 }
 
+/*----------------------------------------------------------------------------
+ * Read and decompress values of a compressed section.
+ *
+ * The section body is a table containing the number of values and
+ * compressed size of each chunk, followed by the compressed chunks.
+ * Each chunk contains big-endian values whose bytes are shuffled
+ * (all first bytes, then all second bytes, ...) before compression.
+ *
+ * The file pointer must be positioned at the start of the section body.
+ *
+ * parameters:
+ *   inp <-> pointer to input object
+ *
+ * returns:
+ *   pointer to decompressed values, to be freed by caller
+ *----------------------------------------------------------------------------*/
+
+static unsigned char *
+_read_section_values_z(_cs_io_t  *inp)
+{
+  unsigned char *vals = NULL;
+
+#if defined(HAVE_ZLIB)
+
+  size_t i, j, c_id;
+  size_t n_chunks = inp->z_n_chunks;
+  size_t type_size = inp->type_size;
+  size_t max_chunk_vals = 0, max_z_len = 0, n_read_vals = 0;
+  size_t *chunk_vals = NULL;
+  unsigned char *t_buf = NULL, *z_buf = NULL, *shuffled = NULL;
+
+  MEM_MALLOC(t_buf, n_chunks*16, unsigned char);
+  MEM_MALLOC(chunk_vals, n_chunks*2, size_t);
+
+  _file_read(t_buf, 8, n_chunks*2, inp);
+  _convert_size(t_buf, chunk_vals, n_chunks*2);
+
+  MEM_FREE(t_buf);
+
+  for (c_id = 0; c_id < n_chunks; c_id++) {
+    if (chunk_vals[c_id*2] > max_chunk_vals)
+      max_chunk_vals = chunk_vals[c_id*2];
+    if (chunk_vals[c_id*2 + 1] > max_z_len)
+      max_z_len = chunk_vals[c_id*2 + 1];
+    n_read_vals += chunk_vals[c_id*2];
+  }
+
+  if (n_read_vals != inp->n_vals)
+    _error(__FILE__, __LINE__, 0,
+           _("Compressed section \"%s\" of file \"%s\" contains\n"
+             "%llu values in its chunks instead of %llu."),
+           inp->name, inp->filename,
+           (unsigned long long)n_read_vals, (unsigned long long)inp->n_vals);
+
+  MEM_MALLOC(vals, inp->n_vals*type_size, unsigned char);
+  MEM_MALLOC(z_buf, max_z_len, unsigned char);
+  MEM_MALLOC(shuffled, max_chunk_vals*type_size, unsigned char);
+
+  n_read_vals = 0;
+
+  for (c_id = 0; c_id < n_chunks; c_id++) {
+
+    size_t n_c_vals = chunk_vals[c_id*2];
+    unsigned char *dest = vals + n_read_vals*type_size;
+    uLongf len = n_c_vals*type_size;
+
+    _file_read(z_buf, 1, chunk_vals[c_id*2 + 1], inp);
+
+    if (   uncompress(shuffled, &len, z_buf, chunk_vals[c_id*2 + 1]) != Z_OK
+        || len != n_c_vals*type_size)
+      _error(__FILE__, __LINE__, 0,
+             _("Error decompressing section \"%s\" of file \"%s\"."),
+             inp->name, inp->filename);
+
+    for (i = 0; i < n_c_vals; i++) {
+      for (j = 0; j < type_size; j++)
+        dest[i*type_size + j] = shuffled[j*n_c_vals + i];
+    }
+
+    if (inp->swap_endian && type_size > 1)
+      _swap_endian(dest, type_size, n_c_vals);
+
+    n_read_vals += n_c_vals;
+  }
+
+  MEM_FREE(shuffled);
+  MEM_FREE(z_buf);
+  MEM_FREE(chunk_vals);
+
+#else
+
+  _error(__FILE__, __LINE__, 0,
+         _("Section \"%s\" of file \"%s\" is compressed,\n"
+           "but Zlib support is not available in this build."),
+         inp->name, inp->filename);
+
+#endif /* defined(HAVE_ZLIB) */
+
+  return vals;
+}
+
 /*----------------------------------------------------------------------------
  * Read section values and print associated info
  *
@@ -1283,13 +1423,17 @@ _read_section_values(_cs_io_t    *inp,
                      const char  *f_fmt)
 {
   size_t n_print = 0, n_skip = 0;
-  unsigned char  *buffer = NULL;
+  unsigned char  *buffer = NULL, *z_data = NULL;
   const unsigned char  *data = NULL;
 
   assert(inp->n_vals > 0);
 
   if (inp->data != NULL)
     printf(_("      Values in header\n"));
+  else if (inp->z_n_chunks > 0)
+    printf(_("      Compressed values:   %llu chunks, %llu bytes\n"),
+           (unsigned long long)(inp->z_n_chunks),
+           (unsigned long long)(inp->z_size));
 
   /* Compute number of values to skip */
 
@@ -1311,9 +1455,18 @@ _read_section_values(_cs_io_t    *inp,
     offset += (ba - (offset % ba)) % ba;
     _file_seek(inp, offset, SEEK_SET);
 
+    /* Compressed values are all read and decompressed, and then
+       handled as embedded values */
+
+    if (inp->z_n_chunks > 0) {
+      z_data = _read_section_values_z(inp);
+      _file_seek(inp, offset + inp->z_size, SEEK_SET);
+      data = z_data;
+    }
+
     /* Allocate buffer */
 
-    if (n_print > 0) {
+    else if (n_print > 0) {
       MEM_MALLOC(buffer, n_print*inp->type_size, unsigned char);
       _file_read(buffer, inp->type_size, n_print, inp);
       data = buffer;
@@ -1347,7 +1500,10 @@ _read_section_values(_cs_io_t    *inp,
 
   if (n_skip > 0) {
 
-    if (inp->data == NULL) {
+    if (z_data != NULL)
+      data = z_data + ((n_print+n_skip)*inp->type_size);
+
+    else if (inp->data == NULL) {
 
       long long offset = _file_tell(inp) + n_skip*inp->type_size;
       _file_seek(inp, offset, SEEK_SET);
@@ -1372,6 +1528,8 @@ _read_section_values(_cs_io_t    *inp,
 
   if (buffer != NULL)
     MEM_FREE(buffer);
+  if (z_data != NULL)
+    MEM_FREE(z_data);
 }
 
 /*----------------------------------------------------------------------------
@@ -1393,7 +1551,11 @@ _skip_section_values(_cs_io_t    *inp)
   if (inp->data == NULL) {
     long long offset = _file_tell(inp);
     size_t ba = inp->body_align;
-    offset += (ba - (offset % ba)) % ba + inp->n_vals*inp->type_size;
+    offset += (ba - (offset % ba)) % ba;
+    if (inp->z_n_chunks > 0)
+      offset += inp->z_size;
+    else
+      offset += inp->n_vals*inp->type_size;
     _file_seek(inp, offset, SEEK_SET);
   }
 }
@@ -1425,7 +1587,10 @@ _extract_section_values(_cs_io_t    *inp,
 
     /* Allocate buffer */
 
-    if (n_vals > 0) {
+    if (n_vals > 0 && inp->z_n_chunks > 0)
+      data = _read_section_values_z(inp);
+
+    else if (n_vals > 0) {
       MEM_MALLOC(data, n_vals*inp->type_size, unsigned char);
       _file_read(data, inp->type_size, n_vals, inp);
     }
@@ -1668,6 +1833,7 @@ _update_index_and_shift(_cs_io_t  *inp)
     else
       idx->max_size *= 2;
     MEM_REALLOC(idx->h_vals, idx->max_size*8, long long);
+    MEM_REALLOC(idx->z_vals, idx->max_size*2, long long);
     MEM_REALLOC(idx->offset, idx->max_size, long long);
   };
 
@@ -1713,6 +1879,9 @@ _update_index_and_shift(_cs_io_t  *inp)
   idx->h_vals[id*8 + 5] = idx->types_size;
   idx->h_vals[id*8 + 6] = 0;
 
+  idx->z_vals[id*2]     = inp->z_n_chunks;
+  idx->z_vals[id*2 + 1] = inp->z_size;
+
   strcpy(idx->names + idx->names_size, inp->name);
   idx->names[new_names_size - 1] = '\0';
   idx->names_size = new_names_size;
@@ -1724,6 +1893,8 @@ _update_index_and_shift(_cs_io_t  *inp)
   if (inp->data == NULL) {
     long long offset = _file_tell(inp);
     long long data_shift = inp->n_vals * inp->type_size;
+    if (inp->z_n_chunks > 0)
+      data_shift = inp->z_size;
     if (inp->body_align > 0) {
       size_t ba = inp->body_align;
       idx->offset[id] = offset + (ba - (offset % ba)) % ba;
@@ -1766,6 +1937,7 @@ _create_index(_cs_io_t  *inp,
   idx->max_size = 32;
 
   MEM_MALLOC(idx->h_vals, idx->max_size*8, long long);
+  MEM_MALLOC(idx->z_vals, idx->max_size*2, long long);
   MEM_MALLOC(idx->offset, idx->max_size, long long);
 
   idx->max_names_size = 256;
@@ -1811,6 +1983,7 @@ _destroy_index(_cs_io_t *inp)
     return;
 
   MEM_FREE(idx->h_vals);
+  MEM_FREE(idx->z_vals);
   MEM_FREE(idx->offset);
   MEM_FREE(idx->names);
   MEM_FREE(idx->types);
@@ -1844,6 +2017,8 @@ _set_indexed_section(_cs_io_t  *inp,
     inp->data = index->data + h_vals[6] - 1;
   inp->name = index->names + h_vals[4];
   inp->type_name = index->types + h_vals[5];
+  inp->z_n_chunks = index->z_vals[section_id*2];
+  inp->z_size = index->z_vals[section_id*2 + 1];
   inp->offset = index->offset[section_id];
   inp->type_size = _type_size_from_name(inp->type_name);
 }
@@ -2367,22 +2542,34 @@ _compare_sections(_cs_io_t    *inp1,
     _set_indexed_section(inp1, id1);
     _set_indexed_section(inp2, id2);
 
-    if (inp1->data == NULL && inp2->data == NULL && block_size > max_block_size)
+    /* Values are read by blocks unless embedded or compressed,
+       in which case they are all available in memory */
+
+    const int read_blocks1 = (inp1->data == NULL && inp1->z_n_chunks == 0);
+    const int read_blocks2 = (inp2->data == NULL && inp2->z_n_chunks == 0);
+
+    if (read_blocks1 && read_blocks2 && block_size > max_block_size)
       block_size = max_block_size;
 
     MEM_MALLOC(cmp1, block_size*8, unsigned char);
     MEM_MALLOC(cmp2, block_size*8, unsigned char);
 
     if (inp1->data == NULL) {
-      MEM_MALLOC(buf1, block_size*type_size1, unsigned char);
       _file_seek(inp1, inp1->offset, SEEK_SET);
+      if (read_blocks1)
+        MEM_MALLOC(buf1, block_size*type_size1, unsigned char);
+      else
+        buf1 = _read_section_values_z(inp1);
     }
     else
       buf1 = inp1->data;
 
     if (inp2->data == NULL) {
-      MEM_MALLOC(buf2, block_size*type_size2, unsigned char);
       _file_seek(inp2, inp2->offset, SEEK_SET);
+      if (read_blocks2)
+        MEM_MALLOC(buf2, block_size*type_size2, unsigned char);
+      else
+        buf2 = _read_section_values_z(inp2);
     }
     else
       buf2 = inp2->data;
@@ -2392,9 +2579,9 @@ _compare_sections(_cs_io_t    *inp1,
       if (n_read + block_size > n_vals1)
         block_size = n_vals1 - n_read;
 
-      if (inp1->data == NULL)
+      if (read_blocks1)
         _file_read(buf1, inp1->type_size, block_size, inp1);
-      if (inp2->data == NULL)
+      if (read_blocks2)
         _file_read(buf2, inp2->type_size, block_size, inp2);
 
       _copy_to_cmp(cmp1, buf1, type1, block_size);
@@ -67,6 +67,7 @@
 #include "cs_io.h"
 #include "cs_join.h"
 #include "cs_lagr_tracking.h"
+#include "cs_load_balance.h"
 #include "cs_log.h"
 #include "cs_log_setup.h"
 #include "cs_log_iteration.h"
@@ -402,6 +403,11 @@ cs_run(void)
 #endif
 
   cs_control_finalize();
+  cs_load_balance_finalize();
+
+  /* Complete pending checkpoint writes */
+
+  cs_restart_checkpoint_wait();
 
   /* Print some mesh statistics */
 
@@ -880,6 +880,9 @@ endif
 ! Test presence of control_file to modify ntmabs if required
 call cs_control_check_file
 
+! Check load imbalance (may stop with checkpoint for repartitioning)
+call cs_load_balance_check
+
 if (      (idtvar.eq.0 .or. idtvar.eq.1)                          &
     .and. (ttmabs.gt.0 .and. ttcabs.ge.ttmabs)) then
   ntmabs = ntcabs
@@ -45,6 +45,8 @@
 #include "cs_mesh_quantities.h"
 #include "cs_mesh_bad_cells.h"
 
+#include "cs_lagr_tracking.h"
+
 /*----------------------------------------------------------------------------
  * Header for the current file
  *----------------------------------------------------------------------------*/
@@ -95,6 +97,10 @@ CS_PROCF (algrma, ALGRMA)(cs_real_t  *min_vol,
   cs_mesh_quantities_compute(m, mq);
   cs_mesh_bad_cells_detect(m, mq);
 
+  /* Update geometry cached by particle tracking */
+
+  cs_lagr_tracking_update_geometry();
+
   *min_vol = mq->min_vol;
   *max_vol = mq->max_vol;
   *tot_vol = mq->tot_vol;
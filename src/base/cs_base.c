@@ -788,6 +788,36 @@ _cs_datatype_to_mpi_init(void)
 #endif
 }
 
+/*----------------------------------------------------------------------------
+ * Return the level of thread support to request from MPI.
+ *
+ * OpenMP only requires MPI_THREAD_FUNNELED. Asynchronous checkpoint
+ * writing, requested at startup through the CS_CHECKPOINT_ASYNC
+ * environment variable, uses a writer thread calling MPI concurrently
+ * with the main thread, and requires MPI_THREAD_MULTIPLE.
+ *
+ * returns:
+ *   required MPI thread support level
+ *----------------------------------------------------------------------------*/
+
+static int
+_cs_base_mpi_thread_level(void)
+{
+#if defined(HAVE_OPENMP)
+  int level = MPI_THREAD_FUNNELED;
+#else
+  int level = MPI_THREAD_SINGLE;
+#endif
+
+  const char *s = getenv("CS_CHECKPOINT_ASYNC");
+  if (s != NULL) {
+    if (atoi(s) > 0)
+      level = MPI_THREAD_MULTIPLE;
+  }
+
+  return level;
+}
+
 /*----------------------------------------------------------------------------
  * Complete MPI setup.
  *
@@ -1212,9 +1242,9 @@ cs_base_mpi_init(int    *argc,
   if (use_mpi == true) {
     MPI_Initialized(&flag);
     if (!flag) {
-#if (MPI_VERSION >= 2) && defined(HAVE_OPENMP)
+#if (MPI_VERSION >= 2)
       int mpi_threads;
-      MPI_Init_thread(argc, argv, MPI_THREAD_FUNNELED, &mpi_threads);
+      MPI_Init_thread(argc, argv, _cs_base_mpi_thread_level(), &mpi_threads);
 #else
       MPI_Init(argc, argv);
 #endif
@@ -1240,9 +1270,9 @@ cs_base_mpi_init(int    *argc,
 
     MPI_Initialized(&flag);
     if (!flag) {
-#if (MPI_VERSION >= 2) && defined(HAVE_OPENMP)
+#if (MPI_VERSION >= 2)
       int mpi_threads;
-      MPI_Init_thread(argc, argv, MPI_THREAD_FUNNELED, &mpi_threads);
+      MPI_Init_thread(argc, argv, _cs_base_mpi_thread_level(), &mpi_threads);
 #else
       MPI_Init(argc, argv);
 #endif
@@ -734,6 +734,17 @@ module cs_c_bindings
 
     !---------------------------------------------------------------------------
 
+    ! Interface to C function checking load imbalance and triggering
+    ! repartitioning if required.
+
+    subroutine cs_load_balance_check()  &
+      bind(C, name='cs_load_balance_check')
+      use, intrinsic :: iso_c_binding
+      implicit none
+    end subroutine cs_load_balance_check
+
+    !---------------------------------------------------------------------------
+
     ! Interface to C function mapping field pointers
 
     subroutine cs_field_pointer_map_base()  &
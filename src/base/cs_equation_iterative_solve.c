@@ -259,6 +259,9 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
 
   bool conv_diff_mg = false;
 
+  cs_matrix_t *a_free = NULL;
+  bool matrix_free = false;
+
   /*============================================================================
    * 0.  Initialization
    *==========================================================================*/
@@ -275,6 +278,17 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
       conv_diff_mg = true;
   }
 
+  /* Determine if a matrix-free operator is requested (not compatible
+     with multigrid or other solvers requiring coefficients, in which
+     case the matrix is assembled) */
+
+  if (f_id > -1 && !conv_diff_mg) {
+    f = cs_field_by_id(f_id);
+    if (   cs_field_get_key_int(f, cs_field_key_id("matrix_free")) > 0
+        && cs_sles_matrix_free_supported(f_id, name))
+      matrix_free = true;
+  }
+
   /* Allocate temporary arrays */
 
   BFT_MALLOC(dam, n_cells_ext, cs_real_t);
@@ -302,7 +316,9 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
   isym = 1;
   if (iconvp > 0) isym = 2;
 
-  BFT_MALLOC(xam,isym*n_faces,cs_real_t);
+  xam = NULL;
+  if (!matrix_free)
+    BFT_MALLOC(xam, isym*n_faces, cs_real_t);
   if (conv_diff_mg) {
     BFT_MALLOC(xam_conv, 2*n_faces, cs_real_t);
     BFT_MALLOC(xam_diff,   n_faces, cs_real_t);
@@ -382,6 +398,23 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
                                        dam_diff,
                                        xam_diff);
   }
+  else if (matrix_free) {
+    cs_matrix_wrapper_scalar_diagonal(iconvp,
+                                      idiffp,
+                                      ndircp,
+                                      isym,
+                                      thetap,
+                                      imucpp,
+                                      coefbp,
+                                      cofbfp,
+                                      rovsdt,
+                                      i_massflux,
+                                      b_massflux,
+                                      i_viscm,
+                                      b_viscm,
+                                      xcpp,
+                                      dam);
+  }
   else {
     cs_matrix_wrapper_scalar(iconvp,
                              idiffp,
@@ -408,6 +441,23 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
       dam[iel] /= relaxp;
   }
 
+  /* Matrix-free operator: extradiagonal terms are computed from face
+     values at each product, so only the diagonal is stored */
+
+  if (matrix_free) {
+    a_free = cs_matrix_free_operator();
+    cs_matrix_set_coefficients_conv_diff(a_free,
+                                         (isym == 1) ? true : false,
+                                         db_size,
+                                         iconvp,
+                                         idiffp,
+                                         thetap,
+                                         (imucpp > 0) ? xcpp : NULL,
+                                         (iconvp > 0) ? i_massflux : NULL,
+                                         (idiffp > 0) ? i_viscm : NULL,
+                                         dam);
+  }
+
   /*==========================================================================
    * 2. Iterative process to handle non orthogonalities (starting from the
    *    second iteration).
@@ -571,14 +621,24 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
   if (iinvpe == 2) iinvpp = 3;
   else iinvpp = iinvpe;
 
-  cs_matrix_vector_native_multiply(isym,
-                                   ibsize,
-                                   iesize,
-                                   iinvpp,
-                                   dam,
-                                   xam,
-                                   pvar,
-                                   w1);
+  if (a_free != NULL) {
+    if (iinvpp == 2)
+      rotation_mode = CS_HALO_ROTATION_ZERO;
+    else if (iinvpp == 3)
+      rotation_mode = CS_HALO_ROTATION_IGNORE;
+    else
+      rotation_mode = CS_HALO_ROTATION_COPY;
+    cs_matrix_vector_multiply(rotation_mode, a_free, pvar, w1);
+  }
+  else
+    cs_matrix_vector_native_multiply(isym,
+                                     ibsize,
+                                     iesize,
+                                     iinvpp,
+                                     dam,
+                                     xam,
+                                     pvar,
+                                     w1);
 
 # pragma omp parallel for
   for (cs_lnum_t iel = 0; iel < n_cells ; iel++)
@@ -641,20 +701,33 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
                                      dam_diff,
                                      xam_diff);
 
-    cs_sles_solve_native(f_id,
-                         var_name,
-                         symmetric,
-                         db_size,
-                         eb_size,
-                         dam,
-                         xam,
-                         rotation_mode,
-                         epsilp,
-                         rnorm,
-                         &niterf,
-                         &ressol,
-                         smbrp,
-                         dpvar);
+    if (a_free != NULL)
+      cs_sles_solve_matrix(f_id,
+                           var_name,
+                           a_free,
+                           rotation_mode,
+                           epsilp,
+                           rnorm,
+                           &niterf,
+                           &ressol,
+                           smbrp,
+                           dpvar);
+
+    else
+      cs_sles_solve_native(f_id,
+                           var_name,
+                           symmetric,
+                           db_size,
+                           eb_size,
+                           dam,
+                           xam,
+                           rotation_mode,
+                           epsilp,
+                           rnorm,
+                           &niterf,
+                           &ressol,
+                           smbrp,
+                           dpvar);
 
     /* Dynamic relaxation of the system */
     if (iswdyp >= 1) {
@@ -69,6 +69,12 @@
 #include <dirent.h>
 #endif
 
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_MMAP) && defined(HAVE_FCNTL_H)
+#include <fcntl.h>
+#include <sys/mman.h>
+#define CS_FILE_HAVE_MMAP 1
+#endif
+
 #if defined(WIN32) || defined(_WIN32)
 #include <io.h>
 #endif
@@ -142,6 +148,8 @@ BEGIN_C_DECLS
        Serial standard C IO (funnelled through rank 0 in parallel)
   \var CS_FILE_STDIO_PARALLEL
        Per-process standard C IO (for reading only)
+  \var CS_FILE_MMAP
+       Per-process memory-mapped file access (for reading only)
   \var CS_FILE_MPI_INDEPENDENT
        Non-collective MPI-IO with independent file open and close
        (for reading only)
@@ -192,6 +200,9 @@ struct _cs_file_t {
 
   FILE              *sh;           /* Serial file handle */
 
+  unsigned char     *map;          /* Mapped file contents, or NULL */
+  size_t             map_size;     /* Mapped file size */
+
 #if defined(HAVE_MPI)
   MPI_Comm           comm;         /* Associated MPI communicator */
   MPI_Comm           io_comm;      /* Associated MPI-IO communicator */
@@ -280,6 +291,7 @@ const char  *cs_file_access_name[]
   = {N_("default"),
      N_("standard input and output, serial access"),
      N_("standard input and output, parallel access"),
+     N_("memory-mapped file, parallel access"),
      N_("non-collective MPI-IO, independent file open/close"),
      N_("non-collective MPI-IO, collective file open/close"),
      N_("collective MPI-IO")};
@@ -332,17 +344,23 @@ _access_method(cs_file_access_t  m,
 
   /* Restrict to possible values */
 
+#if !defined(CS_FILE_HAVE_MMAP)
+  if (_m == CS_FILE_MMAP)
+    _m = CS_FILE_STDIO_PARALLEL;
+#endif
+
 #if defined(HAVE_MPI)
 #  if !defined(HAVE_MPI_IO)
   _m = CS_MAX(_m, CS_FILE_STDIO_PARALLEL);
 #  endif
-  if (cs_glob_mpi_comm == MPI_COMM_NULL)
+  if (cs_glob_mpi_comm == MPI_COMM_NULL && _m != CS_FILE_MMAP)
     _m = CS_FILE_STDIO_SERIAL;
 #else
-  _m = CS_FILE_STDIO_SERIAL;
+  if (_m != CS_FILE_MMAP)
+    _m = CS_FILE_STDIO_SERIAL;
 #endif
 
-  if (w && _m == CS_FILE_STDIO_PARALLEL)
+  if (w && (_m == CS_FILE_STDIO_PARALLEL || _m == CS_FILE_MMAP))
     _m = CS_FILE_STDIO_SERIAL;
 
   return _m;
@@ -592,6 +610,125 @@ _file_close(cs_file_t  *f)
   return retval;
 }
 
+#if defined(CS_FILE_HAVE_MMAP)
+
+/*----------------------------------------------------------------------------
+ * Map a file to memory (read-only).
+ *
+ * As the mapping is shared, ranks on a given node use the same pages of
+ * the system's page cache, and repeated reads of a file are inexpensive.
+ *
+ * parameters:
+ *   f    <-- pointer to file handler
+ *
+ * returns:
+ *   0 in case of success, error number in case of failure
+ *----------------------------------------------------------------------------*/
+
+static int
+_file_mmap(cs_file_t  *f)
+{
+  int retval = 0;
+  struct stat s;
+
+  assert(f->mode == CS_FILE_MODE_READ);
+
+  int fd = open(f->name, O_RDONLY);
+
+  if (fd < 0 || fstat(fd, &s) != 0)
+    retval = errno;
+
+  else if (s.st_size > 0) {
+    void *p = mmap(NULL, s.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED)
+      retval = errno;
+    else {
+      f->map = p;
+      f->map_size = s.st_size;
+    }
+  }
+
+  if (fd > -1)
+    close(fd);
+
+  if (retval != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error mapping file \"%s\":\n\n"
+                "  %s"), f->name, strerror(retval));
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Unmap a memory-mapped file.
+ *
+ * parameters:
+ *   f <-> pointer to file handler
+ *
+ * returns:
+ *   0 in case of success, error number in case of failure
+ *----------------------------------------------------------------------------*/
+
+static int
+_file_munmap(cs_file_t  *f)
+{
+  int retval = 0;
+
+  if (f->map != NULL) {
+    if (munmap(f->map, f->map_size) != 0) {
+      retval = errno;
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error unmapping file \"%s\":\n\n"
+                  "  %s"), f->name, strerror(retval));
+    }
+  }
+
+  f->map = NULL;
+  f->map_size = 0;
+
+  return retval;
+}
+
+#endif /* defined(CS_FILE_HAVE_MMAP) */
+
+/*----------------------------------------------------------------------------
+ * Copy data from a memory-mapped file to a buffer.
+ *
+ * Data beyond the end of the file is ignored, and the number of items
+ * returned adjusted accordingly.
+ *
+ * parameters:
+ *   f      <-- cs_file_t descriptor
+ *   buf    --> pointer to location receiving data
+ *   offset <-- offset of first item in file
+ *   size   <-- size of each item of data in bytes
+ *   ni     <-- number of items to read
+ *
+ * returns:
+ *   the (local) number of items (not bytes) sucessfully read;
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_file_read_mapped(cs_file_t      *f,
+                  void           *buf,
+                  cs_file_off_t   offset,
+                  size_t          size,
+                  size_t          ni)
+{
+  size_t retval = 0;
+
+  if (ni > 0 && offset >= 0 && (size_t)offset < f->map_size) {
+    retval = CS_MIN(ni, (f->map_size - offset) / size);
+    memcpy(buf, f->map + offset, retval*size);
+  }
+
+  if (retval != ni)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Premature end of file \"%s\""), f->name);
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------
  * Read data to a buffer using standard C IO.
  *
@@ -1805,6 +1942,9 @@ cs_file_open(const char        *name,
 
   f->sh = NULL;
 
+  f->map = NULL;
+  f->map_size = 0;
+
 #if defined(HAVE_MPI)
   f->comm = MPI_COMM_NULL;
   f->io_comm = MPI_COMM_NULL;
@@ -1843,17 +1983,18 @@ cs_file_open(const char        *name,
         f->io_comm = MPI_COMM_NULL;
       }
     }
-    if (f->comm == MPI_COMM_NULL)
+    if (f->comm == MPI_COMM_NULL && f->method != CS_FILE_MMAP)
       f->method = CS_FILE_STDIO_SERIAL;
   }
 #else
-  f->method = CS_FILE_STDIO_SERIAL;
+  if (f->method != CS_FILE_MMAP)
+    f->method = CS_FILE_STDIO_SERIAL;
 #endif
 
   /* Use MPI IO ? */
 
 #if !defined(HAVE_MPI_IO)
-  if (f->method > CS_FILE_STDIO_PARALLEL)
+  if (f->method > CS_FILE_MMAP)
     bft_error(__FILE__, __LINE__, 0,
               _("Error opening file:\n%s\n"
                 "MPI-IO is requested, but not available."),
@@ -1867,6 +2008,11 @@ cs_file_open(const char        *name,
   if (f->method <= CS_FILE_STDIO_PARALLEL && f->rank == 0)
     errcode = _file_open(f);
 
+#if defined(CS_FILE_HAVE_MMAP)
+  if (f->method == CS_FILE_MMAP)
+    errcode = _file_mmap(f);
+#endif
+
 #if defined(HAVE_MPI_IO)
   if (f->method == CS_FILE_MPI_INDEPENDENT) {
     f->io_comm = MPI_COMM_SELF;
@@ -1953,6 +2099,11 @@ cs_file_free(cs_file_t  *f)
   if (_f->sh != NULL)
     _file_close(_f);
 
+#if defined(CS_FILE_HAVE_MMAP)
+  else if (_f->map != NULL)
+    _file_munmap(_f);
+#endif
+
 #if defined(HAVE_MPI_IO)
   else if (_f->fh != MPI_FILE_NULL)
     _mpi_file_close(_f);
@@ -2074,6 +2225,17 @@ cs_file_read_global(cs_file_t  *f,
 {
   size_t retval = 0;
 
+  /* With memory-mapped files, each rank simply copies data from
+     the mapping, so no broadcast is needed */
+
+  if (f->method == CS_FILE_MMAP) {
+    retval = _file_read_mapped(f, buf, f->offset, size, ni);
+    f->offset += (cs_file_off_t)ni * (cs_file_off_t)size;
+    if (f->swap_endian == true && size > 1)
+      _swap_endian(buf, buf, size, retval);
+    return retval;
+  }
+
   if (f->method <= CS_FILE_STDIO_PARALLEL) {
     if (f->rank == 0) {
       if (_file_seek(f, f->offset, CS_FILE_SEEK_SET) == 0)
@@ -2083,7 +2245,7 @@ cs_file_read_global(cs_file_t  *f,
 
 #if defined(HAVE_MPI_IO)
 
-  else if ((f->method > CS_FILE_STDIO_PARALLEL)) {
+  else if ((f->method > CS_FILE_MMAP)) {
 
     MPI_Status status;
     int errcode = MPI_SUCCESS, count = 0;
@@ -2329,6 +2491,14 @@ cs_file_read_block(cs_file_t  *f,
                                 _global_num_end);
     break;
 
+  case CS_FILE_MMAP:
+    retval = _file_read_mapped(f,
+                               buf,
+                               f->offset + (_global_num_start - 1)*size,
+                               size,
+                               _global_num_end - _global_num_start);
+    break;
+
 #if defined(HAVE_MPI_IO)
 
   case CS_FILE_MPI_INDEPENDENT:
@@ -2639,6 +2809,9 @@ cs_file_seek(cs_file_t       *f,
     if (f->sh != NULL)
       f->offset = cs_file_tell(f) + offset;
 
+    if (f->method == CS_FILE_MMAP)
+      f->offset = f->map_size + offset;
+
 #if defined(HAVE_MPI_IO)
     if (f->fh != MPI_FILE_NULL) {
       MPI_Offset f_size = 0;
@@ -2751,6 +2924,7 @@ cs_file_dump(const cs_file_t  *f)
                              "CS_FILE_MODE_APPEND"};
   const char *access_name[] = {"CS_FILE_STDIO_SERIAL",
                                "CS_FILE_STDIO_PARALLEL",
+                               "CS_FILE_MMAP",
                                "CS_FILE_MPI_INDEPENDENT",
                                "CS_FILE_MPI_NON_COLLECTIVE",
                                "CS_FILE_MPI_COLLECTIVE"};
@@ -2936,7 +3110,7 @@ cs_file_set_default_access(cs_file_mode_t    mode,
 
   /* Set info objects */
 
-  if (_method > CS_FILE_STDIO_PARALLEL && hints != MPI_INFO_NULL) {
+  if (_method > CS_FILE_MMAP && hints != MPI_INFO_NULL) {
     if (mode == CS_FILE_MODE_READ)
       MPI_Info_dup(hints, &_mpi_io_hints_r);
     else if (mode == CS_FILE_MODE_WRITE || mode == CS_FILE_MODE_APPEND)
@@ -3249,7 +3423,7 @@ cs_file_defaults_info(void)
     cs_file_get_default_access(mode, &method, &hints);
 
 #if defined(HAVE_MPI_IO)
-    if (method > CS_FILE_STDIO_PARALLEL) {
+    if (method > CS_FILE_MMAP) {
       for (log_id = 0; log_id < 2; log_id++)
         cs_log_printf(logs[log_id],
                       _(fmt[mode + 2]),
@@ -3257,7 +3431,7 @@ cs_file_defaults_info(void)
                       _(cs_file_mpi_positionning_name[_mpi_io_positionning]));
     }
 #endif
-    if (method <= CS_FILE_STDIO_PARALLEL) {
+    if (method <= CS_FILE_MMAP) {
       for (log_id = 0; log_id < 2; log_id++)
         cs_log_printf(logs[log_id],
                       _(fmt[mode]), _(cs_file_access_name[method]));
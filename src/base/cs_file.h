@@ -86,6 +86,7 @@ typedef enum {
   CS_FILE_DEFAULT,
   CS_FILE_STDIO_SERIAL,
   CS_FILE_STDIO_PARALLEL,
+  CS_FILE_MMAP,
   CS_FILE_MPI_INDEPENDENT,
   CS_FILE_MPI_NON_COLLECTIVE,
   CS_FILE_MPI_COLLECTIVE
@@ -60,6 +60,45 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+#if defined(HAVE_MPI)
+
+/* Persistent communication plan, for a given halo, synchronization
+   mode, and stride */
+
+typedef struct _cs_halo_plan_t {
+
+  const cs_halo_t   *halo;           /* Associated halo */
+  cs_halo_type_t     sync_mode;      /* Synchronization mode */
+  int                stride;         /* Number of values per element */
+
+  int                n_requests;     /* Number of persistent requests
+                                        (receives first, then sends) */
+  MPI_Request       *request;        /* Persistent requests */
+  MPI_Status        *status;         /* Request status */
+
+  int                n_recv;         /* Number of receive sections */
+  cs_lnum_t         *recv_index;     /* Index of sections in receive buffer
+                                        (size: n_recv + 1) */
+  cs_lnum_t         *recv_shift;     /* Start of matching ghost values in
+                                        variable array (size: n_recv) */
+  cs_real_t         *recv_buffer;    /* Receive buffer */
+
+  cs_lnum_t          n_send_vals;    /* Number of values sent */
+  cs_lnum_t         *send_ids;       /* Ids of sent values in variable
+                                        array, already multiplied by stride
+                                        (size: n_send_vals) */
+  cs_real_t         *send_buffer;    /* Send buffer */
+
+  struct _cs_halo_plan_t  *next;     /* Next plan in list */
+
+} cs_halo_plan_t;
+
+#endif
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -82,8 +121,21 @@ static int           _cs_glob_halo_request_size = 0;
 static MPI_Request  *_cs_glob_halo_request = NULL;
 static MPI_Status   *_cs_glob_halo_status = NULL;
 
+/* Number of pending requests for split (start/wait) synchronization */
+
+static int           _cs_glob_halo_n_pending_requests = 0;
+
+/* Persistent communication plans, and plan of pending synchronization */
+
+static cs_halo_plan_t  *_cs_glob_halo_plans = NULL;
+static cs_halo_plan_t  *_cs_glob_halo_pending_plan = NULL;
+
 #endif
 
+/* Should we use persistent communication plans ? */
+
+static bool _cs_glob_halo_use_persistent = false;
+
 /* Buffer to save rotation halo values */
 
 static size_t  _cs_glob_halo_rot_backup_size = 0;
@@ -309,6 +361,577 @@ _zero_rotation_values(const cs_halo_t  *halo,
   }
 }
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Create a persistent communication plan for a halo.
+ *
+ * Persistent requests are initialized, and the list of values to send
+ * (including stride) is built once, so synchronizations using this plan
+ * only need to pack values, start requests, and copy received values.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   stride    <-- number of (interlaced) values by entity
+ *
+ * returns:
+ *   pointer to created plan
+ *----------------------------------------------------------------------------*/
+
+static cs_halo_plan_t *
+_plan_create(const cs_halo_t  *halo,
+             cs_halo_type_t    sync_mode,
+             int               stride)
+{
+  int rank_id;
+  int n_send = 0, request_count = 0;
+  cs_lnum_t recv_size = 0;
+
+  const cs_lnum_t end_shift = (sync_mode == CS_HALO_STANDARD) ? 1 : 2;
+  const int local_rank = cs_glob_rank_id;
+
+  cs_halo_plan_t *plan;
+
+  BFT_MALLOC(plan, 1, cs_halo_plan_t);
+
+  plan->halo = halo;
+  plan->sync_mode = sync_mode;
+  plan->stride = stride;
+  plan->n_recv = 0;
+  plan->n_send_vals = 0;
+  plan->next = NULL;
+
+  /* Count sections */
+
+  for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    if (halo->c_domain_rank[rank_id] == local_rank)
+      continue;
+
+    cs_lnum_t r_length =   halo->index[2*rank_id + end_shift]
+                         - halo->index[2*rank_id];
+    cs_lnum_t s_length =   halo->send_index[2*rank_id + end_shift]
+                         - halo->send_index[2*rank_id];
+
+    if (r_length > 0) {
+      plan->n_recv += 1;
+      recv_size += r_length*stride;
+    }
+    if (s_length > 0) {
+      n_send += 1;
+      plan->n_send_vals += s_length*stride;
+    }
+
+  }
+
+  plan->n_requests = plan->n_recv + n_send;
+
+  BFT_MALLOC(plan->request, plan->n_requests, MPI_Request);
+  BFT_MALLOC(plan->status, plan->n_requests, MPI_Status);
+  BFT_MALLOC(plan->recv_index, plan->n_recv + 1, cs_lnum_t);
+  BFT_MALLOC(plan->recv_shift, plan->n_recv, cs_lnum_t);
+  BFT_MALLOC(plan->recv_buffer, recv_size, cs_real_t);
+  BFT_MALLOC(plan->send_ids, plan->n_send_vals, cs_lnum_t);
+  BFT_MALLOC(plan->send_buffer, plan->n_send_vals, cs_real_t);
+
+  /* Initialize receives */
+
+  int recv_id = 0;
+  plan->recv_index[0] = 0;
+
+  for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    if (halo->c_domain_rank[rank_id] == local_rank)
+      continue;
+
+    cs_lnum_t length = (  halo->index[2*rank_id + end_shift]
+                        - halo->index[2*rank_id]) * stride;
+
+    if (length > 0) {
+
+      plan->recv_shift[recv_id]
+        = (halo->n_local_elts + halo->index[2*rank_id])*stride;
+      plan->recv_index[recv_id + 1] = plan->recv_index[recv_id] + length;
+
+      MPI_Recv_init(plan->recv_buffer + plan->recv_index[recv_id],
+                    length,
+                    CS_MPI_REAL,
+                    halo->c_domain_rank[rank_id],
+                    halo->c_domain_rank[rank_id],
+                    cs_glob_mpi_comm,
+                    &(plan->request[request_count++]));
+
+      recv_id++;
+
+    }
+
+  }
+
+  /* Pre-pack send ids and initialize sends */
+
+  cs_lnum_t send_shift = 0;
+
+  for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    if (halo->c_domain_rank[rank_id] == local_rank)
+      continue;
+
+    cs_lnum_t start = halo->send_index[2*rank_id];
+    cs_lnum_t end = halo->send_index[2*rank_id + end_shift];
+
+    if (end > start) {
+
+      cs_lnum_t *send_ids = plan->send_ids + send_shift;
+
+      for (cs_lnum_t i = start; i < end; i++) {
+        for (int j = 0; j < stride; j++)
+          send_ids[(i-start)*stride + j] = halo->send_list[i]*stride + j;
+      }
+
+      MPI_Send_init(plan->send_buffer + send_shift,
+                    (end - start)*stride,
+                    CS_MPI_REAL,
+                    halo->c_domain_rank[rank_id],
+                    local_rank,
+                    cs_glob_mpi_comm,
+                    &(plan->request[request_count++]));
+
+      send_shift += (end - start)*stride;
+
+    }
+
+  }
+
+  return plan;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a persistent communication plan.
+ *
+ * parameters:
+ *   plan <-> pointer to plan structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_plan_destroy(cs_halo_plan_t  **plan)
+{
+  cs_halo_plan_t *_plan = *plan;
+
+  for (int i = 0; i < _plan->n_requests; i++)
+    MPI_Request_free(&(_plan->request[i]));
+
+  BFT_FREE(_plan->request);
+  BFT_FREE(_plan->status);
+  BFT_FREE(_plan->recv_index);
+  BFT_FREE(_plan->recv_shift);
+  BFT_FREE(_plan->recv_buffer);
+  BFT_FREE(_plan->send_ids);
+  BFT_FREE(_plan->send_buffer);
+
+  BFT_FREE(*plan);
+}
+
+/*----------------------------------------------------------------------------
+ * Get persistent communication plan matching a halo, synchronization mode
+ * and stride, creating it if necessary.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   stride    <-- number of (interlaced) values by entity
+ *
+ * returns:
+ *   pointer to matching plan
+ *----------------------------------------------------------------------------*/
+
+static cs_halo_plan_t *
+_get_plan(const cs_halo_t  *halo,
+          cs_halo_type_t    sync_mode,
+          int               stride)
+{
+  cs_halo_plan_t *plan = _cs_glob_halo_plans;
+
+  while (plan != NULL) {
+    if (   plan->halo == halo
+        && plan->sync_mode == sync_mode
+        && plan->stride == stride)
+      return plan;
+    plan = plan->next;
+  }
+
+  plan = _plan_create(halo, sync_mode, stride);
+
+  plan->next = _cs_glob_halo_plans;
+  _cs_glob_halo_plans = plan;
+
+  return plan;
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Destroy persistent communication plans associated with a halo.
+ *
+ * This must be called whenever the halo is modified or destroyed.
+ *
+ * parameters:
+ *   halo <-- pointer to halo structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_destroy_plans(const cs_halo_t  *halo)
+{
+#if defined(HAVE_MPI)
+
+  cs_halo_plan_t *prev = NULL;
+  cs_halo_plan_t *plan = _cs_glob_halo_plans;
+
+  while (plan != NULL) {
+    cs_halo_plan_t *next = plan->next;
+    if (plan->halo == halo) {
+      if (prev != NULL)
+        prev->next = next;
+      else
+        _cs_glob_halo_plans = next;
+      _plan_destroy(&plan);
+    }
+    else
+      prev = plan;
+    plan = next;
+  }
+
+#else
+
+  CS_UNUSED(halo);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Update global buffer sizes so as to be usable with a given halo.
+ *
+ * parameters:
+ *   halo <-- pointer to cs_halo_t structure.
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_buffers(const cs_halo_t  *halo)
+{
+  if (halo == NULL)
+    return;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    size_t send_buffer_size =   CS_MAX(halo->n_send_elts[CS_HALO_EXTENDED],
+                                       halo->n_elts[CS_HALO_EXTENDED])
+                              * CS_MAX(sizeof(cs_lnum_t),
+                                       sizeof(cs_real_t)) * _cs_glob_halo_max_stride;
+
+    int n_requests = halo->n_c_domains*2;
+
+    if (send_buffer_size > _cs_glob_halo_send_buffer_size) {
+      _cs_glob_halo_send_buffer_size =  send_buffer_size;
+      BFT_REALLOC(_cs_glob_halo_send_buffer,
+                  _cs_glob_halo_send_buffer_size,
+                  char);
+    }
+
+    if (n_requests > _cs_glob_halo_request_size) {
+      _cs_glob_halo_request_size = n_requests;
+      BFT_REALLOC(_cs_glob_halo_request,
+                  _cs_glob_halo_request_size,
+                  MPI_Request);
+      BFT_REALLOC(_cs_glob_halo_status,
+                  _cs_glob_halo_request_size,
+                  MPI_Status);
+
+    }
+
+  }
+
+#endif
+
+  /* Buffer to save and restore rotation halo values */
+
+  if (halo->n_rotations > 0) {
+
+    int rank_id, t_id, shift;
+    size_t save_count = 0;
+
+    const fvm_periodicity_t *periodicity = halo->periodicity;
+
+    /* Loop on transforms */
+
+    for (t_id = 0; t_id < halo->n_transforms; t_id++) {
+
+      shift = 4 * halo->n_c_domains * t_id;
+
+      if (   fvm_periodicity_get_type(periodicity, t_id)
+          >= FVM_PERIODICITY_ROTATION) {
+        for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+          save_count += halo->perio_lst[shift + 4*rank_id + 1];
+          save_count += halo->perio_lst[shift + 4*rank_id + 3];
+        }
+      }
+
+    }
+
+    save_count *= 3;
+
+    if (save_count > _cs_glob_halo_rot_backup_size) {
+      _cs_glob_halo_rot_backup_size = save_count;
+      BFT_REALLOC(_cs_glob_halo_rot_backup,
+                  _cs_glob_halo_rot_backup_size,
+                  cs_real_t);
+    }
+
+  } /* End of test on presence of rotations */
+}
+
+/*----------------------------------------------------------------------------
+ * Start update of array of strided variable (floating-point) values in case
+ * of parallelism or periodicity.
+ *
+ * Receives and sends are posted (and local periodic values copied), but
+ * distant exchanges are not waited for; _sync_var_strided_wait() must be
+ * called before ghost values are used.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   var       <-> pointer to variable value array
+ *   stride    <-- number of (interlaced) values by entity
+ *----------------------------------------------------------------------------*/
+
+static void
+_sync_var_strided_start(const cs_halo_t  *halo,
+                        cs_halo_type_t    sync_mode,
+                        cs_real_t         var[],
+                        int               stride)
+{
+  cs_lnum_t i, j, start, length;
+
+  cs_lnum_t end_shift = 0;
+  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
+
+  if (stride > _cs_glob_halo_max_stride)
+    _cs_glob_halo_max_stride = stride;
+  _update_buffers(halo);
+
+  if (sync_mode == CS_HALO_STANDARD)
+    end_shift = 1;
+
+  else if (sync_mode == CS_HALO_EXTENDED)
+    end_shift = 2;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1 && _cs_glob_halo_use_persistent) {
+
+    cs_halo_plan_t *plan = _get_plan(halo, sync_mode, stride);
+
+    const cs_lnum_t *send_ids = plan->send_ids;
+    cs_real_t *send_buffer = plan->send_buffer;
+
+    for (i = 0; i < plan->n_send_vals; i++)
+      send_buffer[i] = var[send_ids[i]];
+
+    if (plan->n_requests > 0)
+      MPI_Startall(plan->n_requests, plan->request);
+
+    _cs_glob_halo_pending_plan = plan;
+
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+      if (halo->c_domain_rank[rank_id] == cs_glob_rank_id)
+        local_rank_id = rank_id;
+    }
+
+  }
+
+  else if (cs_glob_n_ranks > 1) {
+
+    int rank_id;
+    int request_count = 0;
+    cs_real_t *build_buffer = (cs_real_t *)_cs_glob_halo_send_buffer;
+    cs_real_t *buffer = NULL;
+    const int local_rank = cs_glob_rank_id;
+
+    /* Receive data from distant ranks */
+
+    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      length = (  halo->index[2*rank_id + end_shift]
+                - halo->index[2*rank_id]) * stride;
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+
+        if (length > 0) {
+
+          buffer = var + (halo->n_local_elts + halo->index[2*rank_id])*stride;
+
+          MPI_Irecv(buffer,
+                    length,
+                    CS_MPI_REAL,
+                    halo->c_domain_rank[rank_id],
+                    halo->c_domain_rank[rank_id],
+                    cs_glob_mpi_comm,
+                    &(_cs_glob_halo_request[request_count++]));
+
+        }
+      }
+      else
+        local_rank_id = rank_id;
+
+    }
+
+    /* Assemble buffers for halo exchange;
+       avoid threading for now, as dynamic scheduling led to slightly higher cost here,
+       and even static scheduling might lead to false sharing for small halos. */
+
+    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+
+        start = halo->send_index[2*rank_id];
+        length = (  halo->send_index[2*rank_id + end_shift]
+                  - halo->send_index[2*rank_id]);
+
+        if (stride == 3) { /* Unroll loop for this case */
+          for (i = 0; i < length; i++) {
+            build_buffer[(start + i)*3]
+              = var[(halo->send_list[start + i])*3];
+            build_buffer[(start + i)*3 + 1]
+              = var[(halo->send_list[start + i])*3 + 1];
+            build_buffer[(start + i)*3 + 2]
+              = var[(halo->send_list[start + i])*3 + 2];
+          }
+        }
+        else {
+          for (i = 0; i < length; i++) {
+            for (j = 0; j < stride; j++)
+              build_buffer[(start + i)*stride + j]
+                = var[(halo->send_list[start + i])*stride + j];
+          }
+        }
+
+      }
+
+    }
+
+    /* We wait for posting all receives (often recommended) */
+
+    if (_cs_glob_halo_use_barrier)
+      MPI_Barrier(cs_glob_mpi_comm);
+
+    /* Send data to distant ranks */
+
+    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      /* If this is not the local rank */
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+
+        start = halo->send_index[2*rank_id];
+        length = (  halo->send_index[2*rank_id + end_shift]
+                  - halo->send_index[2*rank_id]);
+
+        if (length > 0)
+          MPI_Isend(build_buffer + start*stride,
+                    length*stride,
+                    CS_MPI_REAL,
+                    halo->c_domain_rank[rank_id],
+                    local_rank,
+                    cs_glob_mpi_comm,
+                    &(_cs_glob_halo_request[request_count++]));
+
+      }
+
+    }
+
+    _cs_glob_halo_n_pending_requests = request_count;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Copy local values in case of periodicity */
+
+  if (halo->n_transforms > 0) {
+
+    if (local_rank_id > -1) {
+
+      cs_real_t *recv_var
+        = var + (halo->n_local_elts + halo->index[2*local_rank_id])*stride;
+
+      start = halo->send_index[2*local_rank_id];
+      length =   halo->send_index[2*local_rank_id + end_shift]
+               - halo->send_index[2*local_rank_id];
+
+      if (stride == 3) { /* Unroll loop for this case */
+        for (i = 0; i < length; i++) {
+          recv_var[i*3]     = var[(halo->send_list[start + i])*3];
+          recv_var[i*3 + 1] = var[(halo->send_list[start + i])*3 + 1];
+          recv_var[i*3 + 2] = var[(halo->send_list[start + i])*3 + 2];
+        }
+      }
+      else {
+        for (i = 0; i < length; i++) {
+          for (j = 0; j < stride; j++)
+            recv_var[i*stride + j]
+              = var[(halo->send_list[start + i])*stride + j];
+        }
+      }
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of a halo update started with
+ * _sync_var_strided_start().
+ *
+ * parameters:
+ *   var <-> pointer to variable value array
+ *----------------------------------------------------------------------------*/
+
+static void
+_sync_var_strided_wait(cs_real_t  var[])
+{
+#if defined(HAVE_MPI)
+
+  if (_cs_glob_halo_pending_plan != NULL) {
+
+    cs_halo_plan_t *plan = _cs_glob_halo_pending_plan;
+
+    if (plan->n_requests > 0)
+      MPI_Waitall(plan->n_requests, plan->request, plan->status);
+
+    for (int i = 0; i < plan->n_recv; i++)
+      memcpy(var + plan->recv_shift[i],
+             plan->recv_buffer + plan->recv_index[i],
+             (plan->recv_index[i+1] - plan->recv_index[i])*sizeof(cs_real_t));
+
+    _cs_glob_halo_pending_plan = NULL;
+
+  }
+
+  else if (_cs_glob_halo_n_pending_requests > 0) {
+    MPI_Waitall(_cs_glob_halo_n_pending_requests,
+                _cs_glob_halo_request,
+                _cs_glob_halo_status);
+    _cs_glob_halo_n_pending_requests = 0;
+  }
+
+#else
+
+  CS_UNUSED(var);
+
+#endif
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -527,6 +1150,8 @@ cs_halo_destroy(cs_halo_t  *halo)
   if (halo == NULL)
     return NULL;
 
+  _destroy_plans(halo);
+
   halo->n_c_domains = 0;
   BFT_FREE(halo->c_domain_rank);
 
@@ -553,107 +1178,40 @@ cs_halo_destroy(cs_halo_t  *halo)
       _cs_glob_halo_send_buffer_size = 0;
       _cs_glob_halo_request_size = 0;
 
-      BFT_FREE(_cs_glob_halo_send_buffer);
-
-      BFT_FREE(_cs_glob_halo_request);
-      BFT_FREE(_cs_glob_halo_status);
-    }
-
-#endif
-
-  }
-
-  return NULL;
-}
-
-/*----------------------------------------------------------------------------
- * Update global buffer sizes so as to be usable with a given halo.
- *
- * Calls to halo synchronizations with variable strides up to 3 are
- * expected. For strides greater than 3, the halo will be resized if
- * necessary directly by the synchronization function.
- *
- * This function should be called at the end of any halo creation,
- * so that buffer sizes are increased if necessary.
- *
- * parameters:
- *   halo <-- pointer to cs_halo_t structure.
- *---------------------------------------------------------------------------*/
-
-void
-cs_halo_update_buffers(const cs_halo_t *halo)
-{
-  if (halo == NULL)
-    return;
-
-#if defined(HAVE_MPI)
-
-  if (cs_glob_n_ranks > 1) {
-
-    size_t send_buffer_size =   CS_MAX(halo->n_send_elts[CS_HALO_EXTENDED],
-                                       halo->n_elts[CS_HALO_EXTENDED])
-                              * CS_MAX(sizeof(cs_lnum_t),
-                                       sizeof(cs_real_t)) * _cs_glob_halo_max_stride;
-
-    int n_requests = halo->n_c_domains*2;
-
-    if (send_buffer_size > _cs_glob_halo_send_buffer_size) {
-      _cs_glob_halo_send_buffer_size =  send_buffer_size;
-      BFT_REALLOC(_cs_glob_halo_send_buffer,
-                  _cs_glob_halo_send_buffer_size,
-                  char);
-    }
-
-    if (n_requests > _cs_glob_halo_request_size) {
-      _cs_glob_halo_request_size = n_requests;
-      BFT_REALLOC(_cs_glob_halo_request,
-                  _cs_glob_halo_request_size,
-                  MPI_Request);
-      BFT_REALLOC(_cs_glob_halo_status,
-                  _cs_glob_halo_request_size,
-                  MPI_Status);
-
-    }
-
-  }
-
-#endif
-
-  /* Buffer to save and restore rotation halo values */
-
-  if (halo->n_rotations > 0) {
-
-    int rank_id, t_id, shift;
-    size_t save_count = 0;
-
-    const fvm_periodicity_t *periodicity = halo->periodicity;
-
-    /* Loop on transforms */
-
-    for (t_id = 0; t_id < halo->n_transforms; t_id++) {
-
-      shift = 4 * halo->n_c_domains * t_id;
-
-      if (   fvm_periodicity_get_type(periodicity, t_id)
-          >= FVM_PERIODICITY_ROTATION) {
-        for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-          save_count += halo->perio_lst[shift + 4*rank_id + 1];
-          save_count += halo->perio_lst[shift + 4*rank_id + 3];
-        }
-      }
-
+      BFT_FREE(_cs_glob_halo_send_buffer);
+
+      BFT_FREE(_cs_glob_halo_request);
+      BFT_FREE(_cs_glob_halo_status);
     }
 
-    save_count *= 3;
+#endif
 
-    if (save_count > _cs_glob_halo_rot_backup_size) {
-      _cs_glob_halo_rot_backup_size = save_count;
-      BFT_REALLOC(_cs_glob_halo_rot_backup,
-                  _cs_glob_halo_rot_backup_size,
-                  cs_real_t);
-    }
+  }
 
-  } /* End of test on presence of rotations */
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Update global buffer sizes so as to be usable with a given halo.
+ *
+ * Calls to halo synchronizations with variable strides up to 3 are
+ * expected. For strides greater than 3, the halo will be resized if
+ * necessary directly by the synchronization function.
+ *
+ * This function should be called at the end of any halo creation or
+ * modification, so that buffer sizes are increased if necessary, and
+ * persistent communication plans based on previous halo data are freed.
+ *
+ * parameters:
+ *   halo <-- pointer to cs_halo_t structure.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_update_buffers(const cs_halo_t *halo)
+{
+  _destroy_plans(halo);
+
+  _update_buffers(halo);
 }
 
 /*----------------------------------------------------------------------------
@@ -685,6 +1243,8 @@ cs_halo_renumber_cells(cs_halo_t        *halo,
 
     const cs_lnum_t n_elts = halo->n_send_elts[CS_HALO_EXTENDED];
 
+    _destroy_plans(halo);
+
     for (cs_lnum_t j = 0; j < n_elts; j++)
       halo->send_list[j] = new_cell_id[halo->send_list[j]];
 
@@ -706,6 +1266,8 @@ cs_halo_renumber_ghost_cells(cs_halo_t        *halo,
   if (halo == NULL)
     return;
 
+  _destroy_plans(halo);
+
   /* Reverse update from distant cells */
 
   cs_lnum_t *send_buf, *recv_buf;
@@ -1165,6 +1727,14 @@ cs_halo_sync_var(const cs_halo_t  *halo,
 
 #if defined(HAVE_MPI)
 
+  /* Use persistent communication plan if requested */
+
+  if (cs_glob_n_ranks > 1 && _cs_glob_halo_use_persistent) {
+    _sync_var_strided_start(halo, sync_mode, var, 1);
+    _sync_var_strided_wait(var);
+    return;
+  }
+
   if (cs_glob_n_ranks > 1) {
 
     int rank_id;
@@ -1290,161 +1860,8 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
                          cs_real_t         var[],
                          int               stride)
 {
-  cs_lnum_t i, j, start, length;
-
-  cs_lnum_t end_shift = 0;
-  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
-
-  if (stride > _cs_glob_halo_max_stride)
-    _cs_glob_halo_max_stride = stride;
-  cs_halo_update_buffers(halo);
-
-  if (sync_mode == CS_HALO_STANDARD)
-    end_shift = 1;
-
-  else if (sync_mode == CS_HALO_EXTENDED)
-    end_shift = 2;
-
-#if defined(HAVE_MPI)
-
-  if (cs_glob_n_ranks > 1) {
-
-    int rank_id;
-    int request_count = 0;
-    cs_real_t *build_buffer = (cs_real_t *)_cs_glob_halo_send_buffer;
-    cs_real_t *buffer = NULL;
-    const int local_rank = cs_glob_rank_id;
-
-    /* Receive data from distant ranks */
-
-    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-      length = (  halo->index[2*rank_id + end_shift]
-                - halo->index[2*rank_id]) * stride;
-
-      if (halo->c_domain_rank[rank_id] != local_rank) {
-
-        if (length > 0) {
-
-          buffer = var + (halo->n_local_elts + halo->index[2*rank_id])*stride;
-
-          MPI_Irecv(buffer,
-                    length,
-                    CS_MPI_REAL,
-                    halo->c_domain_rank[rank_id],
-                    halo->c_domain_rank[rank_id],
-                    cs_glob_mpi_comm,
-                    &(_cs_glob_halo_request[request_count++]));
-
-        }
-      }
-      else
-        local_rank_id = rank_id;
-
-    }
-
-    /* Assemble buffers for halo exchange;
-       avoid threading for now, as dynamic scheduling led to slightly higher cost here,
-       and even static scheduling might lead to false sharing for small halos. */
-
-    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-      if (halo->c_domain_rank[rank_id] != local_rank) {
-
-        start = halo->send_index[2*rank_id];
-        length = (  halo->send_index[2*rank_id + end_shift]
-                  - halo->send_index[2*rank_id]);
-
-        if (stride == 3) { /* Unroll loop for this case */
-          for (i = 0; i < length; i++) {
-            build_buffer[(start + i)*3]
-              = var[(halo->send_list[start + i])*3];
-            build_buffer[(start + i)*3 + 1]
-              = var[(halo->send_list[start + i])*3 + 1];
-            build_buffer[(start + i)*3 + 2]
-              = var[(halo->send_list[start + i])*3 + 2];
-          }
-        }
-        else {
-          for (i = 0; i < length; i++) {
-            for (j = 0; j < stride; j++)
-              build_buffer[(start + i)*stride + j]
-                = var[(halo->send_list[start + i])*stride + j];
-          }
-        }
-
-      }
-
-    }
-
-    /* We wait for posting all receives (often recommended) */
-
-    if (_cs_glob_halo_use_barrier)
-      MPI_Barrier(cs_glob_mpi_comm);
-
-    /* Send data to distant ranks */
-
-    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-      /* If this is not the local rank */
-
-      if (halo->c_domain_rank[rank_id] != local_rank) {
-
-        start = halo->send_index[2*rank_id];
-        length = (  halo->send_index[2*rank_id + end_shift]
-                  - halo->send_index[2*rank_id]);
-
-        if (length > 0)
-          MPI_Isend(build_buffer + start*stride,
-                    length*stride,
-                    CS_MPI_REAL,
-                    halo->c_domain_rank[rank_id],
-                    local_rank,
-                    cs_glob_mpi_comm,
-                    &(_cs_glob_halo_request[request_count++]));
-
-      }
-
-    }
-
-    /* Wait for all exchanges */
-
-    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
-  }
-
-#endif /* defined(HAVE_MPI) */
-
-  /* Copy local values in case of periodicity */
-
-  if (halo->n_transforms > 0) {
-
-    if (local_rank_id > -1) {
-
-      cs_real_t *recv_var
-        = var + (halo->n_local_elts + halo->index[2*local_rank_id])*stride;
-
-      start = halo->send_index[2*local_rank_id];
-      length =   halo->send_index[2*local_rank_id + end_shift]
-               - halo->send_index[2*local_rank_id];
-
-      if (stride == 3) { /* Unroll loop for this case */
-        for (i = 0; i < length; i++) {
-          recv_var[i*3]     = var[(halo->send_list[start + i])*3];
-          recv_var[i*3 + 1] = var[(halo->send_list[start + i])*3 + 1];
-          recv_var[i*3 + 2] = var[(halo->send_list[start + i])*3 + 2];
-        }
-      }
-      else {
-        for (i = 0; i < length; i++) {
-          for (j = 0; j < stride; j++)
-            recv_var[i*stride + j]
-              = var[(halo->send_list[start + i])*stride + j];
-        }
-      }
-
-    }
-
-  }
+  _sync_var_strided_start(halo, sync_mode, var, stride);
+  _sync_var_strided_wait(var);
 }
 
 /*----------------------------------------------------------------------------
@@ -1542,6 +1959,71 @@ cs_halo_sync_components_strided(const cs_halo_t    *halo,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Start update of array of strided variable (floating-point) halo values
+ * in case of parallelism or periodicity.
+ *
+ * This function is the first part of a split-phase variant of
+ * cs_halo_sync_components_strided(): receives and sends are posted,
+ * but not waited for, so that computations which do not depend on ghost
+ * values may be done before calling cs_halo_sync_wait().
+ *
+ * Only one split-phase synchronization may be pending at a given time.
+ *
+ * parameters:
+ *   halo        <-- pointer to halo structure
+ *   sync_mode   <-- synchronization mode (standard or extended)
+ *   rotation_op <-- rotation operation
+ *   var         <-> pointer to variable value array
+ *   stride      <-- number of (interlaced) values by entity
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_start(const cs_halo_t    *halo,
+                   cs_halo_type_t      sync_mode,
+                   cs_halo_rotation_t  rotation_op,
+                   cs_real_t           var[],
+                   int                 stride)
+{
+  if (   halo->n_rotations > 0
+      && rotation_op == CS_HALO_ROTATION_IGNORE)
+    _save_rotation_values(halo, sync_mode, stride, var);
+
+  _sync_var_strided_start(halo, sync_mode, var, stride);
+}
+
+/*----------------------------------------------------------------------------
+ * Complete update of array of strided variable (floating-point) halo values
+ * started with cs_halo_sync_start().
+ *
+ * Arguments must be identical to those of the matching
+ * cs_halo_sync_start() call.
+ *
+ * parameters:
+ *   halo        <-- pointer to halo structure
+ *   sync_mode   <-- synchronization mode (standard or extended)
+ *   rotation_op <-- rotation operation
+ *   var         <-> pointer to variable value array
+ *   stride      <-- number of (interlaced) values by entity
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_wait(const cs_halo_t    *halo,
+                  cs_halo_type_t      sync_mode,
+                  cs_halo_rotation_t  rotation_op,
+                  cs_real_t           var[],
+                  int                 stride)
+{
+  _sync_var_strided_wait(var);
+
+  if (halo->n_rotations > 0) {
+    if (rotation_op == CS_HALO_ROTATION_IGNORE)
+      _restore_rotation_values(halo, sync_mode, stride, var);
+    else if (rotation_op == CS_HALO_ROTATION_ZERO)
+      _zero_rotation_values(halo, sync_mode, stride, var);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Return MPI_Barrier usage flag.
  *
@@ -1570,6 +2052,42 @@ cs_halo_set_use_barrier(bool use_barrier)
   _cs_glob_halo_use_barrier = use_barrier;
 }
 
+/*----------------------------------------------------------------------------
+ * Return persistent communication plan usage flag.
+ *
+ * returns:
+ *   true if persistent communication plans are used for halo
+ *   synchronization of floating-point values, false otherwise
+ *---------------------------------------------------------------------------*/
+
+bool
+cs_halo_get_use_persistent(void)
+{
+  return _cs_glob_halo_use_persistent;
+}
+
+/*----------------------------------------------------------------------------
+ * Set persistent communication plan usage flag.
+ *
+ * When active, synchronization of floating-point values uses a
+ * communication plan built once for each (halo, synchronization mode,
+ * stride) combination, with persistent MPI requests and pre-packed
+ * send lists. MPI barriers are not used with this mode.
+ *
+ * Plans are rebuilt when halos are renumbered or when
+ * cs_halo_update_buffers() is called after a halo has been modified.
+ *
+ * parameters:
+ *   use_persistent <-- true if persistent communication plans should be
+ *                      used, false otherwise.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_set_use_persistent(bool use_persistent)
+{
+  _cs_glob_halo_use_persistent = use_persistent;
+}
+
 /*----------------------------------------------------------------------------
  * Dump a cs_halo_t structure.
  *
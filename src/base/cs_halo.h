@@ -211,8 +211,9 @@ cs_halo_destroy(cs_halo_t  *this_halo);
  * expected. For strides greater than 3, the halo will be resized if
  * necessary directly by the synchronization function.
  *
- * This function should be called at the end of any halo creation,
- * so that buffer sizes are increased if necessary.
+ * This function should be called at the end of any halo creation or
+ * modification, so that buffer sizes are increased if necessary, and
+ * persistent communication plans based on previous halo data are freed.
  *
  * parameters:
  *   halo <-- pointer to cs_halo_t structure.
@@ -401,6 +402,54 @@ cs_halo_sync_components_strided(const cs_halo_t    *halo,
                                 cs_real_t           var[],
                                 int                 stride);
 
+/*----------------------------------------------------------------------------
+ * Start update of array of strided variable (floating-point) halo values
+ * in case of parallelism or periodicity.
+ *
+ * This function is the first part of a split-phase variant of
+ * cs_halo_sync_components_strided(): receives and sends are posted,
+ * but not waited for, so that computations which do not depend on ghost
+ * values may be done before calling cs_halo_sync_wait().
+ *
+ * Only one split-phase synchronization may be pending at a given time.
+ *
+ * parameters:
+ *   halo        <-- pointer to halo structure
+ *   sync_mode   <-- synchronization mode (standard or extended)
+ *   rotation_op <-- rotation operation
+ *   var         <-> pointer to variable value array
+ *   stride      <-- number of (interlaced) values by entity
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_start(const cs_halo_t    *halo,
+                   cs_halo_type_t      sync_mode,
+                   cs_halo_rotation_t  rotation_op,
+                   cs_real_t           var[],
+                   int                 stride);
+
+/*----------------------------------------------------------------------------
+ * Complete update of array of strided variable (floating-point) halo values
+ * started with cs_halo_sync_start().
+ *
+ * Arguments must be identical to those of the matching
+ * cs_halo_sync_start() call.
+ *
+ * parameters:
+ *   halo        <-- pointer to halo structure
+ *   sync_mode   <-- synchronization mode (standard or extended)
+ *   rotation_op <-- rotation operation
+ *   var         <-> pointer to variable value array
+ *   stride      <-- number of (interlaced) values by entity
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_wait(const cs_halo_t    *halo,
+                  cs_halo_type_t      sync_mode,
+                  cs_halo_rotation_t  rotation_op,
+                  cs_real_t           var[],
+                  int                 stride);
+
 /*----------------------------------------------------------------------------
  * Return MPI_Barrier usage flag.
  *
@@ -423,6 +472,36 @@ cs_halo_get_use_barrier(void);
 void
 cs_halo_set_use_barrier(bool use_barrier);
 
+/*----------------------------------------------------------------------------
+ * Return persistent communication plan usage flag.
+ *
+ * returns:
+ *   true if persistent communication plans are used for halo
+ *   synchronization of floating-point values, false otherwise
+ *---------------------------------------------------------------------------*/
+
+bool
+cs_halo_get_use_persistent(void);
+
+/*----------------------------------------------------------------------------
+ * Set persistent communication plan usage flag.
+ *
+ * When active, synchronization of floating-point values uses a
+ * communication plan built once for each (halo, synchronization mode,
+ * stride) combination, with persistent MPI requests and pre-packed
+ * send lists. MPI barriers are not used with this mode.
+ *
+ * Plans are rebuilt when halos are renumbered or when
+ * cs_halo_update_buffers() is called after a halo has been modified.
+ *
+ * parameters:
+ *   use_persistent <-- true if persistent communication plans should be
+ *                      used, false otherwise.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_set_use_persistent(bool use_persistent);
+
 /*----------------------------------------------------------------------------
  * Dump a cs_halo_t structure.
  *
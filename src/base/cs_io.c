@@ -32,6 +32,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -40,6 +41,10 @@
 #include <mpi.h>
 #endif
 
+#if defined(HAVE_ZLIB)
+#include <zlib.h>
+#endif
+
 #undef HAVE_STDINT_H
 #if defined(__STDC_VERSION__)
 #  if (__STDC_VERSION__ >= 199901L)
@@ -119,6 +124,10 @@ typedef struct {
   cs_file_off_t  *offset;            /* Position of associated data
                                         in file (-1 if embedded) */
 
+  cs_file_off_t  *z_vals;            /* Number of compressed chunks and
+                                        compressed body size for each
+                                        entry (0 if not compressed) */
+
   size_t          max_names_size;    /* Maximum size of names array */
   size_t          names_size;        /* Current size of names array */
   char           *names;             /* Array containing section names */
@@ -169,6 +178,17 @@ struct _cs_io_t {
   int                 log_id;         /* Id of log entry, or -1 */
   double              start_time;     /* Wall-clock time at open */
 
+  /* Compression */
+
+  int                 z_level;        /* Compression level (0 if none) */
+  double              z_tolerance;    /* Relative tolerance for lossy
+                                         compression of floating-point
+                                         values (0 if lossless) */
+  cs_file_off_t       z_n_chunks;     /* Number of compressed chunks in
+                                         current section (0 if none) */
+  cs_file_off_t       z_size;         /* Compressed body size of
+                                         current section */
+
 #if defined(HAVE_MPI)
   MPI_Comm            comm;           /* Assigned communicator */
 #endif
@@ -180,6 +200,12 @@ struct _cs_io_t {
 
 #define CS_IO_MPI_TAG     'C'+'S'+'_'+'I'+'O'
 
+/* Uncompressed size of compressed section chunks, and minimum
+   section data size for compression */
+
+#define CS_IO_Z_CHUNK_SIZE  1048576
+#define CS_IO_Z_MIN_SIZE       4096
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -415,6 +441,13 @@ _cs_io_create(cs_io_mode_t   mode,
   cs_io->log_id = -1;
   cs_io->start_time = 0;
 
+  /* Compression */
+
+  cs_io->z_level = 0;
+  cs_io->z_tolerance = 0.;
+  cs_io->z_n_chunks = 0;
+  cs_io->z_size = 0;
+
 #if defined(HAVE_MPI)
   cs_io->comm = MPI_COMM_NULL;
 #endif
@@ -443,6 +476,7 @@ _create_index(cs_io_t *inp)
 
   BFT_MALLOC(idx->h_vals, idx->max_size*7, cs_file_off_t);
   BFT_MALLOC(idx->offset, idx->max_size, cs_file_off_t);
+  BFT_MALLOC(idx->z_vals, idx->max_size*2, cs_file_off_t);
 
   idx->max_names_size = 256;
   idx->names_size = 0;
@@ -476,6 +510,7 @@ _destroy_index(cs_io_t *inp)
 
   BFT_FREE(idx->h_vals);
   BFT_FREE(idx->offset);
+  BFT_FREE(idx->z_vals);
   BFT_FREE(idx->names);
   BFT_FREE(idx->data);
 
@@ -514,6 +549,7 @@ _update_index_and_shift(cs_io_t             *inp,
       idx->max_size *= 2;
     BFT_REALLOC(idx->h_vals, idx->max_size*7, cs_file_off_t);
     BFT_REALLOC(idx->offset, idx->max_size, cs_file_off_t);
+    BFT_REALLOC(idx->z_vals, idx->max_size*2, cs_file_off_t);
   };
 
   new_names_size = idx->names_size + strlen(inp->sec_name) + 1;
@@ -551,6 +587,9 @@ _update_index_and_shift(cs_io_t             *inp,
   idx->h_vals[id*7 + 5] = 0;
   idx->h_vals[id*7 + 6] = header->type_read;
 
+  idx->z_vals[id*2]     = inp->z_n_chunks;
+  idx->z_vals[id*2 + 1] = inp->z_size;
+
   strcpy(idx->names + idx->names_size, inp->sec_name);
   idx->names[new_names_size - 1] = '\0';
   idx->names_size = new_names_size;
@@ -558,6 +597,8 @@ _update_index_and_shift(cs_io_t             *inp,
   if (inp->data == NULL) {
     cs_file_off_t offset = cs_file_tell(inp->f);
     cs_file_off_t data_shift = inp->n_vals * inp->type_size;
+    if (inp->z_n_chunks > 0)
+      data_shift = inp->z_size;
     if (inp->body_align > 0) {
       size_t ba = inp->body_align;
       idx->offset[id] = offset + (ba - (offset % ba)) % ba;
@@ -1278,6 +1319,470 @@ _cs_io_convert_read(void           *buffer,
   }
 }
 
+#if defined(HAVE_ZLIB)
+
+/*----------------------------------------------------------------------------
+ * Round floating-point values so as to keep only the mantissa bits
+ * required for a given relative tolerance.
+ *
+ * Dropped mantissa bits are set to 0, which greatly improves subsequent
+ * lossless compression. Infinite and NaN values are left unchanged.
+ *
+ * parameters:
+ *   vals      <-> values to round
+ *   elt_type  <-- element type (CS_FLOAT or CS_DOUBLE)
+ *   n_vals    <-- number of values
+ *   tolerance <-- relative tolerance
+ *----------------------------------------------------------------------------*/
+
+static void
+_round_mantissa(void           *vals,
+                cs_datatype_t   elt_type,
+                size_t          n_vals,
+                double          tolerance)
+{
+  int n_bits = ceil(-log2(tolerance)) - 1;
+
+  if (n_bits < 0)
+    n_bits = 0;
+
+  if (elt_type == CS_DOUBLE && sizeof(double) == 8 && n_bits < 52) {
+
+    const uint64_t e_mask = 0x7ff0000000000000ULL;
+    const uint64_t drop = (1ULL << (52 - n_bits)) - 1;
+    uint64_t *_vals = vals;
+
+    for (size_t i = 0; i < n_vals; i++) {
+      uint64_t v = _vals[i];
+      if ((v & e_mask) == e_mask)
+        continue;
+      uint64_t r = (v + (drop >> 1) + 1) & (~drop);
+      if ((r & e_mask) == e_mask)  /* overflow to infinity: truncate */
+        r = v & (~drop);
+      _vals[i] = r;
+    }
+
+  }
+
+  else if (elt_type == CS_FLOAT && sizeof(float) == 4 && n_bits < 23) {
+
+    const uint32_t e_mask = 0x7f800000U;
+    const uint32_t drop = (1U << (23 - n_bits)) - 1;
+    uint32_t *_vals = vals;
+
+    for (size_t i = 0; i < n_vals; i++) {
+      uint32_t v = _vals[i];
+      if ((v & e_mask) == e_mask)
+        continue;
+      uint32_t r = (v + (drop >> 1) + 1) & (~drop);
+      if ((r & e_mask) == e_mask)
+        r = v & (~drop);
+      _vals[i] = r;
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Shuffle bytes of an array so that bytes of same significance are
+ * contiguous, which improves compression of numerical data.
+ *
+ * parameters:
+ *   src       <-- source array
+ *   dest      --> shuffled array
+ *   type_size <-- size of each value
+ *   n_vals    <-- number of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_shuffle(const unsigned char  *src,
+         unsigned char        *dest,
+         size_t                type_size,
+         size_t                n_vals)
+{
+  for (size_t i = 0; i < n_vals; i++) {
+    for (size_t j = 0; j < type_size; j++)
+      dest[j*n_vals + i] = src[i*type_size + j];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Reverse byte shuffling applied by _shuffle().
+ *
+ * parameters:
+ *   src       <-- shuffled array
+ *   dest      --> unshuffled array
+ *   type_size <-- size of each value
+ *   n_vals    <-- number of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_unshuffle(const unsigned char  *src,
+           unsigned char        *dest,
+           size_t                type_size,
+           size_t                n_vals)
+{
+  for (size_t i = 0; i < n_vals; i++) {
+    for (size_t j = 0; j < type_size; j++)
+      dest[i*type_size + j] = src[j*n_vals + i];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compress an array of values by independent chunks.
+ *
+ * Values are converted to the file's endianness, optionally rounded
+ * (if a lossy tolerance is defined), and shuffled before compression.
+ *
+ * The chunk table contains, for each chunk, the number of values and
+ * the compressed size in bytes.
+ *
+ * parameters:
+ *   elts        <-- pointer to values
+ *   elt_type    <-- element type
+ *   n_vals      <-- number of values
+ *   outp        <-- output kernel IO structure
+ *   n_chunks    --> number of chunks
+ *   chunk_vals  --> chunk table (size: 2*n_chunks, to be freed by caller)
+ *   z_size      --> total compressed size in bytes
+ *
+ * returns:
+ *   pointer to compressed data (to be freed by caller)
+ *----------------------------------------------------------------------------*/
+
+static unsigned char *
+_compress_chunks(const void       *elts,
+                 cs_datatype_t     elt_type,
+                 size_t            n_vals,
+                 const cs_io_t    *outp,
+                 size_t           *n_chunks,
+                 cs_file_off_t   **chunk_vals,
+                 size_t           *z_size)
+{
+  const size_t type_size = cs_datatype_size[elt_type];
+  const size_t chunk_size = CS_IO_Z_CHUNK_SIZE / type_size;
+  const bool lossy = (   outp->z_tolerance > 0
+                      && (elt_type == CS_FLOAT || elt_type == CS_DOUBLE));
+
+  size_t _n_chunks = (n_vals + chunk_size - 1) / chunk_size;
+  size_t z_max = compressBound(chunk_size*type_size);
+  size_t _z_size = 0;
+
+  unsigned char *copy = NULL, *shuffled = NULL, *z_buf = NULL;
+  cs_file_off_t *_chunk_vals = NULL;
+
+  BFT_MALLOC(_chunk_vals, _n_chunks*2, cs_file_off_t);
+  BFT_MALLOC(z_buf, _n_chunks*z_max, unsigned char);
+
+  if (_n_chunks > 0) {
+    BFT_MALLOC(copy, chunk_size*type_size, unsigned char);
+    BFT_MALLOC(shuffled, chunk_size*type_size, unsigned char);
+  }
+
+  for (size_t c_id = 0; c_id < _n_chunks; c_id++) {
+
+    size_t s_id = c_id*chunk_size;
+    size_t n_c_vals = CS_MIN(chunk_size, n_vals - s_id);
+    uLongf z_len = z_max;
+
+    memcpy(copy,
+           (const unsigned char *)elts + s_id*type_size,
+           n_c_vals*type_size);
+
+    if (lossy)
+      _round_mantissa(copy, elt_type, n_c_vals, outp->z_tolerance);
+
+    if (cs_file_get_swap_endian(outp->f) == 1 && type_size > 1)
+      _swap_endian(copy, type_size, n_c_vals);
+
+    _shuffle(copy, shuffled, type_size, n_c_vals);
+
+    if (compress2(z_buf + _z_size, &z_len,
+                  shuffled, n_c_vals*type_size,
+                  outp->z_level) != Z_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error compressing data for file \"%s\"."),
+                cs_file_get_name(outp->f));
+
+    _chunk_vals[c_id*2] = n_c_vals;
+    _chunk_vals[c_id*2 + 1] = z_len;
+    _z_size += z_len;
+  }
+
+  BFT_FREE(shuffled);
+  BFT_FREE(copy);
+
+  BFT_REALLOC(z_buf, _z_size, unsigned char);
+
+  *n_chunks = _n_chunks;
+  *chunk_vals = _chunk_vals;
+  *z_size = _z_size;
+
+  return z_buf;
+}
+
+/*----------------------------------------------------------------------------
+ * Decompress an array of values compressed by chunks.
+ *
+ * parameters:
+ *   z_buf       <-- compressed data
+ *   n_chunks    <-- number of chunks
+ *   chunk_vals  <-- chunk table (number of values, compressed size)
+ *   type_size   <-- size of each value
+ *   inp         <-- input kernel IO structure
+ *   dest        --> decompressed values
+ *----------------------------------------------------------------------------*/
+
+static void
+_decompress_chunks(const unsigned char  *z_buf,
+                   size_t                n_chunks,
+                   const cs_file_off_t  *chunk_vals,
+                   size_t                type_size,
+                   const cs_io_t        *inp,
+                   unsigned char        *dest)
+{
+  size_t max_chunk_vals = 0;
+  unsigned char *shuffled = NULL;
+
+  for (size_t c_id = 0; c_id < n_chunks; c_id++)
+    max_chunk_vals = CS_MAX(max_chunk_vals, (size_t)chunk_vals[c_id*2]);
+
+  BFT_MALLOC(shuffled, max_chunk_vals*type_size, unsigned char);
+
+  for (size_t c_id = 0; c_id < n_chunks; c_id++) {
+
+    size_t n_c_vals = chunk_vals[c_id*2];
+    uLongf len = n_c_vals*type_size;
+
+    if (   uncompress(shuffled, &len, z_buf, chunk_vals[c_id*2 + 1]) != Z_OK
+        || len != n_c_vals*type_size)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error decompressing section \"%s\" of file \"%s\"."),
+                inp->sec_name, cs_file_get_name(inp->f));
+
+    _unshuffle(shuffled, dest, type_size, n_c_vals);
+
+    if (cs_file_get_swap_endian(inp->f) == 1 && type_size > 1)
+      _swap_endian(dest, type_size, n_c_vals);
+
+    z_buf += chunk_vals[c_id*2 + 1];
+    dest += n_c_vals*type_size;
+  }
+
+  BFT_FREE(shuffled);
+}
+
+/*----------------------------------------------------------------------------
+ * Read a compressed section body.
+ *
+ * If val_start is 0, all values are read on all ranks; otherwise,
+ * each rank reads a contiguous block of values, with the same
+ * constraints as cs_file_read_block().
+ *
+ * parameters:
+ *   inp       <-> input kernel IO structure
+ *   type_size <-- size of each value
+ *   val_start <-- global number of first value (1 to n), or 0
+ *   val_end   <-- global number of past-the-end value (1 to n), or 0
+ *   buf       --> buffer receiving values
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_body_z(cs_io_t         *inp,
+             size_t           type_size,
+             cs_gnum_t        val_start,
+             cs_gnum_t        val_end,
+             unsigned char   *buf)
+{
+  const size_t n_chunks = inp->z_n_chunks;
+
+  cs_file_off_t *chunk_vals = NULL, *v_idx = NULL, *z_idx = NULL;
+  unsigned char *z_buf = NULL;
+
+  BFT_MALLOC(chunk_vals, n_chunks*2, cs_file_off_t);
+  BFT_MALLOC(v_idx, n_chunks + 1, cs_file_off_t);
+  BFT_MALLOC(z_idx, n_chunks + 1, cs_file_off_t);
+
+  /* Read chunk table */
+
+  {
+    unsigned char *t_buf = NULL;
+    BFT_MALLOC(t_buf, n_chunks*16, unsigned char);
+    cs_file_read_global(inp->f, t_buf, 8, n_chunks*2);
+    _convert_to_offset(t_buf, chunk_vals, n_chunks*2);
+    BFT_FREE(t_buf);
+  }
+
+  v_idx[0] = 0;
+  z_idx[0] = 0;
+  for (size_t c_id = 0; c_id < n_chunks; c_id++) {
+    v_idx[c_id+1] = v_idx[c_id] + chunk_vals[c_id*2];
+    z_idx[c_id+1] = z_idx[c_id] + chunk_vals[c_id*2 + 1];
+  }
+
+  /* Read all values (global mode) */
+
+  if (val_start == 0) {
+
+    BFT_MALLOC(z_buf, z_idx[n_chunks], unsigned char);
+    cs_file_read_global(inp->f, z_buf, 1, z_idx[n_chunks]);
+    _decompress_chunks(z_buf, n_chunks, chunk_vals, type_size, inp, buf);
+
+  }
+
+  /* Read by blocks: each rank reads a contiguous range of chunks,
+     and values are then exchanged where a rank's values are
+     contained in chunks read by another rank. */
+
+  else {
+
+    long long v_s = val_start - 1, v_e = val_end - 1;
+    long long r_vals[4], *all_r_vals = r_vals;
+    long long c_range[2] = {0, n_chunks};
+    long long prefix = 0;
+    int rank_id = 0, n_ranks = 1;
+
+    /* Find chunks containing the requested values */
+
+    r_vals[0] = v_s;
+    r_vals[1] = v_e;
+    r_vals[2] = 0;
+    r_vals[3] = 0;
+
+    if (v_e > v_s) {
+      size_t s_id = 0, e_id = n_chunks;
+      while (e_id - s_id > 1) {    /* v_idx[s_id] <= v_s < v_idx[e_id] */
+        size_t m_id = (s_id + e_id) / 2;
+        if (v_idx[m_id] <= v_s)
+          s_id = m_id;
+        else
+          e_id = m_id;
+      }
+      r_vals[2] = s_id;
+      s_id = 0, e_id = n_chunks;
+      while (e_id - s_id > 1) {    /* v_idx[s_id] < v_e <= v_idx[e_id] */
+        size_t m_id = (s_id + e_id) / 2;
+        if (v_idx[m_id] < v_e)
+          s_id = m_id;
+        else
+          e_id = m_id;
+      }
+      r_vals[3] = e_id;
+    }
+
+#if defined(HAVE_MPI)
+    if (inp->comm != MPI_COMM_NULL) {
+      MPI_Comm_rank(inp->comm, &rank_id);
+      MPI_Comm_size(inp->comm, &n_ranks);
+    }
+    if (n_ranks > 1) {
+      BFT_MALLOC(all_r_vals, n_ranks*4, long long);
+      MPI_Allgather(r_vals, 4, MPI_LONG_LONG, all_r_vals, 4, MPI_LONG_LONG,
+                    inp->comm);
+    }
+#endif
+
+    /* Assign contiguous, non-overlapping chunk ranges to ranks,
+       (the last rank reads up to the end, so as to position the file
+       pointer after the section's body) */
+
+    for (int i = 0; i < n_ranks; i++) {
+      long long c_s = prefix, c_e = prefix;
+      if (all_r_vals[i*4+1] > all_r_vals[i*4])
+        c_e = CS_MAX(all_r_vals[i*4+3], prefix);
+      if (i == n_ranks - 1)
+        c_e = n_chunks;
+      if (i == rank_id) {
+        c_range[0] = c_s;
+        c_range[1] = c_e;
+      }
+      all_r_vals[i*4+2] = c_s;
+      all_r_vals[i*4+3] = c_e;
+      prefix = c_e;
+    }
+
+    /* Read and decompress assigned chunks */
+
+    size_t z_loc = z_idx[c_range[1]] - z_idx[c_range[0]];
+    size_t n_r_vals = v_idx[c_range[1]] - v_idx[c_range[0]];
+    unsigned char *r_buf = NULL;
+
+    BFT_MALLOC(z_buf, z_loc, unsigned char);
+    BFT_MALLOC(r_buf, n_r_vals*type_size, unsigned char);
+
+    cs_file_read_block(inp->f, z_buf, 1, 1,
+                       z_idx[c_range[0]] + 1, z_idx[c_range[1]] + 1);
+
+    _decompress_chunks(z_buf,
+                       c_range[1] - c_range[0],
+                       chunk_vals + c_range[0]*2,
+                       type_size,
+                       inp,
+                       r_buf);
+
+    /* Distribute values */
+
+    if (n_ranks == 1)
+      memcpy(buf,
+             r_buf + (v_s - v_idx[c_range[0]])*type_size,
+             (v_e - v_s)*type_size);
+
+#if defined(HAVE_MPI)
+
+    else {
+
+      int *send_count, *recv_count, *send_displ, *recv_displ;
+
+      BFT_MALLOC(send_count, n_ranks, int);
+      BFT_MALLOC(recv_count, n_ranks, int);
+      BFT_MALLOC(send_displ, n_ranks, int);
+      BFT_MALLOC(recv_displ, n_ranks, int);
+
+      long long r_s = v_idx[c_range[0]], r_e = v_idx[c_range[1]];
+
+      for (int i = 0; i < n_ranks; i++) {
+
+        /* Values read here and needed by rank i */
+        long long s = CS_MAX(r_s, all_r_vals[i*4]);
+        long long e = CS_MIN(r_e, all_r_vals[i*4+1]);
+        send_count[i] = (e > s) ? (e - s)*type_size : 0;
+        send_displ[i] = (e > s) ? (s - r_s)*type_size : 0;
+
+        /* Values needed here and read by rank i */
+        long long o_s = v_idx[all_r_vals[i*4+2]];
+        long long o_e = v_idx[all_r_vals[i*4+3]];
+        s = CS_MAX(o_s, v_s);
+        e = CS_MIN(o_e, v_e);
+        recv_count[i] = (e > s) ? (e - s)*type_size : 0;
+        recv_displ[i] = (e > s) ? (s - v_s)*type_size : 0;
+
+      }
+
+      MPI_Alltoallv(r_buf, send_count, send_displ, MPI_BYTE,
+                    buf, recv_count, recv_displ, MPI_BYTE,
+                    inp->comm);
+
+      BFT_FREE(recv_displ);
+      BFT_FREE(send_displ);
+      BFT_FREE(recv_count);
+      BFT_FREE(send_count);
+
+      BFT_FREE(all_r_vals);
+    }
+
+#endif /* defined(HAVE_MPI) */
+
+    BFT_FREE(r_buf);
+  }
+
+  BFT_FREE(z_buf);
+  BFT_FREE(z_idx);
+  BFT_FREE(v_idx);
+  BFT_FREE(chunk_vals);
+}
+
+#endif /* defined(HAVE_ZLIB) */
+
 /*----------------------------------------------------------------------------
  * Read a section body.
  *
@@ -1387,9 +1892,28 @@ _cs_io_read_body(const cs_io_sec_header_t  *header,
       cs_file_seek(inp->f, offset, CS_FILE_SEEK_SET);
     }
 
+    /* Read compressed values */
+
+    if (inp->z_n_chunks > 0) {
+#if defined(HAVE_ZLIB)
+      if (global_num_start > 0 && global_num_end > 0)
+        _read_body_z(inp,
+                     type_size,
+                     (global_num_start-1)*stride + 1,
+                     (global_num_end-1)*stride + 1,
+                     _buf);
+      else
+        _read_body_z(inp, type_size, 0, 0, _buf);
+#endif
+      if (log != NULL) {
+        int t_id = (global_num_start > 0 && global_num_end > 0) ? 1 : 0;
+        log->data_size[t_id] += inp->z_size;
+      }
+    }
+
     /* Read local or global values */
 
-    if (global_num_start > 0 && global_num_end > 0) {
+    else if (global_num_start > 0 && global_num_end > 0) {
       cs_file_read_block(inp->f,
                          _buf,
                          type_size,
@@ -1650,6 +2174,12 @@ _write_header(const char     *sec_name,
   header_vals[5] = name_size + name_pad_size;
   header_vals[0] += (name_size + name_pad_size);
 
+  /* Compressed sections have the number of chunks and compressed
+     body size following the section name */
+
+  if (outp->z_n_chunks > 0)
+    header_vals[0] += 16;
+
   /* Decide if data is to be embedded */
 
   if (   n_vals > 0
@@ -1727,11 +2257,25 @@ _write_header(const char     *sec_name,
 
   if (embed == true)
     outp->type_name[7] = 'e';
+  else if (outp->z_n_chunks > 0)
+    outp->type_name[6] = 'z';
 
   /* Section name */
 
   strcpy((char *)(outp->buffer) + 56, sec_name);
 
+  if (outp->z_n_chunks > 0) {
+
+    cs_file_off_t z_vals[2] = {outp->z_n_chunks, outp->z_size};
+    unsigned char *z_data =   (unsigned char *)(outp->buffer)
+                            + (56 + name_size + name_pad_size);
+
+    _convert_from_offset(z_data, z_vals, 2);
+
+    if (cs_file_get_swap_endian(outp->f) == 1)
+      _swap_endian(z_data, 8, 2);
+  }
+
   if (embed == true) {
 
     unsigned char *data =   (unsigned char *)(outp->buffer)
@@ -1770,6 +2314,204 @@ _write_header(const char     *sec_name,
   return embed;
 }
 
+#if defined(HAVE_ZLIB)
+
+/*----------------------------------------------------------------------------
+ * Write a compressed section, each associated process providing a
+ * contiguous part of the section's values.
+ *
+ * The section body contains a table with the number of values and
+ * compressed size of each chunk, followed by the compressed chunks.
+ *
+ * parameters:
+ *   section_name     <-- section name
+ *   n_g_vals         <-- total number of values
+ *   val_start        <-- global number of first value (1 to n numbering)
+ *   val_end          <-- global number of past-the end value
+ *   location_id      <-- id of associated location, or 0
+ *   index_id         <-- id of associated index, or 0
+ *   n_location_vals  <-- number of values per location
+ *   elt_type         <-- element type
+ *   elts             <-- pointer to local element data
+ *   outp             <-> output kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_section_z(const char     *sec_name,
+                 cs_gnum_t       n_g_vals,
+                 cs_gnum_t       val_start,
+                 cs_gnum_t       val_end,
+                 size_t          location_id,
+                 size_t          index_id,
+                 size_t          n_location_vals,
+                 cs_datatype_t   elt_type,
+                 const void     *elts,
+                 cs_io_t        *outp)
+{
+  double t_start = 0.;
+  cs_io_log_t  *log = NULL;
+
+  size_t n_chunks = 0, z_size = 0;
+  cs_file_off_t *chunk_vals = NULL;
+  unsigned char *z_buf = NULL, *t_buf = NULL;
+
+  cs_file_off_t g_vals[2] = {0, 0}, z_start = 0;
+
+  z_buf = _compress_chunks(elts,
+                           elt_type,
+                           val_end - val_start,
+                           outp,
+                           &n_chunks,
+                           &chunk_vals,
+                           &z_size);
+
+  g_vals[0] = n_chunks;
+  g_vals[1] = z_size;
+
+#if defined(HAVE_MPI)
+
+  int rank_id = 0, n_ranks = 1;
+
+  if (outp->comm != MPI_COMM_NULL) {
+    MPI_Comm_rank(outp->comm, &rank_id);
+    MPI_Comm_size(outp->comm, &n_ranks);
+  }
+
+  if (n_ranks > 1) {
+
+    long long l_vals[2] = {n_chunks, z_size}, s_vals[2], e_vals[2] = {0, 0};
+
+    MPI_Allreduce(l_vals, s_vals, 2, MPI_LONG_LONG, MPI_SUM, outp->comm);
+    MPI_Exscan(l_vals, e_vals, 2, MPI_LONG_LONG, MPI_SUM, outp->comm);
+
+    g_vals[0] = s_vals[0];
+    g_vals[1] = s_vals[1];
+    if (rank_id > 0)
+      z_start = e_vals[1];
+
+    /* Gather chunk table on rank 0 */
+
+    int count = n_chunks*16;
+    int *counts = NULL, *displs = NULL;
+
+    BFT_MALLOC(t_buf, n_chunks*16, unsigned char);
+    _convert_from_offset(t_buf, chunk_vals, n_chunks*2);
+
+    if (rank_id == 0) {
+      BFT_MALLOC(counts, n_ranks, int);
+      BFT_MALLOC(displs, n_ranks, int);
+    }
+
+    MPI_Gather(&count, 1, MPI_INT, counts, 1, MPI_INT, 0, outp->comm);
+
+    unsigned char *g_t_buf = NULL;
+
+    if (rank_id == 0) {
+      displs[0] = 0;
+      for (int i = 1; i < n_ranks; i++)
+        displs[i] = displs[i-1] + counts[i-1];
+      BFT_MALLOC(g_t_buf, g_vals[0]*16, unsigned char);
+    }
+
+    MPI_Gatherv(t_buf, count, MPI_BYTE,
+                g_t_buf, counts, displs, MPI_BYTE, 0, outp->comm);
+
+    BFT_FREE(t_buf);
+    t_buf = g_t_buf;
+
+    BFT_FREE(displs);
+    BFT_FREE(counts);
+  }
+
+  else
+
+#endif /* defined(HAVE_MPI) */
+
+  {
+    BFT_MALLOC(t_buf, n_chunks*16, unsigned char);
+    _convert_from_offset(t_buf, chunk_vals, n_chunks*2);
+  }
+
+  BFT_FREE(chunk_vals);
+
+  /* Write header */
+
+  outp->z_n_chunks = g_vals[0];
+  outp->z_size = g_vals[0]*16 + g_vals[1];
+
+  _write_header(sec_name,
+                n_g_vals,
+                location_id,
+                index_id,
+                n_location_vals,
+                elt_type,
+                NULL,
+                outp);
+
+  outp->z_n_chunks = 0;
+  outp->z_size = 0;
+
+  /* Write chunk table and compressed data */
+
+  if (outp->log_id > -1) {
+    log = _cs_io_log[outp->mode] + outp->log_id;
+    t_start = cs_timer_wtime();
+  }
+
+  _write_padding(outp->body_align, outp);
+
+  cs_file_write_global(outp->f, t_buf, 8, g_vals[0]*2);
+
+  size_t n_written = cs_file_write_block_buffer(outp->f,
+                                                z_buf,
+                                                1,
+                                                1,
+                                                z_start + 1,
+                                                z_start + z_size + 1);
+
+  if (z_size != n_written)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error writing %llu bytes to file \"%s\"."),
+              (unsigned long long)z_size, cs_file_get_name(outp->f));
+
+  BFT_FREE(t_buf);
+  BFT_FREE(z_buf);
+
+  if (log != NULL) {
+    double t_end = cs_timer_wtime();
+    log->wtimes[1] += t_end - t_start;
+    log->data_size[1] += n_written + n_chunks*16;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Check if a section should be compressed.
+ *
+ * parameters:
+ *   n_g_vals  <-- total number of values
+ *   elt_type  <-- element type
+ *   outp      <-- output kernel IO structure
+ *
+ * returns:
+ *   true if section should be compressed, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_z_compress(cs_gnum_t        n_g_vals,
+            cs_datatype_t    elt_type,
+            const cs_io_t   *outp)
+{
+  bool retval = false;
+
+  if (   outp->z_level > 0
+      && n_g_vals*cs_datatype_size[elt_type] >= CS_IO_Z_MIN_SIZE)
+    retval = true;
+
+  return retval;
+}
+
+#endif /* defined(HAVE_ZLIB) */
+
 /*----------------------------------------------------------------------------
  * Dump a kernel IO file handle's metadata.
  *
@@ -2129,6 +2871,79 @@ cs_io_get_echo(const cs_io_t  *cs_io)
   return (size_t)(cs_io->echo);
 }
 
+/*----------------------------------------------------------------------------
+ * Suspend or resume logging of a kernel IO structure's operations.
+ *
+ * As the log is shared by all kernel IO structures, logging should be
+ * suspended while a file is accessed by a thread other than the main thread.
+ *
+ * parameters:
+ *   cs_io   <-> kernel IO structure
+ *   suspend <-- true to suspend logging, false to resume it
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_suspend_log(cs_io_t  *cs_io,
+                  bool      suspend)
+{
+  assert(cs_io != NULL);
+
+  /* Suspended log ids are stored as (-2 - id), so that -1 still
+     indicates no log entry */
+
+  if (suspend) {
+    if (cs_io->log_id > -1)
+      cs_io->log_id = -2 - cs_io->log_id;
+  }
+  else {
+    if (cs_io->log_id < -1)
+      cs_io->log_id = -2 - cs_io->log_id;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Set compression level for sections written to a kernel IO file.
+ *
+ * Sections whose size is large enough are compressed using Zlib
+ * (after byte shuffling), by independent chunks, so that they may still
+ * be read in parallel. If Zlib is not available, this setting is ignored.
+ *
+ * parameters:
+ *   cs_io <-> kernel IO structure
+ *   level <-- compression level: 0 for none, 1 (fastest) to 9 (best)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_set_compression(cs_io_t  *cs_io,
+                      int       level)
+{
+  assert(cs_io != NULL);
+
+  cs_io->z_level = CS_MAX(0, CS_MIN(level, 9));
+}
+
+/*----------------------------------------------------------------------------
+ * Set relative tolerance for lossy compression of floating-point sections.
+ *
+ * When non-zero, values of compressed floating-point sections are rounded
+ * so as to keep only the mantissa bits needed to ensure the given relative
+ * error; this is intended for data not requiring bit-for-bit restart,
+ * such as time moments. It has no effect if compression is not active.
+ *
+ * parameters:
+ *   cs_io     <-> kernel IO structure
+ *   tolerance <-- relative tolerance, or 0 for lossless compression
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_set_lossy_tolerance(cs_io_t  *cs_io,
+                          double    tolerance)
+{
+  assert(cs_io != NULL);
+
+  cs_io->z_tolerance = CS_MAX(0., tolerance);
+}
+
 /*----------------------------------------------------------------------------
  * Read a section header.
  *
@@ -2227,6 +3042,31 @@ cs_io_read_header(cs_io_t             *inp,
   if (header_vals[1] > 0 && inp->type_name[7] == 'e')
     inp->data = inp->buffer + 56 + header_vals[5];
 
+  inp->z_n_chunks = 0;
+  inp->z_size = 0;
+
+  if (header_vals[1] > 0 && inp->type_name[6] == 'z') {
+
+    cs_file_off_t z_vals[2];
+    unsigned char *z_data = inp->buffer + 56 + header_vals[5];
+
+    if (cs_file_get_swap_endian(inp->f) == 1)
+      _swap_endian(z_data, 8, 2);
+
+    _convert_to_offset(z_data, z_vals, 2);
+
+    inp->z_n_chunks = z_vals[0];
+    inp->z_size = z_vals[1];
+
+#if !defined(HAVE_ZLIB)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error reading file: \"%s\".\n"
+                "Section \"%s\" is compressed, but Zlib support\n"
+                "is not available in this build."),
+              cs_file_get_name(inp->f), inp->sec_name);
+#endif
+  }
+
   inp->type_size = 0;
 
   /* Return immediately if we have an end-of file marker */
@@ -2382,6 +3222,8 @@ cs_io_set_indexed_position(cs_io_t             *inp,
   inp->index_id    = header->index_id;
   inp->n_loc_vals  = header->n_location_vals;
   inp->type_size   = cs_datatype_size[header->type_read];
+  inp->z_n_chunks  = inp->index->z_vals[2*id];
+  inp->z_size      = inp->index->z_vals[2*id + 1];
 
   /* The following values are not taken from the header buffer as
      usual, but are base on the index */
@@ -2782,6 +3624,40 @@ cs_io_write_global(const char     *sec_name,
   if (outp->echo >= CS_IO_ECHO_HEADERS)
     _echo_header(sec_name, n_vals, elt_type);
 
+#if defined(HAVE_ZLIB)
+
+  if (_z_compress(n_vals, elt_type, outp)) {
+
+    cs_gnum_t val_start = 1, val_end = n_vals + 1;
+
+#if defined(HAVE_MPI)
+    if (outp->comm != MPI_COMM_NULL) {
+      int rank_id;
+      MPI_Comm_rank(outp->comm, &rank_id);
+      if (rank_id > 0)
+        val_start = n_vals + 1;
+    }
+#endif
+
+    _write_section_z(sec_name,
+                     n_vals,
+                     val_start,
+                     val_end,
+                     location_id,
+                     index_id,
+                     n_location_vals,
+                     elt_type,
+                     elts,
+                     outp);
+
+    if (n_vals != 0 && outp->echo > CS_IO_ECHO_HEADERS)
+      _echo_data(outp->echo, n_vals, 1, n_vals + 1, elt_type, elts);
+
+    return;
+  }
+
+#endif /* defined(HAVE_ZLIB) */
+
   embed = _write_header(sec_name,
                         n_vals,
                         location_id,
@@ -2883,6 +3759,32 @@ cs_io_write_block(const char     *sec_name,
     n_vals *= n_location_vals;
   }
 
+#if defined(HAVE_ZLIB)
+
+  if (_z_compress(n_g_vals, elt_type, outp)) {
+
+    _write_section_z(sec_name,
+                     n_g_vals,
+                     (global_num_start-1)*stride + 1,
+                     (global_num_end-1)*stride + 1,
+                     location_id,
+                     index_id,
+                     n_location_vals,
+                     elt_type,
+                     elts,
+                     outp);
+
+    if (n_vals != 0 && outp->echo > CS_IO_ECHO_HEADERS)
+      _echo_data(outp->echo, n_g_vals,
+                 (global_num_start-1)*stride + 1,
+                 (global_num_end -1)*stride + 1,
+                 elt_type, elts);
+
+    return;
+  }
+
+#endif /* defined(HAVE_ZLIB) */
+
   _write_header(sec_name,
                 n_g_vals,
                 location_id,
@@ -2984,6 +3886,32 @@ cs_io_write_block_buffer(const char     *sec_name,
     n_vals *= n_location_vals;
   }
 
+#if defined(HAVE_ZLIB)
+
+  if (_z_compress(n_g_vals, elt_type, outp)) {
+
+    _write_section_z(sec_name,
+                     n_g_vals,
+                     (global_num_start-1)*stride + 1,
+                     (global_num_end-1)*stride + 1,
+                     location_id,
+                     index_id,
+                     n_location_vals,
+                     elt_type,
+                     elts,
+                     outp);
+
+    if (n_vals != 0 && outp->echo > CS_IO_ECHO_HEADERS)
+      _echo_data(outp->echo, n_g_vals,
+                 (global_num_start-1)*stride + 1,
+                 (global_num_end -1)*stride + 1,
+                 elt_type, elts);
+
+    return;
+  }
+
+#endif /* defined(HAVE_ZLIB) */
+
   _write_header(sec_name,
                 n_g_vals,
                 location_id,
@@ -3064,7 +3992,10 @@ cs_io_skip(const cs_io_sec_header_t  *header,
       cs_file_off_t offset = cs_file_tell(pp_io->f);
       size_t ba = pp_io->body_align;
       offset += (ba - (offset % ba)) % ba;
-      offset += n_vals*type_size;
+      if (pp_io->z_n_chunks > 0)
+        offset += pp_io->z_size;
+      else
+        offset += n_vals*type_size;
       cs_file_seek(pp_io->f, offset, CS_FILE_SEEK_SET);
     }
 
@@ -259,6 +259,54 @@ cs_io_get_indexed_sec_header(const cs_io_t  *inp,
 size_t
 cs_io_get_echo(const cs_io_t  *pp_io);
 
+/*----------------------------------------------------------------------------
+ * Suspend or resume logging of a kernel IO structure's operations.
+ *
+ * As the log is shared by all kernel IO structures, logging should be
+ * suspended while a file is accessed by a thread other than the main thread.
+ *
+ * parameters:
+ *   pp_io   <-> kernel IO structure
+ *   suspend <-- true to suspend logging, false to resume it
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_suspend_log(cs_io_t  *pp_io,
+                  bool      suspend);
+
+/*----------------------------------------------------------------------------
+ * Set compression level for sections written to a kernel IO file.
+ *
+ * Sections whose size is large enough are compressed using Zlib
+ * (after byte shuffling), by independent chunks, so that they may still
+ * be read in parallel. If Zlib is not available, this setting is ignored.
+ *
+ * parameters:
+ *   pp_io <-> kernel IO structure
+ *   level <-- compression level: 0 for none, 1 (fastest) to 9 (best)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_set_compression(cs_io_t  *pp_io,
+                      int       level);
+
+/*----------------------------------------------------------------------------
+ * Set relative tolerance for lossy compression of floating-point sections.
+ *
+ * When non-zero, values of compressed floating-point sections are rounded
+ * so as to keep only the mantissa bits needed to ensure the given relative
+ * error; this is intended for data not requiring bit-for-bit restart,
+ * such as time moments. It has no effect if compression is not active.
+ *
+ * parameters:
+ *   pp_io     <-> kernel IO structure
+ *   tolerance <-- relative tolerance, or 0 for lossless compression
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_set_lossy_tolerance(cs_io_t  *pp_io,
+                          double    tolerance);
+
 /*----------------------------------------------------------------------------
  * Read a message header.
  *
@@ -0,0 +1,607 @@
+/*============================================================================
+ * Load imbalance monitoring, with repartitioning advice or stop
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2016 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_block_dist.h"
+#include "cs_lagr_particle.h"
+#include "cs_log.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_to_builder.h"
+#include "cs_part_to_block.h"
+#include "cs_partition.h"
+#include "cs_restart.h"
+#include "cs_time_step.h"
+#include "cs_timer.h"
+#include "cs_timer_stats.h"
+
+/*----------------------------------------------------------------------------
+ * Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_load_balance.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_load_balance.c
+        Load imbalance monitoring, with repartitioning advice or stop.
+
+  The load of each rank is sampled at a given time step interval, either
+  using the CPU time of a timer statistic over that interval, or based only
+  on estimated cell costs (base cost of 1 per cell, plus model-dependent
+  costs such as those of Lagrangian particles).
+
+  When the imbalance (ratio of maximum to mean load) remains above a given
+  threshold for a given number of successive checks, a new partitioning
+  of the current mesh is computed using the measured per-cell costs as
+  partitioning weights, and is written to the partition_output directory,
+  so that a later restart may use it.
+
+  Monitoring alone never modifies the course of the computation. Only if
+  stopping is also requested (see \ref cs_load_balance_set_stop) is a
+  checkpoint forced at the current time step and the computation stopped,
+  so that it may be restarted using this partitioning.
+
+  Data is not migrated during the computation: since restart files are
+  partition-independent, field values, boundary condition data and
+  particles are redistributed to the new partitioning on restart, and
+  halos are rebuilt at that stage.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Cell cost function and associated input */
+
+typedef struct {
+
+  cs_load_balance_cell_cost_t  *func;    /* Associated function */
+  void                         *input;   /* Associated input */
+
+} cs_load_balance_cost_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Monitoring options */
+
+static int     _nt_interval = 0;
+static int     _n_sustained = 3;
+static double  _threshold = 1.2;
+static double  _particle_cost = 0.;
+static bool    _stop = false;
+
+static char   *_stats_name = NULL;
+
+/* Cell cost estimation functions */
+
+static int                      _n_cost_funcs = 0;
+static cs_load_balance_cost_t  *_cost_funcs = NULL;
+
+/* Monitoring status */
+
+static int                 _nt_last = -1;
+static int                 _n_imbalanced = 0;
+static bool                _repartitioned = false;
+static cs_timer_counter_t  _t_last;
+
+/* Cell weights on mesh builder blocks (used for repartitioning) */
+
+static float  *_b_cell_weight = NULL;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compute estimated cost of local cells.
+ *
+ * parameters:
+ *   mesh      <-- pointer to mesh structure
+ *   cell_cost --> estimated cost of each local cell
+ *----------------------------------------------------------------------------*/
+
+static void
+_cell_cost(const cs_mesh_t  *mesh,
+           cs_real_t         cell_cost[])
+{
+  const cs_lnum_t n_cells = mesh->n_cells;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    cell_cost[i] = 1.;
+
+  /* Lagrangian particles */
+
+  if (_particle_cost > 0) {
+    const cs_lagr_particle_set_t *p_set = cs_lagr_get_particle_set();
+    if (p_set != NULL) {
+      for (cs_lnum_t i = 0; i < p_set->n_particles; i++) {
+        cs_lnum_t cell_num = cs_lagr_particles_get_lnum(p_set,
+                                                        i,
+                                                        CS_LAGR_CELL_NUM);
+        cs_lnum_t cell_id = CS_ABS(cell_num) - 1;
+        if (cell_id > -1 && cell_id < n_cells)
+          cell_cost[cell_id] += _particle_cost;
+      }
+    }
+  }
+
+  /* Other models */
+
+  for (int i = 0; i < _n_cost_funcs; i++)
+    _cost_funcs[i].func(_cost_funcs[i].input, mesh, cell_cost);
+}
+
+/*----------------------------------------------------------------------------
+ * Return CPU time (in seconds) of the associated timer statistic
+ * since the previous call.
+ *
+ * returns:
+ *   CPU time of timer statistic, or -1 if not available
+ *----------------------------------------------------------------------------*/
+
+static double
+_stats_cpu_time(void)
+{
+  double retval = -1.;
+
+  if (_stats_name == NULL)
+    return retval;
+
+  int stats_id = cs_timer_stats_id_by_name(_stats_name);
+
+  /* Fall back to estimated cell costs if the statistic is not defined */
+
+  if (stats_id < 0) {
+    cs_base_warn(__FILE__, __LINE__);
+    bft_printf(_("Load balancing: timer statistic \"%s\" is not defined;\n"
+                 "load imbalance is based only on estimated cell costs.\n"),
+               _stats_name);
+    BFT_FREE(_stats_name);
+    return retval;
+  }
+
+  cs_timer_counter_t t_cur = cs_timer_stats_get_counter(stats_id);
+  if (_nt_last > -1)
+    retval = (t_cur.cpu_nsec - _t_last.cpu_nsec) * 1e-9;
+  _t_last = t_cur;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Cell weights function for repartitioning, copying weights
+ * previously distributed to mesh builder blocks.
+ *
+ * parameters:
+ *   input       <-> pointer to optional (untyped) value or structure
+ *   mesh        <-- pointer to mesh structure
+ *   cell_range  <-- global number range of cells in local block
+ *   cell_family <-- family id of each local block cell
+ *   cell_center <-- center of each local block cell
+ *   n_weights   <-- number of weights per cell
+ *   cell_weight --> weights of each local block cell
+ *----------------------------------------------------------------------------*/
+
+static void
+_block_cell_weights(void              *input,
+                    const cs_mesh_t   *mesh,
+                    const cs_gnum_t    cell_range[2],
+                    const int          cell_family[],
+                    const cs_coord_t   cell_center[],
+                    int                n_weights,
+                    float              cell_weight[])
+{
+  CS_UNUSED(input);
+  CS_UNUSED(mesh);
+  CS_UNUSED(cell_family);
+  CS_UNUSED(cell_center);
+
+  if (n_weights != 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: %d weights per cell requested, but only 1 is defined."),
+              __func__, n_weights);
+
+  cs_lnum_t n_cells = 0;
+
+  if (cell_range[1] > cell_range[0])
+    n_cells = cell_range[1] - cell_range[0];
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    cell_weight[i] = _b_cell_weight[i];
+}
+
+/*----------------------------------------------------------------------------
+ * Compute and write a new partitioning based on given cell weights.
+ *
+ * The current mesh and partitioning are not modified; the new partitioning
+ * is only used when restarting with it as input.
+ *
+ * parameters:
+ *   mesh        <-- pointer to mesh structure
+ *   cell_weight <-- weight of each local cell
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_partitioning(cs_mesh_t    *mesh,
+                    const float   cell_weight[])
+{
+  cs_mesh_builder_t *mb = cs_mesh_builder_create();
+
+  /* Rebuild mesh builder data from current mesh (keeping mesh) */
+
+  cs_mesh_to_builder(mesh, mb, false, NULL);
+
+  /* Distribute weights to builder blocks */
+
+  cs_lnum_t n_b_cells = 0;
+  if (mb->cell_bi.gnum_range[1] > mb->cell_bi.gnum_range[0])
+    n_b_cells = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+
+  BFT_MALLOC(_b_cell_weight, n_b_cells, float);
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_part_to_block_t *d
+      = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                        mb->cell_bi,
+                                        mesh->n_cells,
+                                        mesh->global_cell_num);
+
+    cs_part_to_block_copy_array(d, CS_FLOAT, 1, cell_weight, _b_cell_weight);
+
+    cs_part_to_block_destroy(&d);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (cs_glob_n_ranks == 1) {
+    for (cs_lnum_t i = 0; i < n_b_cells; i++)
+      _b_cell_weight[i] = cell_weight[i];
+  }
+
+  /* Compute and write new partitioning (always writing output, and
+     ignoring any existing partitioning input), then restore settings;
+     preprocessing hints only apply to the initial partitioning, which
+     has already been done, so the active status is saved as such */
+
+  int write_level = cs_partition_get_write_level();
+  bool preprocess = cs_partition_get_preprocess();
+
+  cs_partition_set_cell_weights(1, _block_cell_weights, NULL);
+  cs_partition_set_write_level(2);
+  cs_partition_set_preprocess(true);
+
+  cs_partition(mesh, mb, CS_PARTITION_MAIN);
+
+  cs_partition_set_cell_weights(0, NULL, NULL);
+  cs_partition_set_write_level(write_level);
+  cs_partition_set_preprocess(preprocess);
+
+  BFT_FREE(_b_cell_weight);
+
+  cs_mesh_builder_destroy(&mb);
+
+  bft_printf
+    (_("\n"
+       "Load balancing:\n\n"
+       "  A new partitioning has been written to \"partition_output\".\n"
+       "  To use it, restart with this directory as \"partition_input\"\n"
+       "  (and \"mesh_output\" as mesh input if the mesh was modified"
+       " by preprocessing).\n"));
+}
+
+/*----------------------------------------------------------------------------
+ * Stop the computation with a checkpoint at the current time step, so
+ * as to restart using a new partitioning.
+ *----------------------------------------------------------------------------*/
+
+static void
+_stop_for_repartitioning(void)
+{
+  const cs_time_step_t  *ts = cs_glob_time_step;
+
+  cs_time_step_define_nt_max(ts->nt_cur);
+  cs_restart_checkpoint_set_next_ts(ts->nt_cur);
+
+  bft_printf
+    (_("  The computation will stop with a checkpoint at time step %d.\n"),
+     ts->nt_cur);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define load balance monitoring options.
+ *
+ * \param[in]  nt_interval  interval (in time steps) between imbalance
+ *                          checks, or 0 to deactivate monitoring
+ * \param[in]  n_sustained  number of successive checks with imbalance
+ *                          above threshold triggering a
+ *                          repartitioning
+ * \param[in]  threshold    imbalance (max/mean ratio) threshold
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_set_options(int     nt_interval,
+                            int     n_sustained,
+                            double  threshold)
+{
+  _nt_interval = CS_MAX(nt_interval, 0);
+  _n_sustained = CS_MAX(n_sustained, 1);
+  _threshold = threshold;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether the computation should stop for repartitioning
+ *        when sustained imbalance is detected.
+ *
+ * By default, a new partitioning is only written, and the computation
+ * continues.
+ *
+ * \param[in]  stop  true to stop with a checkpoint, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_set_stop(bool  stop)
+{
+  _stop = stop;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the timer statistic used to measure load imbalance.
+ *
+ * If no statistic is defined, load imbalance is based only on the
+ * estimated cell costs.
+ *
+ * \param[in]  name  name of associated timer statistic, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_set_timer_stats(const char  *name)
+{
+  BFT_FREE(_stats_name);
+
+  if (name != NULL) {
+    BFT_MALLOC(_stats_name, strlen(name) + 1, char);
+    strcpy(_stats_name, name);
+  }
+
+  _nt_last = -1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the estimated cost of a Lagrangian particle relative to
+ *        that of a cell.
+ *
+ * \param[in]  particle_cost  cost of a particle (0 to ignore particles)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_set_particle_cost(double  particle_cost)
+{
+  _particle_cost = particle_cost;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a model-dependent cell cost estimation function.
+ *
+ * \param[in]  func   pointer to cell cost estimation function
+ * \param[in]  input  pointer to optional (untyped) value or structure
+ *                    for func
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_add_cell_cost(cs_load_balance_cell_cost_t  *func,
+                              void                         *input)
+{
+  BFT_REALLOC(_cost_funcs, _n_cost_funcs + 1, cs_load_balance_cost_t);
+
+  _cost_funcs[_n_cost_funcs].func = func;
+  _cost_funcs[_n_cost_funcs].input = input;
+
+  _n_cost_funcs += 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free load balance monitoring structures.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_finalize(void)
+{
+  BFT_FREE(_stats_name);
+  BFT_FREE(_cost_funcs);
+  _n_cost_funcs = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check load imbalance, and advise or stop for repartitioning
+ *        if required.
+ *
+ * When imbalance is sustained, a new partitioning is written to
+ * "partition_output"; data is migrated to the new partitioning when
+ * restarting with it as "partition_input". If requested using
+ * \ref cs_load_balance_set_stop, the computation also stops with a
+ * checkpoint at the current time step.
+ *
+ * This function should be called once per time step.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_check(void)
+{
+  const cs_time_step_t  *ts = cs_glob_time_step;
+
+  if (_nt_interval < 1 || cs_glob_n_ranks < 2 || _repartitioned)
+    return;
+
+  if ((ts->nt_cur - ts->nt_prev) % _nt_interval != 0)
+    return;
+
+#if defined(HAVE_MPI)
+
+  cs_mesh_t *mesh = cs_glob_mesh;
+  const cs_lnum_t n_cells = mesh->n_cells;
+
+  /* Estimated and measured loads */
+
+  cs_real_t *cell_cost;
+  BFT_MALLOC(cell_cost, n_cells, cs_real_t);
+
+  _cell_cost(mesh, cell_cost);
+
+  double rank_cost = 0.;
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    rank_cost += cell_cost[i];
+
+  double measure = _stats_cpu_time();
+  bool use_timer = (_stats_name != NULL) ? true : false;
+
+  _nt_last = ts->nt_cur;
+
+  /* The first check with a timer statistic only initializes the reference */
+
+  if (use_timer && measure < 0) {
+    BFT_FREE(cell_cost);
+    return;
+  }
+
+  if (!use_timer)
+    measure = rank_cost;
+
+  double l_max = measure, l_sum = measure;
+  MPI_Allreduce(MPI_IN_PLACE, &l_max, 1, MPI_DOUBLE, MPI_MAX,
+                cs_glob_mpi_comm);
+  MPI_Allreduce(MPI_IN_PLACE, &l_sum, 1, MPI_DOUBLE, MPI_SUM,
+                cs_glob_mpi_comm);
+
+  double l_mean = l_sum / cs_glob_n_ranks;
+  double imbalance = (l_mean > 0) ? l_max / l_mean : 1.;
+
+  if (imbalance >= _threshold) {
+    _n_imbalanced += 1;
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("\n"
+                    "  Load imbalance at time step %d: %5.3f"
+                    " (%d/%d successive checks above %5.3f)\n"),
+                  ts->nt_cur, imbalance, _n_imbalanced, _n_sustained,
+                  _threshold);
+  }
+  else
+    _n_imbalanced = 0;
+
+  /* Write new partitioning (and stop if requested) if imbalance
+     is sustained */
+
+  if (_n_imbalanced >= _n_sustained) {
+
+    /* Cell weights scale estimated costs to the measured rank load */
+
+    double scale = 1.;
+    if (use_timer && rank_cost > 0)
+      scale = measure / rank_cost;
+
+    float *cell_weight;
+    BFT_MALLOC(cell_weight, n_cells, float);
+
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      cell_weight[i] = cell_cost[i] * scale;
+
+    _write_partitioning(mesh, cell_weight);
+
+    BFT_FREE(cell_weight);
+
+    if (_stop)
+      _stop_for_repartitioning();
+
+    bft_printf("\n");
+    bft_printf_flush();
+
+    _repartitioned = true;
+    _n_imbalanced = 0;
+
+  }
+
+  BFT_FREE(cell_cost);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,173 @@
+#ifndef __CS_LOAD_BALANCE_H__
+#define __CS_LOAD_BALANCE_H__
+
+/*============================================================================
+ * Load imbalance monitoring, with repartitioning advice or stop
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2016 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+#include "cs_mesh.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public types
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Function pointer for estimation of model-dependent cell costs.
+ *
+ * Costs are defined relative to that of a cell with no additional model,
+ * whose base cost is 1. The function should add the model's cost to each
+ * cell, so that multiple models may be combined.
+ *
+ * \param[in, out]  input      pointer to optional (untyped) value or
+ *                             structure
+ * \param[in]       mesh       pointer to mesh structure
+ * \param[in, out]  cell_cost  estimated cost of each local cell
+ */
+/*----------------------------------------------------------------------------*/
+
+typedef void
+(cs_load_balance_cell_cost_t) (void             *input,
+                               const cs_mesh_t  *mesh,
+                               cs_real_t         cell_cost[]);
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define load balance monitoring options.
+ *
+ * \param[in]  nt_interval  interval (in time steps) between imbalance
+ *                          checks, or 0 to deactivate monitoring
+ * \param[in]  n_sustained  number of successive checks with imbalance
+ *                          above threshold triggering a
+ *                          repartitioning
+ * \param[in]  threshold    imbalance (max/mean ratio) threshold
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_set_options(int     nt_interval,
+                            int     n_sustained,
+                            double  threshold);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether the computation should stop for repartitioning
+ *        when sustained imbalance is detected.
+ *
+ * By default, a new partitioning is only written, and the computation
+ * continues.
+ *
+ * \param[in]  stop  true to stop with a checkpoint, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_set_stop(bool  stop);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the timer statistic used to measure load imbalance.
+ *
+ * If no statistic is defined, load imbalance is based only on the
+ * estimated cell costs.
+ *
+ * \param[in]  name  name of associated timer statistic, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_set_timer_stats(const char  *name);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the estimated cost of a Lagrangian particle relative to
+ *        that of a cell.
+ *
+ * \param[in]  particle_cost  cost of a particle (0 to ignore particles)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_set_particle_cost(double  particle_cost);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a model-dependent cell cost estimation function.
+ *
+ * \param[in]  func   pointer to cell cost estimation function
+ * \param[in]  input  pointer to optional (untyped) value or structure
+ *                    for func
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_add_cell_cost(cs_load_balance_cell_cost_t  *func,
+                              void                         *input);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free load balance monitoring structures.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check load imbalance, and advise or stop for repartitioning
+ *        if required.
+ *
+ * When imbalance is sustained, a new partitioning is written to
+ * "partition_output"; data is migrated to the new partitioning when
+ * restarting with it as "partition_input". If requested using
+ * \ref cs_load_balance_set_stop, the computation also stops with a
+ * checkpoint at the current time step.
+ *
+ * This function should be called once per time step.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_check(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_LOAD_BALANCE_H__ */
@@ -474,6 +474,12 @@ cs_parameters_define_field_keys(void)
 
   cs_field_define_key_int("limiter_choice", -1, CS_FIELD_VARIABLE);
 
+  /* Use a matrix-free operator for scalar convection-diffusion systems
+     (extradiagonal terms computed from face values, not stored); this
+     requires a compatible linear solver (no multigrid or Gauss-Seidel) */
+
+  cs_field_define_key_int("matrix_free", 0, CS_FIELD_VARIABLE);
+
   /* Structure containing the calculation options of the field variables */
   cs_field_define_key_struct("var_cal_opt",
                              &_var_cal_opt,
@@ -133,6 +133,10 @@ BEGIN_C_DECLS
        Order cells using domain-local Morton space-filling curve.
   \var CS_RENUMBER_CELLS_HILBERT
        Order cells using domain-local Hilbert space-filling curve.
+  \var CS_RENUMBER_CELLS_RCM
+       Order cells using domain-local Reverse Cuthill-McKee algorithm.
+  \var CS_RENUMBER_CELLS_ND
+       Order cells using domain-local nested dissection algorithm.
   \var CS_RENUMBER_CELLS_NONE
        No cells renumbering.
 
@@ -188,6 +192,14 @@ BEGIN_C_DECLS
 
 #define CS_RENUMBER_N_SUBS  5  /* Number of categories for histograms */
 
+#define CS_RENUMBER_ND_MIN_SIZE  256   /* Minimum subgraph size for nested
+                                          dissection (RCM used below) */
+
+#define CS_RENUMBER_CACHE_LINE_SIZE  64  /* Cache line size (in bytes) for
+                                            cache miss estimation */
+#define CS_RENUMBER_CACHE_N_LINES   512  /* Number of cache lines for
+                                            cache miss estimation */
+
 /*=============================================================================
  * Local Type Definitions
  *============================================================================*/
@@ -249,6 +261,8 @@ static const char *_cell_renum_name[]
      N_("fill-reducing ordering with METIS"),
      N_("Morton curve in local bounding box"),
      N_("Hilbert curve in local bounding box"),
+     N_("Reverse Cuthill-McKee"),
+     N_("nested dissection"),
      N_("none")};
 
 static const char *_i_face_renum_name[]
@@ -3091,6 +3105,34 @@ _renum_b_faces_for_vectorizing(cs_mesh_t  *mesh,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Simulate access to a given cache line for cache miss estimation.
+ *
+ * An access is considered to be a miss if the same line was not accessed
+ * in the last CS_RENUMBER_CACHE_N_LINES accesses.
+ *
+ * parameters:
+ *   l_id        <-- id of accessed line
+ *   last_access <-> access count at last access to each line (0 if none)
+ *   n_access    <-> number of accesses
+ *   n_miss      <-> number of misses
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_cache_access(cs_lnum_t   l_id,
+              cs_gnum_t   last_access[],
+              cs_gnum_t  *n_access,
+              cs_gnum_t  *n_miss)
+{
+  *n_access += 1;
+
+  if (   last_access[l_id] == 0
+      || *n_access - last_access[l_id] > CS_RENUMBER_CACHE_N_LINES)
+    *n_miss += 1;
+
+  last_access[l_id] = *n_access;
+}
+
 /*----------------------------------------------------------------------------
  * Log statistics for bandwidth and profile.
  *
@@ -3102,6 +3144,11 @@ _renum_b_faces_for_vectorizing(cs_mesh_t  *mesh,
  * is symmetric, this simplifies to the sum of the maximum distances between
  * a vertex and any of its neighbors).
  *
+ * As a cache miss proxy, accesses to a cs_real_t array in a matrix-vector
+ * product's row order are also simulated, with a given number of cache
+ * lines, and an access considered to be a miss if the same cache line was
+ * not accessed in that many previous accesses.
+ *
  * parameters:
  *   mesh      <-- associated mesh
  *   title     <-- title or name of mesh or matrix
@@ -3117,6 +3164,8 @@ _log_bandwidth_info(const cs_mesh_t  *mesh,
   cs_gnum_t profile = 0;
   cs_lnum_t *max_distance = NULL;
 
+  double miss_ratio = 0.;
+
   const cs_lnum_2_t *restrict i_face_cells
     = (const cs_lnum_2_t *restrict)mesh->i_face_cells;
 
@@ -3149,6 +3198,50 @@ _log_bandwidth_info(const cs_mesh_t  *mesh,
 
   BFT_FREE(max_distance);
 
+  /* Cache miss estimation */
+
+  if (mesh->n_cells > 0) {
+
+    const cs_lnum_t line_size
+      = CS_RENUMBER_CACHE_LINE_SIZE / sizeof(cs_real_t);
+    const cs_lnum_t n_lines = mesh->n_cells_with_ghosts/line_size + 1;
+
+    cs_gnum_t n_access = 0, n_miss = 0;
+    cs_gnum_t *last_access;
+    cs_lnum_t *face_cell;
+
+    BFT_MALLOC(face_cell, mesh->n_i_faces*2, cs_lnum_t);
+    for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
+      face_cell[face_id*2] = i_face_cells[face_id][0] + 1;
+      face_cell[face_id*2 + 1] = i_face_cells[face_id][1] + 1;
+    }
+
+    _csr_graph_t *g = _csr_graph_create(mesh->n_cells_with_ghosts,
+                                        mesh->n_i_faces,
+                                        face_cell);
+
+    BFT_FREE(face_cell);
+
+    BFT_MALLOC(last_access, n_lines, cs_gnum_t);
+    for (cs_lnum_t i = 0; i < n_lines; i++)
+      last_access[i] = 0;
+
+    for (cell_id = 0; cell_id < mesh->n_cells; cell_id++) {
+      _cache_access(cell_id / line_size, last_access, &n_access, &n_miss);
+      for (cs_lnum_t k = g->row_index[cell_id];
+           k < g->row_index[cell_id+1];
+           k++)
+        _cache_access(g->col_id[k] / line_size,
+                      last_access, &n_access, &n_miss);
+    }
+
+    miss_ratio = 100. * (double)n_miss / (double)n_access;
+
+    BFT_FREE(last_access);
+    _csr_graph_destroy(&g);
+
+  }
+
 #if defined(HAVE_MPI)
 
   if (cs_glob_n_ranks > 1) {
@@ -3174,6 +3267,19 @@ _log_bandwidth_info(const cs_mesh_t  *mesh,
 
     BFT_FREE(rank_buffer);
 
+    double *rank_ratio = NULL;
+    BFT_MALLOC(rank_ratio, cs_glob_n_ranks, double);
+
+    MPI_Allgather(&miss_ratio, 1, MPI_DOUBLE,
+                  rank_ratio, 1, MPI_DOUBLE, cs_glob_mpi_comm);
+
+    bft_printf
+      (_("\n Histogram of %s cache line misses per access (%%) per rank:\n\n"),
+       title);
+    _display_histograms_double(cs_glob_n_ranks, rank_ratio);
+
+    BFT_FREE(rank_ratio);
+
   } /* End if cs_glob_n_ranks > 1 */
 
 #endif
@@ -3181,9 +3287,11 @@ _log_bandwidth_info(const cs_mesh_t  *mesh,
   if (cs_glob_n_ranks == 1) {
     bft_printf
       (_("\n Matrix bandwidth for %s :          %llu\n"
-         " Matrix profile/lines for %s :      %llu\n"),
+         " Matrix profile/lines for %s :      %llu\n"
+         " Cache line misses per access for %s : %5.2f %%\n"),
        title, (unsigned long long)bandwidth,
-       title, (unsigned long long)profile);
+       title, (unsigned long long)profile,
+       title, miss_ratio);
   }
 }
 
@@ -3660,6 +3768,433 @@ _renum_cells_hilbert(const cs_mesh_t  *mesh,
   BFT_FREE(cell_center);
 }
 
+/*----------------------------------------------------------------------------
+ * Breadth-first traversal of a CSR graph, restricted to vertices with
+ * a given tag.
+ *
+ * Level values of vertices to traverse must be initialized to -1;
+ * the caller is responsible for resetting level values of traversed
+ * vertices (i.e. those in queue) after use.
+ *
+ * parameters:
+ *   g              <-- pointer to CSR graph structure
+ *   tag            <-- vertex tags
+ *   t              <-- tag of vertices to traverse
+ *   root           <-- id of root vertex
+ *   sort_by_degree <-- if true, neighbors of each vertex are queued
+ *                      by increasing degree (Cuthill-McKee ordering)
+ *   level          <-> level of each vertex in traversal
+ *   queue          --> traversed vertex ids, in traversal order
+ *   n_levels       --> number of levels of traversal
+ *
+ * returns:
+ *   number of traversed vertices
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_graph_bfs(const _csr_graph_t  *g,
+           const int            tag[],
+           int                  t,
+           cs_lnum_t            root,
+           bool                 sort_by_degree,
+           cs_lnum_t            level[],
+           cs_lnum_t            queue[],
+           cs_lnum_t           *n_levels)
+{
+  const cs_lnum_t *restrict row_index = g->row_index;
+  const cs_lnum_t *restrict col_id = g->col_id;
+
+  cs_lnum_t head = 0, tail = 0;
+
+  queue[tail++] = root;
+  level[root] = 0;
+
+  while (head < tail) {
+
+    cs_lnum_t ii = queue[head++];
+    cs_lnum_t s_id = tail;
+
+    for (cs_lnum_t k = row_index[ii]; k < row_index[ii+1]; k++) {
+      cs_lnum_t jj = col_id[k];
+      if (tag[jj] == t && level[jj] < 0) {
+        level[jj] = level[ii] + 1;
+        queue[tail++] = jj;
+      }
+    }
+
+    /* Insertion sort of added neighbors by increasing degree */
+
+    if (sort_by_degree) {
+      for (cs_lnum_t k = s_id + 1; k < tail; k++) {
+        cs_lnum_t jj = queue[k];
+        cs_lnum_t d = row_index[jj+1] - row_index[jj];
+        cs_lnum_t l = k;
+        while (l > s_id) {
+          cs_lnum_t kk = queue[l-1];
+          if (row_index[kk+1] - row_index[kk] <= d)
+            break;
+          queue[l] = kk;
+          l--;
+        }
+        queue[l] = jj;
+      }
+    }
+
+  }
+
+  *n_levels = level[queue[tail-1]] + 1;
+
+  return tail;
+}
+
+/*----------------------------------------------------------------------------
+ * Find a pseudo-peripheral vertex of the connected component of a CSR
+ * graph containing a given vertex, restricted to vertices with a given tag.
+ *
+ * This uses a simplified form of the George-Liu algorithm, starting
+ * successive traversals from a lowest degree vertex of the last level
+ * as long as the number of levels increases.
+ *
+ * parameters:
+ *   g      <-- pointer to CSR graph structure
+ *   tag    <-- vertex tags
+ *   t      <-- tag of vertices to traverse
+ *   root   <-- id of initial vertex
+ *   level  <-> level work array (-1 for vertices to traverse)
+ *   queue  --- queue work array
+ *
+ * returns:
+ *   id of pseudo-peripheral vertex
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_graph_pseudo_peripheral(const _csr_graph_t  *g,
+                         const int            tag[],
+                         int                  t,
+                         cs_lnum_t            root,
+                         cs_lnum_t            level[],
+                         cs_lnum_t            queue[])
+{
+  const cs_lnum_t *restrict row_index = g->row_index;
+
+  cs_lnum_t n_levels = 0;
+  cs_lnum_t n_visited = _graph_bfs(g, tag, t, root, false,
+                                   level, queue, &n_levels);
+
+  for (int iter = 0; iter < 10; iter++) {
+
+    /* Select lowest degree vertex in last level */
+
+    cs_lnum_t v_min = root;
+    cs_lnum_t d_min = g->n_cols_max + 1;
+
+    for (cs_lnum_t i = n_visited - 1; i > -1; i--) {
+      cs_lnum_t ii = queue[i];
+      if (level[ii] < n_levels - 1)
+        break;
+      cs_lnum_t d = row_index[ii+1] - row_index[ii];
+      if (d < d_min) {
+        v_min = ii;
+        d_min = d;
+      }
+    }
+
+    for (cs_lnum_t i = 0; i < n_visited; i++)
+      level[queue[i]] = -1;
+
+    if (v_min == root)
+      return root;
+
+    cs_lnum_t n_levels_new = 0;
+    n_visited = _graph_bfs(g, tag, t, v_min, false,
+                           level, queue, &n_levels_new);
+
+    root = v_min;
+    if (n_levels_new <= n_levels)
+      break;
+    n_levels = n_levels_new;
+
+  }
+
+  for (cs_lnum_t i = 0; i < n_visited; i++)
+    level[queue[i]] = -1;
+
+  return root;
+}
+
+/*----------------------------------------------------------------------------
+ * Order a subset of CSR graph vertices using the Reverse Cuthill-McKee
+ * algorithm.
+ *
+ * All vertices in the subset must have the same tag, and their level
+ * must be initialized to -1; once ordered, their tag is set to -1.
+ *
+ * parameters:
+ *   g      <-- pointer to CSR graph structure
+ *   tag    <-> vertex tags
+ *   n_sub  <-- number of vertices in subset
+ *   sub    <-> vertex ids of subset, reordered on output
+ *   level  <-> level work array
+ *   queue  --- queue work array
+ *----------------------------------------------------------------------------*/
+
+static void
+_graph_rcm_order(const _csr_graph_t  *g,
+                 int                  tag[],
+                 cs_lnum_t            n_sub,
+                 cs_lnum_t            sub[],
+                 cs_lnum_t            level[],
+                 cs_lnum_t            queue[])
+{
+  const int t = tag[sub[0]];
+
+  cs_lnum_t n_ordered = 0;
+
+  /* Loop on connected components */
+
+  for (cs_lnum_t i = 0; i < n_sub; i++) {
+
+    if (tag[sub[i]] != t)
+      continue;
+
+    cs_lnum_t n_levels = 0;
+    cs_lnum_t *c_queue = queue + n_ordered;
+
+    cs_lnum_t root = _graph_pseudo_peripheral(g, tag, t, sub[i],
+                                              level, c_queue);
+
+    cs_lnum_t n_c = _graph_bfs(g, tag, t, root, true,
+                               level, c_queue, &n_levels);
+
+    for (cs_lnum_t j = 0; j < n_c; j++) {
+      tag[c_queue[j]] = -1;
+      level[c_queue[j]] = -1;
+    }
+
+    n_ordered += n_c;
+
+  }
+
+  assert(n_ordered == n_sub);
+
+  for (cs_lnum_t i = 0; i < n_sub; i++)
+    sub[i] = queue[n_sub - 1 - i];
+}
+
+/*----------------------------------------------------------------------------
+ * Order a subset of CSR graph vertices using a simple nested dissection
+ * algorithm.
+ *
+ * Separators are based on the median level of a breadth-first traversal
+ * from a pseudo-peripheral vertex, keeping only those vertices of that
+ * level adjacent to the next level. Vertices of both separated parts
+ * are numbered first (recursively), followed by those of the separator.
+ * Subsets below a given size are ordered using the Reverse Cuthill-McKee
+ * algorithm.
+ *
+ * All vertices in the subset must have the same tag, and their level
+ * must be initialized to -1; once ordered, their tag is set to -1.
+ *
+ * parameters:
+ *   g      <-- pointer to CSR graph structure
+ *   tag    <-> vertex tags
+ *   n_tags <-> number of tags used
+ *   n_sub  <-- number of vertices in subset
+ *   sub    <-> vertex ids of subset, reordered on output
+ *   level  <-> level work array
+ *   queue  --- queue work array
+ *----------------------------------------------------------------------------*/
+
+static void
+_graph_nd_order(const _csr_graph_t  *g,
+                int                  tag[],
+                int                 *n_tags,
+                cs_lnum_t            n_sub,
+                cs_lnum_t            sub[],
+                cs_lnum_t            level[],
+                cs_lnum_t            queue[])
+{
+  const cs_lnum_t *restrict row_index = g->row_index;
+  const cs_lnum_t *restrict col_id = g->col_id;
+
+  /* Disconnected subsets are handled one component at a time */
+
+  while (n_sub > CS_RENUMBER_ND_MIN_SIZE) {
+
+    const int t = tag[sub[0]];
+    const int t_a = *n_tags, t_b = *n_tags + 1;
+
+    cs_lnum_t n_levels = 0;
+    cs_lnum_t n_a = 0, n_b = 0, n_s = 0;
+
+    cs_lnum_t root = _graph_pseudo_peripheral(g, tag, t, sub[0],
+                                              level, queue);
+
+    cs_lnum_t n_visited = _graph_bfs(g, tag, t, root, false,
+                                     level, queue, &n_levels);
+
+    *n_tags += 2;
+
+    if (n_visited < n_sub) {
+
+      /* Place reached component first, remaining vertices after */
+
+      for (cs_lnum_t i = 0; i < n_visited; i++) {
+        tag[queue[i]] = t_a;
+        level[queue[i]] = -1;
+      }
+      for (cs_lnum_t i = 0; i < n_sub; i++) {
+        if (tag[sub[i]] == t) {
+          tag[sub[i]] = t_b;
+          sub[n_b++] = sub[i];
+        }
+      }
+      n_a = n_visited;
+      memmove(sub + n_a, sub, n_b*sizeof(cs_lnum_t));
+      memcpy(sub, queue, n_a*sizeof(cs_lnum_t));
+
+      _graph_nd_order(g, tag, n_tags, n_a, sub, level, queue);
+
+      sub += n_a;
+      n_sub = n_b;
+      continue;
+
+    }
+
+    if (n_levels < 3) {
+      for (cs_lnum_t i = 0; i < n_visited; i++)
+        level[queue[i]] = -1;
+      break;
+    }
+
+    /* Separator level: level of the median traversed vertex */
+
+    cs_lnum_t l_s = level[queue[n_visited/2]];
+    l_s = CS_MAX(l_s, 1);
+    l_s = CS_MIN(l_s, n_levels - 2);
+
+    for (cs_lnum_t i = 0; i < n_visited; i++) {
+      cs_lnum_t ii = queue[i];
+      if (level[ii] < l_s)
+        tag[ii] = t_a;
+      else if (level[ii] > l_s)
+        tag[ii] = t_b;
+      else {
+        tag[ii] = t_a;
+        for (cs_lnum_t k = row_index[ii]; k < row_index[ii+1]; k++) {
+          cs_lnum_t jj = col_id[k];
+          if (level[jj] == l_s + 1) {
+            tag[ii] = -1;
+            break;
+          }
+        }
+      }
+    }
+
+    for (cs_lnum_t i = 0; i < n_visited; i++)
+      level[queue[i]] = -1;
+
+    /* Number parts first, separator last */
+
+    for (cs_lnum_t i = 0; i < n_visited; i++) {
+      if (tag[queue[i]] == t_a)
+        sub[n_a++] = queue[i];
+    }
+    for (cs_lnum_t i = 0; i < n_visited; i++) {
+      if (tag[queue[i]] == t_b)
+        sub[n_a + n_b++] = queue[i];
+    }
+    for (cs_lnum_t i = 0; i < n_visited; i++) {
+      if (tag[queue[i]] == -1)
+        sub[n_a + n_b + n_s++] = queue[i];
+    }
+
+    assert(n_a + n_b + n_s == n_sub);
+
+    _graph_nd_order(g, tag, n_tags, n_a, sub, level, queue);
+    _graph_nd_order(g, tag, n_tags, n_b, sub + n_a, level, queue);
+
+    return;
+  }
+
+  if (n_sub > 0)
+    _graph_rcm_order(g, tag, n_sub, sub, level, queue);
+}
+
+/*----------------------------------------------------------------------------
+ * Renumber cells based on the local cell adjacency graph, using either
+ * the Reverse Cuthill-McKee or a simple nested dissection algorithm.
+ *
+ * parameters:
+ *   mesh        <-- pointer to mesh structure
+ *   algorithm   <-- CS_RENUMBER_CELLS_RCM or CS_RENUMBER_CELLS_ND
+ *   new_to_old  --> new to old cell renumbering
+ *----------------------------------------------------------------------------*/
+
+static void
+_renum_cells_graph(const cs_mesh_t           *mesh,
+                   cs_renumber_cells_type_t   algorithm,
+                   cs_lnum_t                  new_to_old[])
+{
+  cs_lnum_t n_cells = mesh->n_cells;
+
+  if (mesh->cell_numbering->n_no_adj_halo_elts > 0)
+    n_cells = mesh->cell_numbering->n_no_adj_halo_elts;
+
+  for (cs_lnum_t i = 0; i < mesh->n_cells; i++)
+    new_to_old[i] = i;
+
+  if (n_cells < 1)
+    return;
+
+  /* Build local graph (ignoring ghost cells) */
+
+  cs_lnum_t n_faces = 0;
+  cs_lnum_t *face_cell;
+
+  BFT_MALLOC(face_cell, mesh->n_i_faces*2, cs_lnum_t);
+
+  for (cs_lnum_t f_id = 0; f_id < mesh->n_i_faces; f_id++) {
+    cs_lnum_t c_id_0 = mesh->i_face_cells[f_id][0];
+    cs_lnum_t c_id_1 = mesh->i_face_cells[f_id][1];
+    if (c_id_0 < n_cells && c_id_1 < n_cells) {
+      face_cell[n_faces*2] = c_id_0 + 1;
+      face_cell[n_faces*2 + 1] = c_id_1 + 1;
+      n_faces++;
+    }
+  }
+
+  _csr_graph_t *g = _csr_graph_create(n_cells, n_faces, face_cell);
+
+  BFT_FREE(face_cell);
+
+  /* Order graph */
+
+  int n_tags = 1;
+  int *tag;
+  cs_lnum_t *level, *queue;
+
+  BFT_MALLOC(tag, n_cells, int);
+  BFT_MALLOC(level, n_cells, cs_lnum_t);
+  BFT_MALLOC(queue, n_cells, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    tag[i] = 0;
+    level[i] = -1;
+  }
+
+  if (algorithm == CS_RENUMBER_CELLS_RCM)
+    _graph_rcm_order(g, tag, n_cells, new_to_old, level, queue);
+  else
+    _graph_nd_order(g, tag, &n_tags, n_cells, new_to_old, level, queue);
+
+  BFT_FREE(queue);
+  BFT_FREE(level);
+  BFT_FREE(tag);
+
+  _csr_graph_destroy(&g);
+}
+
 #if defined(HAVE_METIS) || defined(HAVE_PARMETIS)
 
 /*----------------------------------------------------------------------------
@@ -4471,6 +5006,11 @@ _cells_locality_renumbering_(cs_mesh_t                 *mesh,
     _renum_cells_hilbert(mesh, new_to_old_c);
     break;
 
+  case CS_RENUMBER_CELLS_RCM:
+  case CS_RENUMBER_CELLS_ND:
+    _renum_cells_graph(mesh, algorithm, new_to_old_c);
+    break;
+
   case CS_RENUMBER_CELLS_NONE:
     retval = 1;
     break;
@@ -56,6 +56,8 @@ typedef enum {
   CS_RENUMBER_CELLS_METIS_ORDER,     /* METIS ordering */
   CS_RENUMBER_CELLS_MORTON,          /* Morton space filling curve */
   CS_RENUMBER_CELLS_HILBERT,         /* Hilbert space filling curve */
+  CS_RENUMBER_CELLS_RCM,             /* Reverse Cuthill-McKee */
+  CS_RENUMBER_CELLS_ND,              /* Nested dissection */
   CS_RENUMBER_CELLS_NONE             /* No interior face numbering */
 
 } cs_renumber_cells_type_t;
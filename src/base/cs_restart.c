@@ -39,6 +39,10 @@
 #include <mpi.h>
 #endif
 
+#if defined(HAVE_PTHREAD) && defined(HAVE_OPENMP)
+#include <pthread.h>
+#endif
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -88,6 +92,15 @@ BEGIN_C_DECLS
 
 #define CS_RESTART_NAME_LEN   64
 
+/*
+ * Asynchronous writing by a helper thread requires POSIX threads, and
+ * OpenMP locks for thread-safe memory accounting (see bft_mem_set_ext_threads)
+ */
+
+#if defined(HAVE_PTHREAD) && defined(HAVE_OPENMP)
+#define CS_RESTART_ASYNC_THREAD 1
+#endif
+
 /*============================================================================
  * Local type definitions
  *============================================================================*/
@@ -106,6 +119,49 @@ typedef struct _location_t {
 
 } _location_t;
 
+/* Section staged for asynchronous writing */
+
+typedef struct {
+
+  char             *name;             /* Section name */
+  bool              global;           /* Values written globally (by rank 0)
+                                         if true, by blocks otherwise */
+  cs_gnum_t         n_vals;           /* Global number of values (global),
+                                         or of entities (blocks) */
+  cs_gnum_t         gnum_range[2];    /* Local block range (blocks only) */
+  int               location_id;      /* Id of corresponding location */
+  int               n_location_vals;  /* Number of values per location */
+  cs_datatype_t     elt_type;         /* Element type */
+  double            lossy_tolerance;  /* Tolerance for lossy compression */
+  cs_byte_t        *vals;             /* Private copy of values, or NULL */
+
+} _staged_section_t;
+
+/* Asynchronous write of a restart file */
+
+typedef struct {
+
+  char               *name;            /* Name of restart file */
+  cs_io_t            *fh;              /* Associated file handle */
+
+  double              lossy_tolerance; /* Current tolerance for lossy
+                                          compression of staged sections */
+
+  int                 n_sections;      /* Number of staged sections */
+  int                 n_sections_max;  /* Maximum number of staged sections */
+  _staged_section_t  *sections;        /* Staged sections */
+
+#if defined(HAVE_MPI)
+  MPI_Comm            block_comm;      /* Private block communicator */
+  MPI_Comm            comm;            /* Private associated communicator */
+#endif
+
+#if defined(CS_RESTART_ASYNC_THREAD)
+  pthread_t           thread;          /* Associated writer thread */
+#endif
+
+} _async_write_t;
+
 struct _cs_restart_t {
 
   char              *name;           /* Name of restart file */
@@ -118,6 +174,9 @@ struct _cs_restart_t {
   _location_t       *location;       /* Location definition array */
 
   cs_restart_mode_t  mode;           /* Read or write */
+
+  _async_write_t    *async;          /* Staged data for asynchronous
+                                        writing, or NULL */
 };
 
 /*============================================================================
@@ -151,6 +210,20 @@ static double _checkpoint_wt_next = -1.;     /* next forced wall-clock value */
 static double _checkpoint_wt_last = 0.;      /* wall-clock time of last
                                                 checkpointing */
 
+/* Asynchronous checkpoint writing */
+
+static int    _checkpoint_async = -1;        /* asynchronous writes required
+                                                (-1: not set, based on
+                                                CS_CHECKPOINT_ASYNC) */
+static bool   _checkpoint_async_logged = false;
+
+static int              _n_async_writes = 0;     /* number of active writes */
+static _async_write_t **_async_writes = NULL;    /* active writes */
+
+/* Compression level for written files (0 if none) */
+
+static int _restart_compression_level = 0;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -246,6 +319,346 @@ _locations_from_index(cs_restart_t  *r)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Check if asynchronous writing by a helper thread is possible.
+ *
+ * returns:
+ *   true if a writer thread may be used, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_async_write_available(void)
+{
+  bool retval = false;
+
+#if defined(CS_RESTART_ASYNC_THREAD)
+
+  retval = true;
+
+#if defined(HAVE_MPI)
+
+  /* The writer thread calls MPI concurrently with the main thread */
+
+  if (cs_glob_n_ranks > 1) {
+    int thread_level = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&thread_level);
+    if (thread_level < MPI_THREAD_MULTIPLE)
+      retval = false;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+#endif /* defined(CS_RESTART_ASYNC_THREAD) */
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Create an asynchronous write structure.
+ *
+ * parameters:
+ *   name <-- associated file name
+ *
+ * returns:
+ *   pointer to asynchronous write structure
+ *----------------------------------------------------------------------------*/
+
+static _async_write_t *
+_async_write_create(const char  *name)
+{
+  _async_write_t  *w = NULL;
+
+  BFT_MALLOC(w, 1, _async_write_t);
+
+  BFT_MALLOC(w->name, strlen(name) + 1, char);
+  strcpy(w->name, name);
+
+  w->fh = NULL;
+
+  w->lossy_tolerance = 0.;
+
+  w->n_sections = 0;
+  w->n_sections_max = 0;
+  w->sections = NULL;
+
+#if defined(HAVE_MPI)
+  w->block_comm = MPI_COMM_NULL;
+  w->comm = MPI_COMM_NULL;
+#endif
+
+  return w;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy an asynchronous write structure (closing the associated file).
+ *
+ * parameters:
+ *   w <-> pointer to asynchronous write structure pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_write_destroy(_async_write_t  **w)
+{
+  _async_write_t  *_w = *w;
+
+  if (_w->fh != NULL) {
+    cs_io_suspend_log(_w->fh, false);
+    cs_io_finalize(&(_w->fh));
+  }
+
+  for (int i = 0; i < _w->n_sections; i++) {
+    BFT_FREE(_w->sections[i].name);
+    BFT_FREE(_w->sections[i].vals);
+  }
+  BFT_FREE(_w->sections);
+
+#if defined(HAVE_MPI)
+  if (_w->block_comm != MPI_COMM_NULL && _w->block_comm != _w->comm)
+    MPI_Comm_free(&(_w->block_comm));
+  if (_w->comm != MPI_COMM_NULL)
+    MPI_Comm_free(&(_w->comm));
+#endif
+
+  BFT_FREE(_w->name);
+  BFT_FREE(*w);
+}
+
+/*----------------------------------------------------------------------------
+ * Stage a section for asynchronous writing.
+ *
+ * parameters:
+ *   w               <-> asynchronous write structure
+ *   sec_name        <-- section name
+ *   global          <-- true for global values, false for blocks
+ *   n_vals          <-- global number of values (global values),
+ *                       or of entities (blocks)
+ *   gnum_range      <-- local block range (blocks only), or NULL
+ *   location_id     <-- id of corresponding location
+ *   n_location_vals <-- number of values per location
+ *   elt_type        <-- element type
+ *   vals            <-- values (ownership is transferred)
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_write_stage(_async_write_t   *w,
+                   const char       *sec_name,
+                   bool              global,
+                   cs_gnum_t         n_vals,
+                   const cs_gnum_t   gnum_range[2],
+                   int               location_id,
+                   int               n_location_vals,
+                   cs_datatype_t     elt_type,
+                   cs_byte_t        *vals)
+{
+  if (w->n_sections >= w->n_sections_max) {
+    w->n_sections_max = CS_MAX(16, w->n_sections_max*2);
+    BFT_REALLOC(w->sections, w->n_sections_max, _staged_section_t);
+  }
+
+  _staged_section_t  *s = w->sections + w->n_sections;
+
+  BFT_MALLOC(s->name, strlen(sec_name) + 1, char);
+  strcpy(s->name, sec_name);
+
+  s->global = global;
+  s->n_vals = n_vals;
+  s->gnum_range[0] = (gnum_range != NULL) ? gnum_range[0] : 0;
+  s->gnum_range[1] = (gnum_range != NULL) ? gnum_range[1] : 0;
+  s->location_id = location_id;
+  s->n_location_vals = n_location_vals;
+  s->elt_type = elt_type;
+  s->lossy_tolerance = w->lossy_tolerance;
+  s->vals = vals;
+
+  w->n_sections += 1;
+}
+
+#if defined(CS_RESTART_ASYNC_THREAD)
+
+/*----------------------------------------------------------------------------
+ * Write staged sections to file.
+ *
+ * This function is the entry point of the writer thread.
+ *
+ * parameters:
+ *   arg <-> pointer to asynchronous write structure
+ *
+ * returns:
+ *   NULL
+ *----------------------------------------------------------------------------*/
+
+static void *
+_async_write_sections(void  *arg)
+{
+  _async_write_t  *w = arg;
+
+  for (int i = 0; i < w->n_sections; i++) {
+
+    _staged_section_t  *s = w->sections + i;
+
+    cs_io_set_lossy_tolerance(w->fh, s->lossy_tolerance);
+
+    if (s->global)
+      cs_io_write_global(s->name,
+                         s->n_vals,
+                         s->location_id,
+                         0,
+                         s->n_location_vals,
+                         s->elt_type,
+                         s->vals,
+                         w->fh);
+
+    else
+      cs_io_write_block_buffer(s->name,
+                               s->n_vals,
+                               s->gnum_range[0],
+                               s->gnum_range[1],
+                               s->location_id,
+                               0,
+                               s->n_location_vals,
+                               s->elt_type,
+                               s->vals,
+                               w->fh);
+
+    /* Release staged values as soon as possible */
+
+    BFT_FREE(s->vals);
+  }
+
+  return NULL;
+}
+
+#endif /* defined(CS_RESTART_ASYNC_THREAD) */
+
+/*----------------------------------------------------------------------------
+ * Start writing staged sections of a restart file.
+ *
+ * The file handle is transferred from the restart structure to the
+ * asynchronous write structure, which is added to the active writes.
+ *
+ * parameters:
+ *   r <-> associated restart file pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_write_start(cs_restart_t  *r)
+{
+  _async_write_t  *w = r->async;
+
+  w->fh = r->fh;
+
+  r->fh = NULL;
+  r->async = NULL;
+
+  BFT_REALLOC(_async_writes, _n_async_writes + 1, _async_write_t *);
+  _async_writes[_n_async_writes] = w;
+  _n_async_writes += 1;
+
+#if defined(CS_RESTART_ASYNC_THREAD)
+
+  bft_mem_set_ext_threads(_n_async_writes);
+
+  cs_io_suspend_log(w->fh, true);
+
+  int retval = pthread_create(&(w->thread), NULL, _async_write_sections, w);
+
+  if (retval != 0)
+    bft_error(__FILE__, __LINE__, retval,
+              _("Error creating writer thread for file \"%s\"."), w->name);
+
+#endif /* defined(CS_RESTART_ASYNC_THREAD) */
+}
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of active asynchronous writes.
+ *
+ * parameters:
+ *   name <-- name of file whose writing must be completed,
+ *            or NULL for all files
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_write_wait(const char  *name)
+{
+  int n_active = 0;
+
+  for (int i = 0; i < _n_async_writes; i++) {
+
+    _async_write_t  *w = _async_writes[i];
+
+    if (name == NULL || strcmp(name, w->name) == 0) {
+#if defined(CS_RESTART_ASYNC_THREAD)
+      pthread_join(w->thread, NULL);
+#endif
+      _async_write_destroy(&w);
+    }
+    else
+      _async_writes[n_active++] = w;
+
+  }
+
+  if (n_active < _n_async_writes) {
+    _n_async_writes = n_active;
+    bft_mem_set_ext_threads(_n_async_writes);
+    if (_n_async_writes == 0)
+      BFT_FREE(_async_writes);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Write global values to a restart file, or stage them for asynchronous
+ * writing.
+ *
+ * parameters:
+ *   r               <-> associated restart file pointer
+ *   sec_name        <-- section name
+ *   n_vals          <-- global number of values
+ *   location_id     <-- id of corresponding location
+ *   n_location_vals <-- number of values per location
+ *   elt_type        <-- element type
+ *   vals            <-- values
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_global(cs_restart_t   *r,
+              const char     *sec_name,
+              cs_gnum_t       n_vals,
+              int             location_id,
+              int             n_location_vals,
+              cs_datatype_t   elt_type,
+              const void     *vals)
+{
+  if (r->async == NULL) {
+    cs_io_write_global(sec_name,
+                       n_vals,
+                       location_id,
+                       0,
+                       n_location_vals,
+                       elt_type,
+                       vals,
+                       r->fh);
+    return;
+  }
+
+  cs_byte_t  *_vals = NULL;
+  size_t  n_bytes = n_vals * cs_datatype_size[elt_type];
+
+  if (n_bytes > 0) {
+    BFT_MALLOC(_vals, n_bytes, cs_byte_t);
+    memcpy(_vals, vals, n_bytes);
+  }
+
+  _async_write_stage(r->async,
+                     sec_name,
+                     true,
+                     n_vals,
+                     NULL,
+                     location_id,
+                     n_location_vals,
+                     elt_type,
+                     _vals);
+}
+
 /*----------------------------------------------------------------------------
  * Initialize a checkpoint / restart file management structure;
  *
@@ -292,6 +705,18 @@ _add_file(cs_restart_t  *r)
     }
     else {
       cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
+      /* Use private communicators for asynchronous writes */
+      if (r->async != NULL) {
+        _async_write_t  *w = r->async;
+        if (comm != MPI_COMM_NULL)
+          MPI_Comm_dup(comm, &(w->comm));
+        if (block_comm == comm)
+          w->block_comm = w->comm;
+        else if (block_comm != MPI_COMM_NULL)
+          MPI_Comm_dup(block_comm, &(w->block_comm));
+        block_comm = w->block_comm;
+        comm = w->comm;
+      }
       r->fh = cs_io_initialize(r->name,
                                magic_string,
                                CS_IO_MODE_WRITE,
@@ -323,6 +748,9 @@ _add_file(cs_restart_t  *r)
   }
 #endif
 
+  if (r->mode == CS_RESTART_MODE_WRITE && _restart_compression_level > 0)
+    cs_io_set_compression(r->fh, _restart_compression_level);
+
   timing[1] = cs_timer_wtime();
   _restart_wtime[r->mode] += timing[1] - timing[0];
 
@@ -441,7 +869,7 @@ _read_ent_values(cs_restart_t           *r,
  *----------------------------------------------------------------------------*/
 
 static void
-_write_ent_values(const cs_restart_t     *r,
+_write_ent_values(cs_restart_t           *r,
                   const char             *sec_name,
                   cs_gnum_t               n_glob_ents,
                   cs_lnum_t               n_ents,
@@ -511,18 +939,31 @@ _write_ent_values(const cs_restart_t     *r,
                               vals,
                               buffer);
 
-  /* Write blocks */
+  /* Write blocks, or stage them for asynchronous writing */
 
-  cs_io_write_block_buffer(sec_name,
-                           n_glob_ents,
-                           bi.gnum_range[0],
-                           bi.gnum_range[1],
-                           location_id,
-                           0,
-                           n_location_vals,
-                           elt_type,
-                           buffer,
-                           r->fh);
+  if (r->async != NULL) {
+    _async_write_stage(r->async,
+                       sec_name,
+                       false,
+                       n_glob_ents,
+                       bi.gnum_range,
+                       location_id,
+                       n_location_vals,
+                       elt_type,
+                       buffer);
+    buffer = NULL;
+  }
+  else
+    cs_io_write_block_buffer(sec_name,
+                             n_glob_ents,
+                             bi.gnum_range[0],
+                             bi.gnum_range[1],
+                             location_id,
+                             0,
+                             n_location_vals,
+                             elt_type,
+                             buffer,
+                             r->fh);
 
   /* Free buffer */
 
@@ -1109,6 +1550,95 @@ cs_restart_checkpoint_set_next_wt(double  wt_next)
   _checkpoint_wt_next = wt_next;
 }
 
+/*----------------------------------------------------------------------------
+ * Activate or deactivate asynchronous checkpoint writing.
+ *
+ * When active, checkpoint sections are copied (and redistributed to
+ * blocks in parallel) to a staging buffer, and written to file by a
+ * helper thread, so that computation may resume while data is written.
+ * This requires POSIX threads and OpenMP support, and in parallel, an MPI
+ * library initialized with MPI_THREAD_MULTIPLE support, which is only
+ * requested when the CS_CHECKPOINT_ASYNC environment variable is set to 1
+ * at startup; otherwise, checkpoint files are written synchronously.
+ *
+ * If this function is not called, asynchronous writing is active when
+ * CS_CHECKPOINT_ASYNC is set to 1.
+ *
+ * parameters
+ *   async <-- true to write checkpoint files asynchronously
+ *----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_async(bool  async)
+{
+  _checkpoint_async = (async) ? 1 : 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of asynchronous checkpoint writes.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_wait(void)
+{
+  double timing[2];
+
+  if (_n_async_writes == 0)
+    return;
+
+  timing[0] = cs_timer_wtime();
+
+  _async_write_wait(NULL);
+
+  timing[1] = cs_timer_wtime();
+  _restart_wtime[CS_RESTART_MODE_WRITE] += timing[1] - timing[0];
+}
+
+/*----------------------------------------------------------------------------
+ * Set compression level for checkpoint files.
+ *
+ * Large sections of files opened in write mode after this call are
+ * compressed by independent chunks (so that parallel reads remain
+ * possible) if Zlib support is available; compressed sections are
+ * handled transparently on read.
+ *
+ * parameters
+ *   level <-- compression level: 0 for none, 1 (fastest) to 9 (best)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_compression(int  level)
+{
+  _restart_compression_level = level;
+}
+
+/*----------------------------------------------------------------------------
+ * Set relative tolerance for lossy compression of subsequently written
+ * floating-point sections of a restart file.
+ *
+ * This is intended for data not requiring bit-for-bit restart, such as
+ * time moments, and has no effect if compression is not active.
+ *
+ * parameters
+ *   restart   <-> associated restart file pointer
+ *   tolerance <-- relative tolerance, or 0 for lossless compression
+ *----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_lossy_tolerance(cs_restart_t  *restart,
+                               double         tolerance)
+{
+  assert(restart != NULL);
+
+  if (restart->mode != CS_RESTART_MODE_WRITE)
+    return;
+
+  if (restart->async != NULL)
+    restart->async->lossy_tolerance = tolerance;
+  else
+    cs_io_set_lossy_tolerance(restart->fh, tolerance);
+}
+
 /*----------------------------------------------------------------------------
  * Check if checkpointing is recommended at a given time.
  *
@@ -1323,6 +1853,33 @@ cs_restart_create(const char         *name,
   restart->n_locations = 0;
   restart->location = NULL;
 
+  /* Complete pending asynchronous write of the same file if present */
+
+  _async_write_wait(restart->name);
+
+  restart->async = NULL;
+
+  if (_checkpoint_async < 0) {
+    const char *s = getenv("CS_CHECKPOINT_ASYNC");
+    _checkpoint_async = (s != NULL && atoi(s) > 0) ? 1 : 0;
+  }
+
+  if (mode == CS_RESTART_MODE_WRITE && _checkpoint_async) {
+    if (_async_write_available())
+      restart->async = _async_write_create(restart->name);
+    else if (_checkpoint_async_logged == false) {
+      bft_printf(_("\n"
+                   "  Asynchronous checkpoint writing is not available\n"
+                   "  in this configuration; files are written"
+                   " synchronously.\n"
+                   "  (in parallel, set CS_CHECKPOINT_ASYNC=1 in the"
+                   " environment so that\n"
+                   "  MPI is initialized with MPI_THREAD_MULTIPLE"
+                   " support)\n"));
+      _checkpoint_async_logged = true;
+    }
+  }
+
   /* Open associated file, and build an index of sections in read mode */
 
   _add_file(restart);
@@ -1370,6 +1927,12 @@ cs_restart_destroy(cs_restart_t  **restart)
 
   mode = r->mode;
 
+  /* With asynchronous writing, the file is closed once staged
+     sections are written */
+
+  if (r->async != NULL)
+    _async_write_start(r);
+
   if (r->fh != NULL)
     cs_io_finalize(&(r->fh));
 
@@ -1534,9 +2097,8 @@ cs_restart_add_location(cs_restart_t     *restart,
     (restart->location[restart->n_locations-1]).ent_global_num = ent_global_num;
     (restart->location[restart->n_locations-1])._ent_global_num = NULL;
 
-    cs_io_write_global(location_name, 1, restart->n_locations, 0, 0,
-                       gnum_type, &n_glob_ents,
-                       restart->fh);
+    _write_global(restart, location_name, 1, restart->n_locations, 0,
+                  gnum_type, &n_glob_ents);
 
     timing[1] = cs_timer_wtime();
     _restart_wtime[restart->mode] += timing[1] - timing[0];
@@ -2021,14 +2583,13 @@ cs_restart_write_section(cs_restart_t           *restart,
   /* In single processor mode of for global values */
 
   if (location_id == 0)
-    cs_io_write_global(sec_name,
-                       n_tot_vals,
-                       location_id,
-                       0,
-                       1,
-                       elt_type,
-                       val,
-                       restart->fh);
+    _write_global(restart,
+                  sec_name,
+                  n_tot_vals,
+                  location_id,
+                  1,
+                  elt_type,
+                  val);
 
 
   else if (cs_glob_n_ranks == 1) {
@@ -2041,14 +2602,29 @@ cs_restart_write_section(cs_restart_t           *restart,
                                        _n_location_vals,
                                        val_type,
                                        val);
-    cs_io_write_global(sec_name,
-                       n_tot_vals,
-                       location_id,
-                       0,
-                       _n_location_vals,
-                       elt_type,
-                       (val_tmp != NULL) ? val_tmp : val,
-                       restart->fh);
+
+    /* Permuted values may be staged directly for asynchronous writing */
+
+    if (val_tmp != NULL && restart->async != NULL) {
+      _async_write_stage(restart->async,
+                         sec_name,
+                         true,
+                         n_tot_vals,
+                         NULL,
+                         location_id,
+                         _n_location_vals,
+                         elt_type,
+                         val_tmp);
+      val_tmp = NULL;
+    }
+    else
+      _write_global(restart,
+                    sec_name,
+                    n_tot_vals,
+                    location_id,
+                    _n_location_vals,
+                    elt_type,
+                    (val_tmp != NULL) ? val_tmp : val);
 
     if (val_tmp != NULL)
       BFT_FREE (val_tmp);
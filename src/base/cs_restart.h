@@ -230,6 +230,65 @@ cs_restart_checkpoint_set_next_tv(double  t_next);
 void
 cs_restart_checkpoint_set_next_wt(double  wt_next);
 
+/*----------------------------------------------------------------------------
+ * Activate or deactivate asynchronous checkpoint writing.
+ *
+ * When active, checkpoint sections are copied (and redistributed to
+ * blocks in parallel) to a staging buffer, and written to file by a
+ * helper thread, so that computation may resume while data is written.
+ * This requires POSIX threads and OpenMP support, and in parallel, an MPI
+ * library initialized with MPI_THREAD_MULTIPLE support, which is only
+ * requested when the CS_CHECKPOINT_ASYNC environment variable is set to 1
+ * at startup; otherwise, checkpoint files are written synchronously.
+ *
+ * If this function is not called, asynchronous writing is active when
+ * CS_CHECKPOINT_ASYNC is set to 1.
+ *
+ * parameters
+ *   async <-- true to write checkpoint files asynchronously
+ *----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_async(bool  async);
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of asynchronous checkpoint writes.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_wait(void);
+
+/*----------------------------------------------------------------------------
+ * Set compression level for checkpoint files.
+ *
+ * Large sections of files opened in write mode after this call are
+ * compressed by independent chunks (so that parallel reads remain
+ * possible) if Zlib support is available; compressed sections are
+ * handled transparently on read.
+ *
+ * parameters
+ *   level <-- compression level: 0 for none, 1 (fastest) to 9 (best)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_compression(int  level);
+
+/*----------------------------------------------------------------------------
+ * Set relative tolerance for lossy compression of subsequently written
+ * floating-point sections of a restart file.
+ *
+ * This is intended for data not requiring bit-for-bit restart, such as
+ * time moments, and has no effect if compression is not active.
+ *
+ * parameters
+ *   restart   <-> associated restart file pointer
+ *   tolerance <-- relative tolerance, or 0 for lossless compression
+ *----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_lossy_tolerance(cs_restart_t  *restart,
+                               double         tolerance);
+
 /*----------------------------------------------------------------------------
  * Check if checkpointing is recommended at a given time.
  *
@@ -228,6 +228,7 @@ static cs_time_moment_t *_moment = NULL;
 
 static  bool _restart_info_checked = false;
 static  bool _restart_uses_main = false;
+static  double _restart_tolerance = 0.;
 static  cs_time_moment_restart_info_t *_restart_info = NULL;
 
 static double _t_prev_iter = 0.;
@@ -2732,6 +2733,25 @@ cs_time_moment_restart_use_main(int  use_main)
     _restart_uses_main = false;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define relative tolerance for lossy compression of moment values
+ *        in checkpoint files.
+ *
+ * As moments are statistics, they do not usually require bit-for-bit
+ * restart; this setting only has an effect if checkpoint file
+ * compression is active (see \ref cs_restart_set_compression).
+ *
+ * \param[in]  tolerance  relative tolerance, or 0 for lossless storage
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_time_moment_set_restart_tolerance(double  tolerance)
+{
+  _restart_tolerance = tolerance;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Read restart moment data
@@ -3056,6 +3076,8 @@ cs_time_moment_restart_write(cs_restart_t  *restart)
   BFT_FREE(location_id);
   BFT_FREE(m_type);
 
+  cs_restart_set_lossy_tolerance(restart, _restart_tolerance);
+
   for (int i = 0; i < _n_moments; i++) {
     int j = active_moment_id[i];
     if (j > -1) {
@@ -3079,6 +3101,8 @@ cs_time_moment_restart_write(cs_restart_t  *restart)
     }
   }
 
+  cs_restart_set_lossy_tolerance(restart, 0.);
+
   BFT_FREE(active_moment_id);
   BFT_FREE(active_wa_id);
 }
@@ -329,6 +329,17 @@ cs_time_moment_log_iteration(void);
 void
 cs_time_moment_restart_use_main(int  use_main);
 
+/*----------------------------------------------------------------------------
+ * Define relative tolerance for lossy compression of moment values
+ * in checkpoint files.
+ *
+ * parameters:
+ *   tolerance <-- relative tolerance, or 0 for lossless storage
+ *----------------------------------------------------------------------------*/
+
+void
+cs_time_moment_set_restart_tolerance(double  tolerance);
+
 /*----------------------------------------------------------------------------
  * Read restart moment data
  *
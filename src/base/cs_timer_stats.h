@@ -164,6 +164,22 @@ cs_timer_stats_set_plot(int  id,
 int
 cs_timer_stats_is_active(int  id);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the accumulated time counter for a given statistic.
+ *
+ * Time elapsed since the timer was last started is included if the
+ * statistic is currently active.
+ *
+ * \param[in]  id  id of statistic
+ *
+ * \return  accumulated wall-clock and CPU time counter
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_timer_counter_t
+cs_timer_stats_get_counter(int  id);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Start a timer for a given statistic.
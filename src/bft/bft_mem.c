@@ -194,6 +194,10 @@ static bft_error_handler_t  *_bft_mem_error_handler
 static omp_lock_t _bft_mem_lock;
 #endif
 
+/* Number of active threads not managed by OpenMP */
+
+static int  _bft_mem_n_ext_threads = 0;
+
 /*-----------------------------------------------------------------------------
  * Local function definitions
  *-----------------------------------------------------------------------------*/
@@ -772,7 +776,7 @@ bft_mem_malloc(size_t       ni,
 
   {
 #if defined(HAVE_OPENMP)
-    int in_parallel = omp_in_parallel();
+    int in_parallel = (omp_in_parallel() || _bft_mem_n_ext_threads > 0);
     if (in_parallel)
       omp_set_lock(&_bft_mem_lock);
 #endif
@@ -856,7 +860,7 @@ bft_mem_realloc(void        *ptr,
   /* If the old size equals the new size, nothing needs to be done. */
 
 #if defined(HAVE_OPENMP)
-  int in_parallel = omp_in_parallel();
+  int in_parallel = (omp_in_parallel() || _bft_mem_n_ext_threads > 0);
   if (in_parallel)
     omp_set_lock(&_bft_mem_lock);
 #endif
@@ -975,7 +979,7 @@ bft_mem_free(void        *ptr,
   if (_bft_mem_global_initialized != 0) {
 
 #if defined(HAVE_OPENMP)
-    int in_parallel = omp_in_parallel();
+    int in_parallel = (omp_in_parallel() || _bft_mem_n_ext_threads > 0);
     if (in_parallel)
       omp_set_lock(&_bft_mem_lock);
 #endif
@@ -1074,7 +1078,7 @@ bft_mem_memalign(size_t       alignment,
 
   {
 #if defined(HAVE_OPENMP)
-    int in_parallel = omp_in_parallel();
+    int in_parallel = (omp_in_parallel() || _bft_mem_n_ext_threads > 0);
     if (in_parallel)
       omp_set_lock(&_bft_mem_lock);
 #endif
@@ -1119,6 +1123,22 @@ bft_mem_memalign(size_t       alignment,
 #endif
 }
 
+/*!
+ * \brief Indicate the number of active threads not managed by OpenMP.
+ *
+ * When threads other than OpenMP threads (such as POSIX threads used for
+ * asynchronous operations) may call bft_mem_...() functions, memory
+ * accounting is protected by a lock even outside OpenMP parallel regions.
+ *
+ * \param [in] n_threads number of active external threads.
+ */
+
+void
+bft_mem_set_ext_threads(int  n_threads)
+{
+  _bft_mem_n_ext_threads = n_threads;
+}
+
 /*!
  * \brief Return current theoretical dynamic memory allocated.
  *
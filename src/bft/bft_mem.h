@@ -282,6 +282,20 @@ bft_mem_memalign(size_t       alignment,
                  const char  *file_name,
                  int          line_num);
 
+/*
+ * Indicate the number of active threads not managed by OpenMP.
+ *
+ * When threads other than OpenMP threads (such as POSIX threads used for
+ * asynchronous operations) may call bft_mem_...() functions, memory
+ * accounting is protected by a lock even outside OpenMP parallel regions.
+ *
+ * parameter:
+ *   n_threads <-- number of active external threads.
+ */
+
+void
+bft_mem_set_ext_threads(int  n_threads);
+
 /*!
  * \brief Return current theoretical dynamic memory allocated.
  *
@@ -5782,6 +5782,8 @@ cs_gui_parallel_io(void)
         m = CS_FILE_STDIO_SERIAL;
       else if (!strcmp(method_name, "stdio parallel"))
         m = CS_FILE_STDIO_PARALLEL;
+      else if (!strcmp(method_name, "mmap"))
+        m = CS_FILE_MMAP;
       else if (!strcmp(method_name, "mpi independent"))
         m = CS_FILE_MPI_INDEPENDENT;
       else if (!strcmp(method_name, "mpi noncollective"))
@@ -2027,6 +2027,15 @@ cs_lagr_solve_time_step(const int         itypfb[],
 
   cs_lagr_injection(iprev, itypfb, vislen);
 
+  /* Periodic reordering of particles by cell, to improve locality
+     of cell-based data access in the following particle loops */
+
+  {
+    int nt_sort = cs_lagr_get_cell_sort_interval();
+    if (nt_sort > 0 && ts->nt_cur % nt_sort == 0)
+      cs_lagr_particle_set_sort_by_cell(p_set);
+  }
+
   /* ====================================================================   */
   /* 3.  GESTION DU TEMPS QUI PASSE...   */
   /* ====================================================================   */
@@ -72,6 +72,14 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Minimum number of cells for threaded source term accumulation */
+
+#define CS_THR_MIN 128
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -157,6 +165,12 @@ cs_lagr_coupling(cs_real_t taup[],
   BFT_MALLOC (auxl2, nbpart, cs_real_t);
   BFT_MALLOC (auxl3, nbpart, cs_real_t);
 
+  /* Particles are accumulated cell by cell, so that each cell's source
+     terms are only updated by one thread */
+
+  cs_lnum_t *cell_idx = NULL, *p_ids = NULL;
+  cs_lagr_particle_set_cell_index(p_set, &cell_idx, &p_ids);
+
   /*   Nombre de passage pour les termes sources en stationnaire  */
   if (   cs_glob_lagr_time_scheme->isttio == 1
       && cs_glob_time_step->nt_cur >= cs_glob_lagr_source_terms->nstits)
@@ -222,28 +236,33 @@ cs_lagr_coupling(cs_real_t taup[],
 
   if (cs_glob_lagr_source_terms->ltsdyn == 1) {
 
-    for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
+#   pragma omp parallel for if (ncel > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < ncel; c_id++) {
+      for (cs_lnum_t j = cell_idx[c_id]; j < cell_idx[c_id+1]; j++) {
 
-      unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
+        cs_lnum_t npt = (p_ids != NULL) ? p_ids[j] : j;
 
-      cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
+        unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
 
-      cs_real_t  prev_p_diam = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_DIAMETER);
-      cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_MASS);
-      cs_real_t  p_mass = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_MASS);
+        cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
 
-      cs_lnum_t iel = cs_lagr_particle_get_cell_id(particle, p_am);
+        cs_real_t  prev_p_diam = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_DIAMETER);
+        cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_MASS);
+        cs_real_t  p_mass = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_MASS);
 
-      /* Volume et masse des particules dans la maille */
-      volp[iel] += p_stat_w * cs_math_pi * pow(prev_p_diam, 3) / 6.0;
-      volm[iel] += p_stat_w * prev_p_mass;
+        cs_lnum_t iel = cs_lagr_particle_get_cell_id(particle, p_am);
 
-      /* TS de QM   */
-      tslag[iel + (lag_st->itsvx-1) * ncelet] += - auxl1[npt];
-      tslag[iel + (lag_st->itsvy-1) * ncelet] += - auxl2[npt];
-      tslag[iel + (lag_st->itsvz-1) * ncelet] += - auxl3[npt];
-      tslag[iel + (lag_st->itsli-1) * ncelet] += - 2.0 * p_stat_w * p_mass / taup[npt];
+        /* Volume et masse des particules dans la maille */
+        volp[iel] += p_stat_w * cs_math_pi * pow(prev_p_diam, 3) / 6.0;
+        volm[iel] += p_stat_w * prev_p_mass;
 
+        /* TS de QM   */
+        tslag[iel + (lag_st->itsvx-1) * ncelet] += - auxl1[npt];
+        tslag[iel + (lag_st->itsvy-1) * ncelet] += - auxl2[npt];
+        tslag[iel + (lag_st->itsvz-1) * ncelet] += - auxl3[npt];
+        tslag[iel + (lag_st->itsli-1) * ncelet] += - 2.0 * p_stat_w * p_mass / taup[npt];
+
+      }
     }
 
     /* ====================================================================   */
@@ -256,20 +275,25 @@ cs_lagr_coupling(cs_real_t taup[],
       /* (difficile d'ecrire quoi que ce soit sur v2, qui perd son sens de */
       /*  "composante de Rij")     */
 
-      for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
+#     pragma omp parallel for if (ncel > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < ncel; c_id++) {
+        for (cs_lnum_t j = cell_idx[c_id]; j < cell_idx[c_id+1]; j++) {
 
-        unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
+          cs_lnum_t npt = (p_ids != NULL) ? p_ids[j] : j;
 
-        cs_lnum_t  iel         = cs_lagr_particle_get_cell_id(particle, p_am);
-        cs_real_t *prev_f_vel  = cs_lagr_particle_attr_n(particle, p_am, 1, CS_LAGR_VELOCITY_SEEN);
-        cs_real_t *f_vel       = cs_lagr_particle_attr(particle, p_am, CS_LAGR_VELOCITY_SEEN);
+          unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
+
+          cs_lnum_t  iel         = cs_lagr_particle_get_cell_id(particle, p_am);
+          cs_real_t *prev_f_vel  = cs_lagr_particle_attr_n(particle, p_am, 1, CS_LAGR_VELOCITY_SEEN);
+          cs_real_t *f_vel       = cs_lagr_particle_attr(particle, p_am, CS_LAGR_VELOCITY_SEEN);
 
-        cs_real_t uuf = 0.5 * (prev_f_vel[0] + f_vel[0]);
-        cs_real_t vvf = 0.5 * (prev_f_vel[1] + f_vel[1]);
-        cs_real_t wwf = 0.5 * (prev_f_vel[2] + f_vel[2]);
+          cs_real_t uuf = 0.5 * (prev_f_vel[0] + f_vel[0]);
+          cs_real_t vvf = 0.5 * (prev_f_vel[1] + f_vel[1]);
+          cs_real_t wwf = 0.5 * (prev_f_vel[2] + f_vel[2]);
 
-        tslag[iel + (lag_st->itske-1) * ncelet] += - uuf * auxl1[npt] - vvf * auxl2[npt] - wwf * auxl3[npt];
+          tslag[iel + (lag_st->itske-1) * ncelet] += - uuf * auxl1[npt] - vvf * auxl2[npt] - wwf * auxl3[npt];
 
+        }
       }
 
       for (cs_lnum_t iel = 0; iel < ncel; iel++)
@@ -280,26 +304,31 @@ cs_lagr_coupling(cs_real_t taup[],
     }
     else if (extra->itytur == 3) {
 
-      for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
+#     pragma omp parallel for if (ncel > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < ncel; c_id++) {
+        for (cs_lnum_t j = cell_idx[c_id]; j < cell_idx[c_id+1]; j++) {
 
-        unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
+          cs_lnum_t npt = (p_ids != NULL) ? p_ids[j] : j;
 
-        cs_lnum_t  iel         = cs_lagr_particle_get_cell_id(particle, p_am);
+          unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
+
+          cs_lnum_t  iel         = cs_lagr_particle_get_cell_id(particle, p_am);
 
-        cs_real_t *prev_f_vel  = cs_lagr_particle_attr_n(particle, p_am, 1, CS_LAGR_VELOCITY_SEEN);
-        cs_real_t *f_vel       = cs_lagr_particle_attr(particle, p_am, CS_LAGR_VELOCITY_SEEN);
+          cs_real_t *prev_f_vel  = cs_lagr_particle_attr_n(particle, p_am, 1, CS_LAGR_VELOCITY_SEEN);
+          cs_real_t *f_vel       = cs_lagr_particle_attr(particle, p_am, CS_LAGR_VELOCITY_SEEN);
 
-        cs_real_t uuf = 0.5 * (prev_f_vel[0] + f_vel[0]);
-        cs_real_t vvf = 0.5 * (prev_f_vel[1] + f_vel[1]);
-        cs_real_t wwf = 0.5 * (prev_f_vel[2] + f_vel[2]);
+          cs_real_t uuf = 0.5 * (prev_f_vel[0] + f_vel[0]);
+          cs_real_t vvf = 0.5 * (prev_f_vel[1] + f_vel[1]);
+          cs_real_t wwf = 0.5 * (prev_f_vel[2] + f_vel[2]);
 
-        tslag[iel + (lag_st->itsr11-1) * ncelet] += - 2.0 * uuf * auxl1[npt];
-        tslag[iel + (lag_st->itsr12-1) * ncelet] += - uuf * auxl2[npt] - vvf * auxl1[npt];
-        tslag[iel + (lag_st->itsr13-1) * ncelet] += - uuf * auxl3[npt] - wwf * auxl1[npt];
-        tslag[iel + (lag_st->itsr22-1) * ncelet] += - 2.0 * vvf * auxl2[npt];
-        tslag[iel + (lag_st->itsr23-1) * ncelet] += - vvf * auxl3[npt] - wwf * auxl2[npt];
-        tslag[iel + (lag_st->itsr33-1) * ncelet] += - 2.0 * wwf * auxl3[npt];
+          tslag[iel + (lag_st->itsr11-1) * ncelet] += - 2.0 * uuf * auxl1[npt];
+          tslag[iel + (lag_st->itsr12-1) * ncelet] += - uuf * auxl2[npt] - vvf * auxl1[npt];
+          tslag[iel + (lag_st->itsr13-1) * ncelet] += - uuf * auxl3[npt] - wwf * auxl1[npt];
+          tslag[iel + (lag_st->itsr22-1) * ncelet] += - 2.0 * vvf * auxl2[npt];
+          tslag[iel + (lag_st->itsr23-1) * ncelet] += - vvf * auxl3[npt] - wwf * auxl2[npt];
+          tslag[iel + (lag_st->itsr33-1) * ncelet] += - 2.0 * wwf * auxl3[npt];
 
+        }
       }
       for (cs_lnum_t iel = 0; iel < ncel; iel++) {
 
@@ -332,19 +361,24 @@ cs_lagr_coupling(cs_real_t taup[],
       && (   cs_glob_lagr_specific_physics->impvar == 1
           || cs_glob_lagr_specific_physics->idpvar == 1)) {
 
-    for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
+#   pragma omp parallel for if (ncel > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < ncel; c_id++) {
+      for (cs_lnum_t j = cell_idx[c_id]; j < cell_idx[c_id+1]; j++) {
 
-      unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
+        cs_lnum_t npt = (p_ids != NULL) ? p_ids[j] : j;
 
-      cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
-      cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_MASS);
-      cs_real_t  p_mass = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_MASS);
+        unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
 
-      /* Dans saturne TSmasse > 0 ===> Apport de masse sur le fluide  */
-      cs_lnum_t iel = cs_lagr_particle_get_cell_id(particle, p_am);
+        cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
+        cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_MASS);
+        cs_real_t  p_mass = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_MASS);
 
-      tslag[iel + (lag_st->itsmas-1) * ncelet] += - p_stat_w * (p_mass - prev_p_mass) / dtp;
+        /* Dans saturne TSmasse > 0 ===> Apport de masse sur le fluide  */
+        cs_lnum_t iel = cs_lagr_particle_get_cell_id(particle, p_am);
+
+        tslag[iel + (lag_st->itsmas-1) * ncelet] += - p_stat_w * (p_mass - prev_p_mass) / dtp;
 
+      }
     }
 
   }
@@ -358,39 +392,49 @@ cs_lagr_coupling(cs_real_t taup[],
     if (   cs_glob_lagr_model->physical_model == 1
         && cs_glob_lagr_specific_physics->itpvar == 1) {
 
-      for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
+#     pragma omp parallel for if (ncel > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < ncel; c_id++) {
+        for (cs_lnum_t j = cell_idx[c_id]; j < cell_idx[c_id+1]; j++) {
 
-        unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
-        cs_lnum_t iel = cs_lagr_particle_get_cell_id(particle, p_am);
-        cs_real_t  p_mass = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_MASS);
-        cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_MASS);
-        cs_real_t  p_cp = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_CP);
-        cs_real_t  prev_p_cp = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_CP);
-        cs_real_t  p_tmp = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_TEMPERATURE);
-        cs_real_t  prev_p_tmp = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_TEMPERATURE);
-        cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
+          cs_lnum_t npt = (p_ids != NULL) ? p_ids[j] : j;
+
+          unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
+          cs_lnum_t iel = cs_lagr_particle_get_cell_id(particle, p_am);
+          cs_real_t  p_mass = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_MASS);
+          cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_MASS);
+          cs_real_t  p_cp = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_CP);
+          cs_real_t  prev_p_cp = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_CP);
+          cs_real_t  p_tmp = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_TEMPERATURE);
+          cs_real_t  prev_p_tmp = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_TEMPERATURE);
+          cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
 
-        tslag[iel + (lag_st->itste-1) * ncelet] += - (p_mass * p_tmp * p_cp
-                                - prev_p_mass * prev_p_tmp * prev_p_cp) / dtp * p_stat_w;
-        tslag[iel + (lag_st->itsti-1) * ncelet] += tempct[nbpart + npt] * p_stat_w;
+          tslag[iel + (lag_st->itste-1) * ncelet] += - (p_mass * p_tmp * p_cp
+                                  - prev_p_mass * prev_p_tmp * prev_p_cp) / dtp * p_stat_w;
+          tslag[iel + (lag_st->itsti-1) * ncelet] += tempct[nbpart + npt] * p_stat_w;
 
+        }
       }
       if (extra->iirayo > 0) {
 
-        for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
+#       pragma omp parallel for if (ncel > CS_THR_MIN)
+        for (cs_lnum_t c_id = 0; c_id < ncel; c_id++) {
+          for (cs_lnum_t j = cell_idx[c_id]; j < cell_idx[c_id+1]; j++) {
 
-          unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
-          cs_lnum_t iel = cs_lagr_particle_get_cell_id(particle, p_am);
-          cs_real_t  p_diam = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_DIAMETER);
-          cs_real_t  p_eps = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_EMISSIVITY);
-          cs_real_t  p_tmp = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_TEMPERATURE);
-          cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
+            cs_lnum_t npt = (p_ids != NULL) ? p_ids[j] : j;
+
+            unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
+            cs_lnum_t iel = cs_lagr_particle_get_cell_id(particle, p_am);
+            cs_real_t  p_diam = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_DIAMETER);
+            cs_real_t  p_eps = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_EMISSIVITY);
+            cs_real_t  p_tmp = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_TEMPERATURE);
+            cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
 
-          cs_real_t aux1 = cs_math_pi * p_diam * p_diam * p_eps
-                          * (extra->luminance->val[iel] - 4.0 * _c_stephan * pow (p_tmp, 4));
+            cs_real_t aux1 = cs_math_pi * p_diam * p_diam * p_eps
+                            * (extra->luminance->val[iel] - 4.0 * _c_stephan * pow (p_tmp, 4));
 
-          tslag[iel + (lag_st->itste-1) * ncelet] += aux1 * p_stat_w;
+            tslag[iel + (lag_st->itste-1) * ncelet] += aux1 * p_stat_w;
 
+          }
         }
 
       }
@@ -403,31 +447,36 @@ cs_lagr_coupling(cs_real_t taup[],
 
       else {
 
-        for (cs_lnum_t npt = 0; npt < nbpart; npt++) {
+#       pragma omp parallel for if (ncel > CS_THR_MIN)
+        for (cs_lnum_t c_id = 0; c_id < ncel; c_id++) {
+          for (cs_lnum_t j = cell_idx[c_id]; j < cell_idx[c_id+1]; j++) {
 
-          unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
+            cs_lnum_t npt = (p_ids != NULL) ? p_ids[j] : j;
 
-          cs_lnum_t iel  = cs_lagr_particle_get_cell_id(particle, p_am);
-          cs_lnum_t icha = cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_COAL_NUM);
+            unsigned char *particle = p_set->p_buffer + p_am->extents * npt;
 
-          cs_real_t  p_mass = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_MASS);
-          cs_real_t  p_tmp = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_TEMPERATURE);
-          cs_real_t  p_cp = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_CP);
+            cs_lnum_t iel  = cs_lagr_particle_get_cell_id(particle, p_am);
+            cs_lnum_t icha = cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_COAL_NUM);
 
-          cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_MASS);
-          cs_real_t  prev_p_tmp  = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_TEMPERATURE);
-          cs_real_t  prev_p_cp   = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_CP);
+            cs_real_t  p_mass = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_MASS);
+            cs_real_t  p_tmp = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_TEMPERATURE);
+            cs_real_t  p_cp = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_CP);
 
-          cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
+            cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_MASS);
+            cs_real_t  prev_p_tmp  = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_TEMPERATURE);
+            cs_real_t  prev_p_cp   = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_CP);
 
-          tslag[iel + (lag_st->itste-1) * ncelet]  += - (  p_mass * p_tmp * p_cp
-                                             - prev_p_mass * prev_p_tmp * prev_p_cp) / dtp * p_stat_w;
-          tslag[iel + (lag_st->itsti-1) * ncelet] += tempct[nbpart + npt] * p_stat_w;
-          tslag[iel + (lag_st->itsmv1[icha]-1) * ncelet] += p_stat_w * cpgd1[npt];
-          tslag[iel + (lag_st->itsmv2[icha]-1) * ncelet] += p_stat_w * cpgd2[npt];
-          tslag[iel + (lag_st->itsco-1) * ncelet] += p_stat_w * cpght[npt];
-          tslag[iel + (lag_st->itsfp4-1) * ncelet] = 0.0;
+            cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
+
+            tslag[iel + (lag_st->itste-1) * ncelet]  += - (  p_mass * p_tmp * p_cp
+                                               - prev_p_mass * prev_p_tmp * prev_p_cp) / dtp * p_stat_w;
+            tslag[iel + (lag_st->itsti-1) * ncelet] += tempct[nbpart + npt] * p_stat_w;
+            tslag[iel + (lag_st->itsmv1[icha]-1) * ncelet] += p_stat_w * cpgd1[npt];
+            tslag[iel + (lag_st->itsmv2[icha]-1) * ncelet] += p_stat_w * cpgd2[npt];
+            tslag[iel + (lag_st->itsco-1) * ncelet] += p_stat_w * cpght[npt];
+            tslag[iel + (lag_st->itsfp4-1) * ncelet] = 0.0;
 
+          }
         }
 
       }
@@ -497,6 +546,8 @@ cs_lagr_coupling(cs_real_t taup[],
   BFT_FREE (auxl1);
   BFT_FREE (auxl2);
   BFT_FREE (auxl3);
+  BFT_FREE (cell_idx);
+  BFT_FREE (p_ids);
   BFT_FREE (tslag);
 }
 
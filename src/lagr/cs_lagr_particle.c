@@ -208,6 +208,10 @@ static cs_lagr_attribute_map_t  *_p_attr_map = NULL;
 static  double              _reallocation_factor = 2.0;
 static  unsigned long long  _n_g_max_particles = ULLONG_MAX;
 
+/* Interval (in time steps) between reorderings of particles by cell */
+
+static  int                 _cell_sort_interval = 0;
+
 /*============================================================================
  * Global variables
  *============================================================================*/
@@ -1033,7 +1037,8 @@ cs_lagr_particle_set_resize(cs_lnum_t  n_min_particles)
     if (_n_g_min_particles > _n_g_max_particles)
       retval = -1;
   }
-  else
+
+  if (retval == 0)
     retval = _particle_set_resize(cs_glob_lagr_particle_set, n_min_particles);
 
   return retval;
@@ -1075,6 +1080,182 @@ cs_lagr_set_n_g_particles_max(unsigned long long  n_g_particles_max)
   _n_g_max_particles = n_g_particles_max;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set interval between reorderings of particles by cell.
+ *
+ * Ordering particles by containing cell improves memory locality
+ * for cell-based data accessed in particle loops, and allows
+ * per-cell loops on particles in statistics and source terms.
+ *
+ * \param[in]  nt_interval  interval (in time steps) between reorderings,
+ *                          or 0 to deactivate reordering
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_set_cell_sort_interval(int  nt_interval)
+{
+  _cell_sort_interval = CS_MAX(nt_interval, 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return interval between reorderings of particles by cell.
+ *
+ * \return  interval (in time steps) between reorderings, or 0 if
+ *          reordering is not active
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_lagr_get_cell_sort_interval(void)
+{
+  return _cell_sort_interval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Reorder particles of a set by containing cell.
+ *
+ * A stable counting sort is used, so the relative order of particles
+ * in a given cell is preserved. Particles are permuted in place, following
+ * permutation cycles, so only one additional particle record is needed.
+ * Particles not located in a cell (cell number 0) are placed last.
+ *
+ * \param[in, out]  particles  associated particle set
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_sort_by_cell(cs_lagr_particle_set_t  *particles)
+{
+  const cs_lnum_t  n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t  n_particles = particles->n_particles;
+  const size_t  extents = particles->p_am->extents;
+
+  cs_lnum_t  *dest, *shift;
+  unsigned char  *tmp;
+
+  BFT_MALLOC(dest, n_particles, cs_lnum_t);
+  BFT_MALLOC(shift, n_cells + 2, cs_lnum_t);
+  BFT_MALLOC(tmp, extents, unsigned char);
+
+  for (cs_lnum_t i = 0; i < n_cells + 2; i++)
+    shift[i] = 0;
+
+  for (cs_lnum_t i = 0; i < n_particles; i++) {
+    cs_lnum_t c_num = cs_lagr_particles_get_lnum(particles, i,
+                                                 CS_LAGR_CELL_NUM);
+    dest[i] = (c_num != 0) ? CS_ABS(c_num) - 1 : n_cells;
+    shift[dest[i] + 1] += 1;
+  }
+
+  for (cs_lnum_t i = 0; i < n_cells + 1; i++)
+    shift[i+1] += shift[i];
+
+  for (cs_lnum_t i = 0; i < n_particles; i++)
+    dest[i] = shift[dest[i]]++;
+
+  BFT_FREE(shift);
+
+  /* Apply permutation in place; each swap moves one particle to
+     its final position */
+
+  for (cs_lnum_t i = 0; i < n_particles; i++) {
+    while (dest[i] != i) {
+      cs_lnum_t j = dest[i];
+      unsigned char *p_i = particles->p_buffer + extents*i;
+      unsigned char *p_j = particles->p_buffer + extents*j;
+      memcpy(tmp, p_j, extents);
+      memcpy(p_j, p_i, extents);
+      memcpy(p_i, tmp, extents);
+      dest[i] = dest[j];
+      dest[j] = j;
+    }
+  }
+
+  BFT_FREE(tmp);
+  BFT_FREE(dest);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build a cell -> particles index for a particle set.
+ *
+ * Particles located in cell c are those with ids
+ * p_ids[cell_idx[c]] to p_ids[cell_idx[c+1] - 1], in increasing order.
+ * If the set is already ordered by cell (see
+ * \ref cs_lagr_particle_set_sort_by_cell), p_ids is not built and is set
+ * to NULL, as particles in cell c are then simply those with ids
+ * cell_idx[c] to cell_idx[c+1] - 1.
+ *
+ * Particles not located in a cell are not referenced by the index.
+ *
+ * The caller is responsible for freeing the returned arrays.
+ *
+ * \param[in]   particles  associated particle set
+ * \param[out]  cell_idx   cell -> particles index (size: n_cells + 1)
+ * \param[out]  p_ids      particle ids, or NULL if set is ordered by cell
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_cell_index(const cs_lagr_particle_set_t   *particles,
+                                cs_lnum_t                     **cell_idx,
+                                cs_lnum_t                     **p_ids)
+{
+  const cs_lnum_t  n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t  n_particles = particles->n_particles;
+
+  cs_lnum_t  *_cell_idx, *_p_ids = NULL;
+
+  BFT_MALLOC(_cell_idx, n_cells + 1, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells + 1; i++)
+    _cell_idx[i] = 0;
+
+  bool is_sorted = true;
+  cs_lnum_t prev_c_id = 0;
+
+  for (cs_lnum_t i = 0; i < n_particles; i++) {
+    cs_lnum_t c_num = cs_lagr_particles_get_lnum(particles, i,
+                                                 CS_LAGR_CELL_NUM);
+    cs_lnum_t c_id = (c_num != 0) ? CS_ABS(c_num) - 1 : n_cells;
+    if (c_id < prev_c_id)
+      is_sorted = false;
+    prev_c_id = c_id;
+    if (c_id < n_cells)
+      _cell_idx[c_id + 1] += 1;
+  }
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    _cell_idx[i+1] += _cell_idx[i];
+
+  if (! is_sorted) {
+
+    cs_lnum_t  *shift;
+    BFT_MALLOC(_p_ids, _cell_idx[n_cells], cs_lnum_t);
+    BFT_MALLOC(shift, n_cells, cs_lnum_t);
+
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      shift[i] = _cell_idx[i];
+
+    for (cs_lnum_t i = 0; i < n_particles; i++) {
+      cs_lnum_t c_num = cs_lagr_particles_get_lnum(particles, i,
+                                                   CS_LAGR_CELL_NUM);
+      if (c_num != 0)
+        _p_ids[shift[CS_ABS(c_num) - 1]++] = i;
+    }
+
+    BFT_FREE(shift);
+
+  }
+
+  *cell_idx = _cell_idx;
+  *p_ids = _p_ids;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Copy current attributes to previous attributes.
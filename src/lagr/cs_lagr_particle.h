@@ -1302,6 +1302,74 @@ cs_lagr_set_reallocation_factor(double f);
 void
 cs_lagr_set_n_g_particles_max(unsigned long long  n_g_particles_max);
 
+/*----------------------------------------------------------------------------
+ * Set interval between reorderings of particles by cell.
+ *
+ * Ordering particles by containing cell improves memory locality
+ * for cell-based data accessed in particle loops, and allows
+ * per-cell loops on particles in statistics and source terms.
+ *
+ * parameters:
+ *   nt_interval <-- interval (in time steps) between reorderings,
+ *                   or 0 to deactivate reordering
+ *----------------------------------------------------------------------------*/
+
+void
+cs_lagr_set_cell_sort_interval(int  nt_interval);
+
+/*----------------------------------------------------------------------------
+ * Return interval between reorderings of particles by cell.
+ *
+ * returns:
+ *   interval (in time steps) between reorderings, or 0 if reordering
+ *   is not active
+ *----------------------------------------------------------------------------*/
+
+int
+cs_lagr_get_cell_sort_interval(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Reorder particles of a set by containing cell.
+ *
+ * A stable counting sort is used, so the relative order of particles
+ * in a given cell is preserved. Particles are permuted in place, following
+ * permutation cycles, so only one additional particle record is needed.
+ * Particles not located in a cell (cell number 0) are placed last.
+ *
+ * \param[in, out]  particles  associated particle set
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_sort_by_cell(cs_lagr_particle_set_t  *particles);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build a cell -> particles index for a particle set.
+ *
+ * Particles located in cell c are those with ids
+ * p_ids[cell_idx[c]] to p_ids[cell_idx[c+1] - 1], in increasing order.
+ * If the set is already ordered by cell (see
+ * \ref cs_lagr_particle_set_sort_by_cell), p_ids is not built and is set
+ * to NULL, as particles in cell c are then simply those with ids
+ * cell_idx[c] to cell_idx[c+1] - 1.
+ *
+ * Particles not located in a cell are not referenced by the index.
+ *
+ * The caller is responsible for freeing the returned arrays.
+ *
+ * \param[in]   particles  associated particle set
+ * \param[out]  cell_idx   cell -> particles index (size: n_cells + 1)
+ * \param[out]  p_ids      particle ids, or NULL if set is ordered by cell
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_cell_index(const cs_lagr_particle_set_t   *particles,
+                                cs_lnum_t                     **cell_idx,
+                                cs_lnum_t                     **p_ids);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Copy current attributes to previous attributes.
@@ -75,6 +75,14 @@
 
 #include "cs_lagr_stat.h"
 
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Minimum number of cells for threaded particle moment updates */
+
+#define CS_THR_MIN 128
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -1796,6 +1804,165 @@ _cs_lagr_stat_update_mesh_moment(cs_lagr_moment_t           *mt,
   BFT_FREE(x);
 }
 
+/*----------------------------------------------------------------------------
+ * Update a particle-based moment with a given particle's contribution.
+ *
+ * parameters:
+ *   mt        <-> pointer to moment
+ *   mwa       <-- pointer to associated weight accumulator
+ *   p_set     <-- pointer to particle set
+ *   part      <-- particle id
+ *   attr_id   <-- associated particle attribute id
+ *   dt_val    <-- time step values
+ *   val       <-> moment values
+ *   mean_val  <-> associated mean values (for variances), or NULL
+ *   l_wa_sum  <-> local weight sum for moment
+ *   pval_w    <-- work array for values (if mt->p_data_func), or NULL
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_particle_moment(cs_lagr_moment_t              *mt,
+                        cs_lagr_moment_wa_t           *mwa,
+                        const cs_lagr_particle_set_t  *p_set,
+                        cs_lnum_t                      part,
+                        int                            attr_id,
+                        const cs_real_t                dt_val[],
+                        cs_real_t            *restrict val,
+                        cs_real_t            *restrict mean_val,
+                        cs_real_t            *restrict l_wa_sum,
+                        cs_real_t                     *pval_w)
+{
+  cs_real_t *pval = pval_w;
+
+  unsigned char *particle
+    = p_set->p_buffer + p_set->p_am->extents * part;
+
+  cs_lnum_t cell_id = cs_lagr_particle_get_cell_id(particle,
+                                                   p_set->p_am);
+
+  int p_class = 0;
+  if (p_set->p_am->displ[0][CS_LAGR_STAT_CLASS] > 0)
+    p_class = cs_lagr_particle_get_lnum(particle,
+                                        p_set->p_am,
+                                        CS_LAGR_STAT_CLASS);
+
+  if (cell_id >= 0 && (p_class == mt->class || mt->class == 0)) {
+
+    /* weight associated to current particle */
+
+    cs_real_t p_weight;
+
+    if (mwa->p_data_func == NULL)
+      p_weight = cs_lagr_particle_get_real(particle,
+                                           p_set->p_am,
+                                           CS_LAGR_STAT_WEIGHT);
+    else
+      mwa->p_data_func(mwa->data_input,
+                       particle,
+                       p_set->p_am,
+                       &p_weight);
+    p_weight *= dt_val[cell_id];
+
+    if (mt->p_data_func == NULL)
+      pval = cs_lagr_particle_attr(particle, p_set->p_am, attr_id);
+    else
+      mt->p_data_func(mt->data_input, particle, p_set->p_am, pval);
+
+    /* update weight sum with new particle weight */
+    const cs_real_t wa_sum_n = p_weight + l_wa_sum[cell_id];
+
+    if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
+
+      if (mt->dim == 6) { /* variance-covariance matrix */
+
+        assert(mt->data_dim == 3);
+
+        double delta[3], delta_n[3], r[3], m_n[3];
+
+        for (int l = 0; l < 3; l++) {
+
+          cs_lnum_t jl = cell_id*6 + l;
+          cs_lnum_t jml = cell_id*3 + l;
+          delta[l]   = pval[l] - mean_val[jml];
+          r[l] = delta[l] * (p_weight / (fmax(wa_sum_n, 1e-100)));
+          m_n[l] = mean_val[jml] + r[l];
+          delta_n[l] = pval[l] - m_n[l];
+          val[jl] = (  val[jl]*l_wa_sum[cell_id]
+                     + p_weight*delta[l]*delta_n[l]) / wa_sum_n;
+
+        }
+
+        /* Covariance terms.
+           Note we could have a symmetric formula using
+           0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
+           instead of
+           delta[i]*delta_n[j]
+           but unit tests in cs_moment_test.c do not seem to favor
+           one variant over the other; we use the simplest one.  */
+
+        cs_lnum_t j3 = cell_id*6 + 3,
+                  j4 = cell_id*6 + 4,
+                  j5 = cell_id*6 + 5;
+
+        val[j3] = (  val[j3]*l_wa_sum[cell_id]
+                   + p_weight*delta[0]*delta_n[1]) / wa_sum_n;
+        val[j4] = (  val[j4]*l_wa_sum[cell_id]
+                   + p_weight*delta[1]*delta_n[2]) / wa_sum_n;
+        val[j5] = (  val[j5]*l_wa_sum[cell_id]
+                   + p_weight*delta[0]*delta_n[2]) / wa_sum_n;
+
+        /* update mean value */
+
+        for (cs_lnum_t l = 0; l < 3; l++)
+          mean_val[cell_id*3 + l] += r[l];
+
+      }
+
+      else { /* simple variance */
+
+        /* new weight for the cell: weight attached to
+           current particle (=dt*weight) plus old weight */
+
+        const cs_lnum_t dim = mt->dim;
+
+        for (cs_lnum_t l = 0; l < dim; l++) {
+
+          double delta = pval[l] - mean_val[cell_id*dim+l];
+          double r = delta * (p_weight / (fmax(wa_sum_n, 1e-100)));
+          double m_n = mean_val[cell_id*dim+l] + r;
+
+          val[cell_id*dim+l]
+            = (  val[cell_id*dim+l]*l_wa_sum[cell_id]
+               + (p_weight*delta*(pval[l]-m_n))) / wa_sum_n;
+
+          /* update mean value */
+
+          mean_val[cell_id*dim+l] += r;
+
+        }
+
+      }
+
+    }
+
+    else if (mt->m_type == CS_LAGR_MOMENT_MEAN) {
+
+      const cs_lnum_t dim = mt->dim;
+
+      for (cs_lnum_t l = 0; l < dim; l++)
+        val[cell_id*dim+l] +=   (pval[l] - val[cell_id*dim+l])
+                              * p_weight / (fmax(wa_sum_n, 1e-100));
+
+    } /* End of test if moment is a variance or a mean */
+
+    /* update local weight associated to current moment and class */
+
+    l_wa_sum[cell_id] += p_weight;
+
+  } /* End of test if particle is in a cell
+       and if particle class corresponds to moment class */
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Update all moment accumulators.
@@ -1808,6 +1975,11 @@ _cs_lagr_stat_update_all(void)
   const cs_time_step_t  *ts = cs_glob_time_step;
   cs_lagr_particle_set_t *p_set = cs_lagr_get_particle_set();
   const cs_real_t *dt_val = _dt_val();
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  /* Particle index by cell, built on first use */
+
+  cs_lnum_t *cell_idx = NULL, *p_ids = NULL;
 
   _t_prev_iter = ts->t_prev;
 
@@ -1916,137 +2088,38 @@ _cs_lagr_stat_update_all(void)
             if (mt->p_data_func != NULL)
               BFT_MALLOC(pval, mt->data_dim, cs_real_t);
 
-            for (cs_lnum_t part = 0; part < p_set->n_particles; part++) {
-
-              unsigned char *particle
-                = p_set->p_buffer + p_set->p_am->extents * part;
-
-              cs_lnum_t cell_id = cs_lagr_particle_get_cell_id(particle,
-                                                               p_set->p_am);
-
-              int p_class = 0;
-              if (p_set->p_am->displ[0][CS_LAGR_STAT_CLASS] > 0)
-                p_class = cs_lagr_particle_get_lnum(particle,
-                                                    p_set->p_am,
-                                                    CS_LAGR_STAT_CLASS);
-
-              if (cell_id >= 0 && (p_class == mt->class || mt->class == 0)) {
-
-                /* weight associated to current particle */
-
-                cs_real_t p_weight;
-
-                if (mwa->p_data_func == NULL)
-                  p_weight = cs_lagr_particle_get_real(particle,
-                                                       p_set->p_am,
-                                                       CS_LAGR_STAT_WEIGHT);
-                else
-                  mwa->p_data_func(mwa->data_input,
-                                   particle,
-                                   p_set->p_am,
-                                   &p_weight);
-                p_weight *= dt_val[cell_id];
-
-                if (mt->p_data_func == NULL)
-                  pval = cs_lagr_particle_attr(particle, p_set->p_am, attr_id);
-                else
-                  mt->p_data_func(mt->data_input, particle, p_set->p_am, pval);
-
-                /* update weight sum with new particle weight */
-                const cs_real_t wa_sum_n = p_weight + l_wa_sum[cell_id];
-
-                if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
-
-                  if (mt->dim == 6) { /* variance-covariance matrix */
-
-                    assert(mt->data_dim == 3);
-
-                    double delta[3], delta_n[3], r[3], m_n[3];
-
-                    for (int l = 0; l < 3; l++) {
+            /* Loop on particles cell by cell; as updates for a given cell
+               only depend on particles in that cell, cells may be handled
+               in parallel (unless user data functions are used) */
 
-                      cs_lnum_t jl = cell_id*6 + l;
-                      cs_lnum_t jml = cell_id*3 + l;
-                      delta[l]   = pval[l] - mean_val[jml];
-                      r[l] = delta[l] * (p_weight / (fmax(wa_sum_n, 1e-100)));
-                      m_n[l] = mean_val[jml] + r[l];
-                      delta_n[l] = pval[l] - m_n[l];
-                      val[jl] = (  val[jl]*l_wa_sum[cell_id]
-                                 + p_weight*delta[l]*delta_n[l]) / wa_sum_n;
+            if (cell_idx == NULL)
+              cs_lagr_particle_set_cell_index(p_set, &cell_idx, &p_ids);
 
-                    }
-
-                    /* Covariance terms.
-                       Note we could have a symmetric formula using
-                       0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
-                       instead of
-                       delta[i]*delta_n[j]
-                       but unit tests in cs_moment_test.c do not seem to favor
-                       one variant over the other; we use the simplest one.  */
-
-                    cs_lnum_t j3 = cell_id*6 + 3,
-                              j4 = cell_id*6 + 4,
-                              j5 = cell_id*6 + 5;
-
-                    val[j3] = (  val[j3]*l_wa_sum[cell_id]
-                               + p_weight*delta[0]*delta_n[1]) / wa_sum_n;
-                    val[j4] = (  val[j4]*l_wa_sum[cell_id]
-                               + p_weight*delta[1]*delta_n[2]) / wa_sum_n;
-                    val[j5] = (  val[j5]*l_wa_sum[cell_id]
-                               + p_weight*delta[0]*delta_n[2]) / wa_sum_n;
-
-                    /* update mean value */
-
-                    for (cs_lnum_t l = 0; l < 3; l++)
-                      mean_val[cell_id*3 + l] += r[l];
-
-                  }
-
-                  else { /* simple variance */
-
-                    /* new weight for the cell: weight attached to
-                       current particle (=dt*weight) plus old weight */
-
-                    const cs_lnum_t dim = mt->dim;
-
-                    for (cs_lnum_t l = 0; l < dim; l++) {
-
-                      double delta = pval[l] - mean_val[cell_id*dim+l];
-                      double r = delta * (p_weight / (fmax(wa_sum_n, 1e-100)));
-                      double m_n = mean_val[cell_id*dim+l] + r;
-
-                      val[cell_id*dim+l]
-                        = (  val[cell_id*dim+l]*l_wa_sum[cell_id]
-                           + (p_weight*delta*(pval[l]-m_n))) / wa_sum_n;
-
-                      /* update mean value */
-
-                      mean_val[cell_id*dim+l] += r;
-
-                    }
-
-                  }
+            if (mt->p_data_func == NULL && mwa->p_data_func == NULL) {
 
+#             pragma omp parallel for if (n_cells > CS_THR_MIN)
+              for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+                for (cs_lnum_t j = cell_idx[c_id]; j < cell_idx[c_id+1]; j++) {
+                  cs_lnum_t part = (p_ids != NULL) ? p_ids[j] : j;
+                  _update_particle_moment(mt, mwa, p_set, part, attr_id,
+                                          dt_val, val, mean_val, l_wa_sum,
+                                          NULL);
                 }
+              }
 
-                else if (mt->m_type == CS_LAGR_MOMENT_MEAN) {
-
-                  const cs_lnum_t dim = mt->dim;
-
-                  for (cs_lnum_t l = 0; l < dim; l++)
-                    val[cell_id*dim+l] +=   (pval[l] - val[cell_id*dim+l])
-                                          * p_weight / (fmax(wa_sum_n, 1e-100));
-
-                } /* End of test if moment is a variance or a mean */
-
-                /* update local weight associated to current moment and class */
-
-                l_wa_sum[cell_id] += p_weight;
+            }
+            else {
 
-              } /* End of test if particle is in a cell
-                   and if particle class corresponds to moment class */
+              for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+                for (cs_lnum_t j = cell_idx[c_id]; j < cell_idx[c_id+1]; j++) {
+                  cs_lnum_t part = (p_ids != NULL) ? p_ids[j] : j;
+                  _update_particle_moment(mt, mwa, p_set, part, attr_id,
+                                          dt_val, val, mean_val, l_wa_sum,
+                                          pval);
+                }
+              }
 
-            } /* end of loop on particles */
+            }
 
             if (mt->p_data_func != NULL)
               BFT_FREE(pval);
@@ -2086,6 +2159,9 @@ _cs_lagr_stat_update_all(void)
     }
 
   } /* End of loop on active weigh accumulators */
+
+  BFT_FREE(cell_idx);
+  BFT_FREE(p_ids);
 }
 
 
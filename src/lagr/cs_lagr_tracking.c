@@ -62,6 +62,7 @@
 #include "cs_order.h"
 #include "cs_parall.h"
 #include "cs_prototypes.h"
+#include "cs_rank_neighbors.h"
 #include "cs_search.h"
 #include "cs_timer_stats.h"
 
@@ -96,6 +97,10 @@ BEGIN_C_DECLS
 #define  N_GEOL 13
 #define  CS_LAGR_MIN_COMM_BUF_SIZE  8
 
+/* Minimum number of particles for threaded tracking */
+
+#define  CS_THR_MIN 128
+
 /*=============================================================================
  * Local Enumeration definitions
  *============================================================================*/
@@ -204,25 +209,41 @@ typedef struct {
   /* Buffer used to exchange particle between communicating ranks */
 
   size_t      send_buf_size;  /* Current maximum send buffer size */
+  size_t      recv_buf_size;  /* Current maximum receive buffer size */
   size_t      extents;        /* Extents for particle set */
 
   cs_lnum_t  *send_count;     /* number of particles to send to
                                  each communicating rank */
-  cs_lnum_t  *recv_count;     /* number of particles to receive from
-                                 each communicating rank */
 
   cs_lnum_t  *send_shift;
-  cs_lnum_t  *recv_shift;
 
   unsigned char  *send_buf;
+  unsigned char  *recv_buf;   /* received particles, before they are
+                                 appended to the particle set */
 
 #if defined(HAVE_MPI)
+  cs_rank_neighbors_t  *rn;   /* distant neighbor ranks (symmetric) */
+  int        *rn_halo_id;     /* matching communicating rank id in halo
+                                 for each neighbor rank, or -1 */
+
   MPI_Request  *request;
   MPI_Status   *status;
 #endif
 
 } cs_lagr_halo_t;
 
+/* Cached geometry of a face sub-triangle, defined by the face center
+   of gravity G and face vertices v_i and v_i+1 */
+/*---------------------------------------------------------------------*/
+
+typedef struct {
+
+  cs_real_t  vtx[3];          /* coordinates of vertex v_i */
+  cs_real_t  pvec[3];         /* (v_i+1 - G) ^ (v_i - G) */
+  int        reorient_edge;   /* 1 if v_i id < v_i+1 id, -1 otherwise */
+
+} cs_lagr_face_tri_t;
+
 /* Structures useful to build and manage the Lagrangian computation:
    - exchanging of particles between communicating ranks
    - finding the next cells where the particle moves on to
@@ -236,12 +257,38 @@ typedef struct {
   cs_lnum_t  *cell_face_idx;
   cs_lnum_t  *cell_face_lst;
 
+  /* Face geometry cache for intersection tests; interior faces
+     are numbered first, followed by boundary faces */
+
+  cs_lnum_t           *face_tri_idx;  /* sub-triangles index per face */
+  cs_real_3_t         *face_cog;      /* face centers of gravity */
+  cs_lagr_face_tri_t  *face_tri;      /* sub-triangles geometry */
+
   cs_lagr_halo_t    *halo;   /* Lagrangian halo structure */
 
   cs_interface_set_t  *face_ifs;
 
 } cs_lagr_track_builder_t;
 
+/* Accumulators for quantities updated by particles during tracking;
+   when tracking is threaded, each thread uses its own accumulators,
+   which are merged once all particles have been handled */
+
+typedef struct {
+
+  cs_lnum_t   n_part_dep;          /* number of deposited particles */
+  cs_lnum_t   n_part_fou;          /* number of fouled particles */
+
+  cs_real_t   weight_dep;          /* weight of deposited particles */
+  cs_real_t   weight_fou;          /* weight of fouled particles */
+
+  cs_real_t  *particle_flow_rate;  /* particle mass flow rate per
+                                      boundary zone */
+  cs_real_t  *b_stat;              /* boundary statistics (same layout
+                                      as bound_stat) */
+
+} cs_lagr_tracking_acc_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -561,22 +608,55 @@ _create_lagr_halo(size_t  extents)
 
   BFT_MALLOC(lagr_halo->send_shift, halo->n_c_domains, cs_lnum_t);
   BFT_MALLOC(lagr_halo->send_count, halo->n_c_domains, cs_lnum_t);
-  BFT_MALLOC(lagr_halo->recv_shift, halo->n_c_domains, cs_lnum_t);
-  BFT_MALLOC(lagr_halo->recv_count, halo->n_c_domains, cs_lnum_t);
 
   lagr_halo->send_buf_size = CS_LAGR_MIN_COMM_BUF_SIZE;
+  lagr_halo->recv_buf_size = CS_LAGR_MIN_COMM_BUF_SIZE;
 
   BFT_MALLOC(lagr_halo->send_buf,
              lagr_halo->send_buf_size * extents,
              unsigned char);
+  BFT_MALLOC(lagr_halo->recv_buf,
+             lagr_halo->recv_buf_size * extents,
+             unsigned char);
 
 #if defined(HAVE_MPI)
   if (cs_glob_n_ranks > 1) {
 
-    cs_lnum_t  request_size = 2 * halo->n_c_domains;
+    /* Neighbor ranks are those of the halo, excluding the local rank
+       (for periodicity); the neighborhood is symmetrized so that
+       each rank expects exactly one message from each neighbor */
+
+    int  n_d_ranks = 0;
+    int  *d_rank;
+
+    BFT_MALLOC(d_rank, halo->n_c_domains, int);
+
+    for (rank = 0; rank < halo->n_c_domains; rank++) {
+      if (halo->c_domain_rank[rank] != cs_glob_rank_id)
+        d_rank[n_d_ranks++] = halo->c_domain_rank[rank];
+    }
+
+    lagr_halo->rn = cs_rank_neighbors_create(n_d_ranks, d_rank);
+    cs_rank_neighbors_symmetrize(lagr_halo->rn, cs_glob_mpi_comm);
+
+    const int  rn_size = lagr_halo->rn->size;
+
+    BFT_MALLOC(lagr_halo->rn_halo_id, rn_size, int);
+    for (i = 0; i < rn_size; i++)
+      lagr_halo->rn_halo_id[i] = -1;
+
+    cs_rank_neighbors_to_index(lagr_halo->rn, n_d_ranks, d_rank, d_rank);
+
+    n_d_ranks = 0;
+    for (rank = 0; rank < halo->n_c_domains; rank++) {
+      if (halo->c_domain_rank[rank] != cs_glob_rank_id)
+        lagr_halo->rn_halo_id[d_rank[n_d_ranks++]] = rank;
+    }
+
+    BFT_FREE(d_rank);
 
-    BFT_MALLOC(lagr_halo->request, request_size, MPI_Request);
-    BFT_MALLOC(lagr_halo->status,  request_size, MPI_Status);
+    BFT_MALLOC(lagr_halo->request, rn_size, MPI_Request);
+    BFT_MALLOC(lagr_halo->status,  rn_size, MPI_Status);
 
   }
 #endif
@@ -672,17 +752,18 @@ _delete_lagr_halo(cs_lagr_halo_t   **halo)
 
     BFT_FREE(h->send_shift);
     BFT_FREE(h->send_count);
-    BFT_FREE(h->recv_shift);
-    BFT_FREE(h->recv_count);
 
 #if defined(HAVE_MPI)
     if (cs_glob_n_ranks > 1) {
+      cs_rank_neighbors_destroy(&(h->rn));
+      BFT_FREE(h->rn_halo_id);
       BFT_FREE(h->request);
       BFT_FREE(h->status);
     }
 #endif
 
     BFT_FREE(h->send_buf);
+    BFT_FREE(h->recv_buf);
 
     BFT_FREE(*halo);
   }
@@ -728,6 +809,32 @@ _resize_lagr_halo(cs_lagr_halo_t  *lag_halo,
   /* Otherwise, keep current size */
 }
 
+/*----------------------------------------------------------------------------
+ * Ensure a halo's receive buffer is large enough.
+ *
+ * Contents of the buffer are preserved.
+ *
+ * parameters:
+ *   lag_halo         <->  pointer to a cs_lagr_halo_t structure
+ *   n_recv_particles <-- number of particles to receive
+ *----------------------------------------------------------------------------*/
+
+static void
+_reserve_lagr_halo_recv(cs_lagr_halo_t  *lag_halo,
+                        cs_lnum_t        n_recv_particles)
+{
+  size_t n_halo = lag_halo->recv_buf_size;
+
+  if (n_halo < (size_t)n_recv_particles) {
+    while (n_halo < (size_t)n_recv_particles)
+      n_halo *= 2;
+    lag_halo->recv_buf_size = n_halo;
+    BFT_REALLOC(lag_halo->recv_buf,
+                n_halo*lag_halo->extents,
+                unsigned char);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Define a cell -> face connectivity. Index begins with 0.
  *
@@ -809,6 +916,102 @@ _define_cell_face_connect(cs_lagr_track_builder_t   *builder)
   BFT_FREE(counter);
 }
 
+/*----------------------------------------------------------------------------
+ * Define or update the face geometry cache used for intersection tests.
+ *
+ * Each face is split into sub-triangles joining its center of gravity
+ * to each of its edges, whose geometry is computed once here rather
+ * than for each face crossing test.
+ *
+ * parameters:
+ *   builder   <->  pointer to a cs_lagr_track_builder_t structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_face_geom_cache(cs_lagr_track_builder_t   *builder)
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t  n_i_faces = mesh->n_i_faces;
+  const cs_lnum_t  n_faces = mesh->n_i_faces + mesh->n_b_faces;
+
+  /* Build index (unchanged with mesh motion) */
+
+  if (builder->face_tri_idx == NULL) {
+
+    BFT_MALLOC(builder->face_tri_idx, n_faces + 1, cs_lnum_t);
+
+    cs_lnum_t *face_tri_idx = builder->face_tri_idx;
+
+    face_tri_idx[0] = 0;
+    for (cs_lnum_t i = 0; i < n_i_faces; i++)
+      face_tri_idx[i+1] =   face_tri_idx[i]
+                          + mesh->i_face_vtx_idx[i+1] - mesh->i_face_vtx_idx[i];
+    for (cs_lnum_t i = 0; i < mesh->n_b_faces; i++)
+      face_tri_idx[n_i_faces+i+1] =   face_tri_idx[n_i_faces+i]
+                                    + mesh->b_face_vtx_idx[i+1]
+                                    - mesh->b_face_vtx_idx[i];
+
+    BFT_MALLOC(builder->face_cog, n_faces, cs_real_3_t);
+    BFT_MALLOC(builder->face_tri, face_tri_idx[n_faces], cs_lagr_face_tri_t);
+
+  }
+
+  const cs_lnum_t  *face_tri_idx = builder->face_tri_idx;
+  cs_real_3_t  *face_cog = builder->face_cog;
+  cs_lagr_face_tri_t  *face_tri = builder->face_tri;
+
+#   pragma omp parallel for if (n_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+
+    const cs_real_t  *cog;
+    const cs_lnum_t  *face_connect;
+
+    if (f_id < n_i_faces) {
+      cog = fvq->i_face_cog + 3*f_id;
+      face_connect = mesh->i_face_vtx_lst + mesh->i_face_vtx_idx[f_id];
+    }
+    else {
+      cs_lnum_t  b_f_id = f_id - n_i_faces;
+      cog = fvq->b_face_cog + 3*b_f_id;
+      face_connect = mesh->b_face_vtx_lst + mesh->b_face_vtx_idx[b_f_id];
+    }
+
+    for (int j = 0; j < 3; j++)
+      face_cog[f_id][j] = cog[j];
+
+    const cs_lnum_t  n_vertices = face_tri_idx[f_id+1] - face_tri_idx[f_id];
+    cs_lagr_face_tri_t  *tri = face_tri + face_tri_idx[f_id];
+
+    for (cs_lnum_t i = 0; i < n_vertices; i++) {
+
+      cs_lnum_t  vtx_id_0 = face_connect[i];
+      cs_lnum_t  vtx_id_1 = face_connect[(i+1)%n_vertices];
+
+      const cs_real_t  *vtx_0 = mesh->vtx_coord + (3 * vtx_id_0);
+      const cs_real_t  *vtx_1 = mesh->vtx_coord + (3 * vtx_id_1);
+
+      cs_real_3_t  e0, e1;
+      for (int j = 0; j < 3; j++) {
+        e0[j] = vtx_0[j] - cog[j];
+        e1[j] = vtx_1[j] - cog[j];
+        tri[i].vtx[j] = vtx_0[j];
+      }
+
+      /* P = e1^e0 */
+
+      tri[i].pvec[0] = e1[1]*e0[2] - e1[2]*e0[1];
+      tri[i].pvec[1] = e1[2]*e0[0] - e1[0]*e0[2];
+      tri[i].pvec[2] = e1[0]*e0[1] - e1[1]*e0[0];
+
+      tri[i].reorient_edge = (vtx_id_0 < vtx_id_1 ? 1 : -1);
+
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Initialize a cs_lagr_track_builder_t structure.
  *
@@ -837,6 +1040,14 @@ _init_track_builder(cs_lnum_t  n_particles_max,
 
   _define_cell_face_connect(builder);
 
+  /* Define the face geometry cache */
+
+  builder->face_tri_idx = NULL;
+  builder->face_cog = NULL;
+  builder->face_tri = NULL;
+
+  _define_face_geom_cache(builder);
+
   /* Define a cs_lagr_halo_t structure to deal with parallelism and
      periodicity */
 
@@ -888,6 +1099,10 @@ _destroy_track_builder(cs_lagr_track_builder_t  *builder)
   BFT_FREE(builder->cell_face_idx);
   BFT_FREE(builder->cell_face_lst);
 
+  BFT_FREE(builder->face_tri_idx);
+  BFT_FREE(builder->face_cog);
+  BFT_FREE(builder->face_tri);
+
   /* Destroy the cs_lagr_halo_t structure */
 
   _delete_lagr_halo(&(builder->halo));
@@ -938,19 +1153,22 @@ _manage_error(cs_lnum_t                       failsafe_mode,
 /*----------------------------------------------------------------------------
  * Test if all displacements are finished for all ranks.
  *
+ * parameters:
+ *   p_start <-- id of first particle which may need to be moved
+ *
  * returns:
  *   true if there is a need to move particles or false, otherwise
  *----------------------------------------------------------------------------*/
 
 static bool
-_continue_displacement(void)
+_continue_displacement(cs_lnum_t  p_start)
 {
   int test = 0;
 
   const cs_lagr_particle_set_t  *set = cs_glob_lagr_particle_set;
   const cs_lnum_t  n_particles = set->n_particles;
 
-  for (cs_lnum_t i = 0; i < n_particles; i++) {
+  for (cs_lnum_t i = p_start; i < n_particles; i++) {
     if (_get_tracking_info(set, i)->state == CS_LAGR_PART_TO_SYNC) {
       test = 1;
       break;
@@ -978,9 +1196,11 @@ _continue_displacement(void)
  *                           Face number
  *
  * parameters:
+ *   builder       <-- pointer to tracking builder (with geometry cache)
  *   face_num      <-- local number of the studied face
- *   n_vertices    <-- size of the face connectivity
- *   face_connect  <-- face -> vertex connectivity
+ *   reorient_face <-- 1 if face normal is outward, -1 otherwise
+ *   n_in          <-> number of inward crossings of sub-triangles planes
+ *   n_out         <-> number of outward crossings of sub-triangles planes
  *   particle      <-- particle attributes
  *   p_am          <-- pointer to attributes map
  *
@@ -991,16 +1211,15 @@ _continue_displacement(void)
  *----------------------------------------------------------------------------*/
 
 static double
-_intersect_face(cs_lnum_t                       face_num,
-                cs_lnum_t                       n_vertices,
+_intersect_face(const cs_lagr_track_builder_t  *builder,
+                cs_lnum_t                       face_num,
                 int                             reorient_face,
                 int                            *n_in,
                 int                            *n_out,
-                const cs_lnum_t                 face_connect[],
                 const void                     *particle,
                 const cs_lagr_attribute_map_t  *p_am)
 {
-  const cs_real_t  *face_cog;
+  cs_lnum_t  f_id;
 
   cs_lnum_t  cur_cell_id
     = cs_lagr_particle_get_cell_id(particle, p_am);
@@ -1009,7 +1228,6 @@ _intersect_face(cs_lnum_t                       face_num,
   const cs_real_t  *prev_location
     = ((const cs_lagr_tracking_info_t *)particle)->start_coords;
 
-  cs_mesh_t  *mesh = cs_glob_mesh;
   const cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
 
   const double epsilon = 1.e-15;
@@ -1021,18 +1239,17 @@ _intersect_face(cs_lnum_t                       face_num,
 
   /* Initialization */
 
-  if (face_num > 0) { /* Interior  face */
-
-    cs_lnum_t  face_id = face_num - 1;
-    face_cog = fvq->i_face_cog + (3*face_id);
+  if (face_num > 0) /* Interior  face */
+    f_id = face_num - 1;
+  else /* Boundary face */
+    f_id = cs_glob_mesh->n_i_faces - face_num - 1;
 
-  }
-  else { /* Boundary face */
-
-    cs_lnum_t  face_id = -face_num - 1;
-    face_cog = fvq->b_face_cog + (3*face_id);
+  const cs_real_t  *face_cog = builder->face_cog[f_id];
 
-  }
+  const cs_lnum_t  n_vertices
+    = builder->face_tri_idx[f_id+1] - builder->face_tri_idx[f_id];
+  const cs_lagr_face_tri_t  *face_tri
+    = builder->face_tri + builder->face_tri_idx[f_id];
 
   cs_real_3_t disp = {next_location[0] - prev_location[0],
                       next_location[1] - prev_location[1],
@@ -1071,13 +1288,11 @@ _intersect_face(cs_lnum_t                       face_num,
    *        e1
    */
 
-  /* Initialization of triangle points and edges (vectors)*/
-  cs_real_3_t  e0, e1;
+  /* Initialization of triangle points (sub-triangle geometry is cached) */
   int pi, pip1, p0;
 
   /* 1st vertex: vector e0, p0 = e0 ^ GO  */
-  cs_lnum_t vtx_id_0 = face_connect[0];
-  cs_real_t *vtx_0 = mesh->vtx_coord + (3*vtx_id_0);
+  const cs_real_t *vtx_0 = face_tri[0].vtx;
 
   p0 = _test_edge(prev_location, next_location, face_cog, vtx_0);
   pi = p0;
@@ -1086,22 +1301,12 @@ _intersect_face(cs_lnum_t                       face_num,
   /* Loop on vertices of the face */
   for (cs_lnum_t i = 0; i < n_vertices; i++) {
 
-    vtx_id_0 = face_connect[i];
-    cs_lnum_t vtx_id_1 = face_connect[(i+1)%n_vertices];
-
-    vtx_0 = mesh->vtx_coord + (3 * vtx_id_0);
-    cs_real_t *vtx_1 = mesh->vtx_coord + (3 * vtx_id_1);
-    for (int j = 0; j < 3; j++) {
-      e0[j] = vtx_0[j] - face_cog[j];
-      e1[j] = vtx_1[j] - face_cog[j];
-
-    }
+    vtx_0 = face_tri[i].vtx;
+    const cs_real_t *vtx_1 = face_tri[(i+1)%n_vertices].vtx;
 
     /* P = e1^e0 */
 
-    const cs_real_3_t pvec = {e1[1]*e0[2] - e1[2]*e0[1],
-                              e1[2]*e0[0] - e1[0]*e0[2],
-                              e1[0]*e0[1] - e1[1]*e0[0]};
+    const cs_real_t *pvec = face_tri[i].pvec;
 
     double det = cs_math_3_dot_product(disp, pvec);
 
@@ -1131,18 +1336,15 @@ _intersect_face(cs_lnum_t                       face_num,
     /* 3rd edge: vector e_out */
 
     /* Check the orientation of the edge */
-    int reorient_edge = (vtx_id_0 < vtx_id_1 ? 1 : -1);
+    int reorient_edge = face_tri[i].reorient_edge;
 
     /* Sort the vertices of the edges so that it is easier to find it after */
-    cs_lnum_2_t edge_id = {vtx_id_0, vtx_id_1};
     if (reorient_edge == -1) {
-      edge_id[0] = vtx_id_1;
-      edge_id[1] = vtx_id_0;
+      const cs_real_t *vtx_tmp = vtx_0;
+      vtx_0 = vtx_1;
+      vtx_1 = vtx_tmp;
     }
 
-    vtx_0 = mesh->vtx_coord + (3*edge_id[0]);
-    vtx_1 = mesh->vtx_coord + (3*edge_id[1]);
-
     int w_sign = _test_edge(prev_location, next_location, vtx_0, vtx_1)
                  * reorient_edge * sign_det;
 
@@ -1350,6 +1552,7 @@ _b_mass_contribution(const cs_lagr_particle_set_t   *particles,
  *   t_intersect     <-- used to compute the intersection of the trajectory and
  *                       the face
  *   p_move_particle <-- particle moves?
+ *   acc             <-> pointer to tracking accumulators
  *
  * returns:
  *   particle state
@@ -1360,7 +1563,8 @@ _internal_treatment(cs_lagr_particle_set_t    *particles,
                     void                      *particle,
                     cs_lnum_t                  face_id,
                     double                     t_intersect,
-                    cs_lnum_t                 *p_move_particle)
+                    cs_lnum_t                 *p_move_particle,
+                    cs_lagr_tracking_acc_t    *acc)
 {
   const cs_mesh_t  *mesh = cs_glob_mesh;
   const cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
@@ -1497,8 +1701,8 @@ _internal_treatment(cs_lagr_particle_set_t    *particles,
 
       }
 
-      particles->n_part_dep += 1;
-      particles->weight_dep += particle_stat_weight;
+      acc->n_part_dep += 1;
+      acc->weight_dep += particle_stat_weight;
       // FIXME: particle_state = CS_LAGR_PART_TREATED;
 
     }
@@ -1545,6 +1749,7 @@ _internal_treatment(cs_lagr_particle_set_t    *particles,
  *   particles  <-- pointer to particle set
  *   particle   <-> particle data for current particle
  *   ...        <-> pointer to an error indicator
+ *   acc        <-> pointer to tracking accumulators
  *
  * returns:
  *   particle state
@@ -1557,7 +1762,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
                     double                     t_intersect,
                     cs_lnum_t                  boundary_zone,
                     cs_lnum_t                 *p_move_particle,
-                    cs_real_t                  tkelvi)
+                    cs_real_t                  tkelvi,
+                    cs_lagr_tracking_acc_t    *acc)
 {
   const cs_mesh_t  *mesh = cs_glob_mesh;
   const double pi = 4 * atan(1);
@@ -1647,14 +1853,14 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
     particle_state = CS_LAGR_PART_OUT;
 
     if (bdy_conditions->b_zone_natures[boundary_zone] == CS_LAGR_DEPO1) {
-      particles->n_part_dep += 1;
-      particles->weight_dep += particle_stat_weight;
+      acc->n_part_dep += 1;
+      acc->weight_dep += particle_stat_weight;
       if (cs_glob_lagr_model->deposition == 1)
         cs_lagr_particle_set_lnum(particle, p_am, CS_LAGR_DEPOSITION_FLAG,
                                   CS_LAGR_PART_DEPOSITED);
     }
 
-    bdy_conditions->particle_flow_rate[boundary_zone]
+    acc->particle_flow_rate[boundary_zone]
       -= particle_stat_weight * particle_mass;
 
     /* FIXME: For post-processing by trajectory purpose */
@@ -1678,8 +1884,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
       particle_coord[k] = intersect_pt[k] + bc_epsilon * vect_cen[k];
     }
 
-    particles->n_part_dep += 1;
-    particles->weight_dep += particle_stat_weight;
+    acc->n_part_dep += 1;
+    acc->weight_dep += particle_stat_weight;
 
     /* Specific treatment in case of particle resuspension modeling */
 
@@ -1731,11 +1937,11 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
       /* computation of the number of particles in contact with */
       /* the depositing particle                                */
 
-      surface_coverage = &bound_stat[cs_glob_lagr_boundary_interactions->iscovc * n_b_faces + face_id];
-      deposit_height_mean = &bound_stat[cs_glob_lagr_boundary_interactions->ihdepm * n_b_faces + face_id];
-      deposit_height_var = &bound_stat[cs_glob_lagr_boundary_interactions->ihdepv * n_b_faces + face_id];
+      surface_coverage = &acc->b_stat[cs_glob_lagr_boundary_interactions->iscovc * n_b_faces + face_id];
+      deposit_height_mean = &acc->b_stat[cs_glob_lagr_boundary_interactions->ihdepm * n_b_faces + face_id];
+      deposit_height_var = &acc->b_stat[cs_glob_lagr_boundary_interactions->ihdepv * n_b_faces + face_id];
 
-      deposit_diameter_sum = &bound_stat[cs_glob_lagr_boundary_interactions->ihsum * n_b_faces + face_id];
+      deposit_diameter_sum = &acc->b_stat[cs_glob_lagr_boundary_interactions->ihsum * n_b_faces + face_id];
 
       contact_number = cs_lagr_clogging_barrier(particle,
                                                 p_am,
@@ -1789,8 +1995,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
           (particle, p_am, CS_LAGR_CELL_NUM,
            - cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_CELL_NUM));
 
-        particles->n_part_dep += 1;
-        particles->weight_dep += particle_stat_weight;
+        acc->n_part_dep += 1;
+        acc->weight_dep += particle_stat_weight;
 
         particle_state = CS_LAGR_PART_STUCK;
       }
@@ -1811,15 +2017,15 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
           particle_velocity[k] = 0.0;
           particle_coord[k] = intersect_pt[k] + bc_epsilon * vect_cen[k];
         }
-        particles->n_part_dep += 1;
-        particles->weight_dep += particle_stat_weight;
+        acc->n_part_dep += 1;
+        acc->weight_dep += particle_stat_weight;
         particle_state = CS_LAGR_PART_TREATED;
 
       }
 
       if (cs_glob_lagr_model->clogging) {
 
-        bound_stat[cs_glob_lagr_boundary_interactions->inclgt
+        acc->b_stat[cs_glob_lagr_boundary_interactions->inclgt
                    * n_b_faces + face_id] += particle_stat_weight;
         *deposit_diameter_sum += particle_diameter;
 
@@ -1841,7 +2047,7 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
           *deposit_height_var +=   pow(particle_height * pi / face_area, 2)
                                  * pow(depositing_radius,4);
 
-          bound_stat[cs_glob_lagr_boundary_interactions->inclg
+          acc->b_stat[cs_glob_lagr_boundary_interactions->inclg
                      * n_b_faces + face_id] += particle_stat_weight;
 
           /* The particle is replaced towards the cell center
@@ -1862,8 +2068,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
           cs_lagr_particle_set_lnum(particle, p_am,CS_LAGR_NEIGHBOR_FACE_ID ,
                                     face_id);
 
-          particles->n_part_dep += 1;
-          particles->weight_dep += particle_stat_weight;
+          acc->n_part_dep += 1;
+          acc->weight_dep += particle_stat_weight;
           particle_state = CS_LAGR_PART_TREATED;
         }
         else {
@@ -2000,8 +2206,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
 
           move_particle = CS_LAGR_PART_MOVE_OFF;
           particle_state = CS_LAGR_PART_OUT;
-          particles->n_part_dep += 1;
-          particles->weight_dep += particle_stat_weight;
+          acc->n_part_dep += 1;
+          acc->weight_dep += particle_stat_weight;
 
           cur_part_height   = cs_lagr_particle_get_real(cur_part, p_am,
                                                         CS_LAGR_HEIGHT);
@@ -2200,22 +2406,22 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
         particle_state = CS_LAGR_PART_OUT;
 
         /* Recording for listing/listla*/
-        particles->n_part_fou += 1;
-        particles->weight_fou += particle_stat_weight;
+        acc->n_part_fou += 1;
+        acc->weight_fou += particle_stat_weight;
 
         /* Recording for statistics*/
         if (cs_glob_lagr_boundary_interactions->iencnbbd > 0) {
-          bound_stat[  cs_glob_lagr_boundary_interactions->iencnb
+          acc->b_stat[  cs_glob_lagr_boundary_interactions->iencnb
                      * n_b_faces + face_id]
             += particle_stat_weight;
         }
         if (cs_glob_lagr_boundary_interactions->iencmabd > 0) {
-          bound_stat[  cs_glob_lagr_boundary_interactions->iencma
+          acc->b_stat[  cs_glob_lagr_boundary_interactions->iencma
                      * n_b_faces + face_id]
             += particle_stat_weight * particle_mass / face_area;
         }
         if (cs_glob_lagr_boundary_interactions->iencdibd > 0) {
-          bound_stat[  cs_glob_lagr_boundary_interactions->iencdi
+          acc->b_stat[  cs_glob_lagr_boundary_interactions->iencdi
                      * n_b_faces + face_id]
             +=   particle_stat_weight
                * cs_lagr_particle_get_real(particle, p_am,
@@ -2230,7 +2436,7 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
               = cs_lagr_particle_attr_const(particle, p_am,
                                             CS_LAGR_COKE_MASS);
             for (k = 0; k < n_layers; k++) {
-              bound_stat[  cs_glob_lagr_boundary_interactions->iencck
+              acc->b_stat[  cs_glob_lagr_boundary_interactions->iencck
                          * n_b_faces + face_id]
                 +=   particle_stat_weight
                    * (particle_coal_mass[k] + particle_coke_mass[k])
@@ -2335,25 +2541,31 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
 
       /* Number of particle-boundary interactions  */
       if (cs_glob_lagr_boundary_interactions->inbrbd > 0)
-        bound_stat[cs_glob_lagr_boundary_interactions->inbr * n_b_faces + face_id]
+        acc->b_stat[cs_glob_lagr_boundary_interactions->inbr * n_b_faces + face_id]
           += particle_stat_weight;
 
       /* Particle impact angle and velocity*/
       if (cs_glob_lagr_boundary_interactions->iangbd > 0) {
         cs_real_t imp_ang = acos(cs_math_3_dot_product(compo_vel, face_normal)
                                  / (face_area * norm_vel));
-        bound_stat[cs_glob_lagr_boundary_interactions->iang * n_b_faces + face_id]
+        acc->b_stat[cs_glob_lagr_boundary_interactions->iang * n_b_faces + face_id]
           += imp_ang * particle_stat_weight;
       }
 
       if (cs_glob_lagr_boundary_interactions->ivitbd > 0)
-        bound_stat[cs_glob_lagr_boundary_interactions->ivit * n_b_faces + face_id]
+        acc->b_stat[cs_glob_lagr_boundary_interactions->ivit * n_b_faces + face_id]
           += norm_vel * particle_stat_weight;
 
-      /* User statistics management. By defaut, set to zero */
+      /* User statistics management. By defaut, set to zero
+         (directly in the global array, as this is not an accumulation) */
       if (cs_glob_lagr_boundary_interactions->nusbor > 0)
-        for (int n1 = 0; n1 < cs_glob_lagr_boundary_interactions->nusbor; n1++)
-          bound_stat[cs_glob_lagr_boundary_interactions->iusb[n1] * n_b_faces + face_id] = 0.0;
+        for (int n1 = 0; n1 < cs_glob_lagr_boundary_interactions->nusbor; n1++) {
+          cs_real_t *b_usr_stat
+            = bound_stat + (  cs_glob_lagr_boundary_interactions->iusb[n1]
+                            * n_b_faces + face_id);
+#         pragma omp atomic write
+          *b_usr_stat = 0.0;
+        }
     }
   }
 
@@ -2368,6 +2580,9 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
  *   p_am                     <-- particle attribute map
  *   displacement_step_id     <-- id of displacement step
  *   failsafe_mode            <-- with (0) / without (1) failure capability
+ *   acc                      <-> tracking accumulators for current thread
+ *   s_acc                    <-> shared tracking accumulators, used for
+ *                                interactions which must be serialized
  *
  * returns:
  *   a state associated to the status of the particle (treated, to be deleted,
@@ -2381,7 +2596,9 @@ _local_propagation(void                           *particle,
                    int                             failsafe_mode,
                    cs_real_t                       visc_length[],
                    const cs_field_t               *u,
-                   cs_real_t                       tkelvi)
+                   cs_real_t                       tkelvi,
+                   cs_lagr_tracking_acc_t         *acc,
+                   cs_lagr_tracking_acc_t         *s_acc)
 {
   cs_lnum_t  i, k;
   cs_real_t  disp[3];
@@ -2560,51 +2777,30 @@ reloop_cen:;
         i < cell_face_idx[cur_cell_id+1] && move_particle == CS_LAGR_PART_MOVE_ON;
         i++) {
 
-      cs_lnum_t face_id, vtx_start, vtx_end, n_vertices;
-      const cs_lnum_t  *face_connect;
-
       cs_lnum_t face_num = cell_face_lst[i];
 
       if (face_num > 0) {
 
         /* Interior face */
 
-        face_id = face_num - 1;
+        cs_lnum_t face_id = face_num - 1;
         if (cur_cell_id == mesh->i_face_cells[face_id][1])
           reorient_face = -1;
-        vtx_start = mesh->i_face_vtx_idx[face_id];
-        vtx_end = mesh->i_face_vtx_idx[face_id+1];
-        n_vertices = vtx_end - vtx_start;
-
-        face_connect = mesh->i_face_vtx_lst + vtx_start;
 
       }
-      else {
 
-        assert(face_num < 0);
-
-        /* Boundary faces */
-
-        face_id = -face_num - 1;
-        vtx_start = mesh->b_face_vtx_idx[face_id];
-        vtx_end = mesh->b_face_vtx_idx[face_id+1];
-        n_vertices = vtx_end - vtx_start;
-
-        face_connect = mesh->b_face_vtx_lst + vtx_start;
-
-      }
+      assert(face_num != 0);
 
       /*
         adimensional distance estimation of face intersection
         (-1 if no chance of intersection)
       */
 
-      double t    = _intersect_face(face_num,
-                                    n_vertices,
+      double t    = _intersect_face(builder,
+                                    face_num,
                                     reorient_face,
                                     &n_in,
                                     &n_out,
-                                    face_connect,
                                     particle,
                                     p_am);
 
@@ -2627,18 +2823,24 @@ reloop_cen:;
         prev_location[k] = cell_cen[k];
 
       if (!(restart)) {
-        bft_printf("Warning in local_propagation: the particle is not in the cell:"
-            "n_in=%d, n_out=%d, jrval %e \n",
-            n_in, n_out, *particle_jrval);
-        bft_printf("the particle is replaced at the cell center and the"
-            "trajectory analysis continues from this new position\n");
+#       pragma omp critical (_lagr_tracking_log)
+        {
+          bft_printf("Warning in local_propagation: the particle is not in the cell:"
+              "n_in=%d, n_out=%d, jrval %e \n",
+              n_in, n_out, *particle_jrval);
+          bft_printf("the particle is replaced at the cell center and the"
+              "trajectory analysis continues from this new position\n");
+        }
         restart = true;
       }
       else {
-        bft_printf("Problem in local_propagation: the particle is not in the cell:"
-            "n_in=%d, n_out=%d, jrval %e \n",
-            n_in, n_out, *particle_jrval);
-        bft_printf("the particle has been removed from the simulation\n");
+#       pragma omp critical (_lagr_tracking_log)
+        {
+          bft_printf("Problem in local_propagation: the particle is not in the cell:"
+              "n_in=%d, n_out=%d, jrval %e \n",
+              n_in, n_out, *particle_jrval);
+          bft_printf("the particle has been removed from the simulation\n");
+        }
 
         _manage_error(failsafe_mode,
             particle,
@@ -2690,7 +2892,8 @@ reloop_cen:;
                               particle,
                               face_id,
                               t_intersect,
-                              &move_particle);
+                              &move_particle,
+                              acc);
 
       if (move_particle != CS_LAGR_PART_MOVE_OFF) {
 
@@ -2852,14 +3055,39 @@ reloop_cen:;
          move_particle = 1: continue particle tracking
       */
 
-      particle_state
-        = _boundary_treatment(cs_glob_lagr_particle_set,
-                              particle,
-                              face_num,
-                              t_intersect,
-                              bdy_conditions->b_face_zone_id[face_num-1],
-                              &move_particle,
-                              tkelvi);
+      /* Deposition with DLVO barriers and fouling use random numbers and
+         update face statistics, so they are serialized and use shared
+         accumulators. Clogging also reads and modifies other particles,
+         which would race with their own propagation, so the propagation
+         loop is not threaded when clogging is active
+         (see cs_lagr_tracking_particle_movement). */
+
+      int b_zone_id = bdy_conditions->b_face_zone_id[face_num-1];
+      int b_zone_nature = bdy_conditions->b_zone_natures[b_zone_id];
+
+      if (   b_zone_nature == CS_LAGR_DEPO_DLVO
+          || b_zone_nature == CS_LAGR_FOULING) {
+
+#       pragma omp critical (_lagr_tracking_shared_boundary)
+        particle_state = _boundary_treatment(cs_glob_lagr_particle_set,
+                                             particle,
+                                             face_num,
+                                             t_intersect,
+                                             b_zone_id,
+                                             &move_particle,
+                                             tkelvi,
+                                             s_acc);
+
+      }
+      else
+        particle_state = _boundary_treatment(cs_glob_lagr_particle_set,
+                                             particle,
+                                             face_num,
+                                             t_intersect,
+                                             b_zone_id,
+                                             &move_particle,
+                                             tkelvi,
+                                             acc);
 
       if (cs_glob_lagr_time_scheme->t_order == 2)
         cs_lagr_particle_set_lnum(particle, p_am, CS_LAGR_SWITCH_ORDER_1,
@@ -2881,89 +3109,124 @@ reloop_cen:;
 }
 
 /*----------------------------------------------------------------------------
- * Exchange counters on the number of particles to send and to receive
+ * Create per-thread tracking accumulators.
+ *
+ * Counters are initialized to 0, and arrays are allocated and set to 0.
+ * Boundary statistics are only accumulated per thread when recorded at
+ * every particle/boundary interaction (other interactions updating those
+ * statistics are serialized).
  *
  * parameters:
- *  halo        <--  pointer to a cs_halo_t structure
- *  lag_halo    <--  pointer to a cs_lagr_halo_t structure
+ *   n_threads <-- number of threads
+ *
+ * returns:
+ *   pointer to array of accumulators, or NULL if n_threads < 2
  *----------------------------------------------------------------------------*/
 
-static void
-_exchange_counter(const cs_halo_t  *halo,
-                  cs_lagr_halo_t   *lag_halo)
+static cs_lagr_tracking_acc_t *
+_create_thread_acc(int  n_threads)
 {
-  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
+  cs_lagr_tracking_acc_t  *t_acc = NULL;
 
-#if defined(HAVE_MPI)
-  if (cs_glob_n_ranks > 1) {
+  if (n_threads < 2)
+    return t_acc;
 
-    int  rank;
-    int  request_count = 0;
-    const int  local_rank = cs_glob_rank_id;
+  const cs_lnum_t  n_b_faces = cs_glob_mesh->n_b_faces;
+  const int  n_zones = cs_glob_lagr_bdy_conditions->n_b_max_zones;
 
-    /* Receive data from distant ranks */
+  cs_lnum_t  n_b_stat = 0;
+  if (cs_glob_lagr_post_options->iensi3 > 0 && bound_stat != NULL)
+    n_b_stat = n_b_faces * cs_glob_lagr_dim->nvisbr;
 
-    for (rank = 0; rank < halo->n_c_domains; rank++) {
+  BFT_MALLOC(t_acc, n_threads, cs_lagr_tracking_acc_t);
 
-      if (halo->c_domain_rank[rank] != local_rank)
-        MPI_Irecv(&(lag_halo->recv_count[rank]),
-                  1,
-                  CS_MPI_INT,
-                  halo->c_domain_rank[rank],
-                  halo->c_domain_rank[rank],
-                  cs_glob_mpi_comm,
-                  &(lag_halo->request[request_count++]));
-      else
-        local_rank_id = rank;
+  for (int t_id = 0; t_id < n_threads; t_id++) {
 
+    cs_lagr_tracking_acc_t *acc = t_acc + t_id;
+
+    acc->n_part_dep = 0;
+    acc->n_part_fou = 0;
+    acc->weight_dep = 0.;
+    acc->weight_fou = 0.;
+
+    BFT_MALLOC(acc->particle_flow_rate, n_zones, cs_real_t);
+    for (int i = 0; i < n_zones; i++)
+      acc->particle_flow_rate[i] = 0.;
+
+    acc->b_stat = NULL;
+    if (n_b_stat > 0) {
+      BFT_MALLOC(acc->b_stat, n_b_stat, cs_real_t);
+      for (cs_lnum_t i = 0; i < n_b_stat; i++)
+        acc->b_stat[i] = 0.;
     }
 
-    /* We wait for posting all receives
-       (often recommended in the past, apparently not anymore) */
+  }
 
-#if 0
-    MPI_Barrier(cs_glob_mpi_comm)
-#endif
+  return t_acc;
+}
 
-    /* Send data to distant ranks */
+/*----------------------------------------------------------------------------
+ * Merge per-thread tracking accumulators into shared accumulators,
+ * then free them.
+ *
+ * parameters:
+ *   n_threads <-- number of threads
+ *   t_acc     <-> pointer to array of per-thread accumulators
+ *   s_acc     <-> shared accumulators
+ *----------------------------------------------------------------------------*/
 
-    for (rank = 0; rank < halo->n_c_domains; rank++) {
+static void
+_merge_thread_acc(int                       n_threads,
+                  cs_lagr_tracking_acc_t  **t_acc,
+                  cs_lagr_tracking_acc_t   *s_acc)
+{
+  if (*t_acc == NULL)
+    return;
 
-      /* If this is not the local rank */
+  const cs_lnum_t  n_b_faces = cs_glob_mesh->n_b_faces;
+  const int  n_zones = cs_glob_lagr_bdy_conditions->n_b_max_zones;
+  const cs_lnum_t  n_b_stat = n_b_faces * cs_glob_lagr_dim->nvisbr;
 
-      if (halo->c_domain_rank[rank] != local_rank)
-        MPI_Isend(&(lag_halo->send_count[rank]),
-                  1,
-                  CS_MPI_INT,
-                  halo->c_domain_rank[rank],
-                  local_rank,
-                  cs_glob_mpi_comm,
-                  &(lag_halo->request[request_count++]));
+  for (int t_id = 0; t_id < n_threads; t_id++) {
 
-    }
+    cs_lagr_tracking_acc_t *acc = *t_acc + t_id;
 
-    /* Wait for all exchanges */
+    s_acc->n_part_dep += acc->n_part_dep;
+    s_acc->n_part_fou += acc->n_part_fou;
+    s_acc->weight_dep += acc->weight_dep;
+    s_acc->weight_fou += acc->weight_fou;
 
-    MPI_Waitall(request_count, lag_halo->request, lag_halo->status);
+    for (int i = 0; i < n_zones; i++)
+      s_acc->particle_flow_rate[i] += acc->particle_flow_rate[i];
 
-  }
-#endif /* defined(HAVE_MPI) */
+    if (acc->b_stat != NULL) {
+#     pragma omp parallel for if (n_b_stat > CS_THR_MIN)
+      for (cs_lnum_t i = 0; i < n_b_stat; i++)
+        s_acc->b_stat[i] += acc->b_stat[i];
+    }
 
-  /* Copy local values in case of periodicity */
+    BFT_FREE(acc->particle_flow_rate);
+    BFT_FREE(acc->b_stat);
 
-  if (halo->n_transforms > 0)
-    if (local_rank_id > -1)
-      lag_halo->recv_count[local_rank_id] = lag_halo->send_count[local_rank_id];
+  }
 
+  BFT_FREE(*t_acc);
 }
 
 /*----------------------------------------------------------------------------
- * Exchange particles
+ * Exchange particles with neighboring ranks, and append received particles
+ * to the particle set.
+ *
+ * Each rank sends exactly one message (possibly empty) to each of its
+ * neighbors, and the number of particles received is determined from
+ * each incoming message, so no prior exchange of counts is needed.
+ * Particles are first received in the halo's receive buffer, then
+ * appended to the particle set once their total number is known.
  *
  * parameters:
  *  halo      <-- pointer to a cs_halo_t structure
  *  lag_halo  <-> pointer to a cs_lagr_halo_t structure
- *  particles <-- set of particles to update
+ *  particles <-> set of particles to update
  *----------------------------------------------------------------------------*/
 
 static void
@@ -2971,110 +3234,117 @@ _exchange_particles(const cs_halo_t         *halo,
                     cs_lagr_halo_t          *lag_halo,
                     cs_lagr_particle_set_t  *particles)
 {
-  void  *recv_buf = NULL, *send_buf = NULL;
-
   int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
 
   const size_t tot_extents = lag_halo->extents;
 
   cs_lnum_t  n_recv_particles = 0;
 
+  if (cs_glob_n_ranks > 1) {
+    for (int rank = 0; rank < halo->n_c_domains; rank++) {
+      if (halo->c_domain_rank[rank] == cs_glob_rank_id)
+        local_rank_id = rank;
+    }
+  }
+
+  /* Copy local values in case of periodicity (first, so that particles
+     are received in the same order as communicating ranks in the halo) */
+
+  if (halo->n_transforms > 0) {
+    if (local_rank_id > -1) {
+
+      cs_lnum_t  n_send = lag_halo->send_count[local_rank_id];
+      cs_lnum_t  send_shift = lag_halo->send_shift[local_rank_id];
+
+      _reserve_lagr_halo_recv(lag_halo, n_send);
+
+      memcpy(lag_halo->recv_buf,
+             lag_halo->send_buf + tot_extents*send_shift,
+             tot_extents*n_send);
+
+      n_recv_particles += n_send;
+
+    }
+  }
+
 #if defined(HAVE_MPI)
 
   if (cs_glob_n_ranks > 1) {
 
-    int  rank;
     int  request_count = 0;
     const int  local_rank = cs_glob_rank_id;
+    const cs_rank_neighbors_t  *rn = lag_halo->rn;
 
-    /* Receive data from distant ranks */
+    /* Send data to distant ranks */
 
-    for (rank = 0; rank < halo->n_c_domains; rank++) {
+    for (int i = 0; i < rn->size; i++) {
 
-      cs_lnum_t shift =   particles->n_particles
-                        + lag_halo->recv_shift[rank];
+      int  n_send = 0;
+      void  *send_buf = NULL;
 
-      if (lag_halo->recv_count[rank] == 0)
-        recv_buf = NULL;
-      else
-        recv_buf = particles->p_buffer + tot_extents*shift;
-
-      if (halo->c_domain_rank[rank] != local_rank) {
-        n_recv_particles += lag_halo->recv_count[rank];
-        MPI_Irecv(recv_buf,
-                  lag_halo->recv_count[rank],
-                  _cs_mpi_particle_type,
-                  halo->c_domain_rank[rank],
-                  halo->c_domain_rank[rank],
-                  cs_glob_mpi_comm,
-                  &(lag_halo->request[request_count++]));
-      }
-      else
-        local_rank_id = rank;
+      int  rank = lag_halo->rn_halo_id[i];
 
-    }
+      if (rank > -1) {
+        n_send = lag_halo->send_count[rank];
+        if (n_send > 0)
+          send_buf =   lag_halo->send_buf
+                     + tot_extents*lag_halo->send_shift[rank];
+      }
 
-    /* We wait for posting all receives
-       (often recommended in the past, apparently not anymore) */
+      MPI_Isend(send_buf,
+                n_send,
+                _cs_mpi_particle_type,
+                rn->rank[i],
+                local_rank,
+                cs_glob_mpi_comm,
+                &(lag_halo->request[request_count++]));
 
-#if 0
-    MPI_Barrier(cs_glob_mpi_comm);
-#endif
+    }
 
-    /* Send data to distant ranks */
+    /* Receive data from distant ranks, in rank order */
 
-    for (rank = 0; rank < halo->n_c_domains; rank++) {
+    for (int i = 0; i < rn->size; i++) {
 
-      /* If this is not the local rank */
+      int  n_recv = 0;
+      MPI_Status  status;
 
-      if (halo->c_domain_rank[rank] != local_rank) {
+      MPI_Probe(rn->rank[i], rn->rank[i], cs_glob_mpi_comm, &status);
+      MPI_Get_count(&status, _cs_mpi_particle_type, &n_recv);
 
-        cs_lnum_t shift = lag_halo->send_shift[rank];
-        if (lag_halo->send_count[rank] == 0)
-          send_buf = NULL;
-        else
-          send_buf = lag_halo->send_buf + tot_extents*shift;
+      _reserve_lagr_halo_recv(lag_halo, n_recv_particles + n_recv);
 
-        MPI_Isend(send_buf,
-                  lag_halo->send_count[rank],
-                  _cs_mpi_particle_type,
-                  halo->c_domain_rank[rank],
-                  local_rank,
-                  cs_glob_mpi_comm,
-                  &(lag_halo->request[request_count++]));
+      MPI_Recv(lag_halo->recv_buf + tot_extents*n_recv_particles,
+               n_recv,
+               _cs_mpi_particle_type,
+               rn->rank[i],
+               rn->rank[i],
+               cs_glob_mpi_comm,
+               &status);
 
-      }
+      n_recv_particles += n_recv;
 
     }
 
-    /* Wait for all exchanges */
+    /* Wait for all sends */
 
     MPI_Waitall(request_count, lag_halo->request, lag_halo->status);
 
   }
-#endif /* defined(HAVE_MPI) */
-
-  /* Copy local values in case of periodicity */
-
-  if (halo->n_transforms > 0) {
-    if (local_rank_id > -1) {
-
-      cs_lnum_t  recv_shift =   particles->n_particles
-                              + lag_halo->recv_shift[local_rank_id];
-      cs_lnum_t  send_shift = lag_halo->send_shift[local_rank_id];
 
-      assert(   lag_halo->recv_count[local_rank_id]
-             == lag_halo->send_count[local_rank_id]);
+#endif /* defined(HAVE_MPI) */
 
-      n_recv_particles += lag_halo->send_count[local_rank_id];
+  /* Append received particles to set */
 
-      for (cs_lnum_t i = 0; i < lag_halo->send_count[local_rank_id]; i++)
-        memcpy(particles->p_buffer + tot_extents*(recv_shift + i),
-               lag_halo->send_buf + tot_extents*(send_shift + i),
-               tot_extents);
+  if (cs_lagr_particle_set_resize(particles->n_particles + n_recv_particles)
+      < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _(" Particle set could not be resized to receive %ld particles"
+                " from neighboring ranks.\n"),
+              (long)n_recv_particles);
 
-    }
-  }
+  memcpy(particles->p_buffer + tot_extents*particles->n_particles,
+         lag_halo->recv_buf,
+         tot_extents*n_recv_particles);
 
   /* Update particle count and weight */
 
@@ -3102,29 +3372,29 @@ _exchange_particles(const cs_halo_t         *halo,
  *   mesh      <-- pointer to associated mesh
  *   lag_halo  <-> pointer to particle halo structure to update
  *   particles <-- set of particles to update
+ *   p_start   <-- id of first particle which may need synchronization
  *----------------------------------------------------------------------------*/
 
 static void
 _lagr_halo_count(const cs_mesh_t               *mesh,
                  cs_lagr_halo_t                *lag_halo,
-                 const cs_lagr_particle_set_t  *particles)
+                 const cs_lagr_particle_set_t  *particles,
+                 cs_lnum_t                      p_start)
 {
   cs_lnum_t  i, ghost_id;
 
-  cs_lnum_t  n_recv_particles = 0, n_send_particles = 0;
+  cs_lnum_t  n_send_particles = 0;
 
   const cs_halo_t  *halo = mesh->halo;
 
   /* Initialization */
 
-  for (i = 0; i < halo->n_c_domains; i++) {
+  for (i = 0; i < halo->n_c_domains; i++)
     lag_halo->send_count[i] = 0;
-    lag_halo->recv_count[i] = 0;
-  }
 
   /* Loop on particles to count number of particles to send on each rank */
 
-  for (i = 0; i < particles->n_particles; i++) {
+  for (i = p_start; i < particles->n_particles; i++) {
 
     if (_get_tracking_info(particles, i)->state == CS_LAGR_PART_TO_SYNC) {
 
@@ -3138,28 +3408,15 @@ _lagr_halo_count(const cs_mesh_t               *mesh,
 
   } /* End of loop on particles */
 
-  /* Exchange counters */
-
-  _exchange_counter(halo, lag_halo);
-
-  for (i = 0; i < halo->n_c_domains; i++) {
-    n_recv_particles += lag_halo->recv_count[i];
+  for (i = 0; i < halo->n_c_domains; i++)
     n_send_particles += lag_halo->send_count[i];
-  }
 
   lag_halo->send_shift[0] = 0;
-  lag_halo->recv_shift[0] = 0;
-
-  for (i = 1; i < halo->n_c_domains; i++) {
 
+  for (i = 1; i < halo->n_c_domains; i++)
     lag_halo->send_shift[i] =  lag_halo->send_shift[i-1]
                              + lag_halo->send_count[i-1];
 
-    lag_halo->recv_shift[i] =  lag_halo->recv_shift[i-1]
-                             + lag_halo->recv_count[i-1];
-
-  }
-
   /* Resize halo only if needed */
 
   _resize_lagr_halo(lag_halo, n_send_particles);
@@ -3168,17 +3425,24 @@ _lagr_halo_count(const cs_mesh_t               *mesh,
 /*----------------------------------------------------------------------------
  * Update particle sets, including halo synchronization.
  *
+ * Particles received from other ranks are appended to the set, after
+ * those which remain local.
+ *
  * parameters:
  *   particles <-> set of particles to update
+ *   p_start   <-- id of first particle which may need synchronization
+ *
+ * returns:
+ *   id of first particle received from other ranks
  *----------------------------------------------------------------------------*/
 
-static void
-_sync_particle_set(cs_lagr_particle_set_t  *particles)
+static cs_lnum_t
+_sync_particle_set(cs_lagr_particle_set_t  *particles,
+                   cs_lnum_t                p_start)
 {
   cs_lnum_t  i, k, tr_id, rank, shift, ghost_id;
   cs_real_t matrix[3][4];
 
-  cs_lnum_t  n_recv_particles = 0;
   cs_lnum_t  particle_count = 0;
 
   cs_lnum_t  n_exit_particles = 0;
@@ -3201,12 +3465,10 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
 
   if (halo != NULL) {
 
-    _lagr_halo_count(mesh, lag_halo, particles);
+    _lagr_halo_count(mesh, lag_halo, particles, p_start);
 
-    for (i = 0; i < halo->n_c_domains; i++) {
-      n_recv_particles += lag_halo->recv_count[i];
+    for (i = 0; i < halo->n_c_domains; i++)
       lag_halo->send_count[i] = 0;
-    }
   }
 
   /* Loop on particles, transferring particles to synchronize to send_buf
@@ -3404,6 +3666,8 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
 
   if (halo != NULL)
     _exchange_particles(halo, lag_halo, particles);
+
+  return particle_count;
 }
 
 /*----------------------------------------------------------------------------
@@ -3648,6 +3912,23 @@ cs_lagr_tracking_initialize(void)
                           p_set->p_am->extents);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update geometric data used by particle tracking.
+ *
+ * This should be called when mesh vertices have moved (for example with
+ * ALE), so that cached face geometry remains consistent with the mesh.
+ * It does nothing if particle tracking is not initialized.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_tracking_update_geometry(void)
+{
+  if (_particle_track_builder != NULL)
+    _define_face_geom_cache(_particle_track_builder);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Apply one particle movement step.
@@ -3703,44 +3984,83 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[],
 
   _initialize_displacement(particles, part_b_mass_flux);
 
-  /* Main loop on  particles: global propagation */
+  /* Shared accumulators update global values directly;
+     per-thread accumulators are merged into them after propagation */
+
+  cs_lagr_tracking_acc_t  s_acc = {
+    .n_part_dep = 0,
+    .n_part_fou = 0,
+    .weight_dep = 0.,
+    .weight_fou = 0.,
+    .particle_flow_rate = cs_glob_lagr_bdy_conditions->particle_flow_rate,
+    .b_stat = bound_stat};
+
+  /* Clogging requires a single-threaded propagation loop */
+
+  const int n_threads = (cs_glob_lagr_model->clogging) ? 1 : cs_glob_n_threads;
 
-  while (_continue_displacement()) {
+  cs_lagr_tracking_acc_t  *t_acc = _create_thread_acc(n_threads);
+
+  /* Main loop on  particles: global propagation. After the first pass,
+     only particles received from other ranks (appended to the set)
+     remain to be propagated */
+
+  cs_lnum_t  p_start = 0;
+
+  while (_continue_displacement(p_start)) {
+
+    const cs_lnum_t  n_particles = particles->n_particles;
 
     /* Local propagation */
 
-    for (cs_lnum_t i = 0; i < particles->n_particles; i++) {
+#   pragma omp parallel if (n_particles - p_start > CS_THR_MIN && n_threads > 1)
+    {
+      cs_lagr_tracking_acc_t *acc = &s_acc;
 
-      unsigned char *particle = particles->p_buffer + p_am->extents * i;
+#if defined(HAVE_OPENMP)
+      if (t_acc != NULL)
+        acc = t_acc + omp_get_thread_num();
+#endif
 
-      /* Local copies of the current and previous particles state vectors
-         to be used in case of the first pass of _local_propagation fails */
+      /* Propagation cost varies strongly between particles */
 
-      cs_lagr_tracking_state_t cur_part_state
-        = _get_tracking_info(particles, i)->state;
+#     pragma omp for schedule(dynamic, 16)
+      for (cs_lnum_t i = p_start; i < n_particles; i++) {
 
-      if (cur_part_state == CS_LAGR_PART_TO_SYNC) {
+        unsigned char *particle = particles->p_buffer + p_am->extents * i;
 
-        /* Main particle displacement stage */
+        /* Local copies of the current and previous particles state vectors
+           to be used in case of the first pass of _local_propagation fails */
 
-        cur_part_state = _local_propagation(particle,
-                                            p_am,
-                                            n_displacement_steps,
-                                            failsafe_mode,
-                                            visc_length,
-                                            u,
-                                            tkelvi);
+        cs_lagr_tracking_state_t cur_part_state
+          = _get_tracking_info(particles, i)->state;
 
-        _tracking_info(particles, i)->state = cur_part_state;
+        if (cur_part_state == CS_LAGR_PART_TO_SYNC) {
 
-      }
+          /* Main particle displacement stage */
 
-    } /* End of loop on particles */
+          cur_part_state = _local_propagation(particle,
+                                              p_am,
+                                              n_displacement_steps,
+                                              failsafe_mode,
+                                              visc_length,
+                                              u,
+                                              tkelvi,
+                                              acc,
+                                              &s_acc);
+
+          _tracking_info(particles, i)->state = cur_part_state;
+
+        }
+
+      } /* End of loop on particles */
+
+    } /* End of OpenMP parallel region */
 
     /* Update of the particle set structure. Delete exited particles,
        update for particles which change domain. */
 
-    _sync_particle_set(particles);
+    p_start = _sync_particle_set(particles, p_start);
 
 #if 0
     bft_printf("\n Particle set after sync\n");
@@ -3754,6 +4074,13 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[],
 
   } /* End of while (global displacement) */
 
+  _merge_thread_acc(n_threads, &t_acc, &s_acc);
+
+  particles->n_part_dep += s_acc.n_part_dep;
+  particles->n_part_fou += s_acc.n_part_fou;
+  particles->weight_dep += s_acc.weight_dep;
+  particles->weight_fou += s_acc.weight_fou;
+
   /* Deposition sub-model additional loop */
 
   if (lagr_model->deposition > 0) {
@@ -68,6 +68,19 @@ BEGIN_C_DECLS
 void
 cs_lagr_tracking_initialize(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update geometric data used by particle tracking.
+ *
+ * This should be called when mesh vertices have moved (for example with
+ * ALE), so that cached face geometry remains consistent with the mesh.
+ * It does nothing if particle tracking is not initialized.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_tracking_update_geometry(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Apply one particle movement step.
@@ -427,7 +427,7 @@ _mesh_to_builder_g(cs_mesh_t          *mesh,
                                pp_out);
   }
 
-  if (transfer == false)
+  if (transfer == false && pp_out != NULL)
     BFT_FREE(mb->face_cells);
 
   /* Now write pre-distributed blocks for cell group classes if required */
@@ -457,7 +457,7 @@ _mesh_to_builder_g(cs_mesh_t          *mesh,
                                pp_out);
   }
 
-  if (transfer == false)
+  if (transfer == false && pp_out != NULL)
     BFT_FREE(mb->cell_gc_id);
 
   /* Face group classes */
@@ -514,7 +514,7 @@ _mesh_to_builder_g(cs_mesh_t          *mesh,
                                pp_out);
   }
 
-  if (transfer == false)
+  if (transfer == false && pp_out != NULL)
     BFT_FREE(mb->face_gc_id);
 
   /* Face -> vertex connectivity */
@@ -532,7 +532,7 @@ _mesh_to_builder_g(cs_mesh_t          *mesh,
   if (pp_out != NULL)
     _write_face_vertices_g(mesh, mb, transfer, pp_out);
 
-  if (transfer == false) {
+  if (transfer == false && pp_out != NULL) {
     BFT_FREE(mb->face_vertices_idx);
     BFT_FREE(mb->face_vertices);
   }
@@ -591,7 +591,7 @@ _mesh_to_builder_g(cs_mesh_t          *mesh,
 
   if (transfer == true)
     BFT_FREE(mesh->global_vtx_num);
-  else
+  else if (pp_out != NULL)
     BFT_FREE(mb->vertex_coords);
 }
 
@@ -724,7 +724,7 @@ _mesh_to_builder_l(cs_mesh_t          *mesh,
                                pp_out);
   }
 
-  if (transfer == false)
+  if (transfer == false && pp_out != NULL)
     BFT_FREE(mb->face_cells);
 
   /* Cell group classes */
@@ -764,7 +764,7 @@ _mesh_to_builder_l(cs_mesh_t          *mesh,
                                pp_out);
   }
 
-  if (transfer == false)
+  if (transfer == false && pp_out != NULL)
     BFT_FREE(mb->cell_gc_id);
 
   /* Face group classes */
@@ -806,7 +806,7 @@ _mesh_to_builder_l(cs_mesh_t          *mesh,
                                pp_out);
   }
 
-  if (transfer == false)
+  if (transfer == false && pp_out != NULL)
     BFT_FREE(mb->face_gc_id);
 
   /* Face -> vertex connectivity */
@@ -847,7 +847,7 @@ _mesh_to_builder_l(cs_mesh_t          *mesh,
 
   }
 
-  if (transfer == true) {
+  if (transfer == true || pp_out == NULL) {
 
     BFT_MALLOC(mb->face_vertices_idx, n_faces + 1, cs_lnum_t);
 
@@ -936,7 +936,7 @@ _mesh_to_builder_l(cs_mesh_t          *mesh,
                                pp_out);
   }
 
-  if (transfer == false)
+  if (transfer == false && pp_out != NULL)
     BFT_FREE(mb->face_vertices);
 
   /* Vertex coordinates */
@@ -982,7 +982,7 @@ _mesh_to_builder_l(cs_mesh_t          *mesh,
 
   if (transfer == true)
     BFT_FREE(mesh->global_vtx_num);
-  else
+  else if (pp_out != NULL)
     BFT_FREE(mb->vertex_coords);
 }
 
@@ -1306,7 +1306,9 @@ _write_mesh_perio_data_l(int         perio_num,
  * \param[in, out]  mb        pointer to mesh builder structure
  * \param[in]       transfer  if true, data is transferred from mesh to builder;
  *                            if false, builder fields are only used as a
- *                            temporary arrays.
+ *                            temporary arrays, unless pp_out is NULL, in
+ *                            which case the builder receives a copy of
+ *                            the mesh data.
  * \param[in, out]  pp_out    optional output file, or NULL
  */
 /*----------------------------------------------------------------------------*/
@@ -76,7 +76,8 @@ BEGIN_C_DECLS
  *   mb       <-> pointer to mesh builder structure
  *   transfer <-- if true, data is transferred from mesh to builder;
  *                if false, builder fields are only used as a temporary
- *                arrays.
+ *                arrays, unless pp_out is NULL, in which case the
+ *                builder receives a copy of the mesh data.
  *   pp_out   <-> optional output file, or NULL
  *----------------------------------------------------------------------------*/
 
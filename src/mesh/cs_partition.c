@@ -209,6 +209,11 @@ static int                       *_part_extra_partitions_list = NULL;
 
 static bool                       _part_uniform_sfc_block_size = false;
 
+static int                          _part_n_cell_weights = 0;
+static cs_partition_cell_weights_t *_part_cell_weights_func = NULL;
+static void                        *_part_cell_weights_input = NULL;
+static bool                         _part_b_face_constraint = false;
+
 #if defined(WIN32) || defined(_WIN32)
 static const char _dir_separator = '\\';
 #else
@@ -931,6 +936,526 @@ _precompute_cell_center_l(const cs_mesh_builder_t  *mb,
   BFT_FREE(weight);
 }
 
+/*----------------------------------------------------------------------------
+ * Return number of weights (constraints) per cell used for partitioning.
+ *
+ * returns:
+ *   number of weights per cell, or 0 if cells are not weighted
+ *----------------------------------------------------------------------------*/
+
+static int
+_n_cell_weights(void)
+{
+  int n_weights = 0;
+
+  if (_part_cell_weights_func != NULL && _part_n_cell_weights > 0)
+    n_weights = _part_n_cell_weights;
+
+  /* Boundary faces constraint is added to the cell count if no
+     other constraint is defined */
+
+  if (_part_b_face_constraint)
+    n_weights = CS_MAX(n_weights, 1) + 1;
+
+  return n_weights;
+}
+
+/*----------------------------------------------------------------------------
+ * Count boundary faces adjacent to cells using block data.
+ *
+ * parameters:
+ *   mb          <-- pointer to mesh builder helper structure
+ *   stride      <-- stride of cell_weight array
+ *   cell_weight <-> cell weights array, whose first value for each cell
+ *                   is incremented by the number of adjacent boundary faces
+ *----------------------------------------------------------------------------*/
+
+static void
+_count_cell_b_faces(const cs_mesh_builder_t  *mb,
+                    int                       stride,
+                    float                     cell_weight[])
+{
+  cs_lnum_t n_faces = 0;
+
+  const cs_gnum_t *cell_range = mb->cell_bi.gnum_range;
+  const cs_gnum_t *face_cells = mb->face_cells;
+
+  cs_gnum_t *_face_cells = NULL;
+
+  /* Distribute faces so as to match cell block distribution */
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_datatype_t gnum_type
+      = (sizeof(cs_gnum_t) == 8) ? CS_UINT64 : CS_UINT32;
+
+    cs_block_to_part_t *d
+      = cs_block_to_part_create_by_adj_s(cs_glob_mpi_comm,
+                                         mb->face_bi,
+                                         mb->cell_bi,
+                                         2,
+                                         mb->face_cells,
+                                         NULL,
+                                         NULL);
+
+    n_faces = cs_block_to_part_get_n_part_ents(d);
+
+    BFT_MALLOC(_face_cells, n_faces*2, cs_gnum_t);
+
+    cs_block_to_part_copy_array(d,
+                                gnum_type,
+                                2,
+                                mb->face_cells,
+                                _face_cells);
+
+    cs_block_to_part_destroy(&d);
+
+    face_cells = _face_cells;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (cs_glob_n_ranks == 1)
+    n_faces = mb->n_g_faces;
+
+  /* Faces with only one adjacent cell are boundary faces */
+
+  for (cs_lnum_t face_id = 0; face_id < n_faces; face_id++) {
+
+    cs_gnum_t c_num = 0;
+
+    if (face_cells[face_id*2 + 1] == 0)
+      c_num = face_cells[face_id*2];
+    else if (face_cells[face_id*2] == 0)
+      c_num = face_cells[face_id*2 + 1];
+
+    if (c_num >= cell_range[0] && c_num < cell_range[1])
+      cell_weight[(c_num - cell_range[0])*stride] += 1;
+
+  }
+
+  BFT_FREE(_face_cells);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute global sum and maximum of cell weights for each constraint.
+ *
+ * parameters:
+ *   n_cells     <-- number of local cells
+ *   n_weights   <-- number of weights per cell
+ *   cell_weight <-- cell weights (interlaced)
+ *   w_sum       --> global sum of weights for each constraint
+ *   w_max       --> global maximum of weights for each constraint
+ *----------------------------------------------------------------------------*/
+
+static void
+_cell_weights_sum_max(cs_lnum_t      n_cells,
+                      int            n_weights,
+                      const float    cell_weight[],
+                      double         w_sum[],
+                      double         w_max[])
+{
+  for (int k = 0; k < n_weights; k++) {
+    w_sum[k] = 0;
+    w_max[k] = 0;
+  }
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    for (int k = 0; k < n_weights; k++) {
+      double w = cell_weight[i*n_weights + k];
+      w_sum[k] += w;
+      if (w > w_max[k])
+        w_max[k] = w;
+    }
+  }
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+    double *w_loc;
+    BFT_MALLOC(w_loc, n_weights, double);
+    memcpy(w_loc, w_sum, n_weights*sizeof(double));
+    MPI_Allreduce(w_loc, w_sum, n_weights, MPI_DOUBLE, MPI_SUM,
+                  cs_glob_mpi_comm);
+    memcpy(w_loc, w_max, n_weights*sizeof(double));
+    MPI_Allreduce(w_loc, w_max, n_weights, MPI_DOUBLE, MPI_MAX,
+                  cs_glob_mpi_comm);
+    BFT_FREE(w_loc);
+  }
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Compute cell weights for partitioning using block data.
+ *
+ * User-defined weights come first, followed by the boundary faces count
+ * if this constraint is active. Negative weights are clipped, and
+ * constraints whose weights are all zero are replaced by uniform weights.
+ *
+ * parameters:
+ *   mesh      <-- pointer to mesh structure
+ *   mb        <-- pointer to mesh builder helper structure
+ *   n_weights <-- number of weights per cell
+ *
+ * returns:
+ *   pointer to allocated cell weights (interlaced), on the mesh builder's
+ *   block distribution
+ *----------------------------------------------------------------------------*/
+
+static float *
+_cell_weights(const cs_mesh_t          *mesh,
+              const cs_mesh_builder_t  *mb,
+              int                       n_weights)
+{
+  cs_lnum_t n_cells = 0;
+
+  float *cell_weight = NULL;
+
+  int n_u_weights = (_part_b_face_constraint) ? n_weights - 1 : n_weights;
+
+  if (mb->cell_bi.gnum_range[1] > mb->cell_bi.gnum_range[0])
+    n_cells = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+
+  BFT_MALLOC(cell_weight, n_cells*n_weights, float);
+
+  for (cs_lnum_t i = 0; i < n_cells*n_weights; i++)
+    cell_weight[i] = 1;
+
+  /* User-defined weights */
+
+  if (_part_cell_weights_func != NULL && _part_n_cell_weights > 0) {
+
+    float *u_weight = NULL;
+    cs_coord_t *cell_center = NULL;
+
+    BFT_MALLOC(cell_center, n_cells*3, cs_coord_t);
+
+#if defined(HAVE_MPI)
+    if (cs_glob_n_ranks > 1)
+      _precompute_cell_center_g(mb, cell_center, cs_glob_mpi_comm);
+#endif
+    if (cs_glob_n_ranks == 1)
+      _precompute_cell_center_l(mb, cell_center);
+
+    if (n_u_weights == n_weights)
+      u_weight = cell_weight;
+    else
+      BFT_MALLOC(u_weight, n_cells*n_u_weights, float);
+
+    _part_cell_weights_func(_part_cell_weights_input,
+                            mesh,
+                            mb->cell_bi.gnum_range,
+                            mb->cell_gc_id,
+                            cell_center,
+                            n_u_weights,
+                            u_weight);
+
+    BFT_FREE(cell_center);
+
+    if (u_weight != cell_weight) {
+      for (cs_lnum_t i = 0; i < n_cells; i++) {
+        for (int k = 0; k < n_u_weights; k++)
+          cell_weight[i*n_weights + k] = u_weight[i*n_u_weights + k];
+      }
+      BFT_FREE(u_weight);
+    }
+
+  }
+
+  /* Boundary faces */
+
+  if (_part_b_face_constraint) {
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      cell_weight[i*n_weights + n_weights - 1] = 0;
+    _count_cell_b_faces(mb, n_weights, cell_weight + n_weights - 1);
+  }
+
+  /* Check weights */
+
+  for (cs_lnum_t i = 0; i < n_cells*n_weights; i++) {
+    if (cell_weight[i] < 0)
+      cell_weight[i] = 0;
+  }
+
+  {
+    double *w_sum, *w_max;
+    BFT_MALLOC(w_sum, n_weights*2, double);
+    w_max = w_sum + n_weights;
+
+    _cell_weights_sum_max(n_cells, n_weights, cell_weight, w_sum, w_max);
+
+    for (int k = 0; k < n_weights; k++) {
+      if (w_max[k] <= 0) {
+        bft_printf(_("\n"
+                     " Warning: all partitioning weights for constraint %d\n"
+                     "          are zero; uniform weights are used.\n"),
+                   k);
+        for (cs_lnum_t i = 0; i < n_cells; i++)
+          cell_weight[i*n_weights + k] = 1;
+      }
+    }
+
+    BFT_FREE(w_sum);
+  }
+
+  return cell_weight;
+}
+
+/*----------------------------------------------------------------------------
+ * Combine multiple cell weights (constraints) into a single weight.
+ *
+ * Each constraint is normalized by its global mean, so that all
+ * constraints have a similar influence on the combined weight.
+ *
+ * parameters:
+ *   n_g_cells   <-- global number of cells
+ *   n_cells     <-- number of local cells
+ *   n_weights   <-- number of weights per cell
+ *   cell_weight <-- cell weights (interlaced)
+ *
+ * returns:
+ *   pointer to allocated combined cell weights
+ *----------------------------------------------------------------------------*/
+
+static float *
+_combine_cell_weights(cs_gnum_t     n_g_cells,
+                      cs_lnum_t     n_cells,
+                      int           n_weights,
+                      const float   cell_weight[])
+{
+  float *c_cell_weight = NULL;
+  double *w_sum, *w_max;
+
+  BFT_MALLOC(c_cell_weight, n_cells, float);
+  BFT_MALLOC(w_sum, n_weights*2, double);
+  w_max = w_sum + n_weights;
+
+  _cell_weights_sum_max(n_cells, n_weights, cell_weight, w_sum, w_max);
+
+  /* Replace sums by normalization factors */
+
+  for (int k = 0; k < n_weights; k++)
+    w_sum[k] = ((double)n_g_cells / w_sum[k]) / n_weights;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    double w = 0;
+    for (int k = 0; k < n_weights; k++)
+      w += cell_weight[i*n_weights + k] * w_sum[k];
+    c_cell_weight[i] = w;
+  }
+
+  BFT_FREE(w_sum);
+
+  return c_cell_weight;
+}
+
+/*----------------------------------------------------------------------------
+ * Display the distribution of cell weights per partition.
+ *
+ * parameters:
+ *   cell_range  <-- first and past-the-last cell numbers for this rank
+ *   n_parts     <-- number of partitions
+ *   part        <-- cell partition number
+ *   n_weights   <-- number of weights per cell
+ *   cell_weight <-- cell weights (interlaced)
+ *----------------------------------------------------------------------------*/
+
+static void
+_cell_part_weights_info(const cs_gnum_t   cell_range[2],
+                        int               n_parts,
+                        const int         part[],
+                        int               n_weights,
+                        const float       cell_weight[])
+{
+  size_t n_cells = 0;
+  double *part_w = NULL;
+
+  if (cell_range[1] > cell_range[0])
+    n_cells = cell_range[1] - cell_range[0];
+
+  if (n_parts <= 1 || n_weights < 1)
+    return;
+
+  BFT_MALLOC(part_w, n_parts*n_weights, double);
+
+  for (int i = 0; i < n_parts*n_weights; i++)
+    part_w[i] = 0;
+
+  for (size_t j = 0; j < n_cells; j++) {
+    for (int k = 0; k < n_weights; k++)
+      part_w[part[j]*n_weights + k] += cell_weight[j*n_weights + k];
+  }
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+    double *part_w_sum;
+    BFT_MALLOC(part_w_sum, n_parts*n_weights, double);
+    MPI_Allreduce(part_w, part_w_sum, n_parts*n_weights,
+                  MPI_DOUBLE, MPI_SUM, cs_glob_mpi_comm);
+    BFT_FREE(part_w);
+    part_w = part_w_sum;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  bft_printf(_("\n  Cell weights per domain:\n"));
+
+  for (int k = 0; k < n_weights; k++) {
+
+    double w_min = part_w[k], w_max = part_w[k], w_mean = 0;
+
+    for (int i = 0; i < n_parts; i++) {
+      double w = part_w[i*n_weights + k];
+      w_min = CS_MIN(w_min, w);
+      w_max = CS_MAX(w_max, w);
+      w_mean += w;
+    }
+    w_mean /= n_parts;
+
+    bft_printf(_("    constraint %d: min %12.5g, max %12.5g,"
+                 " imbalance (max/mean) %6.3f\n"),
+               k, w_min, w_max, (w_mean > 0) ? w_max/w_mean : 1.);
+  }
+
+  BFT_FREE(part_w);
+}
+
+/*----------------------------------------------------------------------------
+ * Define cell ranks using weighted splitting of a space-filling curve.
+ *
+ * parameters:
+ *   n_g_cells   <-- global number of cells
+ *   n_ranks     <-- number of ranks in partition
+ *   n_cells     <-- number of local cells
+ *   cell_num    <-- global cell number along space-filling curve
+ *   cell_weight <-- cell weights
+ *   cell_rank   --> cell rank
+ *----------------------------------------------------------------------------*/
+
+static void
+_cell_rank_by_weighted_sfc(cs_gnum_t        n_g_cells,
+                           int              n_ranks,
+                           cs_lnum_t        n_cells,
+                           const cs_gnum_t  cell_num[],
+                           const float      cell_weight[],
+                           int              cell_rank[])
+{
+  cs_lnum_t n_s_cells = n_cells;
+  double w_loc = 0, w_start = 0, w_tot = 0;
+
+  float *s_weight = NULL;
+  int *s_rank = NULL;
+
+#if defined(HAVE_MPI)
+  cs_block_dist_info_t bi;
+  cs_datatype_t int_type = (sizeof(int) == 8) ? CS_INT64 : CS_INT32;
+#endif
+
+  /* Order weights along curve */
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                     cs_glob_n_ranks,
+                                     1,
+                                     0,
+                                     n_g_cells);
+
+    n_s_cells = 0;
+    if (bi.gnum_range[1] > bi.gnum_range[0])
+      n_s_cells = bi.gnum_range[1] - bi.gnum_range[0];
+
+    BFT_MALLOC(s_weight, n_s_cells, float);
+
+    cs_part_to_block_t *d
+      = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                        bi,
+                                        n_cells,
+                                        cell_num);
+
+    cs_part_to_block_copy_array(d, CS_FLOAT, 1, cell_weight, s_weight);
+
+    cs_part_to_block_destroy(&d);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (cs_glob_n_ranks == 1) {
+    BFT_MALLOC(s_weight, n_s_cells, float);
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      s_weight[cell_num[i] - 1] = cell_weight[i];
+  }
+
+  /* Weight of preceding portions of the curve */
+
+  for (cs_lnum_t i = 0; i < n_s_cells; i++)
+    w_loc += s_weight[i];
+
+  w_tot = w_loc;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    MPI_Exscan(&w_loc, &w_start, 1, MPI_DOUBLE, MPI_SUM, cs_glob_mpi_comm);
+    if (cs_glob_rank_id == 0)
+      w_start = 0;
+    MPI_Allreduce(&w_loc, &w_tot, 1, MPI_DOUBLE, MPI_SUM, cs_glob_mpi_comm);
+  }
+#endif
+
+  /* Split curve in portions of equal weight; a cell is assigned
+     to the portion containing its mid-point */
+
+  BFT_MALLOC(s_rank, n_s_cells, int);
+
+  {
+    double w_part = w_tot / n_ranks;
+    double w_acc = w_start;
+
+    for (cs_lnum_t i = 0; i < n_s_cells; i++) {
+      double w_mid = w_acc + 0.5*s_weight[i];
+      int r = (w_part > 0) ? (int)(w_mid / w_part) : 0;
+      s_rank[i] = CS_MIN(CS_MAX(r, 0), n_ranks - 1);
+      w_acc += s_weight[i];
+    }
+  }
+
+  BFT_FREE(s_weight);
+
+  /* Return ranks to initial distribution */
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_block_to_part_t *d
+      = cs_block_to_part_create_by_gnum(cs_glob_mpi_comm,
+                                        bi,
+                                        n_cells,
+                                        cell_num);
+
+    cs_block_to_part_copy_array(d, int_type, 1, s_rank, cell_rank);
+
+    cs_block_to_part_destroy(&d);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (cs_glob_n_ranks == 1) {
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      cell_rank[i] = s_rank[cell_num[i] - 1];
+  }
+
+  BFT_FREE(s_rank);
+}
+
 /*----------------------------------------------------------------------------
  * Define cell ranks using a space-filling curve.
  *
@@ -939,6 +1464,7 @@ _precompute_cell_center_l(const cs_mesh_builder_t  *mb,
  *   n_ranks     <-- number of ranks in partition
  *   mb          <-- pointer to mesh builder helper structure
  *   sfc_type    <-- type of space-filling curve
+ *   cell_weight <-- cell weights, or NULL
  *   cell_rank   --> cell rank (1 to n numbering)
  *   comm        <-- associated MPI communicator
  *----------------------------------------------------------------------------*/
@@ -950,6 +1476,7 @@ _cell_rank_by_sfc(cs_gnum_t                 n_g_cells,
                   int                       n_ranks,
                   const cs_mesh_builder_t  *mb,
                   fvm_io_num_sfc_t          sfc_type,
+                  const float               cell_weight[],
                   int                       cell_rank[],
                   MPI_Comm                  comm)
 
@@ -960,6 +1487,7 @@ _cell_rank_by_sfc(cs_gnum_t                 n_g_cells,
                   int                       n_ranks,
                   const cs_mesh_builder_t  *mb,
                   fvm_io_num_sfc_t          sfc_type,
+                  const float               cell_weight[],
                   int                       cell_rank[])
 
 #endif
@@ -1005,7 +1533,15 @@ _cell_rank_by_sfc(cs_gnum_t                 n_g_cells,
 
   /* Determine rank based on global numbering with SFC ordering; */
 
-  if (_part_uniform_sfc_block_size == false) {
+  if (cell_weight != NULL && _part_uniform_sfc_block_size == false)
+    _cell_rank_by_weighted_sfc(n_g_cells,
+                               n_ranks,
+                               n_cells,
+                               cell_num,
+                               cell_weight,
+                               cell_rank);
+
+  else if (_part_uniform_sfc_block_size == false) {
 
     cs_gnum_t cells_per_rank = n_g_cells / n_ranks;
     cs_lnum_t rmdr = n_g_cells - cells_per_rank * (cs_gnum_t)n_ranks;
@@ -1035,6 +1571,12 @@ _cell_rank_by_sfc(cs_gnum_t                 n_g_cells,
        ranks will have no data (a solution to this would be
        to build a slightly smaller MPI communicator). */
 
+    if (cell_weight != NULL) {
+      cs_base_warn(__FILE__, __LINE__);
+      bft_printf(_("Partitioning by space-filling curve with uniform\n"
+                   "block size requested, so cell weights are ignored.\n"));
+    }
+
     for (i = 0; i < n_cells; i++) {
       cell_rank[i] = ((cell_num[i] - 1) / block_size);
       assert(cell_rank[i] > -1 && cell_rank[i] < n_ranks);
@@ -1338,22 +1880,26 @@ _metis_cell_cells(size_t       n_cells,
  * parameters:
  *   n_cells       <-- number of cells in mesh
  *   n_parts       <-- number of partitions
+ *   n_weights     <-- number of weights (constraints) per cell
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_weight   <-- cell weights (interlaced), or NULL
  *   cell_part     --> cell partition
  *----------------------------------------------------------------------------*/
 
 static void
 _part_metis(size_t   n_cells,
             int      n_parts,
+            int      n_weights,
             idx_t   *cell_idx,
             idx_t   *cell_neighbors,
+            idx_t   *cell_weight,
             int     *cell_part)
 {
   size_t i;
   double  start_time, end_time;
 
-  idx_t   _n_constraints = 1;
+  idx_t   _n_constraints = (cell_weight != NULL) ? n_weights : 1;
 
   idx_t    edgecut    = 0; /* <-- Number of faces on partition */
 
@@ -1380,7 +1926,7 @@ _part_metis(size_t   n_cells,
                              &_n_constraints,
                              cell_idx,
                              cell_neighbors,
-                             NULL,       /* vwgt:   cell weights */
+                             cell_weight, /* vwgt: cell weights */
                              NULL,       /* vsize:  size of the vertices */
                              NULL,       /* adjwgt: face weights */
                              &_n_parts,
@@ -1403,7 +1949,7 @@ _part_metis(size_t   n_cells,
                         &_n_constraints,
                         cell_idx,
                         cell_neighbors,
-                        NULL,       /* vwgt:   cell weights */
+                        cell_weight, /* vwgt: cell weights */
                         NULL,       /* vsize:  size of the vertices */
                         NULL,       /* adjwgt: face weights */
                         &_n_parts,
@@ -1445,8 +1991,10 @@ _part_metis(size_t   n_cells,
  *   n_g_cells     <-- global number of cells
  *   cell_range    <-- first and past-the-last cell numbers for this rank
  *   n_parts       <-- number of partitions
+ *   n_weights     <-- number of weights (constraints) per cell
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_weight   <-- cell weights (interlaced), or NULL
  *   cell_part     --> cell partition
  *   comm          <-- associated MPI communicator
  *----------------------------------------------------------------------------*/
@@ -1455,8 +2003,10 @@ static void
 _part_parmetis(cs_gnum_t   n_g_cells,
                cs_gnum_t   cell_range[2],
                int         n_parts,
+               int         n_weights,
                idx_t      *cell_idx,
                idx_t      *cell_neighbors,
+               idx_t      *cell_weight,
                int        *cell_part,
                MPI_Comm    comm)
 {
@@ -1520,19 +2070,31 @@ _part_parmetis(cs_gnum_t   n_g_cells,
     idx_t  wgtflag  = 0; /* No weighting for faces or cells */
 
     real_t wgt = 1.0/n_parts;
-    real_t ubvec[]  = {1.5};
+    real_t *ubvec = NULL;
     real_t *tpwgts = NULL;
 
-    BFT_MALLOC(tpwgts, n_parts, real_t);
+    if (cell_weight != NULL) {
+      ncon = n_weights;
+      wgtflag = 2;       /* Weights on cells only */
+    }
+
+    BFT_MALLOC(ubvec, ncon, real_t);
+    BFT_MALLOC(tpwgts, n_parts*ncon, real_t);
 
-    for (j = 0; j < n_parts; j++)
+    /* Tighter load imbalance tolerance for weighted cells, as
+       weights are expected to represent the actual cost */
+
+    for (j = 0; j < ncon; j++)
+      ubvec[j] = (cell_weight != NULL) ? 1.05 : 1.5;
+
+    for (j = 0; j < n_parts*ncon; j++)
       tpwgts[j] = wgt;
 
     int retval = ParMETIS_V3_PartKway
                    (vtxdist,
                     cell_idx,
                     cell_neighbors,
-                    NULL,       /* vwgt:   cell weights */
+                    cell_weight, /* vwgt: cell weights */
                     NULL,       /* adjwgt: face weights */
                     &wgtflag,
                     &numflag,
@@ -1546,6 +2108,7 @@ _part_parmetis(cs_gnum_t   n_g_cells,
                     &comm);
 
     BFT_FREE(tpwgts);
+    BFT_FREE(ubvec);
 
     edgecut = _edgecut;
 
@@ -1837,6 +2400,7 @@ _scotch_cell_cells(size_t        n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_weight   <-- cell weights, or NULL
  *   cell_part     --> cell partition
  *----------------------------------------------------------------------------*/
 
@@ -1845,6 +2409,7 @@ _part_scotch(SCOTCH_Num   n_cells,
              int          n_parts,
              SCOTCH_Num  *cell_idx,
              SCOTCH_Num  *cell_neighbors,
+             SCOTCH_Num  *cell_weight,
              int         *cell_part)
 {
   SCOTCH_Num  i;
@@ -1882,7 +2447,7 @@ _part_scotch(SCOTCH_Num   n_cells,
                         n_cells,            /* vertnbr */
                         cell_idx,           /* verttab */
                         NULL,               /* vendtab: verttab + 1 or NULL */
-                        NULL,               /* velotab: vertex weights */
+                        cell_weight,        /* velotab: vertex weights */
                         NULL,               /* vlbltab; vertex labels */
                         cell_idx[n_cells],  /* edgenbr */
                         cell_neighbors,     /* edgetab */
@@ -1958,6 +2523,7 @@ _part_scotch(SCOTCH_Num   n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_weight   <-- cell weights, or NULL
  *   cell_part     --> cell partition
  *   comm          <-- associated MPI communicator
  *----------------------------------------------------------------------------*/
@@ -1968,6 +2534,7 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
                int          n_parts,
                SCOTCH_Num  *cell_idx,
                SCOTCH_Num  *cell_neighbors,
+               SCOTCH_Num  *cell_weight,
                int         *cell_part,
                MPI_Comm     comm)
 {
@@ -2011,7 +2578,7 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
                 n_cells,            /* vertlocmax (= vertlocnbr) */
                 cell_idx,           /* vertloctab */
                 NULL,               /* vendloctab: vertloctab + 1 or NULL */
-                NULL,               /* veloloctab: vertex weights */
+                cell_weight,        /* veloloctab: vertex weights */
                 NULL,               /* vlblloctab; vertex labels */
                 cell_idx[n_cells],  /* edgelocnbr */
                 cell_idx[n_cells],  /* edgelocsiz */
@@ -2298,6 +2865,122 @@ _distribute_output(const cs_mesh_builder_t   *mb,
 #endif /* defined(HAVE_MPI) */
 }
 
+/*----------------------------------------------------------------------------
+ * Compute scaling factors for conversion of cell weights to integers.
+ *
+ * Weights are scaled so as to preserve sufficient resolution while
+ * ensuring the global sum of integer weights for a constraint does not
+ * overflow 32-bit integers.
+ *
+ * parameters:
+ *   n_cells     <-- number of local cells
+ *   n_weights   <-- number of weights per cell
+ *   cell_weight <-- cell weights (interlaced)
+ *   scale       --> scaling factor for each constraint
+ *----------------------------------------------------------------------------*/
+
+static void
+_cell_weights_int_scale(cs_lnum_t     n_cells,
+                        int           n_weights,
+                        const float   cell_weight[],
+                        double        scale[])
+{
+  const double w_int_max = 1000.;
+  const double w_int_sum_max = 1073741824.; /* 2^30 */
+
+  double *w_sum, *w_max;
+
+  BFT_MALLOC(w_sum, n_weights*2, double);
+  w_max = w_sum + n_weights;
+
+  _cell_weights_sum_max(n_cells, n_weights, cell_weight, w_sum, w_max);
+
+  for (int k = 0; k < n_weights; k++) {
+    scale[k] = w_int_max / w_max[k];
+    if (w_sum[k]*scale[k] > w_int_sum_max)
+      scale[k] = w_int_sum_max / w_sum[k];
+  }
+
+  BFT_FREE(w_sum);
+}
+
+/*----------------------------------------------------------------------------
+ * Distribute cell weights from mesh builder block info so as to match
+ * partitioning input.
+ *
+ * parameters:
+ *   mb           <-- pointer to mesh builder structure
+ *   rank_step    <-- Step between active partitioning ranks
+ *                    (1 in basic case, > 1 if we seek to partition on a
+ *                    reduced number of ranks)
+ *   n_g_cells    <-- global number of cells
+ *   n_weights    <-- number of weights per cell
+ *   cell_weight  <-- cell weights (interlaced) on mesh builder blocks
+ *
+ * returns:
+ *   pointer to cell weights matching partitioning input (cell_weight
+ *   if no redistribution is needed, newly allocated array otherwise)
+ *----------------------------------------------------------------------------*/
+
+static float *
+_distribute_input_weights(const cs_mesh_builder_t   *mb,
+                          int                        rank_step,
+                          cs_gnum_t                  n_g_cells,
+                          int                        n_weights,
+                          float                      cell_weight[])
+{
+  float *p_cell_weight = cell_weight;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1 && (mb->cell_bi.rank_step != rank_step)) {
+
+    cs_gnum_t i;
+    cs_gnum_t n_b_cells = 0, n_p_cells = 0;
+
+    cs_part_to_block_t *d = NULL;
+    cs_gnum_t *global_cell_num = NULL;
+
+    cs_block_dist_info_t cell_bi
+      = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                    cs_glob_n_ranks,
+                                    rank_step,
+                                    0,
+                                    n_g_cells);
+
+    if (mb->cell_bi.gnum_range[1] > mb->cell_bi.gnum_range[0])
+      n_b_cells = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+
+    if (cell_bi.gnum_range[1] > cell_bi.gnum_range[0])
+      n_p_cells = cell_bi.gnum_range[1] - cell_bi.gnum_range[0];
+
+    BFT_MALLOC(p_cell_weight, n_p_cells*n_weights, float);
+    BFT_MALLOC(global_cell_num, n_b_cells, cs_gnum_t);
+
+    for (i = 0; i < n_b_cells; i++)
+      global_cell_num[i] = mb->cell_bi.gnum_range[0] + i;
+
+    d = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                        cell_bi,
+                                        n_b_cells,
+                                        global_cell_num);
+    cs_part_to_block_transfer_gnum(d, global_cell_num);
+    global_cell_num = NULL;
+
+    cs_part_to_block_copy_array(d,
+                                CS_FLOAT,
+                                n_weights,
+                                cell_weight,
+                                p_cell_weight);
+
+    cs_part_to_block_destroy(&d);
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  return p_cell_weight;
+}
+
 #endif /*    defined(HAVE_METIS) || defined(HAVE_PARMETIS) \
           || defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH) */
 
@@ -2939,6 +3622,21 @@ cs_partition_set_write_level(int  write_flag)
   _part_write_output = write_flag;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return partitioning write to file option.
+ *
+ * \return  option to save partitioning information
+ *          (see \ref cs_partition_set_write_level)
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_partition_get_write_level(void)
+{
+  return _part_write_output;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define hints indicating if initial partitioning fo a preprocessing
@@ -3041,6 +3739,64 @@ cs_partition_add_partitions(int  n_extra_partitions,
            sizeof(int)*n_extra_partitions);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define cell weights for partitioning.
+ *
+ * When weights are defined, graph-based partitioners (METIS, SCOTCH)
+ * and space-filling curve based partitioning seek to balance the sum of
+ * cell weights per domain rather than the number of cells.
+ *
+ * ParMETIS and METIS handle multiple constraints natively. With SCOTCH or
+ * space-filling curves, constraints are combined into a single weight, in
+ * which each constraint is normalized by its global mean. Block
+ * partitioning ignores weights.
+ *
+ * \param[in]  n_weights  number of weights (constraints) per cell, or 0
+ *                        to deactivate user-defined weights
+ * \param[in]  func       pointer to weights definition function, or NULL
+ * \param[in]  input      pointer to optional (untyped) value or structure
+ *                        for func; must remain available until
+ *                        partitioning is done
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_cell_weights(int                           n_weights,
+                              cs_partition_cell_weights_t  *func,
+                              void                         *input)
+{
+  if (n_weights < 1 || func == NULL) {
+    _part_n_cell_weights = 0;
+    _part_cell_weights_func = NULL;
+    _part_cell_weights_input = NULL;
+  }
+  else {
+    _part_n_cell_weights = n_weights;
+    _part_cell_weights_func = func;
+    _part_cell_weights_input = input;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if the number of boundary faces per cell should be used
+ *        as an additional partitioning constraint.
+ *
+ * This constraint is appended to those defined with
+ * \ref cs_partition_set_cell_weights, or to a uniform cell weight
+ * (i.e. the cell count) if no weights are defined.
+ *
+ * \param[in]  balance_b_faces  true if boundary faces should be balanced
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_b_face_constraint(bool  balance_b_faces)
+{
+  _part_b_face_constraint = balance_b_faces;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Partition mesh based on current options.
@@ -3072,6 +3828,10 @@ cs_partition(cs_mesh_t             *mesh,
   cs_lnum_t  n_faces = 0;
   cs_gnum_t  *face_cells = NULL;
 
+  int  n_weights = 0;
+  float  *cell_weight = NULL;    /* cell weights on mesh builder blocks */
+  float  *c_cell_weight = NULL;  /* combined cell weights, if needed */
+
   /* Initialize local options */
 
   if (stage == CS_PARTITION_MAIN) {
@@ -3143,6 +3903,32 @@ cs_partition(cs_mesh_t             *mesh,
 
   }
 
+  /* Compute cell weights if required (on mesh builder blocks);
+     only METIS handles multiple constraints, so they are combined
+     for other algorithms */
+
+  if (_algorithm != CS_PARTITION_BLOCK)
+    n_weights = _n_cell_weights();
+
+  if (n_weights > 0) {
+
+    cell_weight = _cell_weights(mesh, mb, n_weights);
+
+    if (n_weights > 1 && _algorithm != CS_PARTITION_METIS) {
+      bft_printf(_("\n"
+                   " Combining %d partitioning constraints into a single"
+                   " cell weight.\n"),
+                 n_weights);
+      c_cell_weight
+        = _combine_cell_weights(mesh->n_g_cells,
+                                (  mb->cell_bi.gnum_range[1]
+                                 - mb->cell_bi.gnum_range[0]),
+                                n_weights,
+                                cell_weight);
+    }
+
+  }
+
   /* Build and partition graph */
 
 #if defined(HAVE_METIS) || defined(HAVE_PARMETIS)
@@ -3151,7 +3937,7 @@ cs_partition(cs_mesh_t             *mesh,
 
     int  i;
     cs_timer_t  t2;
-    idx_t  *cell_idx = NULL, *cell_neighbors = NULL;
+    idx_t  *cell_idx = NULL, *cell_neighbors = NULL, *vwgt = NULL;
 
     _metis_cell_cells(n_cells,
                       n_faces,
@@ -3163,6 +3949,36 @@ cs_partition(cs_mesh_t             *mesh,
     if (face_cells != mb->face_cells)
       BFT_FREE(face_cells);
 
+    if (cell_weight != NULL) {
+
+      double  *scale = NULL;
+      float  *p_cell_weight
+        = _distribute_input_weights(mb,
+                                    _part_rank_step[stage],
+                                    mesh->n_g_cells,
+                                    n_weights,
+                                    cell_weight);
+
+      BFT_MALLOC(scale, n_weights, double);
+      _cell_weights_int_scale((  mb->cell_bi.gnum_range[1]
+                               - mb->cell_bi.gnum_range[0]),
+                              n_weights,
+                              cell_weight,
+                              scale);
+
+      BFT_MALLOC(vwgt, n_cells*n_weights, idx_t);
+      for (cs_lnum_t j = 0; j < n_cells; j++) {
+        for (int k = 0; k < n_weights; k++)
+          vwgt[j*n_weights + k]
+            = p_cell_weight[j*n_weights + k]*scale[k] + 0.5;
+      }
+
+      BFT_FREE(scale);
+      if (p_cell_weight != cell_weight)
+        BFT_FREE(p_cell_weight);
+
+    }
+
     t2 = cs_timer_time();
     dt = cs_timer_diff(&t0, &t2);
 
@@ -3200,8 +4016,10 @@ cs_partition(cs_mesh_t             *mesh,
           _part_parmetis(mesh->n_g_cells,
                          cell_range,
                          n_ranks,
+                         n_weights,
                          cell_idx,
                          cell_neighbors,
+                         vwgt,
                          cell_part,
                          part_comm);
 
@@ -3212,6 +4030,10 @@ cs_partition(cs_mesh_t             *mesh,
 
         _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
 
+        if (cell_weight != NULL)
+          _cell_part_weights_info(mb->cell_bi.gnum_range, n_ranks, cell_part,
+                                  n_weights, cell_weight);
+
         if (write_output || i < n_extra_partitions)
           _write_output(mesh->n_g_cells,
                         mb->cell_bi.gnum_range,
@@ -3247,8 +4069,10 @@ cs_partition(cs_mesh_t             *mesh,
         if (cs_glob_rank_id < 0 || (cs_glob_rank_id % _part_rank_step[stage] == 0))
           _part_metis(n_cells,
                       n_ranks,
+                      n_weights,
                       cell_idx,
                       cell_neighbors,
+                      vwgt,
                       cell_part);
 
         _distribute_output(mb,
@@ -3258,6 +4082,10 @@ cs_partition(cs_mesh_t             *mesh,
 
         _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
 
+        if (cell_weight != NULL)
+          _cell_part_weights_info(mb->cell_bi.gnum_range, n_ranks, cell_part,
+                                  n_weights, cell_weight);
+
         if (write_output || i < n_extra_partitions)
           _write_output(mesh->n_g_cells,
                         mb->cell_bi.gnum_range,
@@ -3268,6 +4096,7 @@ cs_partition(cs_mesh_t             *mesh,
 
     BFT_FREE(cell_idx);
     BFT_FREE(cell_neighbors);
+    BFT_FREE(vwgt);
   }
 
 #endif /* defined(HAVE_METIS) || defined(HAVE_PARMETIS) */
@@ -3278,7 +4107,7 @@ cs_partition(cs_mesh_t             *mesh,
 
     int  i;
     cs_timer_t  t2;
-    SCOTCH_Num  *cell_idx = NULL, *cell_neighbors = NULL;
+    SCOTCH_Num  *cell_idx = NULL, *cell_neighbors = NULL, *velotab = NULL;
 
     _scotch_cell_cells(n_cells,
                        n_faces,
@@ -3290,6 +4119,33 @@ cs_partition(cs_mesh_t             *mesh,
     if (face_cells != mb->face_cells)
       BFT_FREE(face_cells);
 
+    if (cell_weight != NULL) {
+
+      double  scale = 1;
+      float  *s_cell_weight
+        = (c_cell_weight != NULL) ? c_cell_weight : cell_weight;
+      float  *p_cell_weight
+        = _distribute_input_weights(mb,
+                                    _part_rank_step[stage],
+                                    mesh->n_g_cells,
+                                    1,
+                                    s_cell_weight);
+
+      _cell_weights_int_scale((  mb->cell_bi.gnum_range[1]
+                               - mb->cell_bi.gnum_range[0]),
+                              1,
+                              s_cell_weight,
+                              &scale);
+
+      BFT_MALLOC(velotab, n_cells, SCOTCH_Num);
+      for (cs_lnum_t j = 0; j < n_cells; j++)
+        velotab[j] = p_cell_weight[j]*scale + 0.5;
+
+      if (p_cell_weight != s_cell_weight)
+        BFT_FREE(p_cell_weight);
+
+    }
+
     t2 = cs_timer_time();
     dt = cs_timer_diff(&t0, &t2);
 
@@ -3329,6 +4185,7 @@ cs_partition(cs_mesh_t             *mesh,
                          n_ranks,
                          cell_idx,
                          cell_neighbors,
+                         velotab,
                          cell_part,
                          part_comm);
 
@@ -3339,6 +4196,10 @@ cs_partition(cs_mesh_t             *mesh,
 
         _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
 
+        if (cell_weight != NULL)
+          _cell_part_weights_info(mb->cell_bi.gnum_range, n_ranks, cell_part,
+                                  n_weights, cell_weight);
+
         if (write_output || i < n_extra_partitions)
           _write_output(mesh->n_g_cells,
                         mb->cell_bi.gnum_range,
@@ -3376,6 +4237,7 @@ cs_partition(cs_mesh_t             *mesh,
                        n_ranks,
                        cell_idx,
                        cell_neighbors,
+                       velotab,
                        cell_part);
 
         _distribute_output(mb,
@@ -3385,6 +4247,10 @@ cs_partition(cs_mesh_t             *mesh,
 
         _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
 
+        if (cell_weight != NULL)
+          _cell_part_weights_info(mb->cell_bi.gnum_range, n_ranks, cell_part,
+                                  n_weights, cell_weight);
+
         if (write_output || i < n_extra_partitions)
           _write_output(mesh->n_g_cells,
                         mb->cell_bi.gnum_range,
@@ -3395,6 +4261,7 @@ cs_partition(cs_mesh_t             *mesh,
 
     BFT_FREE(cell_idx);
     BFT_FREE(cell_neighbors);
+    BFT_FREE(velotab);
   }
 
 #endif /* defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH) */
@@ -3427,14 +4294,21 @@ cs_partition(cs_mesh_t             *mesh,
                         n_ranks,
                         mb,
                         sfc_type,
+                        (c_cell_weight != NULL) ? c_cell_weight : cell_weight,
                         cell_part,
                         cs_glob_mpi_comm);
 #else
-      _cell_rank_by_sfc(mesh->n_g_cells, n_ranks, mb, sfc_type, cell_part);
+      _cell_rank_by_sfc(mesh->n_g_cells, n_ranks, mb, sfc_type,
+                        (c_cell_weight != NULL) ? c_cell_weight : cell_weight,
+                        cell_part);
 #endif
 
       _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
 
+      if (cell_weight != NULL)
+        _cell_part_weights_info(mb->cell_bi.gnum_range, n_ranks, cell_part,
+                                n_weights, cell_weight);
+
       if (write_output || i < n_extra_partitions)
         _write_output(mesh->n_g_cells,
                       mb->cell_bi.gnum_range,
@@ -3454,6 +4328,9 @@ cs_partition(cs_mesh_t             *mesh,
 
   }
 
+  BFT_FREE(c_cell_weight);
+  BFT_FREE(cell_weight);
+
   /* Reset extra partitions list if used */
 
   if (n_extra_partitions > 0) {
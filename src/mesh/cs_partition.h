@@ -115,6 +115,36 @@ typedef enum {
 
 } cs_partition_algorithm_t;
 
+/*----------------------------------------------------------------------------
+ * Function pointer for definition of cell weights for partitioning.
+ *
+ * Weights are defined on the mesh builder's block distribution, before the
+ * mesh is partitioned, so only global cell numbers, cell family numbers,
+ * and approximate cell centers are available at this stage. Each cell
+ * has n_weights values (interlaced), each corresponding to a balancing
+ * constraint; weights must be non-negative, and a cell with uniform
+ * cost would typically have a weight of 1.
+ *
+ * parameters:
+ *   input       <-> pointer to optional (untyped) value or structure
+ *   mesh        <-- pointer to mesh structure (for family definitions)
+ *   cell_range  <-- first and past-the-last global cell numbers
+ *                   for this rank
+ *   cell_family <-- family number of each local cell
+ *   cell_center <-- approximate center of each local cell (interlaced)
+ *   n_weights   <-- number of weights (constraints) per cell
+ *   cell_weight --> weights of each local cell (interlaced)
+ *----------------------------------------------------------------------------*/
+
+typedef void
+(cs_partition_cell_weights_t) (void              *input,
+                               const cs_mesh_t   *mesh,
+                               const cs_gnum_t    cell_range[2],
+                               const int          cell_family[],
+                               const cs_coord_t   cell_center[],
+                               int                n_weights,
+                               float              cell_weight[]);
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -169,6 +199,17 @@ cs_partition_set_algorithm(cs_partition_stage_t      stage,
 void
 cs_partition_set_write_level(int  write_flag);
 
+/*----------------------------------------------------------------------------
+ * Return partitioning write to file option.
+ *
+ * returns:
+ *   option to save partitioning information (see
+ *   cs_partition_set_write_level)
+ *----------------------------------------------------------------------------*/
+
+int
+cs_partition_get_write_level(void);
+
 /*----------------------------------------------------------------------------
  * Define hints indicating if initial partitioning fo a preprocessing
  * stage is required.
@@ -224,6 +265,47 @@ void
 cs_partition_add_partitions(int  n_extra_partitions,
                             int  extra_partitions_list[]);
 
+/*----------------------------------------------------------------------------
+ * Define cell weights for partitioning.
+ *
+ * When weights are defined, graph-based partitioners (METIS, SCOTCH)
+ * and space-filling curve based partitioning seek to balance the sum of
+ * cell weights per domain rather than the number of cells.
+ *
+ * ParMETIS and METIS handle multiple constraints natively. With SCOTCH or
+ * space-filling curves, constraints are combined into a single weight, in
+ * which each constraint is normalized by its global mean. Block
+ * partitioning ignores weights.
+ *
+ * parameters:
+ *   n_weights <-- number of weights (constraints) per cell, or 0 to
+ *                 deactivate user-defined weights
+ *   func      <-- pointer to weights definition function, or NULL
+ *   input     <-- pointer to optional (untyped) value or structure
+ *                 for func; must remain available until partitioning
+ *                 is done
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_cell_weights(int                           n_weights,
+                              cs_partition_cell_weights_t  *func,
+                              void                         *input);
+
+/*----------------------------------------------------------------------------
+ * Indicate if the number of boundary faces per cell should be used as an
+ * additional partitioning constraint.
+ *
+ * This constraint is appended to those defined with
+ * cs_partition_set_cell_weights(), or to a uniform cell weight
+ * (i.e. the cell count) if no weights are defined.
+ *
+ * parameters:
+ *   balance_b_faces <-- true if boundary faces should be balanced
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_b_face_constraint(bool  balance_b_faces);
+
 /*----------------------------------------------------------------------------
  * Compute partitioning for a given mesh.
  *
@@ -278,6 +278,10 @@ cs_user_linear_solvers(void)
    *  CS_SLES_BICGSTAB   (Bi-conjugate gradient stabilized)
    *  CS_SLES_BICGSTAB2  (BiCGStab2)
    *  CS_SLES_GMRES      (generalized minimal residual)
+   *  CS_SLES_PCG_PIPELINED (pipelined conjugate gradient, hiding
+   *                         global reduction latency)
+   *  CS_SLES_GMRES_S_STEP (s-step GMRES, with one global reduction
+   *                        per block of s Krylov vectors)
    *
    *  The multigrid solver uses the conjugate gradient as a smoother
    *  and coarse solver by default, but this behavior may be modified. */
@@ -303,6 +307,28 @@ cs_user_linear_solvers(void)
   }
   /*! [sles_user_1] */
 
+  /* Example: use s-step GMRES for user variable (named user_2) */
+  /*------------------------------------------------------------*/
+
+  BEGIN_EXAMPLE_SCOPE
+
+  /*! [sles_user_2] */
+  cs_field_t *cvar_user_2 = cs_field_by_name_try("user_2");
+  if (cvar_user_2 != NULL) {
+    cs_sles_it_t *c = cs_sles_it_define(cvar_user_2->id,
+                                        NULL,
+                                        CS_SLES_GMRES_S_STEP,
+                                        0,      /* polynomial precond. degree */
+                                        10000); /* n_max_iter */
+
+    /* Build and orthogonalize Krylov vectors by blocks of 6
+       (one global reduction per block) */
+    cs_sles_it_set_s_step(c, 6);
+  }
+  /*! [sles_user_2] */
+
+  END_EXAMPLE_SCOPE
+
   /* Example: increase verbosity parameters for pressure */
   /*-----------------------------------------------------*/
 
@@ -352,6 +378,26 @@ cs_user_linear_solvers(void)
 
   END_EXAMPLE_SCOPE
 
+  /* Example: reuse multigrid hierarchy across time steps for pressure */
+  /*-------------------------------------------------------------------*/
+
+  BEGIN_EXAMPLE_SCOPE
+
+  /*! [sles_mg_reuse] */
+  cs_multigrid_t *mg = cs_multigrid_define(CS_F_(p)->id, NULL);
+
+  /* Keep aggregation and coarse structures between time steps, only
+     recomputing coarse matrix coefficients; fully rebuild the hierarchy
+     every 20 setups, or when the number of cycles exceeds 1.5 times that
+     observed just after the last rebuild. */
+
+  cs_multigrid_set_reuse_options(mg,
+                                 20,    /* rebuild interval (default 1) */
+                                 1.5);  /* cycles ratio for rebuild */
+  /*! [sles_mg_reuse] */
+
+  END_EXAMPLE_SCOPE
+
   /* Set parallel grid merging options for all multigrid solvers */
   /*-------------------------------------------------------------*/
 
@@ -398,6 +444,103 @@ cs_user_linear_solvers(void)
 
   END_EXAMPLE_SCOPE
 
+  /* Example: BiCGStab preconditioned by multigrid for velocity */
+  /*------------------------------------------------------------*/
+
+  BEGIN_EXAMPLE_SCOPE
+
+  /*! [sles_mgp_vector] */
+  {
+    /* Coarsening of block (vector or tensor) systems aggregates all
+       components of a cell together; Jacobi smoothers are used
+       as Gauss-Seidel requires scalar extra-diagonal terms. */
+
+    cs_sles_it_t *c = cs_sles_it_define(CS_F_(u)->id,
+                                        NULL,
+                                        CS_SLES_BICGSTAB,
+                                        -1,
+                                        1000);
+    cs_sles_pc_t *pc = cs_multigrid_pc_create();
+    cs_multigrid_t *mg = cs_sles_pc_get_context(pc);
+    cs_sles_it_transfer_pc(c, &pc);
+
+    cs_multigrid_set_solver_options
+      (mg,
+       CS_SLES_JACOBI, /* descent smoother */
+       CS_SLES_JACOBI, /* ascent smoother */
+       CS_SLES_JACOBI, /* coarse solver */
+       1,              /* n max cycles */
+       2,              /* n max iter for descent */
+       2,              /* n max iter for ascent */
+       100,            /* n max iter coarse solver */
+       0, 0, 0,        /* polynomial precond. degree */
+       -1.0,           /* precision multiplier descent (< 0 forces max iters) */
+       -1.0,           /* precision multiplier ascent (< 0 forces max iters) */
+       1.0);           /* requested precision multiplier coarse */
+  }
+  /*! [sles_mgp_vector] */
+
+  END_EXAMPLE_SCOPE
+
+  /* Example: multigrid with multicolor Gauss-Seidel smoothers */
+  /*-----------------------------------------------------------*/
+
+  BEGIN_EXAMPLE_SCOPE
+
+  /*! [sles_mg_colored_gs] */
+  {
+    /* With OpenMP threads, the multicolor variant keeps a true
+       (symmetric) Gauss-Seidel smoother, whereas the default
+       process-local Gauss-Seidel degrades to a Gauss-Seidel/Jacobi
+       hybrid across thread boundaries. */
+
+    cs_multigrid_t *mg = cs_multigrid_define(CS_F_(p)->id, NULL);
+
+    cs_multigrid_set_solver_options
+      (mg,
+       CS_SLES_P_COLORED_GAUSS_SEIDEL, /* descent smoother */
+       CS_SLES_P_COLORED_GAUSS_SEIDEL, /* ascent smoother */
+       CS_SLES_PCG,                    /* coarse solver */
+       100,            /* n max cycles */
+       1,              /* n max iter for descent */
+       1,              /* n max iter for ascent */
+       500,            /* n max iter coarse solver */
+       0, 0, 0,        /* polynomial precond. degree */
+       -1.0,           /* precision multiplier descent (< 0 forces max iters) */
+       -1.0,           /* precision multiplier ascent (< 0 forces max iters) */
+       1.0);           /* requested precision multiplier coarse */
+  }
+  /*! [sles_mg_colored_gs] */
+
+  END_EXAMPLE_SCOPE
+
+  /* Example: matrix-free operator for a scalar (named scalar1) */
+  /*-----------------------------------------------------------*/
+
+  BEGIN_EXAMPLE_SCOPE
+
+  /*! [sles_matrix_free] */
+  cs_field_t *cvar_s1 = cs_field_by_name_try("scalar1");
+  if (cvar_s1 != NULL) {
+
+    /* Extradiagonal terms are computed from face mass fluxes and
+       viscosities at each matrix.vector product, so they are neither
+       stored nor streamed from memory. Multigrid and Gauss-Seidel
+       require explicit coefficients, so a Krylov solver with Jacobi
+       or polynomial preconditioning must be used. */
+
+    cs_field_set_key_int(cvar_s1, cs_field_key_id("matrix_free"), 1);
+
+    cs_sles_it_define(cvar_s1->id,
+                      NULL,
+                      CS_SLES_BICGSTAB,
+                      0,      /* polynomial precond. degree */
+                      10000); /* n_max_iter */
+  }
+  /*! [sles_matrix_free] */
+
+  END_EXAMPLE_SCOPE
+
   /* Set a non-default linear solver for DOM radiation. */
   /*----------------------------------------------------*/
 
@@ -49,7 +49,9 @@
 
 #include "cs_base.h"
 #include "cs_file.h"
+#include "cs_gradient.h"
 #include "cs_grid.h"
+#include "cs_halo.h"
 #include "cs_matrix.h"
 #include "cs_matrix_default.h"
 #include "cs_parall.h"
@@ -121,11 +123,43 @@ cs_user_matrix_tuning(void)
 
   cs_matrix_variant_destroy(&mv);
 
+  /* Use block compressed sparse row storage for matrices with full
+     extra-diagonal blocks (such as coupled velocity components) */
+
+  mv = cs_matrix_variant_create(CS_MATRIX_BSR,
+                                cs_glob_mesh->i_face_numbering);
+
+  cs_matrix_set_variant(CS_MATRIX_BLOCK, mv);
+
+  cs_matrix_variant_destroy(&mv);
+
   /* Also allow tuning for multigrid for all expected levels
    * (we rarely have more than 10 or 11 levels except for huge meshes). */
 
   cs_grid_set_matrix_tuning(CS_MATRIX_SCALAR_SYM, 12);
 
+  /* Store multigrid coarse matrix extra-diagonal coefficients in single
+     precision (diagonal and vectors remain in double precision). */
+
+  cs_grid_set_mixed_precision(true);
+
+  /* Overlap halo exchanges with the product of rows which do not reference
+     ghost values (for CSR and MSR matrices). This is most effective
+     if cells adjacent to the halo are numbered last
+     (see cs_renumber_set_algorithm in cs_user_numbering). */
+
+  cs_matrix_set_halo_overlap(true);
+
+  /* Use persistent communication plans for halo synchronization
+     (built once per halo, avoiding per-call request setup). */
+
+  cs_halo_set_use_persistent(true);
+
+  /* Cache least-squares gradient geometric weights (recomputed only
+     when the mesh moves), in single precision to reduce memory traffic. */
+
+  cs_gradient_set_lsq_cache(CS_GRADIENT_LSQ_CACHE_FLOAT);
+
   /*! [performance_tuning_matrix] */
 
   END_EXAMPLE_SCOPE
@@ -113,6 +113,8 @@ cs_user_numbering(void)
      CS_RENUMBER_CELLS_METIS_ORDER     (METIS ordering, if available)
      CS_RENUMBER_CELLS_MORTON          (Morton space filling curve)
      CS_RENUMBER_CELLS_HILBERT         (Hilbert space filling curve)
+     CS_RENUMBER_CELLS_RCM             (Reverse Cuthill-McKee)
+     CS_RENUMBER_CELLS_ND              (nested dissection)
      CS_RENUMBER_CELLS_NONE            (no renumbering)
 
      For interior faces, available algorithms are:
@@ -55,6 +55,8 @@
 #include "cs_parall.h"
 #include "cs_partition.h"
 #include "cs_renumber.h"
+#include "cs_restart.h"
+#include "cs_time_moment.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -103,6 +105,8 @@ cs_user_parallel_io(void)
      CS_FILE_STDIO_SERIAL        Serial standard C IO
                                  (funnelled through rank 0 in parallel)
      CS_FILE_STDIO_PARALLEL      Per-process standard C IO
+     CS_FILE_MMAP                Per-process memory-mapped file access
+                                 (for reading only)
      CS_FILE_MPI_INDEPENDENT     Non-collective MPI-IO
                                  with independent file open and close
      CS_FILE_MPI_NON_COLLECTIVE  Non-collective MPI-IO
@@ -157,6 +161,49 @@ cs_user_parallel_io(void)
 
   /*! [perfomance_tuning_parallel_io] */
 
+  /*! [performance_tuning_mmap_read] */
+
+  /* Read files (mesh input, restart) through memory mappings: each rank
+     copies its data directly from the mapping, so ranks on a same node
+     share the system page cache, and repeated reads of a same file
+     (such as when restarting on different rank counts) are inexpensive.
+     This is best suited to node-local or well-cached file systems. */
+
+#if defined(HAVE_MPI)
+  cs_file_set_default_access(CS_FILE_MODE_READ, CS_FILE_MMAP, MPI_INFO_NULL);
+#else
+  cs_file_set_default_access(CS_FILE_MODE_READ, CS_FILE_MMAP);
+#endif
+
+  /*! [performance_tuning_mmap_read] */
+
+  /*! [performance_tuning_async_checkpoint] */
+
+  /* Write checkpoint files asynchronously: sections are staged in memory
+     and written by a helper thread (where the POSIX threads and MPI thread
+     support levels allow it), so that computation may resume during
+     output. Staged data uses additional memory until written.
+     In parallel, MPI_THREAD_MULTIPLE support is only requested at startup
+     when the CS_CHECKPOINT_ASYNC environment variable is set to 1 (which
+     also activates asynchronous writing without this call). */
+
+  cs_restart_checkpoint_set_async(true);
+
+  /*! [performance_tuning_async_checkpoint] */
+
+  /*! [performance_tuning_checkpoint_compression] */
+
+  /* Compress large checkpoint file sections (Zlib level 1 is usually
+     a good compromise between speed and size); time moments, which
+     do not require bit-for-bit restart, may additionally be stored
+     with a given relative precision. */
+
+  cs_restart_set_compression(1);
+
+  cs_time_moment_set_restart_tolerance(1e-6);
+
+  /*! [performance_tuning_checkpoint_compression] */
+
   END_EXAMPLE_SCOPE
 }
 
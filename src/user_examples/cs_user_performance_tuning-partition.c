@@ -50,6 +50,7 @@
 #include "cs_base.h"
 #include "cs_file.h"
 #include "cs_grid.h"
+#include "cs_load_balance.h"
 #include "cs_matrix.h"
 #include "cs_matrix_default.h"
 #include "cs_parall.h"
@@ -76,6 +77,62 @@ BEGIN_C_DECLS
  */
 /*----------------------------------------------------------------------------*/
 
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*! [performance_tuning_partition_weights] */
+
+/*----------------------------------------------------------------------------
+ * Example cell weights definition for partitioning.
+ *
+ * Cells inside a given box (such as a zone with a costly model) are
+ * assumed to be 4 times as costly as other cells.
+ *
+ * parameters:
+ *   input       <-> pointer to box bounds (x_min, y_min, z_min,
+ *                   x_max, y_max, z_max)
+ *   mesh        <-- pointer to mesh structure (for family definitions)
+ *   cell_range  <-- first and past-the-last global cell numbers
+ *                   for this rank
+ *   cell_family <-- family number of each local cell
+ *   cell_center <-- approximate center of each local cell (interlaced)
+ *   n_weights   <-- number of weights (constraints) per cell
+ *   cell_weight --> weights of each local cell (interlaced)
+ *----------------------------------------------------------------------------*/
+
+static void
+_box_cell_weights(void              *input,
+                  const cs_mesh_t   *mesh,
+                  const cs_gnum_t    cell_range[2],
+                  const int          cell_family[],
+                  const cs_coord_t   cell_center[],
+                  int                n_weights,
+                  float              cell_weight[])
+{
+  CS_UNUSED(mesh);
+  CS_UNUSED(cell_family);
+
+  const double *box = input;
+
+  const cs_lnum_t n_cells = cell_range[1] - cell_range[0];
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+
+    const cs_coord_t *c = cell_center + 3*i;
+
+    cell_weight[i*n_weights] = 1.;
+
+    if (   c[0] >= box[0] && c[0] <= box[3]
+        && c[1] >= box[1] && c[1] <= box[4]
+        && c[2] >= box[2] && c[2] <= box[5])
+      cell_weight[i*n_weights] = 4.;
+
+  }
+}
+
+/*! [performance_tuning_partition_weights] */
+
 /*============================================================================
  * User function definitions
  *============================================================================*/
@@ -173,6 +230,50 @@ cs_user_partition(void)
   /*! [performance_tuning_partition_4] */
 
   END_EXAMPLE_SCOPE
+
+  BEGIN_EXAMPLE_SCOPE
+
+  /*! [performance_tuning_partition_5] */
+
+  /* Example: define cell weights so as to balance computational cost
+   * rather than the number of cells, and also balance the number of
+   * boundary faces (as an additional constraint).
+   *
+   * The weights definition function and its input must remain
+   * available until the mesh is partitioned. */
+
+  static double box[] = {0., 0., 0., 1., 1., 2.};
+
+  cs_partition_set_cell_weights(1, _box_cell_weights, box);
+
+  cs_partition_set_b_face_constraint(true);
+
+  /*! [performance_tuning_partition_5] */
+
+  END_EXAMPLE_SCOPE
+
+  BEGIN_EXAMPLE_SCOPE
+
+  /*! [performance_tuning_partition_6] */
+
+  /* Example: monitor load imbalance every 50 time steps, based on the
+   * CPU time of the "operations" timer statistic, and estimating the
+   * cost of a Lagrangian particle as 1/10th of that of a cell.
+   *
+   * If the imbalance remains above 1.25 for 4 successive checks,
+   * a new partitioning is computed and written to "partition_output".
+   * Stopping is also requested here, so the computation stops with a
+   * checkpoint, to be restarted with this partitioning (by default,
+   * the computation continues). */
+
+  cs_load_balance_set_options(50, 4, 1.25);
+  cs_load_balance_set_stop(true);
+  cs_load_balance_set_timer_stats("operations");
+  cs_load_balance_set_particle_cost(0.1);
+
+  /*! [performance_tuning_partition_6] */
+
+  END_EXAMPLE_SCOPE
 }
 
 /*----------------------------------------------------------------------------*/
@@ -117,9 +117,10 @@ main (int argc, char *argv[])
 
 #if defined(HAVE_MPI_IO)
   const int n_pos = 2;
-  const int n_access = 5;
-  const cs_file_access_t access[5] = {CS_FILE_STDIO_SERIAL,
+  const int n_access = 6;
+  const cs_file_access_t access[6] = {CS_FILE_STDIO_SERIAL,
                                       CS_FILE_STDIO_PARALLEL,
+                                      CS_FILE_MMAP,
                                       CS_FILE_MPI_INDEPENDENT,
                                       CS_FILE_MPI_NON_COLLECTIVE,
                                       CS_FILE_MPI_COLLECTIVE};
@@ -127,8 +128,8 @@ main (int argc, char *argv[])
                                              CS_FILE_MPI_INDIVIDUAL_POINTERS};
 #else
   const int n_pos = 1;
-  const int n_access = 1;
-  const int access[1] = {CS_FILE_STDIO_SERIAL};
+  const int n_access = 2;
+  const int access[2] = {CS_FILE_STDIO_SERIAL, CS_FILE_MMAP};
   const cs_file_mpi_positionning_t pos[1] = {CS_FILE_MPI_EXPLICIT_OFFSETS};
 #endif
 
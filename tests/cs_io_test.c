@@ -0,0 +1,543 @@
+/*============================================================================
+ * Unit test for cs_io.c (compressed sections round-trip);
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2016 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <bft_error.h>
+#include <bft_mem.h>
+#include <bft_printf.h>
+
+#include "cs_base.h"
+#include "cs_file.h"
+#include "cs_io.h"
+
+/*---------------------------------------------------------------------------*/
+
+/* Sizes are chosen so that compressed sections span several 1 MiB chunks,
+   with a partial last chunk */
+
+#define N_G_GLOBAL   200003   /* Values of global double section */
+#define N_G_BLOCK    405561   /* Values of block double section */
+#define N_G_ELTS     150001   /* Elements of block integer section */
+#define N_SMALL          100   /* Values of (uncompressed) small section */
+
+static const char _magic[] = "Checkpoint / restart, R0";
+
+/*----------------------------------------------------------------------------
+ * Print message on standard output
+ *----------------------------------------------------------------------------*/
+
+static int _bft_printf_proxy
+(
+ const char     *const format,
+       va_list         arg_ptr
+)
+{
+  static FILE *f = NULL;
+
+  if (f == NULL) {
+    char filename[64];
+    int rank = 0;
+#if defined(HAVE_MPI)
+    if (cs_glob_mpi_comm != MPI_COMM_NULL)
+      MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+#endif
+    sprintf (filename, "cs_io_test_out.%d", rank);
+    f = fopen(filename, "w");
+    assert(f != NULL);
+  }
+
+  return vfprintf(f, format, arg_ptr);
+}
+
+/*----------------------------------------------------------------------------
+ * Stop the code in case of error
+ *----------------------------------------------------------------------------*/
+
+static void
+_bft_error_handler(const char  *filename,
+                   int          line_no,
+                   int          code_err_sys,
+                   const char  *format,
+                   va_list      arg_ptr)
+{
+  bft_printf_flush();
+
+  if (code_err_sys != 0)
+    fprintf(stderr, "\nSystem error: %s\n", strerror(code_err_sys));
+
+  vfprintf(stderr, format, arg_ptr);
+}
+
+/*----------------------------------------------------------------------------
+ * Reference value for a given global value id.
+ *----------------------------------------------------------------------------*/
+
+static inline double
+_ref_val_d(cs_gnum_t  i)
+{
+  return sin(0.001*i)*1000. + 1.e-3*i;
+}
+
+static inline int32_t
+_ref_val_i(cs_gnum_t  i)
+{
+  return (int32_t)(i*7 % 1000003);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute a block range for a given rank.
+ *
+ * With an even split, ranks have (nearly) the same number of elements;
+ * otherwise, rank r has a share proportional to r+1. If partial is true,
+ * only the middle half of the range is kept.
+ *
+ * parameters:
+ *   n_g     <-- global number of elements
+ *   rank    <-- rank id
+ *   size    <-- number of ranks
+ *   even    <-- true for even split
+ *   partial <-- true to keep only the middle half of the range
+ *   range   --> global numbers of first and past-the-end elements (1 to n)
+ *----------------------------------------------------------------------------*/
+
+static void
+_block_range(cs_gnum_t   n_g,
+             int         rank,
+             int         size,
+             bool        even,
+             bool        partial,
+             cs_gnum_t   range[2])
+{
+  if (even) {
+    range[0] = (n_g*rank)/size + 1;
+    range[1] = (n_g*(rank+1))/size + 1;
+  }
+  else {
+    double w = 0.5*size*(size+1);
+    range[0] = n_g*(0.5*rank*(rank+1)/w) + 1;
+    range[1] = n_g*(0.5*(rank+1)*(rank+2)/w) + 1;
+  }
+  if (rank == size - 1)
+    range[1] = n_g + 1;
+
+  if (partial) {
+    cs_gnum_t n = range[1] - range[0];
+    range[0] += n/4;
+    range[1] -= n/4;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Write test file.
+ *
+ * parameters:
+ *   name      <-- file name
+ *   method    <-- file access method
+ *   level     <-- compression level
+ *   tolerance <-- lossy compression tolerance
+ *   rank      <-- rank id
+ *   size      <-- number of ranks
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_test_file(const char        *name,
+                 cs_file_access_t   method,
+                 int                level,
+                 double             tolerance,
+                 int                rank,
+                 int                size)
+{
+  cs_gnum_t range[2];
+
+#if defined(HAVE_MPI)
+  cs_io_t *outp = cs_io_initialize(name, _magic, CS_IO_MODE_WRITE,
+                                   method, CS_IO_ECHO_NONE, MPI_INFO_NULL,
+                                   cs_glob_mpi_comm, cs_glob_mpi_comm);
+#else
+  cs_io_t *outp = cs_io_initialize(name, _magic, CS_IO_MODE_WRITE,
+                                   method, CS_IO_ECHO_NONE);
+#endif
+
+  cs_io_set_compression(outp, level);
+  cs_io_set_lossy_tolerance(outp, tolerance);
+
+  /* Global sections */
+
+  double *g_vals;
+  BFT_MALLOC(g_vals, N_G_GLOBAL, double);
+  for (cs_gnum_t i = 0; i < N_G_GLOBAL; i++)
+    g_vals[i] = _ref_val_d(i);
+
+  cs_io_write_global("small", N_SMALL, 0, 0, 1, CS_DOUBLE, g_vals, outp);
+  cs_io_write_global("global", N_G_GLOBAL, 0, 0, 1, CS_DOUBLE, g_vals, outp);
+
+  BFT_FREE(g_vals);
+
+  /* Block sections */
+
+  _block_range(N_G_BLOCK, rank, size, true, false, range);
+
+  double *b_vals;
+  BFT_MALLOC(b_vals, range[1] - range[0], double);
+  for (cs_gnum_t i = range[0]; i < range[1]; i++)
+    b_vals[i - range[0]] = _ref_val_d(i-1);
+
+  cs_io_write_block_buffer("block_d", N_G_BLOCK, range[0], range[1],
+                           0, 0, 1, CS_DOUBLE, b_vals, outp);
+
+  BFT_FREE(b_vals);
+
+  _block_range(N_G_ELTS, rank, size, true, false, range);
+
+  int32_t *i_vals;
+  BFT_MALLOC(i_vals, (range[1] - range[0])*3, int32_t);
+  for (cs_gnum_t i = (range[0]-1)*3; i < (range[1]-1)*3; i++)
+    i_vals[i - (range[0]-1)*3] = _ref_val_i(i);
+
+  cs_io_write_block_buffer("block_i", N_G_ELTS, range[0], range[1],
+                           1, 0, 3, CS_INT32, i_vals, outp);
+
+  BFT_FREE(i_vals);
+
+  cs_io_finalize(&outp);
+}
+
+/*----------------------------------------------------------------------------
+ * Check values read against reference values.
+ *
+ * parameters:
+ *   sec_name  <-- section name
+ *   elt_type  <-- element type
+ *   start     <-- global id of first value
+ *   n_vals    <-- number of values
+ *   vals      <-- values read
+ *   tolerance <-- relative tolerance for floating-point values
+ *
+ * returns:
+ *   number of values differing from reference
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_check_vals(const char     *sec_name,
+            cs_datatype_t   elt_type,
+            cs_gnum_t       start,
+            cs_gnum_t       n_vals,
+            const void     *vals,
+            double          tolerance)
+{
+  cs_gnum_t n_diffs = 0;
+
+  if (elt_type == CS_DOUBLE) {
+    const double *v = vals;
+    for (cs_gnum_t i = 0; i < n_vals; i++) {
+      double r = _ref_val_d(start + i);
+      if (tolerance > 0) {
+        if (fabs(v[i] - r) > tolerance*fabs(r))
+          n_diffs++;
+      }
+      else if (memcmp(v + i, &r, sizeof(double)) != 0)
+        n_diffs++;
+    }
+  }
+  else {
+    const int32_t *v = vals;
+    for (cs_gnum_t i = 0; i < n_vals; i++) {
+      if (v[i] != _ref_val_i(start + i))
+        n_diffs++;
+    }
+  }
+
+  if (n_diffs > 0)
+    bft_printf("  section \"%s\": %llu values differ from reference\n",
+               sec_name, (unsigned long long)n_diffs);
+
+  return n_diffs;
+}
+
+/*----------------------------------------------------------------------------
+ * Read a section whose header has been read or set, and check values.
+ *
+ * parameters:
+ *   header    <-> section header
+ *   inp       <-> kernel IO structure
+ *   even      <-- true for even block split
+ *   partial   <-- true to read only part of each block
+ *   tolerance <-- relative tolerance for floating-point values
+ *   rank      <-- rank id
+ *   size      <-- number of ranks
+ *
+ * returns:
+ *   number of values differing from reference
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_read_and_check(cs_io_sec_header_t  *header,
+                cs_io_t             *inp,
+                bool                 even,
+                bool                 partial,
+                double               tolerance,
+                int                  rank,
+                int                  size)
+{
+  cs_gnum_t n_diffs = 0;
+  void *vals = NULL;
+
+  if (   strcmp(header->sec_name, "small") == 0
+      || strcmp(header->sec_name, "global") == 0) {
+    vals = cs_io_read_global(header, NULL, inp);
+    n_diffs = _check_vals(header->sec_name, CS_DOUBLE,
+                          0, header->n_vals, vals, tolerance);
+  }
+
+  else if (strcmp(header->sec_name, "block_d") == 0) {
+    cs_gnum_t range[2];
+    _block_range(header->n_vals, rank, size, even, partial, range);
+    vals = cs_io_read_block(header, range[0], range[1], NULL, inp);
+    n_diffs = _check_vals(header->sec_name, CS_DOUBLE,
+                          range[0] - 1, range[1] - range[0], vals,
+                          tolerance);
+  }
+
+  else if (strcmp(header->sec_name, "block_i") == 0) {
+    cs_gnum_t range[2];
+    _block_range(N_G_ELTS, rank, size, even, partial, range);
+    vals = cs_io_read_block(header, range[0], range[1], NULL, inp);
+    n_diffs = _check_vals(header->sec_name, CS_INT32,
+                          (range[0] - 1)*3, (range[1] - range[0])*3, vals,
+                          0.);
+  }
+
+  BFT_FREE(vals);
+
+  return n_diffs;
+}
+
+/*----------------------------------------------------------------------------
+ * Read test file and check values.
+ *
+ * parameters:
+ *   name      <-- file name
+ *   method    <-- file access method
+ *   indexed   <-- true for indexed read, false for sequential read
+ *   even      <-- true for even block split
+ *   partial   <-- true to read only part of each block
+ *   tolerance <-- relative tolerance for floating-point values
+ *   rank      <-- rank id
+ *   size      <-- number of ranks
+ *
+ * returns:
+ *   number of values differing from reference
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_read_test_file(const char        *name,
+                cs_file_access_t   method,
+                bool               indexed,
+                bool               even,
+                bool               partial,
+                double             tolerance,
+                int                rank,
+                int                size)
+{
+  cs_gnum_t n_diffs = 0;
+  int n_read = 0;
+  cs_io_sec_header_t header;
+  cs_io_t *inp = NULL;
+
+  if (indexed) {
+
+#if defined(HAVE_MPI)
+    inp = cs_io_initialize_with_index(name, _magic, method, CS_IO_ECHO_NONE,
+                                      MPI_INFO_NULL,
+                                      cs_glob_mpi_comm, cs_glob_mpi_comm);
+#else
+    inp = cs_io_initialize_with_index(name, _magic, method, CS_IO_ECHO_NONE);
+#endif
+
+    /* Read in reverse order to check positioning */
+
+    for (int id = cs_io_get_index_size(inp) - 1; id >= 0; id--) {
+      cs_io_set_indexed_position(inp, &header, id);
+      n_diffs += _read_and_check(&header, inp, even, partial, tolerance,
+                                 rank, size);
+      n_read++;
+    }
+
+  }
+  else {
+
+#if defined(HAVE_MPI)
+    inp = cs_io_initialize(name, _magic, CS_IO_MODE_READ,
+                           method, CS_IO_ECHO_NONE, MPI_INFO_NULL,
+                           cs_glob_mpi_comm, cs_glob_mpi_comm);
+#else
+    inp = cs_io_initialize(name, _magic, CS_IO_MODE_READ,
+                           method, CS_IO_ECHO_NONE);
+#endif
+
+    while (cs_io_read_header(inp, &header) == 0) {
+      n_diffs += _read_and_check(&header, inp, even, partial, tolerance,
+                                 rank, size);
+      n_read++;
+    }
+
+  }
+
+  cs_io_finalize(&inp);
+
+  if (n_read != 4) {
+    bft_printf("  %d sections read instead of 4\n", n_read);
+    n_diffs++;
+  }
+
+  return n_diffs;
+}
+
+/*---------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  char mem_trace_name[32];
+  char file_name[32];
+  int size = 1;
+  int rank = 0;
+  cs_gnum_t n_diffs = 0;
+
+#if defined(HAVE_MPI_IO)
+  const int n_access = 3;
+  const cs_file_access_t access[3] = {CS_FILE_STDIO_SERIAL,
+                                      CS_FILE_STDIO_PARALLEL,
+                                      CS_FILE_MPI_COLLECTIVE};
+#else
+  const int n_access = 2;
+  const cs_file_access_t access[2] = {CS_FILE_STDIO_SERIAL,
+                                      CS_FILE_STDIO_PARALLEL};
+#endif
+
+  const double tolerance[2] = {0., 1.e-6};
+
+#if defined(HAVE_MPI)
+
+  /* Initialization */
+
+  cs_base_mpi_init(&argc, &argv);
+
+  if (cs_glob_mpi_comm != MPI_COMM_NULL) {
+    MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+    MPI_Comm_size(cs_glob_mpi_comm, &size);
+  }
+
+#endif /* (HAVE_MPI) */
+
+  bft_error_handler_set(_bft_error_handler);
+
+  if (size > 1)
+    sprintf(mem_trace_name, "cs_io_test_mem.%d", rank);
+  else
+    strcpy(mem_trace_name, "cs_io_test_mem");
+  bft_mem_init(mem_trace_name);
+  bft_printf_proxy_set(_bft_printf_proxy);
+
+#if !defined(HAVE_ZLIB)
+  bft_printf("Zlib not available: sections are written uncompressed.\n\n");
+#endif
+
+  /* Write with each access method and tolerance, then read back with
+     each access method, both indexed and sequentially, with the
+     writer's block split, a different split, and partial blocks */
+
+  for (int t_id = 0; t_id < 2; t_id++) {
+
+    for (int w_id = 0; w_id < n_access; w_id++) {
+
+      sprintf(file_name, "cs_io_test_%d_%d.csc", t_id, w_id);
+
+      _write_test_file(file_name, access[w_id], 1, tolerance[t_id],
+                       rank, size);
+
+      for (int r_id = 0; r_id < n_access; r_id++) {
+        for (int mode = 0; mode < 6; mode++) {
+
+          bool indexed = (mode % 2) ? true : false;
+          bool even = (mode < 2) ? true : false;
+          bool partial = (mode >= 4) ? true : false;
+
+          cs_gnum_t n_m_diffs = _read_test_file(file_name,
+                                                access[r_id],
+                                                indexed,
+                                                even,
+                                                partial,
+                                                tolerance[t_id],
+                                                rank,
+                                                size);
+
+          bft_printf("tolerance %g, write %s, read %s, %s, %s%s: %s\n",
+                     tolerance[t_id],
+                     cs_file_access_name[access[w_id]],
+                     cs_file_access_name[access[r_id]],
+                     (indexed) ? "indexed" : "sequential",
+                     (even) ? "same split" : "different split",
+                     (partial) ? " (partial)" : "",
+                     (n_m_diffs == 0) ? "ok" : "FAILED");
+
+          n_diffs += n_m_diffs;
+        }
+      }
+
+    }
+
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_mpi_comm != MPI_COMM_NULL) {
+    cs_gnum_t n_l_diffs = n_diffs;
+    MPI_Allreduce(&n_l_diffs, &n_diffs, 1, CS_MPI_GNUM, MPI_SUM,
+                  cs_glob_mpi_comm);
+  }
+#endif
+
+  bft_mem_end();
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag != 0)
+      MPI_Finalize();
+  }
+#endif
+
+  exit ((n_diffs == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
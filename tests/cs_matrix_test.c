@@ -0,0 +1,388 @@
+/*============================================================================
+ * Unit test for cs_matrix.c (matrix-free operator products);
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2016 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <bft_error.h>
+#include <bft_mem.h>
+#include <bft_printf.h>
+
+#include "cs_base.h"
+#include "cs_matrix.h"
+
+/*---------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Print message on standard output
+ *----------------------------------------------------------------------------*/
+
+static int _bft_printf_proxy
+(
+ const char     *const format,
+       va_list         arg_ptr
+)
+{
+  static FILE *f = NULL;
+
+  if (f == NULL) {
+    char filename[64];
+    int rank = 0;
+#if defined(HAVE_MPI)
+    if (cs_glob_mpi_comm != MPI_COMM_NULL)
+      MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+#endif
+    sprintf (filename, "cs_matrix_test_out.%d", rank);
+    f = fopen(filename, "w");
+    assert(f != NULL);
+  }
+
+  return vfprintf(f, format, arg_ptr);
+}
+
+/*----------------------------------------------------------------------------
+ * Stop the code in case of error
+ *----------------------------------------------------------------------------*/
+
+static void
+_bft_error_handler(const char  *filename,
+                   int          line_no,
+                   int          code_err_sys,
+                   const char  *format,
+                   va_list      arg_ptr)
+{
+  bft_printf_flush();
+
+  if (code_err_sys != 0)
+    fprintf(stderr, "\nSystem error: %s\n", strerror(code_err_sys));
+
+  vfprintf(stderr, format, arg_ptr);
+}
+
+/*----------------------------------------------------------------------------
+ * Build face connectivity of a structured nx*ny*nz grid, numbered so
+ * that faces are not sorted by adjacent cell.
+ *
+ * parameters:
+ *   nx      <-- number of cells in x direction
+ *   ny      <-- number of cells in y direction
+ *   nz      <-- number of cells in z direction
+ *   n_faces --> number of interior faces
+ *   faces   --> face -> cells connectivity, allocated here
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_faces(cs_lnum_t     nx,
+             cs_lnum_t     ny,
+             cs_lnum_t     nz,
+             cs_lnum_t    *n_faces,
+             cs_lnum_2_t **faces)
+{
+  cs_lnum_t _n_faces = (nx-1)*ny*nz + nx*(ny-1)*nz + nx*ny*(nz-1);
+  cs_lnum_2_t *_faces;
+
+  BFT_MALLOC(_faces, _n_faces, cs_lnum_2_t);
+
+  cs_lnum_t f_id = 0;
+
+  for (int dir = 0; dir < 3; dir++) {
+    for (cs_lnum_t k = 0; k < nz; k++) {
+      for (cs_lnum_t j = 0; j < ny; j++) {
+        for (cs_lnum_t i = 0; i < nx; i++) {
+          cs_lnum_t c_id = (k*ny + j)*nx + i;
+          if (dir == 0 && i < nx-1) {
+            _faces[f_id][0] = c_id;
+            _faces[f_id][1] = c_id + 1;
+            f_id++;
+          }
+          else if (dir == 1 && j < ny-1) {
+            _faces[f_id][0] = c_id;
+            _faces[f_id][1] = c_id + nx;
+            f_id++;
+          }
+          else if (dir == 2 && k < nz-1) {
+            _faces[f_id][0] = c_id;
+            _faces[f_id][1] = c_id + nx*ny;
+            f_id++;
+          }
+        }
+      }
+    }
+  }
+
+  assert(f_id == _n_faces);
+
+  *n_faces = _n_faces;
+  *faces = _faces;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute extradiagonal coefficients matching those of a matrix-free
+ * convection-diffusion operator (same expressions as cs_matrix_scalar).
+ *
+ * parameters:
+ *   symmetric  <-- true for diffusion only
+ *   n_faces    <-- number of interior faces
+ *   faces      <-- face -> cells connectivity
+ *   thetap     <-- theta-scheme coefficient
+ *   xcpp       <-- Cp values, or NULL
+ *   i_massflux <-- interior faces mass flux
+ *   i_visc     <-- interior faces viscosity
+ *   xa         --> extradiagonal coefficients (interlaced if non-symmetric)
+ *----------------------------------------------------------------------------*/
+
+static void
+_conv_diff_xa(bool               symmetric,
+              cs_lnum_t          n_faces,
+              const cs_lnum_2_t  faces[],
+              double             thetap,
+              const cs_real_t    xcpp[],
+              const cs_real_t    i_massflux[],
+              const cs_real_t    i_visc[],
+              cs_real_t          xa[])
+{
+  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+    if (symmetric)
+      xa[f_id] = - thetap*i_visc[f_id];
+    else {
+      cs_lnum_t ii = faces[f_id][0], jj = faces[f_id][1];
+      double m_ij = i_massflux[f_id];
+      double flui =  0.5*(m_ij - fabs(m_ij));
+      double fluj = -0.5*(m_ij + fabs(m_ij));
+      if (xcpp != NULL) {
+        flui *= xcpp[ii];
+        fluj *= xcpp[jj];
+      }
+      xa[2*f_id]     = thetap*(flui - i_visc[f_id]);
+      xa[2*f_id + 1] = thetap*(fluj - i_visc[f_id]);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compare products of a matrix-free operator with those of assembled
+ * native and MSR matrices.
+ *
+ * parameters:
+ *   symmetric  <-- true for diffusion only
+ *   db_size    <-- diagonal block size
+ *   n_cells    <-- number of cells
+ *   n_faces    <-- number of interior faces
+ *   faces      <-- face -> cells connectivity
+ *
+ * returns:
+ *   number of mismatches detected
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare_free(bool               symmetric,
+              int                db_size,
+              cs_lnum_t          n_cells,
+              cs_lnum_t          n_faces,
+              const cs_lnum_2_t  faces[])
+{
+  int n_errors = 0;
+
+  const double thetap = 0.75;
+  const int _db_size[4] = {db_size, db_size, db_size, db_size*db_size};
+  const cs_lnum_t n_vals = n_cells*db_size;
+
+  const cs_matrix_type_t ref_type[] = {CS_MATRIX_NATIVE, CS_MATRIX_MSR};
+
+  cs_real_t *da, *xa, *xcpp, *i_massflux, *i_visc, *x, *y, *y_ref;
+
+  BFT_MALLOC(da, n_cells*db_size*db_size, cs_real_t);
+  BFT_MALLOC(xa, 2*n_faces, cs_real_t);
+  BFT_MALLOC(xcpp, n_cells, cs_real_t);
+  BFT_MALLOC(i_massflux, n_faces, cs_real_t);
+  BFT_MALLOC(i_visc, n_faces, cs_real_t);
+  BFT_MALLOC(x, n_vals, cs_real_t);
+  BFT_MALLOC(y, n_vals, cs_real_t);
+  BFT_MALLOC(y_ref, n_vals, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_cells*db_size*db_size; i++)
+    da[i] = 6. + 0.1*(i%11);
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    xcpp[i] = 1. + 0.01*(i%5);
+  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+    i_massflux[f_id] = sin(0.3*f_id);
+    i_visc[f_id] = 1. + 0.5*cos(0.7*f_id);
+  }
+  for (cs_lnum_t i = 0; i < n_vals; i++)
+    x[i] = cos(0.11*i);
+
+  _conv_diff_xa(symmetric, n_faces, faces, thetap,
+                xcpp, i_massflux, i_visc, xa);
+
+  /* Matrix-free operator */
+
+  cs_matrix_structure_t *ms_free
+    = cs_matrix_structure_create(CS_MATRIX_FREE, true, n_cells, n_cells,
+                                 n_faces, NULL, faces, NULL, NULL);
+  cs_matrix_t *a_free = cs_matrix_create(ms_free);
+
+  cs_matrix_set_coefficients_conv_diff(a_free,
+                                       symmetric,
+                                       _db_size,
+                                       (symmetric) ? 0 : 1,
+                                       1,
+                                       thetap,
+                                       xcpp,
+                                       i_massflux,
+                                       i_visc,
+                                       da);
+
+  for (int t_id = 0; t_id < 2; t_id++) {
+
+    cs_matrix_structure_t *ms
+      = cs_matrix_structure_create(ref_type[t_id], true, n_cells, n_cells,
+                                   n_faces, NULL, faces, NULL, NULL);
+    cs_matrix_t *a = cs_matrix_create(ms);
+
+    cs_matrix_set_coefficients(a, symmetric, _db_size, NULL,
+                               n_faces, faces, da, xa);
+
+    /* Full and extradiagonal products */
+
+    for (int exclude_diag = 0; exclude_diag < 2; exclude_diag++) {
+
+      if (exclude_diag) {
+        cs_matrix_exdiag_vector_multiply(CS_HALO_ROTATION_COPY, a, x, y_ref);
+        cs_matrix_exdiag_vector_multiply(CS_HALO_ROTATION_COPY, a_free, x, y);
+      }
+      else {
+        cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, a, x, y_ref);
+        cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, a_free, x, y);
+      }
+
+      double d_max = 0.;
+      for (cs_lnum_t i = 0; i < n_vals; i++) {
+        double d = fabs(y[i] - y_ref[i]) / (1. + fabs(y_ref[i]));
+        if (d > d_max)
+          d_max = d;
+      }
+
+      bft_printf("%-9s db_size %d, %-6s %-8s: max. difference %12.5e\n",
+                 (symmetric) ? "symmetric" : "general", db_size,
+                 cs_matrix_type_name[ref_type[t_id]],
+                 (exclude_diag) ? "(A-D).x" : "A.x", d_max);
+
+      if (d_max > 1.e-12) {
+        bft_printf("  mismatch between matrix-free and assembled product\n");
+        n_errors++;
+      }
+
+    }
+
+    cs_matrix_destroy(&a);
+    cs_matrix_structure_destroy(&ms);
+
+  }
+
+  cs_matrix_destroy(&a_free);
+  cs_matrix_structure_destroy(&ms_free);
+
+  BFT_FREE(y_ref);
+  BFT_FREE(y);
+  BFT_FREE(x);
+  BFT_FREE(i_visc);
+  BFT_FREE(i_massflux);
+  BFT_FREE(xcpp);
+  BFT_FREE(xa);
+  BFT_FREE(da);
+
+  return n_errors;
+}
+
+/*---------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  char mem_trace_name[32];
+  int size = 1;
+  int rank = 0;
+  int n_errors = 0;
+
+#if defined(HAVE_MPI)
+
+  /* Initialization */
+
+  cs_base_mpi_init(&argc, &argv);
+
+  if (cs_glob_mpi_comm != MPI_COMM_NULL) {
+    MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+    MPI_Comm_size(cs_glob_mpi_comm, &size);
+  }
+
+#endif /* (HAVE_MPI) */
+
+  bft_error_handler_set(_bft_error_handler);
+
+  if (size > 1)
+    sprintf(mem_trace_name, "cs_matrix_test_mem.%d", rank);
+  else
+    strcpy(mem_trace_name, "cs_matrix_test_mem");
+  bft_mem_init(mem_trace_name);
+  bft_printf_proxy_set(_bft_printf_proxy);
+
+  /* Local structured grid (products are purely local) */
+
+  const cs_lnum_t nx = 12, ny = 9, nz = 7;
+
+  cs_lnum_t n_faces;
+  cs_lnum_2_t *faces;
+
+  _build_faces(nx, ny, nz, &n_faces, &faces);
+
+  for (int sym = 0; sym < 2; sym++) {
+    n_errors += _compare_free(sym, 1, nx*ny*nz, n_faces,
+                              (const cs_lnum_2_t *)faces);
+    n_errors += _compare_free(sym, 3, nx*ny*nz, n_faces,
+                              (const cs_lnum_2_t *)faces);
+  }
+
+  BFT_FREE(faces);
+
+  bft_mem_end();
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag != 0)
+      MPI_Finalize();
+  }
+#endif
+
+  exit ((n_errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
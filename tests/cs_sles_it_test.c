@@ -0,0 +1,332 @@
+/*============================================================================
+ * Unit test for cs_sles_it.c (pipelined versus standard conjugate gradient);
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2016 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <bft_error.h>
+#include <bft_mem.h>
+#include <bft_printf.h>
+
+#include "cs_base.h"
+#include "cs_matrix.h"
+#include "cs_sles.h"
+#include "cs_sles_it.h"
+
+/*---------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Print message on standard output
+ *----------------------------------------------------------------------------*/
+
+static int _bft_printf_proxy
+(
+ const char     *const format,
+       va_list         arg_ptr
+)
+{
+  static FILE *f = NULL;
+
+  if (f == NULL) {
+    char filename[64];
+    int rank = 0;
+#if defined(HAVE_MPI)
+    if (cs_glob_mpi_comm != MPI_COMM_NULL)
+      MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+#endif
+    sprintf (filename, "cs_sles_it_test_out.%d", rank);
+    f = fopen(filename, "w");
+    assert(f != NULL);
+  }
+
+  return vfprintf(f, format, arg_ptr);
+}
+
+/*----------------------------------------------------------------------------
+ * Stop the code in case of error
+ *----------------------------------------------------------------------------*/
+
+static void
+_bft_error_handler(const char  *filename,
+                   int          line_no,
+                   int          code_err_sys,
+                   const char  *format,
+                   va_list      arg_ptr)
+{
+  bft_printf_flush();
+
+  if (code_err_sys != 0)
+    fprintf(stderr, "\nSystem error: %s\n", strerror(code_err_sys));
+
+  vfprintf(stderr, format, arg_ptr);
+}
+
+/*----------------------------------------------------------------------------
+ * Build the edges and coefficients of a 2D diffusion-type system on
+ * a structured nx*ny grid, with variable coefficients so that diagonal
+ * and polynomial preconditioning differ from the identity.
+ *
+ * parameters:
+ *   nx      <-- number of cells in x direction
+ *   ny      <-- number of cells in y direction
+ *   n_edges --> number of edges
+ *   edges   --> edges (cell pairs), allocated here
+ *   da      --> diagonal coefficients, allocated here
+ *   xa      --> extradiagonal coefficients, allocated here
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_system(cs_lnum_t     nx,
+              cs_lnum_t     ny,
+              cs_lnum_t    *n_edges,
+              cs_lnum_2_t **edges,
+              cs_real_t   **da,
+              cs_real_t   **xa)
+{
+  cs_lnum_t n_cells = nx*ny;
+  cs_lnum_t _n_edges = (nx-1)*ny + nx*(ny-1);
+
+  cs_lnum_2_t *_edges;
+  cs_real_t *_da, *_xa;
+
+  BFT_MALLOC(_edges, _n_edges, cs_lnum_2_t);
+  BFT_MALLOC(_da, n_cells, cs_real_t);
+  BFT_MALLOC(_xa, _n_edges, cs_real_t);
+
+  /* Small shift so that the system is strictly positive definite */
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    _da[i] = 1.e-3 * (1 + i%7);
+
+  cs_lnum_t e_id = 0;
+
+  for (cs_lnum_t j = 0; j < ny; j++) {
+    for (cs_lnum_t i = 0; i < nx; i++) {
+      cs_lnum_t c_id = j*nx + i;
+      if (i < nx-1) {
+        _edges[e_id][0] = c_id;
+        _edges[e_id][1] = c_id + 1;
+        e_id++;
+      }
+      if (j < ny-1) {
+        _edges[e_id][0] = c_id;
+        _edges[e_id][1] = c_id + nx;
+        e_id++;
+      }
+    }
+  }
+
+  for (e_id = 0; e_id < _n_edges; e_id++) {
+    cs_lnum_t c_id_0 = _edges[e_id][0], c_id_1 = _edges[e_id][1];
+    cs_real_t k = 1. + 0.5*sin(0.1*c_id_0) + 0.25*((c_id_1/nx)%3);
+    _xa[e_id] = -k;
+    _da[c_id_0] += k;
+    _da[c_id_1] += k;
+  }
+
+  *n_edges = _n_edges;
+  *edges = _edges;
+  *da = _da;
+  *xa = _xa;
+}
+
+/*----------------------------------------------------------------------------
+ * Solve a system with a given iterative solver.
+ *
+ * parameters:
+ *   type        <-- solver type
+ *   poly_degree <-- preconditioning polynomial degree (-1 for none)
+ *   a           <-- matrix
+ *   rhs         <-- right hand side
+ *   vx          --> solution (initialized to 0 here)
+ *   n_iter      --> number of iterations
+ *   residue     --> final residue
+ *
+ * returns:
+ *   convergence status
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_solve(cs_sles_it_type_t   type,
+       int                 poly_degree,
+       const cs_matrix_t  *a,
+       const cs_real_t    *rhs,
+       cs_real_t          *vx,
+       int                *n_iter,
+       double             *residue)
+{
+  cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    vx[i] = 0.;
+
+  void *c = cs_sles_it_create(type, poly_degree, 10000, false);
+
+  cs_sles_it_setup(c, "test", a, 0);
+
+  cs_sles_convergence_state_t cvg
+    = cs_sles_it_solve(c, "test", a, 0, CS_HALO_ROTATION_COPY,
+                       1.e-10, 1., n_iter, residue, rhs, vx, 0, NULL);
+
+  cs_sles_it_free(c);
+  cs_sles_it_destroy(&c);
+
+  return cvg;
+}
+
+/*---------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  char mem_trace_name[32];
+  int size = 1;
+  int rank = 0;
+  int retval = EXIT_SUCCESS;
+
+#if defined(HAVE_MPI)
+
+  /* Initialization */
+
+  cs_base_mpi_init(&argc, &argv);
+
+  if (cs_glob_mpi_comm != MPI_COMM_NULL) {
+    MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+    MPI_Comm_size(cs_glob_mpi_comm, &size);
+  }
+
+#endif /* (HAVE_MPI) */
+
+  bft_error_handler_set(_bft_error_handler);
+
+  if (size > 1)
+    sprintf(mem_trace_name, "cs_sles_it_test_mem.%d", rank);
+  else
+    strcpy(mem_trace_name, "cs_sles_it_test_mem");
+  bft_mem_init(mem_trace_name);
+  bft_printf_proxy_set(_bft_printf_proxy);
+
+  /* Build a local system; in parallel, each rank holds an identical
+     uncoupled block, so the global system is block-diagonal */
+
+  const cs_lnum_t nx = 40, ny = 30;
+  const cs_lnum_t n_cells = nx*ny;
+
+  cs_lnum_t n_edges;
+  cs_lnum_2_t *edges;
+  cs_real_t *da, *xa, *rhs, *x_ref, *x_pip;
+
+  _build_system(nx, ny, &n_edges, &edges, &da, &xa);
+
+  BFT_MALLOC(rhs, n_cells, cs_real_t);
+  BFT_MALLOC(x_ref, n_cells, cs_real_t);
+  BFT_MALLOC(x_pip, n_cells, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    rhs[i] = cos(0.05*i);
+
+  cs_matrix_structure_t *ms
+    = cs_matrix_structure_create(CS_MATRIX_MSR, true, n_cells, n_cells,
+                                 n_edges, NULL, (const cs_lnum_2_t *)edges,
+                                 NULL, NULL);
+  cs_matrix_t *a = cs_matrix_create(ms);
+
+  cs_matrix_set_coefficients(a, true, NULL, NULL,
+                             n_edges, (const cs_lnum_2_t *)edges, da, xa);
+
+  /* Compare standard and pipelined conjugate gradient with no
+     preconditioning, Jacobi and polynomial preconditioning */
+
+  for (int poly_degree = -1; poly_degree < 2; poly_degree++) {
+
+    int n_iter_ref = 0, n_iter_pip = 0;
+    double res_ref = 0, res_pip = 0;
+
+    cs_sles_convergence_state_t cvg_ref
+      = _solve(CS_SLES_PCG, poly_degree, a, rhs, x_ref,
+               &n_iter_ref, &res_ref);
+    cs_sles_convergence_state_t cvg_pip
+      = _solve(CS_SLES_PCG_PIPELINED, poly_degree, a, rhs, x_pip,
+               &n_iter_pip, &res_pip);
+
+    double d_max = 0., x_max = 0.;
+    for (cs_lnum_t i = 0; i < n_cells; i++) {
+      double d = fabs(x_ref[i] - x_pip[i]);
+      if (d > d_max)
+        d_max = d;
+      if (fabs(x_ref[i]) > x_max)
+        x_max = fabs(x_ref[i]);
+    }
+
+    bft_printf("poly_degree %d:\n"
+               "  PCG:           %d iterations, residue %12.5e\n"
+               "  pipelined PCG: %d iterations, residue %12.5e\n"
+               "  max. solution difference: %12.5e (max. value %12.5e)\n",
+               poly_degree, n_iter_ref, res_ref, n_iter_pip, res_pip,
+               d_max, x_max);
+
+    /* Both variants are mathematically equivalent; allow for rounding
+       differences in the convergence test and final iterate */
+
+    if (   cvg_ref != CS_SLES_CONVERGED || cvg_pip != CS_SLES_CONVERGED
+        || abs(n_iter_ref - n_iter_pip) > 1
+        || fabs(res_ref - res_pip) > 0.1*res_ref
+        || d_max > 1.e-6*x_max) {
+      bft_printf("  mismatch between PCG and pipelined PCG\n");
+      retval = EXIT_FAILURE;
+    }
+
+  }
+
+  cs_matrix_destroy(&a);
+  cs_matrix_structure_destroy(&ms);
+
+  BFT_FREE(x_pip);
+  BFT_FREE(x_ref);
+  BFT_FREE(rhs);
+  BFT_FREE(xa);
+  BFT_FREE(da);
+  BFT_FREE(edges);
+
+  bft_mem_end();
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag != 0)
+      MPI_Finalize();
+  }
+#endif
+
+  exit (retval);
+}